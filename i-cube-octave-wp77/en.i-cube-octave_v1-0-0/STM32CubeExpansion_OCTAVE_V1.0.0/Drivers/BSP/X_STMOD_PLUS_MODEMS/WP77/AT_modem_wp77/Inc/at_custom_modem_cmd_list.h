@@ -0,0 +1,157 @@
+/**
+  ******************************************************************************
+  * @file    at_custom_modem_cmd_list.h
+  * @author  Sierra Wireless Inc. and Affiliates
+  * @brief   WP77 AT commands definition (X-macro lists)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 Sierra Wireless Inc. and Affiliates
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by Sierra Wireless Inc. under the BSD 3-Clause license, the "License";
+  *  You may not use this file except in compliance with the License. You may obtain a copy of the License at:
+  *  opensource.org/licenses/BSD-3-Clause
+  *
+  * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+  * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+  * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+  * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+  * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+  * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef AT_CUSTOM_MODEM_CMD_LIST_WP77_H
+#define AT_CUSTOM_MODEM_CMD_LIST_WP77_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "plf_config.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+/* External variables --------------------------------------------------------*/
+
+/* Exported macros -----------------------------------------------------------*/
+/* WP77 AT commands definition
+ * Each command is defined once here, with:
+ *   X(cmd enum, cmd string, cmd timeout (in ms), build cmd ftion, analyze cmd ftion)
+ * These lists are expanded by:
+ *   - at_custom_modem_specific.h: enum of modem specific command ids (in list order)
+ *   - at_custom_modem_specific.c: commands LUT and direct access table (cmd id -> LUT row), const data only
+ *   - WP77_ATCMD_NB below: number of commands in the LUT (constant expression, sizes static tables)
+ * To add a command, add a line in the appropriate list below: no other table has to be updated.
+ * Timeouts and functions are only referenced when the LUT is expanded (at_custom_modem_specific.c).
+ */
+
+/* commands whose id is defined by AT Core (see at_modem_signalling.h) */
+#define WP77_ATCMD_GENERIC_LIST(X) \
+  X(CMD_AT,                      "",               WP77_AT_TIMEOUT,            fCmdBuild_NoParams,     fRspAnalyze_None) \
+  X(CMD_AT_OK,                   "OK",             WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_None) \
+  X(CMD_AT_CONNECT,              "CONNECT",        WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_None) \
+  X(CMD_AT_RING,                 "RING",           WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_None) \
+  X(CMD_AT_NO_CARRIER,           "NO CARRIER",     WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_None) \
+  X(CMD_AT_ERROR,                "ERROR",          WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_Error_WP77) \
+  X(CMD_AT_NO_DIALTONE,          "NO DIALTONE",    WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_None) \
+  X(CMD_AT_BUSY,                 "BUSY",           WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_None) \
+  X(CMD_AT_NO_ANSWER,            "NO ANSWER",      WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_None) \
+  X(CMD_AT_CME_ERROR,            "+CME ERROR",     WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_Error_WP77) \
+  X(CMD_AT_CMS_ERROR,            "+CMS ERROR",     WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_CmsErr) \
+  /* GENERIC MODEM commands */ \
+  X(CMD_AT_CGMI,                 "+CGMI",          WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_CGMI) \
+  X(CMD_AT_CGMM,                 "+CGMM",          WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_CGMM) \
+  X(CMD_AT_CGMR,                 "+CGMR",          WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_CGMR) \
+  X(CMD_AT_CGSN,                 "+CGSN",          WP77_DEFAULT_TIMEOUT,       fCmdBuild_CGSN_WP77,    fRspAnalyze_CGSN) \
+  X(CMD_AT_GSN,                  "+GSN",           WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_GSN) \
+  X(CMD_AT_CIMI,                 "+CIMI",          WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_CIMI) \
+  X(CMD_AT_CEER,                 "+CEER",          WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_CEER) \
+  X(CMD_AT_CMEE,                 "+CMEE",          WP77_DEFAULT_TIMEOUT,       fCmdBuild_CMEE,         fRspAnalyze_None) \
+  X(CMD_AT_CPIN,                 "+CPIN",          WP77_DEFAULT_TIMEOUT,       fCmdBuild_CPIN,         fRspAnalyze_CPIN) \
+  X(CMD_AT_CFUN,                 "+CFUN",          WP77_DEFAULT_TIMEOUT,       fCmdBuild_CFUN,         fRspAnalyze_CFUN_WP77) \
+  X(CMD_AT_COPS,                 "+COPS",          WP77_COPS_TIMEOUT,          fCmdBuild_COPS,         fRspAnalyze_COPS) \
+  X(CMD_AT_CNUM,                 "+CNUM",          WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_CNUM) \
+  X(CMD_AT_CGATT,                "+CGATT",         WP77_CGATT_TIMEOUT,         fCmdBuild_CGATT,        fRspAnalyze_CGATT) \
+  X(CMD_AT_CGPADDR,              "+CGPADDR",       WP77_DEFAULT_TIMEOUT,       fCmdBuild_CGPADDR,      fRspAnalyze_CGPADDR) \
+  X(CMD_AT_CEREG,                "+CEREG",         WP77_DEFAULT_TIMEOUT,       fCmdBuild_CEREG,        fRspAnalyze_CEREG) \
+  X(CMD_AT_CREG,                 "+CREG",          WP77_DEFAULT_TIMEOUT,       fCmdBuild_CREG,         fRspAnalyze_CREG) \
+  X(CMD_AT_CGREG,                "+CGREG",         WP77_DEFAULT_TIMEOUT,       fCmdBuild_CGREG,        fRspAnalyze_CGREG) \
+  X(CMD_AT_CSQ,                  "+CSQ",           WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_CSQ) \
+  X(CMD_AT_CGDCONT,              "+CGDCONT",       WP77_DEFAULT_TIMEOUT,       fCmdBuild_CGDCONT_WP77, fRspAnalyze_None) \
+  X(CMD_AT_CGACT,                "+CGACT",         WP77_CGACT_TIMEOUT,         fCmdBuild_CGACT,        fRspAnalyze_None) \
+  X(CMD_AT_CGDATA,               "+CGDATA",        WP77_DEFAULT_TIMEOUT,       fCmdBuild_CGDATA,       fRspAnalyze_None) \
+  X(CMD_AT_CGEREP,               "+CGEREP",        WP77_DEFAULT_TIMEOUT,       fCmdBuild_CGEREP,       fRspAnalyze_None) \
+  X(CMD_AT_CGEV,                 "+CGEV",          WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_CGEV) \
+  X(CMD_ATD,                     "D",              WP77_DEFAULT_TIMEOUT,       fCmdBuild_ATD_WP77,     fRspAnalyze_None) \
+  X(CMD_ATE,                     "E",              WP77_DEFAULT_TIMEOUT,       fCmdBuild_ATE,          fRspAnalyze_None) \
+  X(CMD_ATH,                     "H",              WP77_ATH_TIMEOUT,           fCmdBuild_NoParams,     fRspAnalyze_None) \
+  X(CMD_ATO,                     "O",              WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_None) \
+  X(CMD_ATV,                     "V",              WP77_DEFAULT_TIMEOUT,       fCmdBuild_ATV,          fRspAnalyze_None) \
+  X(CMD_ATX,                     "X",              WP77_DEFAULT_TIMEOUT,       fCmdBuild_ATX,          fRspAnalyze_None) \
+  X(CMD_AT_ESC_CMD,              "+++",            WP77_ESCAPE_TIMEOUT,        fCmdBuild_ESCAPE_CMD,   fRspAnalyze_None) \
+  X(CMD_AT_IPR,                  "+IPR",           WP77_DEFAULT_TIMEOUT,       fCmdBuild_IPR,          fRspAnalyze_IPR) \
+  X(CMD_AT_IFC,                  "+IFC",           WP77_DEFAULT_TIMEOUT,       fCmdBuild_IFC,          fRspAnalyze_None) \
+  X(CMD_AT_AND_W,                "&W",             WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_None) \
+  X(CMD_AT_AND_D,                "&D",             WP77_DEFAULT_TIMEOUT,       fCmdBuild_AT_AND_D,     fRspAnalyze_None) \
+  X(CMD_AT_DIRECT_CMD,           "",               WP77_DEFAULT_TIMEOUT,       fCmdBuild_DIRECT_CMD,   fRspAnalyze_DIRECT_CMD) \
+  X(CMD_AT_CSIM,                 "+CSIM",          WP77_DEFAULT_TIMEOUT,       fCmdBuild_CSIM,         fRspAnalyze_CSIM) \
+  X(CMD_AT_CPSMS,                "+CPSMS",         WP77_CPSMS_TIMEOUT,         fCmdBuild_CPSMS,        fRspAnalyze_CPSMS) \
+  X(CMD_AT_CEDRXS,               "+CEDRXS",        WP77_CEDRX_TIMEOUT,         fCmdBuild_CEDRXS,       fRspAnalyze_CEDRXS) \
+  X(CMD_AT_CEDRXP,               "+CEDRXP",        WP77_CEDRX_TIMEOUT,         fCmdBuild_NoParams,     fRspAnalyze_CEDRXP) \
+  X(CMD_AT_CEDRXRDP,             "+CEDRXRDP",      WP77_CEDRX_TIMEOUT,         fCmdBuild_NoParams,     fRspAnalyze_CEDRXRDP)
+
+/* commands whose id is specific to WP77: ids are generated after CMD_AT_LAST_GENERIC */
+#define WP77_ATCMD_SPECIFIC_LIST(X) \
+  /* MODEM SPECIFIC COMMANDS */ \
+  X(CMD_AT_SELRAT,               "!SELRAT",        WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_SELRAT_WP77) /* RAT selection / Query */ \
+  X(CMD_AT_BAND,                 "!BAND",          WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_BAND_WP77) /* Band selection / Query */ \
+  X(CMD_AT_SELACQ,               "!SELACQ",        WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_SELACQ_WP77) /* Check RAT scan sequence */ \
+  X(CMD_AT_WDSI,                 "+WDSI",          WP77_DEFAULT_TIMEOUT,       fCmdBuild_WDSI_WP77,    fRspAnalyze_WDSI_WP77) /* Check Air Vantage Connection settings */ \
+  X(CMD_AT_KSREP,                "+KSREP",         WP77_DEFAULT_TIMEOUT,       fCmdBuild_KSREP_WP77,   fRspAnalyze_None) /* Modem Enable Boot Status */ \
+  X(CMD_AT_KSUP,                 "+KSUP",          WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_None) /* Modem Boot Status */ \
+  /* WP77 specific TCP/IP commands */ \
+  X(CMD_AT_SOCKET_PROMPT,        "> ",             WP77_SOCKET_PROMPT_TIMEOUT, fCmdBuild_NoParams,     fRspAnalyze_None) /* when sending socket data : prompt = "> " */ \
+  X(CMD_AT_SEND_OK,              "SEND OK",        WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_None) /* socket send data OK */ \
+  X(CMD_AT_SEND_FAIL,            "SEND FAIL",      WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_None) /* socket send data problem */ \
+  X(CMD_AT_CCID,                 "+CCID",          WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_CCID_WP77) /* show ICCID */ \
+  X(CMD_AT_KCELL,                "+KCELL",         WP77_DEFAULT_TIMEOUT,       fCmdBuild_KCELL_WP77,   fRspAnalyze_KCELL_WP77) /* query and report signal strength */ \
+  X(CMD_AT_GSTATUS,              "!GSTATUS",       WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_GSTATUS_WP77) /* check modem and RF status */ \
+  /* MODEM SPECIFIC EVENTS (URC, BOOT, ...) */ \
+  X(CMD_AT_WAIT_EVENT,           "",               WP77_DEFAULT_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_None) \
+  X(CMD_AT_BOOT_EVENT,           "",               WP77_RDY_TIMEOUT,           fCmdBuild_NoParams,     fRspAnalyze_None) \
+  X(CMD_AT_SIMREADY_EVENT,       "",               WP77_SIMREADY_TIMEOUT,      fCmdBuild_NoParams,     fRspAnalyze_None) \
+  X(CMD_AT_RDY_EVENT,            "RDY",            WP77_RDY_TIMEOUT,           fCmdBuild_NoParams,     fRspAnalyze_None) \
+  X(CMD_AT_APP_RDY_EVENT,        "APP RDY",        WP77_APP_RDY_TIMEOUT,       fCmdBuild_NoParams,     fRspAnalyze_None) \
+  X(CMD_AT_POWERED_DOWN_EVENT,   "POWERED DOWN",   WP77_RDY_TIMEOUT,           fCmdBuild_NoParams,     fRspAnalyze_None) \
+  X(CMD_AT_PSM_POWER_DOWN_EVENT, "PSM POWER DOWN", WP77_RDY_TIMEOUT,           fCmdBuild_NoParams,     fRspAnalyze_None) \
+  WP77_ATCMD_COM_MDM_LIST(X)
+
+/* number of commands in the LUT */
+#define WP77_ATCMD_COUNT(cmd_id, cmd_str, cmd_timeout, cmd_BuildFunc, rsp_AnalyzeFunc) + 1U
+#define WP77_ATCMD_NB \
+  (0U WP77_ATCMD_GENERIC_LIST(WP77_ATCMD_COUNT) WP77_ATCMD_SPECIFIC_LIST(WP77_ATCMD_COUNT))
+
+#if defined(USE_COM_MDM)
+#define WP77_ATCMD_COM_MDM_LIST(X) \
+  X(CMD_AT_ORP,                  "+ORP",           WP77_DEFAULT_TIMEOUT,       fCmdBuild_ORP,          fRspAnalyze_ORP)
+#else
+#define WP77_ATCMD_COM_MDM_LIST(X)
+#endif /* defined(USE_COM_MDM) */
+
+/* Exported functions ------------------------------------------------------- */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT_CUSTOM_MODEM_CMD_LIST_WP77_H */
+
+/************************ (C) COPYRIGHT Sierra Wireless *****END OF FILE****/
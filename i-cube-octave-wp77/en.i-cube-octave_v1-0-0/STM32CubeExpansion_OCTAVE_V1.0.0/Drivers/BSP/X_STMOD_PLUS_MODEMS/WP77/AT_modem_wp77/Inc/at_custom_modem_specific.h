@@ -42,6 +42,7 @@ extern "C" {
 #include "cellular_service.h"
 #include "cellular_service_int.h"
 #include "ipc_common.h"
+#include "at_custom_modem_cmd_list.h"
 
 /* Exported constants --------------------------------------------------------*/
 /* device specific parameters */
@@ -51,36 +52,13 @@ extern "C" {
 
 /* Exported types ------------------------------------------------------------*/
 
+/* modem specific command ids: generated from WP77_ATCMD_SPECIFIC_LIST (see at_custom_modem_cmd_list.h) */
+#define WP77_ATCMD_ENUM(cmd_id, cmd_str, cmd_timeout, cmd_BuildFunc, rsp_AnalyzeFunc) cmd_id,
 enum
 {
-  /* modem specific commands */
-  CMD_AT_SELRAT = (CMD_AT_LAST_GENERIC + 1U), /*RAT selection / Query */
-  CMD_AT_BAND,                           /* Band selection / Query */
-  CMD_AT_SELACQ,                         /* Check RAT scan sequence */
-  CMD_AT_WDSI,                           /* Check Air Vantage Connection settings */
-  CMD_AT_KSREP,							 /* Modem Enable Boot Status */
-  CMD_AT_KSUP,							 /* Modem Boot Status */
-  /* WP77 specific TCP/IP commands */
-
-  CMD_AT_SOCKET_PROMPT,                  /* when sending socket data : prompt = "> " */
-  CMD_AT_SEND_OK,                        /* socket send data OK */
-  CMD_AT_SEND_FAIL,                      /* socket send data problem */
-  CMD_AT_CCID,                           /* show ICCID */
-  CMD_AT_KCELL,                          /* query and report signal strength */
-  CMD_AT_GSTATUS,                        /* check modem and RF status */
-
-  /* modem specific events (URC, BOOT, ...) */
-  CMD_AT_WAIT_EVENT,
-  CMD_AT_BOOT_EVENT,
-  CMD_AT_SIMREADY_EVENT,
-  CMD_AT_RDY_EVENT,
-  CMD_AT_APP_RDY_EVENT,
-  CMD_AT_POWERED_DOWN_EVENT,
-  CMD_AT_PSM_POWER_DOWN_EVENT,
- #if defined(USE_COM_MDM)
-  CMD_AT_ORP,
- #endif /* defined(USE_COM_MDM) */
-
+  CMD_AT_WP77_BASE = CMD_AT_LAST_GENERIC, /* first modem specific command id is CMD_AT_LAST_GENERIC + 1 */
+  WP77_ATCMD_SPECIFIC_LIST(WP77_ATCMD_ENUM)
+  CMD_AT_WP77_LAST, /* keep it at last position */
 };
 
 /* device specific parameters */
@@ -35,6 +35,7 @@ extern "C" {
 #endif
 
 /* Includes ------------------------------------------------------------------*/
+#include "at_custom_modem_cmd_list.h"
 
 /* Exported constants --------------------------------------------------------*/
 /* You can specify in project configuration the modem and hardware interface used.
@@ -63,6 +64,7 @@ extern "C" {
 #define CONFIG_MODEM_MAX_SOCKET_RX_DATA_SIZE ((uint32_t)1500U)
 #define CONFIG_MODEM_MAX_SIM_GENERIC_ACCESS_CMD_SIZE ((uint32_t)1460U)
 #define CONFIG_MODEM_MIN_SIM_GENERIC_ACCESS_RSP_SIZE ((uint32_t)4U)
+#define CONFIG_MODEM_ATCMD_NB                ((uint32_t)WP77_ATCMD_NB) /* number of commands in modem LUT */
 
 /* Ping URC received before or after Reply */
 #define PING_URC_RECEIVED_AFTER_REPLY        (1U)
@@ -330,8 +330,7 @@ at_action_rsp_t fRspAnalyze_Error_WP77(at_context_t *p_at_ctxt, atcustom_modem_c
         {
           csint_ComMdm_t *p_mdm_com = &(p_modem_ctxt->SID_ctxt.com_mdm_data);
           /* retrieve CME ERROR code */
-          uint32_t CmeErrorCode = ATutil_convertStringToInt(&p_msg_in->buffer[element_infos->str_start_idx],
-                                                            element_infos->str_size);
+          uint32_t CmeErrorCode = atcm_get_param_int(p_msg_in, element_infos);
           p_mdm_com->errorCode = (int32_t) CmeErrorCode;
           /*
           PRINT_INFO("CMD_AT_ORP param 2: (size=%d) value=%d", element_infos->str_size, CmeErrorCode)
@@ -423,8 +422,7 @@ at_action_rsp_t fRspAnalyze_SELRAT_WP77(at_context_t *p_at_ctxt, atcustom_modem_
 	START_PARAM_LOOP()
 	if (element_infos->param_rank == 2U)
 	{
-	  uint8_t rat = ATutil_convertStringToInt(&p_msg_in->buffer[element_infos->str_start_idx],
-							element_infos->str_size);
+	  uint8_t rat = atcm_get_param_int(p_msg_in, element_infos);
 	  WP77_shared.mode_and_bands_config.nw_scanmode = rat;
 	  if(rat == 0)
 	  {
@@ -562,13 +560,13 @@ at_action_rsp_t fRspAnalyze_WDSI_WP77(at_context_t *p_at_ctxt, atcustom_modem_co
   START_PARAM_LOOP()
   if (element_infos->param_rank == 2U)
   {
-	  wdsi_urc= ATutil_convertStringToInt(&p_msg_in->buffer[element_infos->str_start_idx],element_infos->str_size);
+	  wdsi_urc= atcm_get_param_int(p_msg_in, element_infos);
   }
   else if (element_infos->param_rank == 3U)
   {
 	  if(wdsi_urc == 23)
 	  {
-		  avms_connection_status = ATutil_convertStringToInt(&p_msg_in->buffer[element_infos->str_start_idx],element_infos->str_size);
+		  avms_connection_status = atcm_get_param_int(p_msg_in, element_infos);
 		  WP77_shared.avms_connection_status = avms_connection_status;
 		  PRINT_INFO(" Air Vantage connection Status changed to %d",avms_connection_status)
 	  }
@@ -651,6 +649,7 @@ static orp_msg_t orp_msg_urc = { .free = 1U };
 
 static int8_t orp_storage_add_msg(const uint8_t *pbuf, uint32_t size);
 static bool orpMsgIsAnURC(const uint8_t *pbuf, uint32_t size);
+static uint16_t orpMsgGetPayloadOffset(const uint8_t *pbuf, uint16_t size, uint8_t separator);
 
 static int8_t orp_storage_add_msg(const uint8_t *pbuf, uint32_t size)
 {
@@ -786,18 +785,10 @@ at_action_rsp_t fRspAnalyze_ORP(at_context_t *p_at_ctxt, atcustom_modem_context_
       if (orpMsgIsAnURC(&p_msg_in->buffer[element_infos->str_start_idx],  element_infos->str_size))
       {
         PRINT_INFO("ORP urc received, crossing case")
-		csint_ComMdm_t *p_mdm_com = &(p_modem_ctxt->SID_ctxt.com_mdm_data);
-		char *strFound;
-        char rcvBuf[p_mdm_com->rxBuffer.max_buffer_size];
-
-        strncpy(rcvBuf,(const char*)&p_msg_in->buffer[element_infos->str_start_idx],element_infos->str_size);
-        strFound = strchr(rcvBuf,',');
-        if(strFound)
-        {
-        	int loc = strFound - rcvBuf + 1;
-        	element_infos->str_start_idx = element_infos->str_start_idx + loc;
-        	element_infos->str_size = element_infos->str_size - loc;
-        }
+        uint16_t loc = orpMsgGetPayloadOffset(&p_msg_in->buffer[element_infos->str_start_idx],
+                                              element_infos->str_size, (uint8_t)',');
+        element_infos->str_start_idx += loc;
+        element_infos->str_size -= loc;
         /* try to store received ORP URC */
         if (orp_storage_add_msg(&p_msg_in->buffer[element_infos->str_start_idx],  element_infos->str_size) == 0)
         {
@@ -814,25 +805,15 @@ at_action_rsp_t fRspAnalyze_ORP(at_context_t *p_at_ctxt, atcustom_modem_context_
         /* a response from modem is expected only in CS_COMMDM_TRANSACTION type */
         if (p_mdm_com->transaction_type == CS_COMMDM_TRANSACTION)
         {
-          char * strFound;
-          char rcvBuf[p_mdm_com->rxBuffer.max_buffer_size];
-          strncpy(rcvBuf,(const char*)&p_msg_in->buffer[element_infos->str_start_idx],element_infos->str_size);
           PRINT_BUF((const uint8_t *)&p_msg_in->buffer[element_infos->str_start_idx], element_infos->str_size)
-          strFound = strchr(rcvBuf,'D');
-          if(strFound)
-          {
-        	int loc = strFound - rcvBuf + 1;
-        	element_infos->str_start_idx = element_infos->str_start_idx + loc;
-        	bufSize = element_infos->str_size - loc;
-          }
-          else
-          {
-            bufSize = element_infos->str_size;
-          }
+          uint16_t loc = orpMsgGetPayloadOffset(&p_msg_in->buffer[element_infos->str_start_idx],
+                                                element_infos->str_size, (uint8_t)'D');
+          element_infos->str_start_idx += loc;
+          bufSize = (uint32_t)element_infos->str_size - (uint32_t)loc;
           /* check that received buffer size doesn't exceed rx buffer provided by user */
           if (bufSize <= p_mdm_com->rxBuffer.max_buffer_size)
           {
-             /* re copy ORP response to client buffer */
+             /* copy ORP response from received message directly to client buffer */
             (void) memcpy((void *) p_mdm_com->rxBuffer.p_buffer,
                         (const void *)&p_msg_in->buffer[element_infos->str_start_idx],
                         (size_t)bufSize);
@@ -861,18 +842,11 @@ at_action_rsp_t fRspAnalyze_ORP(at_context_t *p_at_ctxt, atcustom_modem_context_
       if (orpMsgIsAnURC(&p_msg_in->buffer[element_infos->str_start_idx],  element_infos->str_size))
       {
         PRINT_INFO("ORP urc confirmed")
-		const char *strFound;
-        csint_ComMdm_t *p_mdm_com = &(p_modem_ctxt->SID_ctxt.com_mdm_data);
-        char rcvBuf[p_mdm_com->rxBuffer.max_buffer_size];
-        strncpy(rcvBuf,(const char*)&p_msg_in->buffer[element_infos->str_start_idx],element_infos->str_size);
         PRINT_BUF((const uint8_t *)&p_msg_in->buffer[element_infos->str_start_idx], element_infos->str_size)
-        strFound = strchr(rcvBuf,',');
-        if(strFound)
-        {
-        	int loc = strFound - rcvBuf + 1;
-        	element_infos->str_start_idx = element_infos->str_start_idx + loc;
-        	element_infos->str_size = element_infos->str_size - loc;
-        }
+        uint16_t loc = orpMsgGetPayloadOffset(&p_msg_in->buffer[element_infos->str_start_idx],
+                                              element_infos->str_size, (uint8_t)',');
+        element_infos->str_start_idx += loc;
+        element_infos->str_size -= loc;
 
         /* try to store received ORP URC */
         if (orp_storage_add_msg(&p_msg_in->buffer[element_infos->str_start_idx],  element_infos->str_size) == 0)
@@ -919,6 +893,23 @@ static bool orpMsgIsAnURC(const uint8_t *pbuf, uint32_t size)
   return(isAnURC);
 }
 
+static uint16_t orpMsgGetPayloadOffset(const uint8_t *pbuf, uint16_t size, uint8_t separator)
+{
+  uint16_t offset = 0U;
+  const uint8_t *p_separator;
+
+  /* search separator directly in received message (no intermediate copy)
+   * payload starts after first separator, or at beginning of message if separator not found
+   */
+  p_separator = (const uint8_t *)memchr((const void *)pbuf, (int32_t)separator, (size_t)size);
+  if (p_separator != NULL)
+  {
+    offset = (uint16_t)(p_separator - pbuf) + 1U;
+  }
+
+  return(offset);
+}
+
 #endif /* defined(USE_COM_MDM) */
 /************************ (C) COPYRIGHT Sierra Wireless *****END OF FILE****/
 
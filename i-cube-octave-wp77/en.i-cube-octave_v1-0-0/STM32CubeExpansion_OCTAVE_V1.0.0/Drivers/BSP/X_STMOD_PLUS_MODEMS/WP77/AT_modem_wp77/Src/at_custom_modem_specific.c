@@ -158,6 +158,14 @@ WP77_shared_variables_t WP77_shared =
 };
 
 /* Private variables ---------------------------------------------------------*/
+/* LUT rows: generated from WP77 AT commands lists (see at_custom_modem_cmd_list.h) */
+#define WP77_LUT_ROW(cmd_id, cmd_str, cmd_timeout, cmd_BuildFunc, rsp_AnalyzeFunc) WP77_LUT_ROW_##cmd_id,
+enum
+{
+  WP77_ATCMD_GENERIC_LIST(WP77_LUT_ROW)
+  WP77_ATCMD_SPECIFIC_LIST(WP77_LUT_ROW)
+  WP77_LUT_ROW_NB, /* number of rows in LUT, must not exceed 255 (see ATCMD_WP77_LUT_index) */
+};
 
 /* Socket Data receive: to analyze size received in data header */
 static AT_CHAR_t SocketHeaderDataRx_Buf[4];
@@ -176,6 +184,8 @@ static void reset_variables_WP77(void);
 static void socketHeaderRX_reset(void);
 static void SocketHeaderRX_addChar(CRC_CHAR_t *rxchar);
 static uint16_t SocketHeaderRX_getSize(void);
+static void WP77_tokenize_line(const IPC_RxMessage_t *p_msg_in, uint16_t start_idx, at_bool_t split_fields,
+                               at_line_tokens_t *p_tokens);
 
 
 #if (ENABLE_WP77_LOW_POWER_MODE == 1U)
@@ -192,88 +202,23 @@ static bool is_waiting_modem_wakeup(void);
 /* Functions Definition ------------------------------------------------------*/
 void ATCustom_WP77_init(atparser_context_t *p_atp_ctxt)
 {
-  /* Commands Look-up table */
+  /* Commands Look-up table: generated from WP77 AT commands lists (see at_custom_modem_cmd_list.h) */
+#define WP77_ATCMD_LUT_ENTRY(cmd_id, cmd_str, cmd_timeout, cmd_BuildFunc, rsp_AnalyzeFunc) \
+  {(cmd_id), cmd_str, (cmd_timeout), (cmd_BuildFunc), (rsp_AnalyzeFunc)},
   static const atcustom_LUT_t ATCMD_WP77_LUT[] =
   {
     /* cmd enum - cmd string - cmd timeout (in ms) - build cmd ftion - analyze cmd ftion */
-    {CMD_AT,             "",             WP77_AT_TIMEOUT,       fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_AT_OK,          "OK",           WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_AT_CONNECT,     "CONNECT",      WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_AT_RING,        "RING",         WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_AT_NO_CARRIER,  "NO CARRIER",   WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_AT_ERROR,       "ERROR",        WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_Error_WP77},
-    {CMD_AT_NO_DIALTONE, "NO DIALTONE",  WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_AT_BUSY,        "BUSY",         WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_AT_NO_ANSWER,   "NO ANSWER",    WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_AT_CME_ERROR,   "+CME ERROR",   WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_Error_WP77},
-    {CMD_AT_CMS_ERROR,   "+CMS ERROR",   WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_CmsErr},
-
-    /* GENERIC MODEM commands */
-    {CMD_AT_CGMI,        "+CGMI",        WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_CGMI},
-    {CMD_AT_CGMM,        "+CGMM",        WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_CGMM},
-    {CMD_AT_CGMR,        "+CGMR",        WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_CGMR},
-    {CMD_AT_CGSN,        "+CGSN",        WP77_DEFAULT_TIMEOUT,  fCmdBuild_CGSN_WP77,  fRspAnalyze_CGSN},
-    {CMD_AT_GSN,         "+GSN",         WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_GSN},
-    {CMD_AT_CIMI,        "+CIMI",        WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_CIMI},
-    {CMD_AT_CEER,        "+CEER",        WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_CEER},
-    {CMD_AT_CMEE,        "+CMEE",        WP77_DEFAULT_TIMEOUT,  fCmdBuild_CMEE,       fRspAnalyze_None},
-    {CMD_AT_CPIN,        "+CPIN",        WP77_DEFAULT_TIMEOUT,  fCmdBuild_CPIN,       fRspAnalyze_CPIN},
-    {CMD_AT_CFUN,        "+CFUN",        WP77_DEFAULT_TIMEOUT,  fCmdBuild_CFUN,       fRspAnalyze_CFUN_WP77},
-    {CMD_AT_COPS,        "+COPS",        WP77_COPS_TIMEOUT,     fCmdBuild_COPS,  	  fRspAnalyze_COPS},
-    {CMD_AT_CNUM,        "+CNUM",        WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_CNUM},
-    {CMD_AT_CGATT,       "+CGATT",       WP77_CGATT_TIMEOUT,    fCmdBuild_CGATT,      fRspAnalyze_CGATT},
-    {CMD_AT_CGPADDR,     "+CGPADDR",     WP77_DEFAULT_TIMEOUT,  fCmdBuild_CGPADDR,    fRspAnalyze_CGPADDR},
-    {CMD_AT_CEREG,       "+CEREG",       WP77_DEFAULT_TIMEOUT,  fCmdBuild_CEREG,      fRspAnalyze_CEREG},
-    {CMD_AT_CREG,        "+CREG",        WP77_DEFAULT_TIMEOUT,  fCmdBuild_CREG,       fRspAnalyze_CREG},
-    {CMD_AT_CGREG,       "+CGREG",       WP77_DEFAULT_TIMEOUT,  fCmdBuild_CGREG,      fRspAnalyze_CGREG},
-    {CMD_AT_CSQ,         "+CSQ",         WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_CSQ},
-    {CMD_AT_CGDCONT,     "+CGDCONT",     WP77_DEFAULT_TIMEOUT,  fCmdBuild_CGDCONT_WP77,    fRspAnalyze_None},
-    {CMD_AT_CGACT,       "+CGACT",       WP77_CGACT_TIMEOUT,    fCmdBuild_CGACT,      fRspAnalyze_None},
-    {CMD_AT_CGDATA,      "+CGDATA",      WP77_DEFAULT_TIMEOUT,  fCmdBuild_CGDATA,     fRspAnalyze_None},
-    {CMD_AT_CGEREP,      "+CGEREP",      WP77_DEFAULT_TIMEOUT,  fCmdBuild_CGEREP,     fRspAnalyze_None},
-    {CMD_AT_CGEV,        "+CGEV",        WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_CGEV},
-    {CMD_ATD,            "D",            WP77_DEFAULT_TIMEOUT,  fCmdBuild_ATD_WP77,   fRspAnalyze_None},
-    {CMD_ATE,            "E",            WP77_DEFAULT_TIMEOUT,  fCmdBuild_ATE,        fRspAnalyze_None},
-    {CMD_ATH,            "H",            WP77_ATH_TIMEOUT,      fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_ATO,            "O",            WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_ATV,            "V",            WP77_DEFAULT_TIMEOUT,  fCmdBuild_ATV,        fRspAnalyze_None},
-    {CMD_ATX,            "X",            WP77_DEFAULT_TIMEOUT,  fCmdBuild_ATX,        fRspAnalyze_None},
-    {CMD_AT_ESC_CMD,     "+++",          WP77_ESCAPE_TIMEOUT,   fCmdBuild_ESCAPE_CMD, fRspAnalyze_None},
-    {CMD_AT_IPR,         "+IPR",         WP77_DEFAULT_TIMEOUT,  fCmdBuild_IPR,        fRspAnalyze_IPR},
-    {CMD_AT_IFC,         "+IFC",         WP77_DEFAULT_TIMEOUT,  fCmdBuild_IFC,        fRspAnalyze_None},
-    {CMD_AT_AND_W,       "&W",           WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_AT_AND_D,       "&D",           WP77_DEFAULT_TIMEOUT,  fCmdBuild_AT_AND_D,   fRspAnalyze_None},
-    {CMD_AT_DIRECT_CMD,  "",             WP77_DEFAULT_TIMEOUT,  fCmdBuild_DIRECT_CMD, fRspAnalyze_DIRECT_CMD},
-    {CMD_AT_CSIM,        "+CSIM",        WP77_DEFAULT_TIMEOUT,  fCmdBuild_CSIM,       fRspAnalyze_CSIM},
-	{CMD_AT_CCID,        "+CCID",        WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_CCID_WP77},
-
-    /* MODEM SPECIFIC COMMANDS */
-	{CMD_AT_SELRAT,      "!SELRAT",      WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_SELRAT_WP77},
-	{CMD_AT_WDSI,        "+WDSI",        WP77_DEFAULT_TIMEOUT,  fCmdBuild_WDSI_WP77,  fRspAnalyze_WDSI_WP77},
-	{CMD_AT_KSUP,        "+KSUP",        WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_None},
-	{CMD_AT_KSREP,       "+KSREP",       WP77_DEFAULT_TIMEOUT,  fCmdBuild_KSREP_WP77, fRspAnalyze_None},
-	{CMD_AT_BAND,        "!BAND",        WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_BAND_WP77},
-	{CMD_AT_SELACQ,      "!SELACQ",      WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_SELACQ_WP77},
-	{CMD_AT_GSTATUS,     "!GSTATUS",     WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_GSTATUS_WP77},
-    {CMD_AT_SOCKET_PROMPT, "> ",         WP77_SOCKET_PROMPT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_AT_SEND_OK,      "SEND OK",     WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_AT_SEND_FAIL,    "SEND FAIL",   WP77_DEFAULT_TIMEOUT,  fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_AT_KCELL,       "+KCELL",       WP77_DEFAULT_TIMEOUT,  fCmdBuild_KCELL_WP77, fRspAnalyze_KCELL_WP77},
-    {CMD_AT_CPSMS,       "+CPSMS",       WP77_CPSMS_TIMEOUT,    fCmdBuild_CPSMS,  fRspAnalyze_CPSMS},
-    {CMD_AT_CEDRXS,      "+CEDRXS",      WP77_CEDRX_TIMEOUT,    fCmdBuild_CEDRXS, fRspAnalyze_CEDRXS},
-    {CMD_AT_CEDRXP,      "+CEDRXP",      WP77_CEDRX_TIMEOUT,    fCmdBuild_NoParams,   fRspAnalyze_CEDRXP},
-    {CMD_AT_CEDRXRDP,    "+CEDRXRDP",    WP77_CEDRX_TIMEOUT,    fCmdBuild_NoParams,   fRspAnalyze_CEDRXRDP},
-
-    /* MODEM SPECIFIC EVENTS */
-    {CMD_AT_WAIT_EVENT,     "",          WP77_DEFAULT_TIMEOUT,        fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_AT_BOOT_EVENT,     "",          WP77_RDY_TIMEOUT,            fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_AT_RDY_EVENT,      "RDY",       WP77_RDY_TIMEOUT,            fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_AT_APP_RDY_EVENT,  "APP RDY",   WP77_APP_RDY_TIMEOUT,        fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_AT_POWERED_DOWN_EVENT,     "POWERED DOWN", WP77_RDY_TIMEOUT, fCmdBuild_NoParams,   fRspAnalyze_None},
-    {CMD_AT_PSM_POWER_DOWN_EVENT, "PSM POWER DOWN", WP77_RDY_TIMEOUT, fCmdBuild_NoParams,   fRspAnalyze_None},
-#if defined(USE_COM_MDM)
-    {CMD_AT_ORP,     "+ORP",     WP77_DEFAULT_TIMEOUT,  fCmdBuild_ORP, fRspAnalyze_ORP},
-#endif /* defined(USE_COM_MDM) */
+    WP77_ATCMD_GENERIC_LIST(WP77_ATCMD_LUT_ENTRY)
+    WP77_ATCMD_SPECIFIC_LIST(WP77_ATCMD_LUT_ENTRY)
+  };
+
+  /* Direct access table: cmd id -> LUT row + 1 (0 if command is not in LUT) */
+#define WP77_ATCMD_LUT_INDEX(cmd_id, cmd_str, cmd_timeout, cmd_BuildFunc, rsp_AnalyzeFunc) \
+  [(cmd_id)] = (uint8_t)(WP77_LUT_ROW_##cmd_id + 1U),
+  static const uint8_t ATCMD_WP77_LUT_index[CMD_AT_WP77_LAST] =
+  {
+    WP77_ATCMD_GENERIC_LIST(WP77_ATCMD_LUT_INDEX)
+    WP77_ATCMD_SPECIFIC_LIST(WP77_ATCMD_LUT_INDEX)
   };
 #define SIZE_ATCMD_WP77_LUT ((uint16_t) (sizeof (ATCMD_WP77_LUT) / sizeof (atcustom_LUT_t)))
 
@@ -283,6 +228,8 @@ void ATCustom_WP77_init(atparser_context_t *p_atp_ctxt)
   /* ###########################  START CUSTOMIZATION PART  ########################### */
   WP77_ctxt.modem_LUT_size = SIZE_ATCMD_WP77_LUT;
   WP77_ctxt.p_modem_LUT = (const atcustom_LUT_t *)ATCMD_WP77_LUT;
+  WP77_ctxt.modem_LUT_index_size = (uint32_t) CMD_AT_WP77_LAST;
+  WP77_ctxt.p_modem_LUT_index = &ATCMD_WP77_LUT_index[0];
 
   /* override default termination string for AT command: <CR> */
   (void) sprintf((CRC_CHAR_t *)p_atp_ctxt->endstr, "\r");
@@ -1737,6 +1684,8 @@ at_endmsg_t ATCustom_WP77_extractElement(atparser_context_t *p_atp_ctxt,
   element_infos->str_start_idx = *p_parseIndex;
   element_infos->str_end_idx = *p_parseIndex;
   element_infos->str_size = 0U;
+  element_infos->param_type = ATPARAM_TYPE_UNKNOWN;
+  element_infos->param_value = 0U;
 
   /* reach limit of input buffer ? (empty message received) */
   if (*p_parseIndex >= p_msg_in->size)
@@ -1745,6 +1694,36 @@ at_endmsg_t ATCustom_WP77_extractElement(atparser_context_t *p_atp_ctxt,
     goto exit_ATCustom_WP77_extractElement;
   }
 
+  /* params are tokenized in one pass when the first param is requested (command id is known at this point),
+   * then each param is returned directly from the recorded fields (kept by the caller in element_infos)
+   */
+  if ((element_infos->param_rank == 1U) && (element_infos->p_tokens != NULL))
+  {
+    WP77_tokenize_line(p_msg_in,
+                       *p_parseIndex,
+                       (element_infos->cmd_id_received != (uint32_t) CMD_AT_ORP) ? AT_TRUE : AT_FALSE,
+                       element_infos->p_tokens);
+  }
+  if ((element_infos->param_rank != 0U) && (element_infos->p_tokens != NULL) &&
+      (element_infos->param_rank <= (uint16_t) element_infos->p_tokens->nb_fields))
+  {
+    const at_line_field_t *p_field = &element_infos->p_tokens->field[element_infos->param_rank - 1U];
+    if (p_field->start_idx == *p_parseIndex)
+    {
+      element_infos->str_start_idx = p_field->start_idx;
+      element_infos->str_end_idx = p_field->end_idx;
+      element_infos->str_size = p_field->size;
+      element_infos->param_type = p_field->type;
+      element_infos->param_value = p_field->value;
+      *p_parseIndex = p_field->next_idx;
+      retval_msg_end_detected = (p_field->last == true) ? ATENDMSG_YES : ATENDMSG_NO;
+
+      /* increase parameter rank */
+      element_infos->param_rank = (element_infos->param_rank + 1U);
+      goto exit_ATCustom_WP77_extractElement;
+    }
+  }
+
   /* extract parameter from message */
   exit_loop = false;
   do
@@ -2356,6 +2335,118 @@ static void WP77_modem_reset(atcustom_modem_context_t *p_modem_ctxt)
   WP77_ctxt.state_SyntaxAutomaton = WAITING_FOR_INIT_CR;
 }*/
 
+/**
+  * @brief  Split a received line in fields and record them (single pass on the line)
+  * @note   Fields are separated by ':' or ',' (if split_fields is true) and the line ends with <CR>.
+  *         For each field, record its position, its type and its integer value (decimal integer
+  *         field: digits after optional leading spaces).
+  * @param  p_msg_in ptr to received message
+  * @param  start_idx index of first field in the message
+  * @param  split_fields AT_FALSE if the line has to be considered as one block (+ORP)
+  * @param  p_tokens ptr to the fields of the line (updated)
+  * @retval none
+  */
+static void WP77_tokenize_line(const IPC_RxMessage_t *p_msg_in, uint16_t start_idx, at_bool_t split_fields,
+                               at_line_tokens_t *p_tokens)
+{
+  uint16_t idx = start_idx;
+  uint8_t nb_fields = 0U;
+  bool end_of_line = false;
+
+  const AT_CHAR_t *p_buffer = p_msg_in->buffer;
+  uint16_t size = p_msg_in->size;
+
+  while ((end_of_line == false) && (nb_fields < AT_LINE_MAX_FIELDS) && (idx < size))
+  {
+    /* field is built in local variables (the fields table may alias the message buffer for the compiler)
+     * and recorded once complete
+     */
+    at_line_field_t *p_field = &p_tokens->field[nb_fields];
+    uint16_t start = idx;
+    uint16_t end = idx;
+    uint16_t field_size = 0U;
+    uint32_t value = 0U;
+    uint16_t nb_digits = 0U;
+    at_param_type_t type = ATPARAM_TYPE_INT;
+    bool end_of_field = false;
+    AT_CHAR_t car;
+
+    do
+    {
+      car = p_buffer[idx];
+      if (((car == (AT_CHAR_t)(':')) || (car == (AT_CHAR_t)(','))) && (split_fields == AT_TRUE))
+      {
+        end_of_field = true;
+      }
+      else if (car == (AT_CHAR_t)('\r'))
+      {
+        end_of_field = true;
+        end_of_line = true;
+      }
+      else
+      {
+        end = idx;
+        field_size++;
+        /* type and value only change while the field is still a decimal integer */
+        if (type == ATPARAM_TYPE_INT)
+        {
+          if ((uint8_t)(car - (AT_CHAR_t)('0')) <= 9U)
+          {
+            value = (value * 10U) + ((uint32_t)car - (uint32_t)('0'));
+            nb_digits++;
+          }
+          else if ((car == (AT_CHAR_t)(' ')) && (nb_digits == 0U))
+          {
+            /* leading spaces (after separators) do not change the field type */
+          }
+          else if ((car == (AT_CHAR_t)('"')) && (nb_digits == 0U))
+          {
+            type = ATPARAM_TYPE_STRING;
+          }
+          else
+          {
+            type = ATPARAM_TYPE_TEXT;
+          }
+        }
+      }
+
+      idx++;
+      /* reach limit of input buffer ? */
+      if (idx >= size)
+      {
+        end_of_field = true;
+        end_of_line = true;
+      }
+    } while (end_of_field == false);
+
+    p_field->start_idx = start;
+    p_field->end_idx = end;
+    p_field->size = field_size;
+    p_field->value = value;
+
+    if (field_size == 0U)
+    {
+      type = ATPARAM_TYPE_EMPTY;
+    }
+    else if (((field_size > 2U) && (p_buffer[start + 1U] == (AT_CHAR_t)('x'))) ||
+             ((type == ATPARAM_TYPE_INT) && (nb_digits > 9U)))
+    {
+      /* hexa value (0x...) or value which may exceed 32bits: let ATutil functions convert it */
+      type = ATPARAM_TYPE_TEXT;
+    }
+    else
+    {
+      /* nothing to do */
+    }
+    p_field->type = type;
+    p_field->next_idx = idx;
+    p_field->last = end_of_line;
+    nb_fields++;
+  }
+
+  p_tokens->nb_fields = nb_fields;
+}
+
 static void reset_variables_WP77(void)
 {
   /* Set default values of WP77 specific variables after SWITCH ON or RESET */
@@ -0,0 +1,334 @@
+/**
+  ******************************************************************************
+  * @file    bench_wp77_tokenize.c
+  * @author  Sierra Wireless Inc. and Affiliates
+  * @brief   Host test and benchmark of the WP77 line tokenizer
+  *          (ATCustom_WP77_extractElement with and without the line fields)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 Sierra Wireless Inc. and Affiliates
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by Sierra Wireless Inc. under the BSD 3-Clause license, the "License";
+  *  You may not use this file except in compliance with the License. You may obtain a copy of the License at:
+  *  opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  *
+  * This file is not part of the target build. From this directory, build and run it
+  * on the host (plf_config.h and rtosal.h of this directory replace the target ones):
+  *
+  *   C=../../../../../../Middlewares/ST/STM32_Cellular/Core
+  *   gcc -O2 -Wall -ffunction-sections -Wl,--gc-sections -I. -I../Inc \
+  *       -I$C/AT_Core/Inc -I$C/Ipc/Inc -I$C/Cellular_Service/Inc -I$C/Runtime_Library/Inc \
+  *       -I$C/Error/Inc -I$C/Trace/Inc \
+  *       -I../../../../../../Projects/B-L4S5I-IOT01A/Demonstrations/Cellular/STM32_Cellular/Config \
+  *       bench_wp77_tokenize.c ../Src/at_custom_modem_specific.c $C/AT_Core/Src/at_modem_common.c \
+  *       $C/AT_Core/Src/at_util.c $C/Runtime_Library/Src/cellular_runtime_standard.c -o bench_tokenize
+  *   ./bench_tokenize
+  *
+  * Each line is parsed as ATParser_parse_rsp does (command rank, then params until the
+  * end of the message), once with the line fields (p_tokens set) and once with the
+  * character by character extraction (p_tokens NULL). Both parses must return the same
+  * params, and the integer value recorded by the tokenizer must match the param string.
+  * Integer params are converted with atcm_get_param_int in both modes, as the analyze
+  * functions do, so that the timings include the conversion saved by the tokenizer.
+  * Two lines are also parsed interleaved, each with its own fields, to check that the
+  * tokenizer keeps no state outside of the fields provided by the caller.
+  * The lines below follow the WP77 answers syntax, they are not a capture of a session
+  * (+QIRD is not in the WP77 commands list: socket data are received in +ORP frames).
+  * The process exit code is the number of failures (0: all tests passed).
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "at_core.h"
+#include "at_parser.h"
+#include "at_modem_common.h"
+#include "at_util.h"
+#include "at_custom_modem_specific.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define BENCH_LOOP          (200000U) /* benchmark iterations per line */
+#define BENCH_MAX_PARAMS    (32U)     /* max number of params recorded per line */
+#define BENCH_ERR_PRINT_MAX (20U)     /* max number of failures displayed */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  const char *p_line;     /* received line (with header and trailer) */
+  uint32_t    cmd_id;     /* command id found by the parser in rank 0 */
+  uint32_t    int_params; /* ranks of the integer params (converted by the analyze functions) */
+} bench_line_t;
+
+/* param as returned by the extraction */
+typedef struct
+{
+  uint16_t    start_idx;
+  uint16_t    end_idx;
+  uint16_t    size;
+  uint16_t    parse_idx;
+  at_endmsg_t end;
+} bench_param_t;
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t bench_test_nb = 0U;
+static uint32_t bench_fail_nb = 0U;
+
+static const bench_line_t bench_lines[] =
+{
+  { "\r\n+CSQ: 23,99\r\n",                          (uint32_t) CMD_AT_CSQ,     0x06U },
+  { "\r\n+CEREG: 2,5,\"A2B1\",\"01A2D101\",7\r\n",  (uint32_t) CMD_AT_CEREG,   0x26U },
+  { "\r\n+CEREG: 5,\"A2B1\",\"01A2D101\",7,,,\"00100001\",\"00000110\"\r\n",
+                                                       (uint32_t) CMD_AT_CEREG,   0x12U },
+  { "\r\n+CGPADDR: 1,\"10.181.42.7\"\r\n",         (uint32_t) CMD_AT_CGPADDR, 0x02U },
+  { "\r\n+ORP: \"sensors\",\"temperature\",23.5,1634567890123\r\n",
+                                                       (uint32_t) CMD_AT_ORP,     0x00U },
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void bench_set_msg(IPC_RxMessage_t *p_msg, const char *p_line);
+static uint32_t bench_parse(const IPC_RxMessage_t *p_msg, const bench_line_t *p_line, at_line_tokens_t *p_tokens,
+                            bench_param_t *p_params);
+static void bench_check(bool ok, const char *p_label, const char *p_line, uint32_t rank);
+static void bench_compare_modes(void);
+static void bench_interleaved(void);
+static double bench_time_ns(void);
+static void bench_run(void);
+
+/* Private function Definition -----------------------------------------------*/
+static void bench_set_msg(IPC_RxMessage_t *p_msg, const char *p_line)
+{
+  size_t size = strlen(p_line);
+  (void)memcpy(p_msg->buffer, p_line, size);
+  p_msg->size = (uint16_t)size;
+}
+
+/**
+ * @brief  parse a line as ATParser_parse_rsp does, integer params are converted as the analyze functions do
+ * @retval number of params returned (including the command in rank 0)
+ */
+static uint32_t bench_parse(const IPC_RxMessage_t *p_msg, const bench_line_t *p_line, at_line_tokens_t *p_tokens,
+                            bench_param_t *p_params)
+{
+  atparser_context_t atp_ctxt;
+  at_element_info_t element_infos =
+  {
+    .current_parse_idx = 0U,
+    .cmd_id_received = (uint32_t) CMD_AT_INVALID,
+    .param_rank = 0U,
+    .p_tokens = p_tokens,
+  };
+  at_endmsg_t end;
+  uint32_t nb_params = 0U;
+  uint32_t value;
+
+  (void)memset(&atp_ctxt, 0, sizeof(atp_ctxt));
+  do
+  {
+    end = ATCustom_WP77_extractElement(&atp_ctxt, p_msg, &element_infos);
+    if (nb_params == 0U)
+    {
+      /* command found in rank 0 (as atcm_searchCmdInLUT does) */
+      element_infos.cmd_id_received = p_line->cmd_id;
+    }
+    else if ((nb_params < 32U) && ((p_line->int_params & (1UL << nb_params)) != 0U))
+    {
+      value = atcm_get_param_int(p_msg, &element_infos);
+      if (p_params != NULL)
+      {
+        bench_check(value == ATutil_convertStringToInt(&p_msg->buffer[element_infos.str_start_idx],
+                                                       element_infos.str_size),
+                    "int", p_line->p_line, nb_params);
+      }
+    }
+    else
+    {
+      /* string param: not converted */
+    }
+    if ((p_params != NULL) && (nb_params < BENCH_MAX_PARAMS))
+    {
+      p_params[nb_params].start_idx = element_infos.str_start_idx;
+      p_params[nb_params].end_idx = element_infos.str_end_idx;
+      p_params[nb_params].size = element_infos.str_size;
+      p_params[nb_params].parse_idx = element_infos.current_parse_idx;
+      p_params[nb_params].end = end;
+      if ((p_tokens != NULL) && (element_infos.param_type == ATPARAM_TYPE_INT))
+      {
+        /* integer value recorded by the tokenizer must match the param string */
+        char str[16];
+        uint16_t start = element_infos.str_start_idx;
+        uint16_t size = element_infos.str_size;
+        if (size >= sizeof(str))
+        {
+          size = (uint16_t)(sizeof(str) - 1U);
+        }
+        (void)memcpy(str, &p_msg->buffer[start], size);
+        str[size] = '\0';
+        bench_check(element_infos.param_value == (uint32_t)strtoul(str, NULL, 10), "value",
+                    (const char *)p_msg->buffer, nb_params);
+      }
+    }
+    nb_params++;
+  } while (end != ATENDMSG_YES);
+
+  return (nb_params);
+}
+
+static void bench_check(bool ok, const char *p_label, const char *p_line, uint32_t rank)
+{
+  bench_test_nb++;
+  if (ok == false)
+  {
+    bench_fail_nb++;
+    if (bench_fail_nb <= BENCH_ERR_PRINT_MAX)
+    {
+      printf("FAIL %s: param %u of line %.*s\n", p_label, rank, (int)(strlen(p_line) - 4U), &p_line[2]);
+    }
+  }
+}
+
+/**
+ * @brief  same params returned with and without the line fields
+ */
+static void bench_compare_modes(void)
+{
+  IPC_RxMessage_t msg;
+  at_line_tokens_t tokens;
+  bench_param_t params_tokens[BENCH_MAX_PARAMS];
+  bench_param_t params_legacy[BENCH_MAX_PARAMS];
+
+  for (uint32_t i = 0U; i < (sizeof(bench_lines) / sizeof(bench_lines[0])); i++)
+  {
+    uint32_t nb_tokens;
+    uint32_t nb_legacy;
+
+    bench_set_msg(&msg, bench_lines[i].p_line);
+    nb_tokens = bench_parse(&msg, &bench_lines[i], &tokens, params_tokens);
+    nb_legacy = bench_parse(&msg, &bench_lines[i], NULL, params_legacy);
+    bench_check(nb_tokens == nb_legacy, "params number", bench_lines[i].p_line, nb_tokens);
+    for (uint32_t rank = 0U; (rank < nb_tokens) && (rank < nb_legacy) && (rank < BENCH_MAX_PARAMS); rank++)
+    {
+      bench_check(memcmp(&params_tokens[rank], &params_legacy[rank], sizeof(bench_param_t)) == 0,
+                  "param", bench_lines[i].p_line, rank);
+    }
+  }
+}
+
+/**
+ * @brief  two lines parsed interleaved, each with its own fields
+ */
+static void bench_interleaved(void)
+{
+  IPC_RxMessage_t msg_a;
+  IPC_RxMessage_t msg_b;
+  at_line_tokens_t tokens_a;
+  at_line_tokens_t tokens_b;
+  atparser_context_t atp_ctxt;
+  at_element_info_t info_a = { .current_parse_idx = 0U, .cmd_id_received = (uint32_t) CMD_AT_INVALID,
+                               .param_rank = 0U, .p_tokens = &tokens_a };
+  at_element_info_t info_b = { .current_parse_idx = 0U, .cmd_id_received = (uint32_t) CMD_AT_INVALID,
+                               .param_rank = 0U, .p_tokens = &tokens_b };
+  bench_param_t ref_a[BENCH_MAX_PARAMS];
+  bench_param_t ref_b[BENCH_MAX_PARAMS];
+  at_endmsg_t end_a = ATENDMSG_NO;
+  at_endmsg_t end_b = ATENDMSG_NO;
+  uint32_t rank_a = 0U;
+  uint32_t rank_b = 0U;
+
+  (void)memset(&atp_ctxt, 0, sizeof(atp_ctxt));
+  bench_set_msg(&msg_a, bench_lines[1].p_line);
+  bench_set_msg(&msg_b, bench_lines[0].p_line);
+  (void)bench_parse(&msg_a, &bench_lines[1], NULL, ref_a);
+  (void)bench_parse(&msg_b, &bench_lines[0], NULL, ref_b);
+
+  while ((end_a != ATENDMSG_YES) || (end_b != ATENDMSG_YES))
+  {
+    if (end_a != ATENDMSG_YES)
+    {
+      end_a = ATCustom_WP77_extractElement(&atp_ctxt, &msg_a, &info_a);
+      info_a.cmd_id_received = bench_lines[1].cmd_id;
+      bench_check((info_a.str_start_idx == ref_a[rank_a].start_idx) && (info_a.str_size == ref_a[rank_a].size) &&
+                  (end_a == ref_a[rank_a].end), "interleaved", bench_lines[1].p_line, rank_a);
+      rank_a++;
+    }
+    if (end_b != ATENDMSG_YES)
+    {
+      end_b = ATCustom_WP77_extractElement(&atp_ctxt, &msg_b, &info_b);
+      info_b.cmd_id_received = bench_lines[0].cmd_id;
+      bench_check((info_b.str_start_idx == ref_b[rank_b].start_idx) && (info_b.str_size == ref_b[rank_b].size) &&
+                  (end_b == ref_b[rank_b].end), "interleaved", bench_lines[0].p_line, rank_b);
+      rank_b++;
+    }
+  }
+}
+
+static double bench_time_ns(void)
+{
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief  time per line with and without the line fields
+ */
+static void bench_run(void)
+{
+  IPC_RxMessage_t msg;
+  at_line_tokens_t tokens;
+  volatile uint32_t sink = 0U;
+
+  printf("benchmark: %u loops per line\n", BENCH_LOOP);
+  printf("  %-10s %8s %12s %12s\n", "line", "params", "tokens", "per char");
+  for (uint32_t i = 0U; i < (sizeof(bench_lines) / sizeof(bench_lines[0])); i++)
+  {
+    double t0;
+    double t_tokens;
+    double t_legacy;
+    uint32_t nb_params = 0U;
+    char name[12];
+
+    bench_set_msg(&msg, bench_lines[i].p_line);
+    t0 = bench_time_ns();
+    for (uint32_t loop = 0U; loop < BENCH_LOOP; loop++)
+    {
+      nb_params = bench_parse(&msg, &bench_lines[i], &tokens, NULL);
+      sink += nb_params;
+    }
+    t_tokens = bench_time_ns() - t0;
+
+    t0 = bench_time_ns();
+    for (uint32_t loop = 0U; loop < BENCH_LOOP; loop++)
+    {
+      sink += bench_parse(&msg, &bench_lines[i], NULL, NULL);
+    }
+    t_legacy = bench_time_ns() - t0;
+
+    (void)sscanf(&bench_lines[i].p_line[2], "%11[^:]", name);
+    printf("  %-10s %8u %9.1f ns %9.1f ns\n", name, nb_params,
+           t_tokens / (double)BENCH_LOOP, t_legacy / (double)BENCH_LOOP);
+  }
+  (void)sink;
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(void)
+{
+  bench_compare_modes();
+  bench_interleaved();
+  printf("WP77 tokenizer: %u tests, %u failures\n", bench_test_nb, bench_fail_nb);
+
+  bench_run();
+
+  return (bench_fail_nb > 255U) ? 255 : (int)bench_fail_nb;
+}
+
+/************************ (C) COPYRIGHT Sierra Wireless *****END OF FILE****/
@@ -0,0 +1,66 @@
+/**
+  ******************************************************************************
+  * @file    plf_config.h
+  * @author  Sierra Wireless Inc. and Affiliates
+  * @brief   Platform configuration used by the host build of the WP77 tokenizer
+  *          benchmark (replaces the project plf_config.h)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 Sierra Wireless Inc. and Affiliates
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by Sierra Wireless Inc. under the BSD 3-Clause license, the "License";
+  *  You may not use this file except in compliance with the License. You may obtain a copy of the License at:
+  *  opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef PLF_CONFIG_H
+#define PLF_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define USE_MODEM_WP77
+#define HWREF_B_CELL_WP77_V2
+#define USE_COM_MDM
+#define USE_SOCKETS_MODEM         (1U)
+#define USE_SOCKETS_TYPE          USE_SOCKETS_MODEM
+#define USE_PRINTF                (1U)
+#define USE_LOW_POWER             (0)
+#define MODEM_UART_BAUDRATE       (115200U)
+
+/* Exported types ------------------------------------------------------------*/
+/* HAL types used by the AT Core and IPC headers */
+typedef struct
+{
+  uint32_t dummy;
+} UART_HandleTypeDef;
+
+typedef enum
+{
+  GPIO_PIN_RESET = 0,
+  GPIO_PIN_SET
+} GPIO_PinState;
+
+/* Exported macros -----------------------------------------------------------*/
+#define UNUSED(X) (void)(X)
+#define __NOP()   do {} while (false)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLF_CONFIG_H */
+
+/************************ (C) COPYRIGHT Sierra Wireless *****END OF FILE****/
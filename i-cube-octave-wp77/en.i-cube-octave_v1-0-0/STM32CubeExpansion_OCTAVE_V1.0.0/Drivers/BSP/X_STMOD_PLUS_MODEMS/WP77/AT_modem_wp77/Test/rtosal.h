@@ -0,0 +1,45 @@
+/**
+  ******************************************************************************
+  * @file    rtosal.h
+  * @author  Sierra Wireless Inc. and Affiliates
+  * @brief   RTOS types used by the host build of the WP77 tokenizer benchmark
+  *          (replaces Rtosal/Inc/rtosal.h, no RTOS service is called)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 Sierra Wireless Inc. and Affiliates
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by Sierra Wireless Inc. under the BSD 3-Clause license, the "License";
+  *  You may not use this file except in compliance with the License. You may obtain a copy of the License at:
+  *  opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef RTOSAL_H
+#define RTOSAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+typedef void   *osMutexId;
+typedef void   *osSemaphoreId;
+typedef void   *osMessageQId;
+typedef void   *osThreadId;
+typedef void   *osTimerId;
+typedef int32_t osPriority;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RTOSAL_H */
+
+/************************ (C) COPYRIGHT Sierra Wireless *****END OF FILE****/
@@ -140,6 +140,14 @@ typedef int16_t at_handle_t;
 typedef uint8_t  at_buf_t;
 typedef void (* urc_callback_t)(at_buf_t *p_rsp_buf);
 
+#if (CST_EVENT_LOG == 1U)
+typedef uint8_t at_trace_t;
+#define ATTRACE_SID_START        ((at_trace_t) 0U)  /* service request received: id = SID                    */
+#define ATTRACE_SID_END          ((at_trace_t) 1U)  /* service request processed: id = SID, status = result  */
+#define ATTRACE_CMD_SENT         ((at_trace_t) 2U)  /* AT command sent to modem: id = AT command ID          */
+typedef void (* at_trace_callback_t)(at_trace_t trace, uint32_t id, at_status_t status);
+#endif /* CST_EVENT_LOG == 1U */
+
 typedef uint16_t at_hw_event_t;
 #define HWEVT_UNKNOWN            ((at_hw_event_t) 0U)  /* unknown HW event */
 #define HWEVT_MODEM_RING         ((at_hw_event_t) 1U)  /* modem HW event = RING gpio transition detected */
@@ -155,6 +163,10 @@ at_status_t  AT_reset_context(at_handle_t athandle);
 at_status_t  AT_sendcmd(at_handle_t athandle, at_msg_t msg_in_id, at_buf_t *p_cmd_in_buf, at_buf_t *p_rsp_buf);
 at_status_t  AT_open_channel(at_handle_t athandle);
 at_status_t  AT_close_channel(at_handle_t athandle);
+at_bool_t    AT_is_processing(void);
+#if (CST_EVENT_LOG == 1U)
+void         AT_set_trace_callback(at_trace_callback_t trace_callback);
+#endif /* CST_EVENT_LOG == 1U */
 void         AT_internalEvent(sysctrl_device_type_t deviceType);
 at_status_t  atcore_task_start(osPriority taskPrio, uint16_t stackSize);
 
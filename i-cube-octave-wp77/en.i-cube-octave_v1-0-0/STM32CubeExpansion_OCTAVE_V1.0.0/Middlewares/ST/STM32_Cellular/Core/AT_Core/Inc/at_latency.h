@@ -0,0 +1,52 @@
+/**
+  ******************************************************************************
+  * @file    at_latency.h
+  * @author  MCD Application Team
+  * @brief   Header for at_latency.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef AT_LATENCY_H
+#define AT_LATENCY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "plf_config.h"
+#include "at_core.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+/* External variables --------------------------------------------------------*/
+/* Exported macros -----------------------------------------------------------*/
+
+/* Exported functions ------------------------------------------------------- */
+#if (ATCORE_LATENCY_STATS == 1U)
+void     ATlatency_init(void);
+uint32_t ATlatency_get_timeout(uint32_t cmd_id, const AT_CHAR_t *p_cmd_str, uint32_t lut_timeout);
+void     ATlatency_record(uint32_t cmd_id, uint32_t latency, at_bool_t timeout);
+void     ATlatency_reset(void);
+void     ATlatency_display(void);
+#endif /* ATCORE_LATENCY_STATS == 1U */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT_LATENCY_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
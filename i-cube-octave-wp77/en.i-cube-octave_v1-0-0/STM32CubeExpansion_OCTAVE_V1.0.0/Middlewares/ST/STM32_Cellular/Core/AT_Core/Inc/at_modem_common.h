@@ -308,6 +308,9 @@ typedef struct
 {
   uint32_t                           modem_LUT_size;
   const struct atcustom_LUT_struct   *p_modem_LUT;
+  /* optional direct access table (NULL if not used): p_modem_LUT_index[cmd_id] = LUT row + 1 (0: not in LUT) */
+  uint32_t                           modem_LUT_index_size;
+  const uint8_t                      *p_modem_LUT_index;
 
   /* received command syntax analysis: state of automaton which analyzes cmd syntax */
   atcustom_modem_SyntaxAutomatonState_t   state_SyntaxAutomaton;
@@ -414,6 +417,7 @@ void atcm_get_IP_address_infos(atcustom_persistent_context_t *p_persistent_ctxt,
                                csint_ip_addr_info_t  *ip_addr_info);
 CS_IPaddrType_t atcm_get_ip_address_type(AT_CHAR_t *p_addr_str);
 void atcm_extract_IP_address(const uint8_t *p_Src, uint16_t size, uint8_t *p_Dst);
+uint32_t atcm_get_param_int(const IPC_RxMessage_t *p_msg_in, const at_element_info_t *element_infos);
 
 at_status_t atcm_select_hw_simslot(CS_SimSlot_t sim);
 
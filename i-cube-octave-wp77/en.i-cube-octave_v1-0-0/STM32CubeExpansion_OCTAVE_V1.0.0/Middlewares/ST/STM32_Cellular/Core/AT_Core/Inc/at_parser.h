@@ -84,6 +84,38 @@ typedef struct
 
 } at_context_t;
 
+/* at_param_type_t
+ * type of current param, as detected by the modem tokenizer (if any)
+ */
+typedef uint8_t at_param_type_t;
+#define ATPARAM_TYPE_UNKNOWN  ((at_param_type_t) 0U) /* param not tokenized, value has to be converted */
+#define ATPARAM_TYPE_EMPTY    ((at_param_type_t) 1U) /* empty param */
+#define ATPARAM_TYPE_INT      ((at_param_type_t) 2U) /* decimal integer, param_value is valid */
+#define ATPARAM_TYPE_STRING   ((at_param_type_t) 3U) /* quoted string */
+#define ATPARAM_TYPE_TEXT     ((at_param_type_t) 4U) /* other (unquoted text, hexa value...) */
+
+/* maximum number of params recorded per line by the modem tokenizer, next params are extracted one by one */
+#define AT_LINE_MAX_FIELDS    ((uint8_t) 16U)
+
+/* field of a received line, as recorded by the modem tokenizer (if any) */
+typedef struct
+{
+  uint32_t        value;     /* field integer value */
+  uint16_t        start_idx; /* field start index in the message */
+  uint16_t        end_idx;   /* field end index in the message */
+  uint16_t        size;      /* field size */
+  uint16_t        next_idx;  /* parse index of next field (separator skipped) */
+  at_param_type_t type;      /* field type */
+  bool            last;      /* true if this is the last field of the message */
+} at_line_field_t;
+
+/* fields of the line currently parsed */
+typedef struct
+{
+  uint8_t         nb_fields; /* number of fields recorded */
+  at_line_field_t field[AT_LINE_MAX_FIELDS];
+} at_line_tokens_t;
+
 typedef struct
 {
   uint16_t    current_parse_idx; /* current parse index in the input buffer */
@@ -92,6 +124,9 @@ typedef struct
   uint16_t    str_start_idx;     /* current param start index in the message */
   uint16_t    str_end_idx;       /* current param end index in the message */
   uint16_t    str_size;          /* current param size */
+  at_param_type_t param_type;    /* current param type (ATPARAM_TYPE_UNKNOWN if not tokenized) */
+  uint32_t    param_value;       /* current param integer value (same conversion as ATutil_convertStringToInt) */
+  at_line_tokens_t *p_tokens;    /* fields of the line, provided by the caller of the parsing (NULL if none) */
 } at_element_info_t;
 
 /* External variables --------------------------------------------------------*/
@@ -26,6 +26,9 @@
 #include "cellular_runtime_standard.h"
 #include "cellular_runtime_custom.h"
 #include "plf_config.h"
+#if (ATCORE_LATENCY_STATS == 1U)
+#include "at_latency.h"
+#endif /* ATCORE_LATENCY_STATS == 1U */
 /* following file added to check SID for DATA suspend/resume cases */
 #include "cellular_service_int.h"
 
@@ -63,6 +66,10 @@
 #define MSG_IPC_RECEIVED_SIZE (uint32_t) ((uint16_t) 128U)
 #define SIG_IPC_MSG                      (1U) /* signals definition for IPC message queue */
 #define SIG_INTERNAL_EVENT_MODEM         (2U) /* signals definition for internal event from the cellular modem */
+#if (ATCORE_URC_FAST_PATH == 1U)
+#define MSG_URC_AVAILABLE_SIZE (uint32_t) ((uint16_t) 8U)
+#define SIG_URC_AVAILABLE                (1U) /* signals definition for URC queue */
+#endif /* ATCORE_URC_FAST_PATH == 1U */
 
 /* Global variables ----------------------------------------------------------*/
 
@@ -72,9 +79,16 @@ static osSemaphoreId s_WaitAnswer_SemaphoreId = NULL;
 /* Queues definition */
 /* this queue is used by IPC to inform that messages are ready to be retrieved */
 static osMessageQId q_msg_IPC_received_Id;
+#if (ATCORE_URC_FAST_PATH == 1U)
+/* this queue is used to inform the URC task that URC are ready to be forwarded to the client */
+static osMessageQId q_msg_URC_available_Id;
+#endif /* ATCORE_URC_FAST_PATH == 1U */
 
 /* Private function prototypes -----------------------------------------------*/
 static void ATCoreTaskBody(void *argument);
+#if (ATCORE_URC_FAST_PATH == 1U)
+static void ATCoreUrcTaskBody(void *argument);
+#endif /* ATCORE_URC_FAST_PATH == 1U */
 
 /* Mutex used to avoid crossing cases when preparing/parsing AT commands/responses/URC */
 #if (USE_PARSING_MUTEX == 1)
@@ -89,6 +103,9 @@ static urc_callback_t register_URC_callback;
 static IPC_RxMessage_t msgFromIPC; /* IPC msg */
 static __IO uint8_t MsgReceived = 0U; /* received IPC msg counter */
 static IPC_CheckEndOfMsgCallbackTypeDef custom_checkEndOfMsgCallback = NULL;
+#if (CST_EVENT_LOG == 1U)
+static at_trace_callback_t register_trace_callback = NULL;
+#endif /* CST_EVENT_LOG == 1U */
 
 /* Global variables ----------------------------------------------------------*/
 
@@ -105,6 +122,8 @@ static at_status_t waitFromIPC(uint32_t tickstart, uint32_t cmdTimeout,
 static at_action_rsp_t process_answer(at_action_send_t action_send,
 		uint32_t at_cmd_timeout);
 static at_action_rsp_t analyze_action_result(at_action_rsp_t val);
+static void dispatch_URC(void);
+static void forward_URC(at_buf_t *p_urc_buf);
 
 static void IRQ_DISABLE(void);
 static void IRQ_ENABLE(void);
@@ -146,6 +165,10 @@ at_status_t AT_init(void) {
 		}
 #endif
 
+#if (ATCORE_LATENCY_STATS == 1U)
+		ATlatency_init();
+#endif /* ATCORE_LATENCY_STATS == 1U */
+
 		AT_Core_initialized = 1U;
 		retval = ATSTATUS_OK;
 	}
@@ -340,6 +363,12 @@ at_status_t AT_sendcmd(at_handle_t athandle, at_msg_t msg_in_id,
 
 		/* start to process this command */
 		at_context.processing_cmd = 1U;
+#if (CST_EVENT_LOG == 1U)
+		if (register_trace_callback != NULL) {
+			(*register_trace_callback)(ATTRACE_SID_START, (uint32_t) msg_in_id,
+					ATSTATUS_OK);
+		}
+#endif /* CST_EVENT_LOG == 1U */
 
 		/* save ptr on response buffer */
 		at_context.p_rsp_buf = p_rsp_buf;
@@ -385,6 +414,12 @@ at_status_t AT_sendcmd(at_handle_t athandle, at_msg_t msg_in_id,
 		(void) ATParser_get_rsp(&at_context, p_rsp_buf);
 
 		exit_func:
+#if (CST_EVENT_LOG == 1U)
+		if (register_trace_callback != NULL) {
+			(*register_trace_callback)(ATTRACE_SID_END, (uint32_t) msg_in_id,
+					retval);
+		}
+#endif /* CST_EVENT_LOG == 1U */
 		/* finished to process this command */
 		at_context.processing_cmd = 0U;
 	}
@@ -392,6 +427,26 @@ at_status_t AT_sendcmd(at_handle_t athandle, at_msg_t msg_in_id,
 	return (retval);
 }
 
+/**
+ * @brief  Check if an AT command is being processed.
+ * @retval at_bool_t AT_TRUE if a command is under process.
+ */
+at_bool_t AT_is_processing(void) {
+	return ((at_context.processing_cmd == 1U) ? AT_TRUE : AT_FALSE);
+}
+
+#if (CST_EVENT_LOG == 1U)
+/**
+ * @brief  Register a callback notified of each service request and AT command.
+ * @note   The callback is called in the context of the AT_sendcmd() caller.
+ * @param  trace_callback Callback (NULL to unregister).
+ * @retval none
+ */
+void AT_set_trace_callback(at_trace_callback_t trace_callback) {
+	register_trace_callback = trace_callback;
+}
+#endif /* CST_EVENT_LOG == 1U */
+
 /**
  * @brief  Notify that an internal event has been received.
  * @param  deviceType Device ID on which the event has been received.
@@ -538,6 +593,11 @@ static at_status_t process_AT_transaction(at_msg_t msg_in_id,
 	uint16_t build_atcmd_size;
 	uint8_t another_cmd_to_send;
 	at_action_rsp_t action_rsp = ATACTION_RSP_NO_ACTION;
+#if (ATCORE_LATENCY_STATS == 1U)
+	uint32_t cmd_id;
+	uint32_t cmd_tickstart = 0U;
+	uint32_t cmd_latency;
+#endif /* ATCORE_LATENCY_STATS == 1U */
 
 	/* reset at cmd buffer */
 	(void) memset((void*) build_atcmd, 0, ATCMD_MAX_CMD_SIZE);
@@ -561,6 +621,9 @@ static at_status_t process_AT_transaction(at_msg_t msg_in_id,
 				(uint8_t*) &build_atcmd[0],
 				(uint16_t) (sizeof(AT_CHAR_t) * ATCMD_MAX_CMD_SIZE),
 				&build_atcmd_size, &at_cmd_timeout);
+#if (ATCORE_LATENCY_STATS == 1U)
+		cmd_id = at_context.parser.current_atcmd.id;
+#endif /* ATCORE_LATENCY_STATS == 1U */
 #if (USE_PARSING_MUTEX == 1)
 		(void) rtosalMutexRelease(ATCore_ParsingMutexHandle);
 #endif /* USE_PARSING_MUTEX == 1 */
@@ -582,6 +645,16 @@ static at_status_t process_AT_transaction(at_msg_t msg_in_id,
 					LOG_ERROR(8, ERROR_WARNING);
 					retval = ATSTATUS_ERROR;
 				} else {
+#if (ATCORE_LATENCY_STATS == 1U)
+					cmd_tickstart = HAL_GetTick();
+#endif /* ATCORE_LATENCY_STATS == 1U */
+#if (CST_EVENT_LOG == 1U)
+					if (register_trace_callback != NULL) {
+						(*register_trace_callback)(ATTRACE_CMD_SENT,
+								at_context.parser.current_atcmd.id,
+								ATSTATUS_OK);
+					}
+#endif /* CST_EVENT_LOG == 1U */
 					retval = sendToIPC((uint8_t*) &build_atcmd[0],
 							build_atcmd_size);
 					if (retval != ATSTATUS_OK) {
@@ -597,6 +670,18 @@ static at_status_t process_AT_transaction(at_msg_t msg_in_id,
 				if (((action_send & ATACTION_SEND_WAIT_MANDATORY_RSP) != 0U)
 						|| ((action_send & ATACTION_SEND_TEMPO) != 0U)) {
 					action_rsp = process_answer(action_send, at_cmd_timeout);
+#if (ATCORE_LATENCY_STATS == 1U)
+					/* record latency of commands waiting for a mandatory response */
+					if ((build_atcmd_size > 0U)
+							&& ((action_send & ATACTION_SEND_WAIT_MANDATORY_RSP)
+									!= 0U)) {
+						cmd_latency = HAL_GetTick() - cmd_tickstart;
+						ATlatency_record(cmd_id, cmd_latency,
+								((action_rsp == ATACTION_RSP_ERROR)
+										&& (cmd_latency >= at_cmd_timeout)) ?
+										AT_TRUE : AT_FALSE);
+					}
+#endif /* ATCORE_LATENCY_STATS == 1U */
 					if (action_rsp == ATACTION_RSP_FRC_CONTINUE) {
 						/* this is not the last command */
 						another_cmd_to_send = 1U;
@@ -708,6 +793,47 @@ static at_action_rsp_t analyze_action_result(at_action_rsp_t val) {
 	return (action);
 }
 
+static void dispatch_URC(void) {
+#if (ATCORE_URC_FAST_PATH == 1U)
+	/* URC are forwarded by the URC task (higher priority than ATCore task):
+	 * the client callback does not delay the parsing of next messages and
+	 * latency-critical URC are forwarded first (see atcm_modem_get_urc).
+	 * If the queue is full, a signal is already pending and all URC will be
+	 * retrieved when it is treated.
+	 */
+	(void) rtosalMessageQueuePut(q_msg_URC_available_Id,
+			(uint32_t) SIG_URC_AVAILABLE, (uint32_t) 0U);
+#else
+	static at_buf_t urc_buf[ATCMD_MAX_BUF_SIZE]; /* buffer size not optimized yet */
+
+	forward_URC(urc_buf);
+#endif /* ATCORE_URC_FAST_PATH == 1U */
+}
+
+static void forward_URC(at_buf_t *p_urc_buf) {
+	at_status_t retUrc;
+
+	/* notify user with callback */
+	if (register_URC_callback != NULL) {
+		/* get URC response buffer */
+		do {
+			(void) memset((void*) p_urc_buf, 0, ATCMD_MAX_BUF_SIZE);
+#if (USE_PARSING_MUTEX == 1)
+			(void) rtosalMutexAcquire(ATCore_ParsingMutexHandle,
+					RTOSAL_WAIT_FOREVER);
+#endif /* USE_PARSING_MUTEX == 1 */
+			retUrc = ATParser_get_urc(&at_context, p_urc_buf);
+#if (USE_PARSING_MUTEX == 1)
+			(void) rtosalMutexRelease(ATCore_ParsingMutexHandle);
+#endif /* USE_PARSING_MUTEX == 1 */
+			if ((retUrc == ATSTATUS_OK) || (retUrc == ATSTATUS_OK_PENDING_URC)) {
+				/* call the URC callback */
+				(*register_URC_callback)(p_urc_buf);
+			}
+		} while (retUrc == ATSTATUS_OK_PENDING_URC);
+	}
+}
+
 static void IRQ_DISABLE(void) {
 	__disable_irq();
 }
@@ -721,6 +847,10 @@ at_status_t atcore_task_start(osPriority taskPrio, uint16_t stackSize) {
 
 	/* ATCore task handler */
 	static osThreadId atcoreTaskId = NULL;
+#if (ATCORE_URC_FAST_PATH == 1U)
+	/* ATCore URC task handler */
+	static osThreadId atcoreUrcTaskId = NULL;
+#endif /* ATCORE_URC_FAST_PATH == 1U */
 
 	/* check if AT_init has been called before */
 	if (AT_Core_initialized != 1U) {
@@ -745,6 +875,22 @@ at_status_t atcore_task_start(osPriority taskPrio, uint16_t stackSize) {
 					(const rtosal_char_t*) "IPC_MSG_RCV",
 					MSG_IPC_RECEIVED_SIZE); /* create message queue */
 
+#if (ATCORE_URC_FAST_PATH == 1U)
+			q_msg_URC_available_Id = rtosalMessageQueueNew(
+					(const rtosal_char_t*) "URC_MSG_AVAIL",
+					MSG_URC_AVAILABLE_SIZE); /* create message queue */
+
+			/* start URC thread */
+			atcoreUrcTaskId = rtosalThreadNew(
+					(const rtosal_char_t*) "AtCoreUrc",
+					(os_pthread) ATCoreUrcTaskBody, ATCORE_URC_THREAD_PRIO,
+					(uint32_t) ATCORE_URC_THREAD_STACK_SIZE, NULL);
+			if (atcoreUrcTaskId == NULL) {
+				TRACE_ERR("atcoreUrcTaskId creation error")
+				LOG_ERROR(22, ERROR_WARNING);
+			}
+#endif /* ATCORE_URC_FAST_PATH == 1U */
+
 			/* start driver thread */
 			atcoreTaskId = rtosalThreadNew((const rtosal_char_t*) "AtCore",
 					(os_pthread) ATCoreTaskBody, taskPrio, (uint32_t) stackSize,
@@ -765,13 +911,10 @@ at_status_t atcore_task_start(osPriority taskPrio, uint16_t stackSize) {
 static void ATCoreTaskBody(void *argument) {
 	UNUSED(argument);
 
-	at_status_t retUrc;
 	at_action_rsp_t action;
 	rtosalStatus status;
 	uint32_t msg = 0;
 
-	static at_buf_t urc_buf[ATCMD_MAX_BUF_SIZE]; /* buffer size not optimized yet */
-
 	TRACE_DBG("<start ATCore TASK>")
 
 	/* Infinite loop */
@@ -827,20 +970,7 @@ static void ATCoreTaskBody(void *argument) {
 
 				/* check if this is an URC to forward */
 				if (action == ATACTION_RSP_URC_FORWARDED) {
-					/* notify user with callback */
-					if (register_URC_callback != NULL) {
-						/* get URC response buffer */
-						do {
-							(void) memset((void*) urc_buf, 0,
-									ATCMD_MAX_BUF_SIZE);
-							retUrc = ATParser_get_urc(&at_context, urc_buf);
-							if ((retUrc == ATSTATUS_OK)
-									|| (retUrc == ATSTATUS_OK_PENDING_URC)) {
-								/* call the URC callback */
-								(*register_URC_callback)(urc_buf);
-							}
-						} while (retUrc == ATSTATUS_OK_PENDING_URC);
-					}
+					dispatch_URC();
 				} else if ((action == ATACTION_RSP_FRC_CONTINUE)
 						|| (action == ATACTION_RSP_FRC_END)
 						|| (action == ATACTION_RSP_ERROR)) {
@@ -854,17 +984,7 @@ static void ATCoreTaskBody(void *argument) {
 				 * Do not call IPC_receive in this case
 				 */
 				TRACE_DBG("!!! an internal event has been received !!!")
-				if (register_URC_callback != NULL) {
-					do {
-						(void) memset((void*) urc_buf, 0, ATCMD_MAX_BUF_SIZE);
-						retUrc = ATParser_get_urc(&at_context, urc_buf);
-						if ((retUrc == ATSTATUS_OK)
-								|| (retUrc == ATSTATUS_OK_PENDING_URC)) {
-							/* call the URC callback */
-							(*register_URC_callback)(urc_buf);
-						}
-					} while (retUrc == ATSTATUS_OK_PENDING_URC);
-				}
+				dispatch_URC();
 			} else {
 				/* should not happen */
 				__NOP();
@@ -873,5 +993,29 @@ static void ATCoreTaskBody(void *argument) {
 	}
 }
 
+#if (ATCORE_URC_FAST_PATH == 1U)
+static void ATCoreUrcTaskBody(void *argument) {
+	UNUSED(argument);
+
+	rtosalStatus status;
+	uint32_t msg = 0;
+
+	static at_buf_t urc_buf[ATCMD_MAX_BUF_SIZE]; /* buffer size not optimized yet */
+
+	TRACE_DBG("<start ATCore URC TASK>")
+
+	/* Infinite loop */
+	for (;;) {
+		/* waiting URC available event (message) */
+		status = rtosalMessageQueueGet(q_msg_URC_available_Id,
+				(uint32_t*) &msg, (uint32_t) RTOSAL_WAIT_FOREVER);
+		if (((status == osEventMessage) || (status == osOK))
+				&& (msg == (SIG_URC_AVAILABLE))) {
+			forward_URC(urc_buf);
+		}
+	}
+}
+#endif /* ATCORE_URC_FAST_PATH == 1U */
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
 
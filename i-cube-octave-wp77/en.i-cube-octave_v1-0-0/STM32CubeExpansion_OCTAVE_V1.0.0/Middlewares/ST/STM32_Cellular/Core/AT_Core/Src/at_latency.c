@@ -0,0 +1,473 @@
+/**
+ ******************************************************************************
+ * @file    at_latency.c
+ * @author  MCD Application Team
+ * @brief   This file provides code for AT commands latency statistics
+ *          and adaptive timeout
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+ * All rights reserved.</center></h2>
+ *
+ * This software component is licensed by ST under Ultimate Liberty license
+ * SLA0044, the "License"; You may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at:
+ *                             www.st.com/SLA0044
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include <stdbool.h>
+#include "plf_config.h"
+
+#if (ATCORE_LATENCY_STATS == 1U)
+#include "plf_modem_config.h"
+#include "at_latency.h"
+#include "rtosal.h"
+#include "error_handler.h"
+#include "cellular_runtime_custom.h"
+
+#if (USE_CMD_CONSOLE == 1)
+#include "cmd.h"
+#endif /* USE_CMD_CONSOLE == 1 */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private defines -----------------------------------------------------------*/
+#define ATLAT_EXTRA_CMD_NB     (2U)   /* entries added to modem LUT size for commands not found in LUT */
+#define ATLAT_TABLE_SIZE       (CONFIG_MODEM_ATCMD_NB + ATLAT_EXTRA_CMD_NB)
+#define ATLAT_HISTO_NB         (12U)  /* number of buckets of the latency histogram */
+#define ATLAT_HISTO_BASE_SHIFT (4U)   /* bucket 0: [0..15]ms, bucket n: [16*2^(n-1)..16*2^n - 1]ms,
+                                       * last bucket: all latencies above */
+#define ATLAT_HISTO_WINDOW     (256U) /* when reached, histogram is halved to follow modem behavior changes */
+#define ATLAT_SRTT_SHIFT       (3U)   /* EWMA gain = 1/8 (latency stored scaled by 8) */
+#define ATLAT_RTTVAR_SHIFT     (2U)   /* deviation gain = 1/4 (deviation stored scaled by 4) */
+#define ATLAT_MIN_SAMPLES      (16U)  /* samples needed before the learned timeout is applied */
+#define ATLAT_P99_FACTOR       (2U)   /* learned timeout = max(2 * p99, ewma + 4 * deviation) */
+#define ATLAT_MAX_SAMPLES      (255U) /* samples counter saturation */
+#define ATLAT_CMD_ARG_MAX_NB   (2U)
+
+typedef struct {
+	uint32_t cmd_id;             /* AT command id                                   */
+	const AT_CHAR_t *p_cmd_str;  /* AT command string (from modem LUT), may be NULL */
+	uint32_t count;              /* number of answered commands                     */
+	uint32_t timeout_nb;         /* number of commands not answered before timeout  */
+	uint32_t srtt;               /* smoothed latency in ms, scaled by 8             */
+	uint32_t rttvar;             /* latency mean deviation in ms, scaled by 4       */
+	uint32_t max;                /* max latency in ms                               */
+	uint32_t timeout;            /* last timeout applied in ms                      */
+	uint16_t histo_total;        /* number of samples in histogram                  */
+	uint16_t histo[ATLAT_HISTO_NB]; /* latency histogram (log2 buckets)            */
+	uint8_t samples;             /* samples since last reset of learned timeout     */
+} atlat_entry_t;
+
+/* Private macros ------------------------------------------------------------*/
+#if (USE_PRINTF == 0U)
+#include "trace_interface.h"
+#define PRINT_FORCE(format, args...) \
+  TRACE_PRINT_FORCE(DBG_CHAN_ATCMD, DBL_LVL_P0, "" format "\n\r", ## args)
+#else
+#include <stdio.h>
+#define PRINT_FORCE(format, args...)   (void)printf("" format "\n\r", ## args);
+#endif  /* (USE_PRINTF == 0U) */
+
+/* Private variables ---------------------------------------------------------*/
+static osMutexId atlat_mutex = NULL;
+static atlat_entry_t atlat_table[ATLAT_TABLE_SIZE]; /* one entry per command of the modem LUT */
+static uint16_t atlat_nb = 0U;
+static uint32_t atlat_untracked_nb = 0U; /* commands not tracked because table is full */
+#if (ATCORE_ADAPTIVE_TIMEOUT == 1U)
+static bool atlat_adaptive = true;
+#endif /* ATCORE_ADAPTIVE_TIMEOUT == 1U */
+
+/* Global variables ----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static atlat_entry_t* find_entry(uint32_t cmd_id);
+static uint8_t histo_index(uint32_t latency);
+static uint32_t histo_percentile(const atlat_entry_t *p_entry,
+		uint32_t percent);
+#if (USE_CMD_CONSOLE == 1)
+static void atlat_cmd_help(void);
+static cmd_status_t atlat_cmd(uint8_t *p_cmd_line);
+#endif /* USE_CMD_CONSOLE == 1 */
+
+/* Private function Definition -----------------------------------------------*/
+/**
+ * @brief  Search (or allocate) the statistics entry of a command
+ * @param  cmd_id - AT command id
+ * @retval atlat_entry_t* - NULL if table is full
+ */
+static atlat_entry_t* find_entry(uint32_t cmd_id) {
+	atlat_entry_t *p_entry = NULL;
+	uint16_t i = 0U;
+
+	while ((p_entry == NULL) && (i < atlat_nb)) {
+		if (atlat_table[i].cmd_id == cmd_id) {
+			p_entry = &atlat_table[i];
+		}
+		i++;
+	}
+
+	if (p_entry == NULL) {
+		if (atlat_nb < ATLAT_TABLE_SIZE) {
+			p_entry = &atlat_table[atlat_nb];
+			(void) memset((void*) p_entry, 0, sizeof(atlat_entry_t));
+			p_entry->cmd_id = cmd_id;
+			atlat_nb++;
+		} else {
+			atlat_untracked_nb++;
+		}
+	}
+
+	return (p_entry);
+}
+
+/**
+ * @brief  Compute histogram bucket of a latency
+ * @param  latency - in ms
+ * @retval uint8_t - bucket index
+ */
+static uint8_t histo_index(uint32_t latency) {
+	uint32_t value = latency >> ATLAT_HISTO_BASE_SHIFT;
+	uint8_t index = 0U;
+
+	while ((value != 0U) && (index < (ATLAT_HISTO_NB - 1U))) {
+		value >>= 1;
+		index++;
+	}
+
+	return (index);
+}
+
+/**
+ * @brief  Estimate a latency percentile from histogram
+ * @note   upper bound of the bucket is returned (pessimistic estimation)
+ * @param  p_entry - statistics entry
+ * @param  percent - percentile requested (1-100)
+ * @retval uint32_t - latency in ms
+ */
+static uint32_t histo_percentile(const atlat_entry_t *p_entry,
+		uint32_t percent) {
+	uint32_t retval = p_entry->max;
+	uint32_t threshold = (((uint32_t) p_entry->histo_total * percent) + 99U)
+			/ 100U;
+	uint32_t cumul = 0U;
+	uint32_t upper;
+	bool leave_loop = false;
+	uint8_t i = 0U;
+
+	if (threshold == 0U) {
+		retval = 0U;
+	} else {
+		do {
+			cumul += p_entry->histo[i];
+			if (cumul >= threshold) {
+				upper = ((uint32_t) 1U << (ATLAT_HISTO_BASE_SHIFT + i)) - 1U;
+				retval = (upper < p_entry->max) ? upper : p_entry->max;
+				leave_loop = true;
+			}
+			i++;
+		} while ((leave_loop == false) && (i < (ATLAT_HISTO_NB - 1U)));
+	}
+
+	return (retval);
+}
+
+#if (USE_CMD_CONSOLE == 1)
+/**
+ * @brief  console cmd help
+ * @param  -
+ * @retval -
+ */
+static void atlat_cmd_help(void) {
+	CMD_print_help((uint8_t*) "atlat");
+	PRINT_FORCE("atlat help")
+	PRINT_FORCE("atlat stat : display AT commands latency statistics")
+	PRINT_FORCE("atlat reset : reset AT commands latency statistics")
+#if (ATCORE_ADAPTIVE_TIMEOUT == 1U)
+	PRINT_FORCE("atlat adaptive [on|off] : enable/disable adaptive AT commands timeout")
+#endif /* ATCORE_ADAPTIVE_TIMEOUT == 1U */
+	PRINT_FORCE("")
+}
+
+/**
+ * @brief  cmd management
+ * @param  p_cmd_line - pointer on command parameters
+ * @retval cmd_status_t - status of cmd management CMD_OK or CMD_SYNTAX_ERROR
+ */
+static cmd_status_t atlat_cmd(uint8_t *p_cmd_line) {
+	cmd_status_t result = CMD_SYNTAX_ERROR;
+	uint32_t argc;
+	uint32_t len;
+	uint8_t *p_argv[ATLAT_CMD_ARG_MAX_NB];
+	const uint8_t *p_cmd;
+
+	PRINT_FORCE("")
+	p_cmd = (uint8_t*) strtok((CRC_CHAR_t*) p_cmd_line, " \t");
+
+	if (p_cmd != NULL) {
+		if (memcmp((const CRC_CHAR_t*) p_cmd, "atlat", crs_strlen(p_cmd))
+				== 0) {
+			/* parameters parsing */
+			for (argc = 0U; argc < ATLAT_CMD_ARG_MAX_NB; argc++) {
+				p_argv[argc] = (uint8_t*) strtok(NULL, " \t");
+				if (p_argv[argc] == NULL) {
+					break;
+				}
+			}
+
+			if (argc == 0U) /* No parameters */
+			{
+				/* cmd 'atlat': display statistics */
+				result = CMD_OK;
+				ATlatency_display();
+			} else /* At least one parameter provided */
+			{
+				len = crs_strlen(p_argv[0]);
+				if (memcmp((CRC_CHAR_t*) p_argv[0], "help", len) == 0) {
+					/* cmd 'atlat help': display help */
+					result = CMD_OK;
+					atlat_cmd_help();
+				} else if (memcmp((CRC_CHAR_t*) p_argv[0], "stat", len) == 0) {
+					/* cmd 'atlat stat': display statistics */
+					result = CMD_OK;
+					ATlatency_display();
+				} else if (memcmp((CRC_CHAR_t*) p_argv[0], "reset", len)
+						== 0) {
+					/* cmd 'atlat reset': reset statistics */
+					result = CMD_OK;
+					ATlatency_reset();
+					PRINT_FORCE("AT commands latency statistics reset")
+				}
+#if (ATCORE_ADAPTIVE_TIMEOUT == 1U)
+				else if (memcmp((CRC_CHAR_t*) p_argv[0], "adaptive", len)
+						== 0) {
+					/* cmd 'atlat adaptive [on|off]' */
+					if (argc == 1U) {
+						result = CMD_OK;
+					} else if (memcmp((CRC_CHAR_t*) p_argv[1], "on",
+							crs_strlen(p_argv[1])) == 0) {
+						atlat_adaptive = true;
+						result = CMD_OK;
+					} else if (memcmp((CRC_CHAR_t*) p_argv[1], "off",
+							crs_strlen(p_argv[1])) == 0) {
+						atlat_adaptive = false;
+						result = CMD_OK;
+					} else {
+						atlat_cmd_help();
+					}
+					PRINT_FORCE("adaptive timeout: %s",
+							(atlat_adaptive == true) ? "on" : "off")
+				}
+#endif /* ATCORE_ADAPTIVE_TIMEOUT == 1U */
+				else /* cmd 'atlat xxx ...': unknown */
+				{
+					PRINT_FORCE("atlat: Unrecognized command. Usage:")
+					/* Display help */
+					atlat_cmd_help();
+				}
+			}
+		}
+	}
+	return (result);
+}
+#endif /* USE_CMD_CONSOLE == 1 */
+
+/* Functions Definition ------------------------------------------------------*/
+/**
+ * @brief  Initialize AT commands latency statistics
+ * @note   called by AT_init, after CMD_init
+ * @param  -
+ * @retval -
+ */
+void ATlatency_init(void) {
+	atlat_nb = 0U;
+	atlat_untracked_nb = 0U;
+
+	atlat_mutex = rtosalMutexNew(NULL);
+	if (atlat_mutex == NULL) {
+		/* Platform is reset */
+		ERROR_Handler(DBG_CHAN_ATCMD, 23, ERROR_FATAL);
+	}
+
+#if (USE_CMD_CONSOLE == 1)
+	CMD_Declare((uint8_t*) "atlat", atlat_cmd,
+			(uint8_t*) "AT commands latency");
+#endif /* USE_CMD_CONSOLE == 1 */
+}
+
+/**
+ * @brief  Get the timeout to apply to an AT command
+ * @note   if adaptive timeout is active and enough answers have been received for this command,
+ *         timeout is derived from measured latency, bounded by ATCORE_ADAPTIVE_TIMEOUT_FLOOR
+ *         and by the LUT timeout (ceiling). Otherwise LUT timeout is returned.
+ * @param  cmd_id - AT command id
+ * @param  p_cmd_str - AT command string (used for display only, may be NULL)
+ * @param  lut_timeout - timeout defined in modem LUT for this command
+ * @retval uint32_t - timeout in ms
+ */
+uint32_t ATlatency_get_timeout(uint32_t cmd_id, const AT_CHAR_t *p_cmd_str,
+		uint32_t lut_timeout) {
+	uint32_t retval = lut_timeout;
+	atlat_entry_t *p_entry;
+
+	(void) rtosalMutexAcquire(atlat_mutex, RTOSAL_WAIT_FOREVER);
+
+	p_entry = find_entry(cmd_id);
+	if (p_entry != NULL) {
+		p_entry->p_cmd_str = p_cmd_str;
+#if (ATCORE_ADAPTIVE_TIMEOUT == 1U)
+		if ((atlat_adaptive == true)
+				&& (p_entry->samples >= ATLAT_MIN_SAMPLES)) {
+			uint32_t learned = ATLAT_P99_FACTOR
+					* histo_percentile(p_entry, 99U);
+			uint32_t rto = (p_entry->srtt >> ATLAT_SRTT_SHIFT)
+					+ p_entry->rttvar;
+
+			if (rto > learned) {
+				learned = rto;
+			}
+			if (learned < ATCORE_ADAPTIVE_TIMEOUT_FLOOR) {
+				learned = ATCORE_ADAPTIVE_TIMEOUT_FLOOR;
+			}
+			/* LUT timeout is the ceiling */
+			if (learned < retval) {
+				retval = learned;
+			}
+		}
+#endif /* ATCORE_ADAPTIVE_TIMEOUT == 1U */
+		p_entry->timeout = retval;
+	}
+
+	(void) rtosalMutexRelease(atlat_mutex);
+
+	return (retval);
+}
+
+/**
+ * @brief  Record the latency of an AT command
+ * @param  cmd_id - AT command id
+ * @param  latency - time elapsed between command sending and final answer, in ms
+ * @param  timeout - AT_TRUE if no answer has been received before timeout
+ * @retval -
+ */
+void ATlatency_record(uint32_t cmd_id, uint32_t latency, at_bool_t timeout) {
+	atlat_entry_t *p_entry;
+	int32_t err;
+
+	(void) rtosalMutexAcquire(atlat_mutex, RTOSAL_WAIT_FOREVER);
+
+	p_entry = find_entry(cmd_id);
+	if (p_entry != NULL) {
+		if (timeout == AT_TRUE) {
+			p_entry->timeout_nb++;
+			/* learned timeout is no more reliable:
+			 * LUT timeout is applied until enough new answers are received */
+			p_entry->samples = 0U;
+		} else {
+			if (p_entry->count == 0U) {
+				/* first sample: deviation initialized to latency / 2 */
+				p_entry->srtt = latency << ATLAT_SRTT_SHIFT;
+				p_entry->rttvar = latency << (ATLAT_RTTVAR_SHIFT - 1U);
+			} else {
+				/* srtt += (latency - srtt) / 8, rttvar += (|err| - rttvar) / 4 */
+				err = (int32_t) latency
+						- (int32_t) (p_entry->srtt >> ATLAT_SRTT_SHIFT);
+				p_entry->srtt = (uint32_t) ((int32_t) p_entry->srtt + err);
+				if (err < 0) {
+					err = -err;
+				}
+				p_entry->rttvar = (uint32_t) ((int32_t) p_entry->rttvar + err
+						- (int32_t) (p_entry->rttvar >> ATLAT_RTTVAR_SHIFT));
+			}
+
+			if (latency > p_entry->max) {
+				p_entry->max = latency;
+			}
+
+			/* histogram ageing */
+			if (p_entry->histo_total >= ATLAT_HISTO_WINDOW) {
+				p_entry->histo_total = 0U;
+				for (uint8_t i = 0U; i < ATLAT_HISTO_NB; i++) {
+					p_entry->histo[i] >>= 1;
+					p_entry->histo_total += p_entry->histo[i];
+				}
+			}
+			p_entry->histo[histo_index(latency)]++;
+			p_entry->histo_total++;
+
+			p_entry->count++;
+			if (p_entry->samples < ATLAT_MAX_SAMPLES) {
+				p_entry->samples++;
+			}
+		}
+	}
+
+	(void) rtosalMutexRelease(atlat_mutex);
+}
+
+/**
+ * @brief  Reset AT commands latency statistics
+ * @param  -
+ * @retval -
+ */
+void ATlatency_reset(void) {
+	(void) rtosalMutexAcquire(atlat_mutex, RTOSAL_WAIT_FOREVER);
+	atlat_nb = 0U;
+	atlat_untracked_nb = 0U;
+	(void) memset((void*) atlat_table, 0, sizeof(atlat_table));
+	(void) rtosalMutexRelease(atlat_mutex);
+}
+
+/**
+ * @brief  Display AT commands latency statistics
+ * @note   percentiles are estimated from a log2 histogram (upper bound of bucket)
+ * @param  -
+ * @retval -
+ */
+void ATlatency_display(void) {
+	const atlat_entry_t *p_entry;
+	const AT_CHAR_t *p_name;
+
+	(void) rtosalMutexAcquire(atlat_mutex, RTOSAL_WAIT_FOREVER);
+
+	PRINT_FORCE("*** AT Latency Stat Begin (ms) ***")
+#if (ATCORE_ADAPTIVE_TIMEOUT == 1U)
+	PRINT_FORCE("adaptive timeout: %s - floor:%lu",
+			(atlat_adaptive == true) ? "on" : "off",
+			(uint32_t) ATCORE_ADAPTIVE_TIMEOUT_FLOOR)
+#else
+	PRINT_FORCE("adaptive timeout: not available")
+#endif /* ATCORE_ADAPTIVE_TIMEOUT == 1U */
+	PRINT_FORCE("%-14s %6s %4s %6s %6s %6s %6s %6s %6s %6s", "cmd", "nb",
+			"tmo", "ewma", "dev", "p50", "p95", "p99", "max", "timeout")
+
+	for (uint16_t i = 0U; i < atlat_nb; i++) {
+		p_entry = &atlat_table[i];
+		p_name = ((p_entry->p_cmd_str != NULL)
+				&& (p_entry->p_cmd_str[0] != 0U)) ?
+				p_entry->p_cmd_str : (const AT_CHAR_t*) "(raw)";
+		PRINT_FORCE("%-14s %6lu %4lu %6lu %6lu %6lu %6lu %6lu %6lu %6lu",
+				(const CRC_CHAR_t*) p_name, p_entry->count,
+				p_entry->timeout_nb, p_entry->srtt >> ATLAT_SRTT_SHIFT,
+				p_entry->rttvar >> ATLAT_RTTVAR_SHIFT,
+				histo_percentile(p_entry, 50U),
+				histo_percentile(p_entry, 95U),
+				histo_percentile(p_entry, 99U), p_entry->max,
+				p_entry->timeout)
+	}
+
+	if (atlat_untracked_nb != 0U) {
+		PRINT_FORCE("untracked commands: %lu (table size: %lu)",
+				atlat_untracked_nb, (uint32_t) ATLAT_TABLE_SIZE)
+	}
+	PRINT_FORCE("*** AT Latency Stat End ***")
+
+	(void) rtosalMutexRelease(atlat_mutex);
+}
+
+#endif /* ATCORE_LATENCY_STATS == 1U */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
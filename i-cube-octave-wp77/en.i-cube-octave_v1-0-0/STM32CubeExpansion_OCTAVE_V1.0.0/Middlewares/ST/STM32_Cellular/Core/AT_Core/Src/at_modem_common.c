@@ -30,6 +30,9 @@
 #include "cellular_runtime_standard.h"
 #include "cellular_runtime_custom.h"
 #include "plf_config.h"
+#if (ATCORE_LATENCY_STATS == 1U)
+#include "at_latency.h"
+#endif /* ATCORE_LATENCY_STATS == 1U */
 
 /* Private typedef -----------------------------------------------------------*/
 
@@ -66,6 +69,7 @@ static void reserve_user_modem_cid(atcustom_persistent_context_t *p_persistent_c
                                    uint8_t reserved_modem_cid);
 static void affect_modem_cid(atcustom_persistent_context_t *p_persistent_ctxt,
                              CS_PDN_conf_id_t conf_id);
+static const atcustom_LUT_t *get_LUT_entry(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id);
 
 /* Private function Definition -----------------------------------------------*/
 /*
@@ -146,6 +150,46 @@ static void affect_modem_cid(atcustom_persistent_context_t *p_persistent_ctxt, C
   return;
 }
 
+/*
+*  Search the LUT entry of a command Id: direct access if modem provides an index table, linear search otherwise
+*/
+static const atcustom_LUT_t *get_LUT_entry(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id)
+{
+  const atcustom_LUT_t *retval = NULL;
+
+  /* check if this is the invalid cmd id */
+  if (cmd_id != CMD_AT_INVALID)
+  {
+    if (p_modem_ctxt->p_modem_LUT_index != NULL)
+    {
+      /* direct access: index table contains LUT row + 1 (0 if command not in LUT) */
+      if (cmd_id < p_modem_ctxt->modem_LUT_index_size)
+      {
+        uint32_t row = (uint32_t) p_modem_ctxt->p_modem_LUT_index[cmd_id];
+        if ((row != 0U) && (row <= p_modem_ctxt->modem_LUT_size))
+        {
+          retval = &p_modem_ctxt->p_modem_LUT[row - 1U];
+        }
+      }
+    }
+    else
+    {
+      /* search in LUT the cmd ID */
+      uint16_t i = 0U;
+      while ((retval == NULL) && (i < p_modem_ctxt->modem_LUT_size))
+      {
+        if (p_modem_ctxt->p_modem_LUT[i].cmd_id == cmd_id)
+        {
+          retval = &p_modem_ctxt->p_modem_LUT[i];
+        }
+        i++;
+      }
+    }
+  }
+
+  return (retval);
+}
+
 /* Functions Definition ------------------------------------------------------*/
 /**
   * @brief  Put IP Address infos for the selected PDP config
@@ -309,6 +353,30 @@ void atcm_extract_IP_address(const uint8_t *p_Src, uint16_t size, uint8_t *p_Dst
   }
 }
 
+/**
+  * @brief  Get integer value of current param
+  *         If the param has already been converted by the modem tokenizer, its value is
+  *         returned directly, otherwise the param string is converted.
+  * @param  p_msg_in ptr to received message
+  * @param  element_infos ptr to current param infos
+  * @retval uint32_t param value
+  */
+uint32_t atcm_get_param_int(const IPC_RxMessage_t *p_msg_in, const at_element_info_t *element_infos)
+{
+  uint32_t retval;
+
+  if (element_infos->param_type == ATPARAM_TYPE_INT)
+  {
+    retval = element_infos->param_value;
+  }
+  else
+  {
+    retval = ATutil_convertStringToInt(&p_msg_in->buffer[element_infos->str_start_idx], element_infos->str_size);
+  }
+
+  return (retval);
+}
+
 /**
   * @brief  Selection of the SIM slot to use
   * @param  sim
@@ -382,22 +450,11 @@ CS_PDN_conf_id_t atcm_get_cid_current_SID(atcustom_modem_context_t *p_modem_ctxt
 const AT_CHAR_t *atcm_get_CmdStr(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id)
 {
   const AT_CHAR_t *retval = ((uint8_t *)"");
-  uint16_t i = 0U;
-  bool leave_loop = false;
+  const atcustom_LUT_t *p_entry = get_LUT_entry(p_modem_ctxt, cmd_id);
 
-  /* check if this is the invalid cmd id*/
-  if (cmd_id != CMD_AT_INVALID)
+  if (p_entry != NULL)
   {
-    /* search in LUT the cmd ID */
-    do
-    {
-      if (p_modem_ctxt->p_modem_LUT[i].cmd_id == cmd_id)
-      {
-        retval = (const AT_CHAR_t *)(&p_modem_ctxt->p_modem_LUT[i].cmd_str);
-        leave_loop = true;
-      }
-      i++;
-    } while ((leave_loop == false) && (i < p_modem_ctxt->modem_LUT_size));
+    retval = (const AT_CHAR_t *)(&p_entry->cmd_str);
   }
 
   return (retval);
@@ -417,18 +474,22 @@ uint32_t atcm_get_CmdTimeout(const atcustom_modem_context_t *p_modem_ctxt, uint3
   /* check if this is the invalid cmd id */
   if (cmd_id != CMD_AT_INVALID)
   {
-    /* search in LUT the cmd ID */
-    bool leave_loop = false;
-    uint16_t i = 0U;
-    do
+    const atcustom_LUT_t *p_entry = get_LUT_entry(p_modem_ctxt, cmd_id);
+#if (ATCORE_LATENCY_STATS == 1U)
+    const AT_CHAR_t *p_cmd_str = NULL;
+#endif /* ATCORE_LATENCY_STATS == 1U */
+    if (p_entry != NULL)
     {
-      if (p_modem_ctxt->p_modem_LUT[i].cmd_id == cmd_id)
-      {
-        retval = p_modem_ctxt->p_modem_LUT[i].cmd_timeout;
-        leave_loop = true;
-      }
-      i++;
-    } while ((leave_loop == false) && (i < p_modem_ctxt->modem_LUT_size));
+      retval = p_entry->cmd_timeout;
+#if (ATCORE_LATENCY_STATS == 1U)
+      p_cmd_str = &p_entry->cmd_str[0];
+#endif /* ATCORE_LATENCY_STATS == 1U */
+    }
+
+#if (ATCORE_LATENCY_STATS == 1U)
+    /* LUT timeout is the ceiling, a shorter timeout is returned if learned from measured latency */
+    retval = ATlatency_get_timeout(cmd_id, p_cmd_str, retval);
+#endif /* ATCORE_LATENCY_STATS == 1U */
   }
 
   return (retval);
@@ -444,21 +505,11 @@ uint32_t atcm_get_CmdTimeout(const atcustom_modem_context_t *p_modem_ctxt, uint3
 CmdBuildFuncTypeDef atcm_get_CmdBuildFunc(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id)
 {
   CmdBuildFuncTypeDef retval = fCmdBuild_NoParams; /* return default value */
+  const atcustom_LUT_t *p_entry = get_LUT_entry(p_modem_ctxt, cmd_id);
 
-  if (cmd_id != CMD_AT_INVALID)
+  if (p_entry != NULL)
   {
-    uint16_t i = 0U;
-    bool leave_loop = false;
-    /* search in LUT the cmd ID */
-    do
-    {
-      if (p_modem_ctxt->p_modem_LUT[i].cmd_id == cmd_id)
-      {
-        retval = p_modem_ctxt->p_modem_LUT[i].cmd_BuildFunc;
-        leave_loop = true;
-      }
-      i++;
-    } while ((leave_loop == false) && (i < p_modem_ctxt->modem_LUT_size));
+    retval = p_entry->cmd_BuildFunc;
   }
 
   return (retval);
@@ -474,21 +525,11 @@ CmdBuildFuncTypeDef atcm_get_CmdBuildFunc(const atcustom_modem_context_t *p_mode
 CmdAnalyzeFuncTypeDef atcm_get_CmdAnalyzeFunc(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id)
 {
   CmdAnalyzeFuncTypeDef retval = fRspAnalyze_None;
+  const atcustom_LUT_t *p_entry = get_LUT_entry(p_modem_ctxt, cmd_id);
 
-  if (cmd_id != CMD_AT_INVALID)
+  if (p_entry != NULL)
   {
-    /* search in LUT the cmd ID */
-    uint16_t i = 0U;
-    bool leave_loop = false;
-    do
-    {
-      if (p_modem_ctxt->p_modem_LUT[i].cmd_id == cmd_id)
-      {
-        retval = p_modem_ctxt->p_modem_LUT[i].rsp_AnalyzeFunc;
-        leave_loop = true;
-      }
-      i++;
-    } while ((leave_loop == false) && (i < p_modem_ctxt->modem_LUT_size));
+    retval = p_entry->rsp_AnalyzeFunc;
   }
 
   return (retval);
@@ -906,8 +947,65 @@ at_status_t atcm_modem_get_urc(atcustom_modem_context_t *p_modem_ctxt,
   *  all common behaviors for URC have to be implemented here
   */
 
+  /* latency-critical URC are reported first (COM-MDM events, socket data pending, socket closed by remote)
+  *  to avoid being delayed by network or signal quality URC received at the same time
+  */
+#if defined(USE_COM_MDM)
+  if (p_modem_ctxt->persist.urc_avail_commdm_event_count != 0U)
+  {
+    PRINT_INFO("urc_avail_commdm_event")
+
+    CS_comMdm_status_t comMdmd_event_infos;
+    /* report number of pending COMMDM messages */
+    comMdmd_event_infos.param1 = p_modem_ctxt->persist.urc_avail_commdm_event_count - 1U;
+    if (DATAPACK_writeStruct(p_rsp_buf,
+                             (uint16_t) CSMT_URC_COMMDM_EVENT,
+                             (uint16_t) sizeof(comMdmd_event_infos),
+                             (void *)&comMdmd_event_infos) != DATAPACK_OK)
+    {
+      retval = ATSTATUS_ERROR;
+    }
+
+    /* decrease counter of pending COMMDM messages stored */
+    p_modem_ctxt->persist.urc_avail_commdm_event_count--;
+  }
+  else if (p_modem_ctxt->persist.urc_avail_socket_data_pending == AT_TRUE)
+#else
+  if (p_modem_ctxt->persist.urc_avail_socket_data_pending == AT_TRUE)
+#endif /* defined(USE_COM_MDM) */
+  {
+    PRINT_DBG("urc_avail_socket_data_pending")
+
+    socket_handle_t sockHandle = atcm_socket_get_hdle_urc_data_pending(p_modem_ctxt);
+    if (DATAPACK_writeStruct(p_rsp_buf,
+                             (uint16_t) CSMT_URC_SOCKET_DATA_PENDING,
+                             (uint16_t) sizeof(socket_handle_t),
+                             (void *)&sockHandle) != DATAPACK_OK)
+    {
+      retval = ATSTATUS_ERROR;
+    }
+
+    /* reset flag if no more socket data pending */
+    p_modem_ctxt->persist.urc_avail_socket_data_pending = atcm_socket_remaining_urc_data_pending(p_modem_ctxt);
+  }
+  else if (p_modem_ctxt->persist.urc_avail_socket_closed_by_remote == AT_TRUE)
+  {
+    PRINT_DBG("urc_avail_socket_closed_by_remote")
+
+    socket_handle_t sockHandle = atcm_socket_get_hdlr_urc_closed_by_remote(p_modem_ctxt);
+    if (DATAPACK_writeStruct(p_rsp_buf,
+                             (uint16_t) CSMT_URC_SOCKET_CLOSED,
+                             (uint16_t) sizeof(socket_handle_t),
+                             (void *)&sockHandle) != DATAPACK_OK)
+    {
+      retval = ATSTATUS_ERROR;
+    }
+
+    /* reset flag if no more socket data pending */
+    p_modem_ctxt->persist.urc_avail_socket_closed_by_remote = atcm_socket_remaining_urc_closed_by_remote(p_modem_ctxt);
+  }
   /* URC for EPS network registration */
-  if (p_modem_ctxt->persist.urc_avail_eps_network_registration == AT_TRUE)
+  else if (p_modem_ctxt->persist.urc_avail_eps_network_registration == AT_TRUE)
   {
     PRINT_DBG("urc_avail_eps_network_registration")
     if (DATAPACK_writeStruct(p_rsp_buf,
@@ -1075,38 +1173,6 @@ at_status_t atcm_modem_get_urc(atcustom_modem_context_t *p_modem_ctxt,
     /* reset flag  (systematically to avoid never ending URC) */
     p_modem_ctxt->persist.urc_avail_signal_quality = AT_FALSE;
   }
-  else if (p_modem_ctxt->persist.urc_avail_socket_data_pending == AT_TRUE)
-  {
-    PRINT_DBG("urc_avail_socket_data_pending")
-
-    socket_handle_t sockHandle = atcm_socket_get_hdle_urc_data_pending(p_modem_ctxt);
-    if (DATAPACK_writeStruct(p_rsp_buf,
-                             (uint16_t) CSMT_URC_SOCKET_DATA_PENDING,
-                             (uint16_t) sizeof(socket_handle_t),
-                             (void *)&sockHandle) != DATAPACK_OK)
-    {
-      retval = ATSTATUS_ERROR;
-    }
-
-    /* reset flag if no more socket data pending */
-    p_modem_ctxt->persist.urc_avail_socket_data_pending = atcm_socket_remaining_urc_data_pending(p_modem_ctxt);
-  }
-  else if (p_modem_ctxt->persist.urc_avail_socket_closed_by_remote == AT_TRUE)
-  {
-    PRINT_DBG("urc_avail_socket_closed_by_remote")
-
-    socket_handle_t sockHandle = atcm_socket_get_hdlr_urc_closed_by_remote(p_modem_ctxt);
-    if (DATAPACK_writeStruct(p_rsp_buf,
-                             (uint16_t) CSMT_URC_SOCKET_CLOSED,
-                             (uint16_t) sizeof(socket_handle_t),
-                             (void *)&sockHandle) != DATAPACK_OK)
-    {
-      retval = ATSTATUS_ERROR;
-    }
-
-    /* reset flag if no more socket data pending */
-    p_modem_ctxt->persist.urc_avail_socket_closed_by_remote = atcm_socket_remaining_urc_closed_by_remote(p_modem_ctxt);
-  }
   else if (p_modem_ctxt->persist.urc_avail_pdn_event == AT_TRUE)
   {
     PRINT_DBG("urc_avail_pdn_event")
@@ -1286,26 +1352,6 @@ at_status_t atcm_modem_get_urc(atcustom_modem_context_t *p_modem_ctxt,
     /* reset flag (systematically to avoid never ending URC) */
     p_modem_ctxt->persist.urc_avail_modem_events = CS_MDMEVENT_NONE;
   }
-#if defined(USE_COM_MDM)
-  else if (p_modem_ctxt->persist.urc_avail_commdm_event_count != 0U)
-  {
-    PRINT_INFO("urc_avail_commdm_event")
-
-    CS_comMdm_status_t comMdmd_event_infos;
-    /* report number of pending COMMDM messages */
-    comMdmd_event_infos.param1 = p_modem_ctxt->persist.urc_avail_commdm_event_count - 1U;
-    if (DATAPACK_writeStruct(p_rsp_buf,
-                             (uint16_t) CSMT_URC_COMMDM_EVENT,
-                             (uint16_t) sizeof(comMdmd_event_infos),
-                             (void *)&comMdmd_event_infos) != DATAPACK_OK)
-    {
-      retval = ATSTATUS_ERROR;
-    }
-
-    /* decrease counter of pending COMMDM messages stored */
-    p_modem_ctxt->persist.urc_avail_commdm_event_count--;
-  }
-#endif /* defined(USE_COM_MDM) */
   else
   {
     PRINT_INFO("no pending URC")
@@ -1885,10 +1931,12 @@ at_status_t atcm_searchCmdInLUT(atcustom_modem_context_t *p_modem_ctxt,
     /* search in LUT the ID corresponding to command received */
     bool leave_loop = false;
     uint16_t i = 0U;
+    AT_CHAR_t first_char = p_msg_in->buffer[element_infos->str_start_idx];
     do
     {
-      /* if string length > 0 */
-      if (strlen((const CRC_CHAR_t *)(p_modem_ctxt->p_modem_LUT)[i].cmd_str) > 0U)
+      /* if string length > 0 and first char is matching (avoid strlen/memcmp on other commands) */
+      if (((p_modem_ctxt->p_modem_LUT)[i].cmd_str[0] != 0U) &&
+          ((p_modem_ctxt->p_modem_LUT)[i].cmd_str[0] == first_char))
       {
         /* compare strings size first */
         if ((strlen((const CRC_CHAR_t *)(p_modem_ctxt->p_modem_LUT)[i].cmd_str) == element_infos->str_size))
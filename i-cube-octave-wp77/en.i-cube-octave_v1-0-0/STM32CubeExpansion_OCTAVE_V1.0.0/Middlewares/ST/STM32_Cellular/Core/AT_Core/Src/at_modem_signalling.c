@@ -1726,9 +1726,7 @@ at_action_rsp_t fRspAnalyze_CFUN(at_context_t *p_at_ctxt,
 	if (p_atp_ctxt->current_atcmd.type == ATTYPE_READ_CMD) {
 		START_PARAM_LOOP()
 				if (element_infos->param_rank == 2U) {
-					uint32_t cfun_status = ATutil_convertStringToInt(
-							&p_msg_in->buffer[element_infos->str_start_idx],
-							element_infos->str_size);
+					uint32_t cfun_status = atcm_get_param_int(p_msg_in, element_infos);
 					if (cfun_status == 1U) {
 						p_modem_ctxt->SID_ctxt.cfun_status = CS_CMI_FULL;
 					} else if (cfun_status == 4U) {
@@ -1763,9 +1761,7 @@ at_action_rsp_t fRspAnalyze_COPS(at_context_t *p_at_ctxt,
 		START_PARAM_LOOP()
 				if (element_infos->param_rank == 2U) {
 					/* mode (mandatory) */
-					uint32_t mode = ATutil_convertStringToInt(
-							&p_msg_in->buffer[element_infos->str_start_idx],
-							element_infos->str_size);
+					uint32_t mode = atcm_get_param_int(p_msg_in, element_infos);
 					switch (mode) {
 					case 0:
 						p_modem_ctxt->SID_ctxt.read_operator_infos.mode =
@@ -1794,9 +1790,7 @@ at_action_rsp_t fRspAnalyze_COPS(at_context_t *p_at_ctxt,
 							p_modem_ctxt->SID_ctxt.read_operator_infos.mode)
 				} else if (element_infos->param_rank == 3U) {
 					/* format (optional) */
-					uint32_t format = ATutil_convertStringToInt(
-							&p_msg_in->buffer[element_infos->str_start_idx],
-							element_infos->str_size);
+					uint32_t format = atcm_get_param_int(p_msg_in, element_infos);
 					p_modem_ctxt->SID_ctxt.read_operator_infos.optional_fields_presence |=
 							CS_RSF_FORMAT_PRESENT; /* bitfield */
 					switch (format) {
@@ -1839,9 +1833,7 @@ at_action_rsp_t fRspAnalyze_COPS(at_context_t *p_at_ctxt,
 					/* AccessTechno (optional) */
 					p_modem_ctxt->SID_ctxt.read_operator_infos.optional_fields_presence |=
 							CS_RSF_ACT_PRESENT; /* bitfield */
-					uint32_t AcT = ATutil_convertStringToInt(
-							&p_msg_in->buffer[element_infos->str_start_idx],
-							element_infos->str_size);
+					uint32_t AcT = atcm_get_param_int(p_msg_in, element_infos);
 					switch (AcT) {
 					case 0:
 						p_modem_ctxt->SID_ctxt.read_operator_infos.AcT =
@@ -1937,9 +1929,7 @@ at_action_rsp_t fRspAnalyze_CGATT(at_context_t *p_at_ctxt,
 	if (p_atp_ctxt->current_atcmd.type == ATTYPE_READ_CMD) {
 		START_PARAM_LOOP()
 				if (element_infos->param_rank == 2U) {
-					uint32_t attach = ATutil_convertStringToInt(
-							&p_msg_in->buffer[element_infos->str_start_idx],
-							element_infos->str_size);
+					uint32_t attach = atcm_get_param_int(p_msg_in, element_infos);
 					p_modem_ctxt->SID_ctxt.attach_status =
 							(attach == 1U) ? CS_PS_ATTACHED : CS_PS_DETACHED;
 					PRINT_DBG("attach status = %d",
@@ -1978,14 +1968,10 @@ at_action_rsp_t fRspAnalyze_CREG(at_context_t *p_at_ctxt,
 					if (element_infos->param_rank == 2U) {
 						/* param traced only */
 						PRINT_DBG("+CREG: n=%ld",
-								ATutil_convertStringToInt(
-										&p_msg_in->buffer[element_infos->str_start_idx],
-										element_infos->str_size))
+								atcm_get_param_int(p_msg_in, element_infos))
 					}
 					if (element_infos->param_rank == 3U) {
-						uint32_t stat = ATutil_convertStringToInt(
-								&p_msg_in->buffer[element_infos->str_start_idx],
-								element_infos->str_size);
+						uint32_t stat = atcm_get_param_int(p_msg_in, element_infos);
 						p_modem_ctxt->persist.cs_network_state =
 								convert_NetworkState(stat, CS_NETWORK_TYPE);
 						PRINT_DBG("+CREG: stat=%ld", stat)
@@ -2009,9 +1995,7 @@ at_action_rsp_t fRspAnalyze_CREG(at_context_t *p_at_ctxt,
 					if (element_infos->param_rank == 6U) {
 						/* param traced only */
 						PRINT_DBG("+CREG: act=%ld",
-								ATutil_convertStringToInt(
-										&p_msg_in->buffer[element_infos->str_start_idx],
-										element_infos->str_size))
+								atcm_get_param_int(p_msg_in, element_infos))
 					}
 					/* other parameters are not supported yet */
 				END_PARAM_LOOP()
@@ -2027,9 +2011,7 @@ at_action_rsp_t fRspAnalyze_CREG(at_context_t *p_at_ctxt,
 		/* this is an URC */
 		START_PARAM_LOOP()
 				if (element_infos->param_rank == 2U) {
-					uint32_t stat = ATutil_convertStringToInt(
-							&p_msg_in->buffer[element_infos->str_start_idx],
-							element_infos->str_size);
+					uint32_t stat = atcm_get_param_int(p_msg_in, element_infos);
 					p_modem_ctxt->persist.urc_avail_cs_network_registration =
 							AT_TRUE;
 					p_modem_ctxt->persist.cs_network_state =
@@ -2057,9 +2039,7 @@ at_action_rsp_t fRspAnalyze_CREG(at_context_t *p_at_ctxt,
 				if (element_infos->param_rank == 5U) {
 					/* param traced only */
 					PRINT_DBG("+CREG URC: act=%ld",
-							ATutil_convertStringToInt(
-									&p_msg_in->buffer[element_infos->str_start_idx],
-									element_infos->str_size))
+							atcm_get_param_int(p_msg_in, element_infos))
 				}END_PARAM_LOOP()
 	}
 
@@ -2090,14 +2070,10 @@ at_action_rsp_t fRspAnalyze_CGREG(at_context_t *p_at_ctxt,
 					if (element_infos->param_rank == 2U) {
 						/* param traced only */
 						PRINT_DBG("+CGREG: n=%ld",
-								ATutil_convertStringToInt(
-										&p_msg_in->buffer[element_infos->str_start_idx],
-										element_infos->str_size))
+								atcm_get_param_int(p_msg_in, element_infos))
 					}
 					if (element_infos->param_rank == 3U) {
-						uint32_t stat = ATutil_convertStringToInt(
-								&p_msg_in->buffer[element_infos->str_start_idx],
-								element_infos->str_size);
+						uint32_t stat = atcm_get_param_int(p_msg_in, element_infos);
 						p_modem_ctxt->persist.gprs_network_state =
 								convert_NetworkState(stat, GPRS_NETWORK_TYPE);
 						PRINT_DBG("+CGREG: stat=%ld", stat)
@@ -2121,30 +2097,22 @@ at_action_rsp_t fRspAnalyze_CGREG(at_context_t *p_at_ctxt,
 					if (element_infos->param_rank == 6U) {
 						/* param traced only */
 						PRINT_DBG("+CGREG: act=%ld",
-								ATutil_convertStringToInt(
-										&p_msg_in->buffer[element_infos->str_start_idx],
-										element_infos->str_size))
+								atcm_get_param_int(p_msg_in, element_infos))
 					}
 					if (element_infos->param_rank == 7U) {
 						/* param traced only */
 						PRINT_DBG("+CGREG: rac=%ld",
-								ATutil_convertStringToInt(
-										&p_msg_in->buffer[element_infos->str_start_idx],
-										element_infos->str_size))
+								atcm_get_param_int(p_msg_in, element_infos))
 					}
 					if (element_infos->param_rank == 8U) {
 						/* param traced only */
 						PRINT_DBG("+CGREG: cause_type=%ld",
-								ATutil_convertStringToInt(
-										&p_msg_in->buffer[element_infos->str_start_idx],
-										element_infos->str_size))
+								atcm_get_param_int(p_msg_in, element_infos))
 					}
 					if (element_infos->param_rank == 9U) {
 						/* param traced only */
 						PRINT_DBG("+CGREG: reject_cause=%ld",
-								ATutil_convertStringToInt(
-										&p_msg_in->buffer[element_infos->str_start_idx],
-										element_infos->str_size))
+								atcm_get_param_int(p_msg_in, element_infos))
 					}
 					if (element_infos->param_rank == 10U) {
 						/* parameter present only if n=4 or 5
@@ -2181,9 +2149,7 @@ at_action_rsp_t fRspAnalyze_CGREG(at_context_t *p_at_ctxt,
 		/* this is an URC */
 		START_PARAM_LOOP()
 				if (element_infos->param_rank == 2U) {
-					uint32_t stat = ATutil_convertStringToInt(
-							&p_msg_in->buffer[element_infos->str_start_idx],
-							element_infos->str_size);
+					uint32_t stat = atcm_get_param_int(p_msg_in, element_infos);
 					p_modem_ctxt->persist.urc_avail_gprs_network_registration =
 							AT_TRUE;
 					p_modem_ctxt->persist.gprs_network_state =
@@ -2212,9 +2178,7 @@ at_action_rsp_t fRspAnalyze_CGREG(at_context_t *p_at_ctxt,
 				if (element_infos->param_rank == 5U) {
 					/* param traced only */
 					PRINT_DBG("+CGREG URC: act=%ld",
-							ATutil_convertStringToInt(
-									&p_msg_in->buffer[element_infos->str_start_idx],
-									element_infos->str_size))
+							atcm_get_param_int(p_msg_in, element_infos))
 				}
 				if (element_infos->param_rank == 6U) {
 					/* param traced only */
@@ -2224,16 +2188,12 @@ at_action_rsp_t fRspAnalyze_CGREG(at_context_t *p_at_ctxt,
 				if (element_infos->param_rank == 7U) {
 					/* param traced only */
 					PRINT_DBG("+CGREG URC: cause_type=%ld",
-							ATutil_convertStringToInt(
-									&p_msg_in->buffer[element_infos->str_start_idx],
-									element_infos->str_size))
+							atcm_get_param_int(p_msg_in, element_infos))
 				}
 				if (element_infos->param_rank == 8U) {
 					/* param traced only */
 					PRINT_DBG("+CGREG URC: reject_cause=%ld",
-							ATutil_convertStringToInt(
-									&p_msg_in->buffer[element_infos->str_start_idx],
-									element_infos->str_size))
+							atcm_get_param_int(p_msg_in, element_infos))
 				}
 				if (element_infos->param_rank == 9U) {
 					/* active_time */
@@ -2290,15 +2250,11 @@ at_action_rsp_t fRspAnalyze_CEREG(at_context_t *p_at_ctxt,
 			START_PARAM_LOOP()
 					if (element_infos->param_rank == 2U) {
 						/* <n> parameter */
-						n_val = ATutil_convertStringToInt(
-								&p_msg_in->buffer[element_infos->str_start_idx],
-								element_infos->str_size);
+						n_val = atcm_get_param_int(p_msg_in, element_infos);
 						PRINT_DBG("+CEREG: n=%ld", n_val)
 					}
 					if (element_infos->param_rank == 3U) {
-						uint32_t stat = ATutil_convertStringToInt(
-								&p_msg_in->buffer[element_infos->str_start_idx],
-								element_infos->str_size);
+						uint32_t stat = atcm_get_param_int(p_msg_in, element_infos);
 						p_modem_ctxt->persist.eps_network_state =
 								convert_NetworkState(stat, EPS_NETWORK_TYPE);
 						PRINT_DBG("+CEREG: stat=%ld", stat)
@@ -2323,9 +2279,7 @@ at_action_rsp_t fRspAnalyze_CEREG(at_context_t *p_at_ctxt,
 					if (element_infos->param_rank == 6U) {
 						/* param traced only */
 						PRINT_INFO("+CEREG: act=%ld",
-								ATutil_convertStringToInt(
-										&p_msg_in->buffer[element_infos->str_start_idx],
-										element_infos->str_size))
+								atcm_get_param_int(p_msg_in, element_infos))
 					}
 					/* for other parameters, two cases to consider:
 					 * n=(0,1,2 or 3) or n=(4 or 5)
@@ -2334,31 +2288,23 @@ at_action_rsp_t fRspAnalyze_CEREG(at_context_t *p_at_ctxt,
 						if (element_infos->param_rank == 7U) {
 							/* param traced only */
 							PRINT_DBG("+CEREG: cause_type=%ld",
-									ATutil_convertStringToInt(
-											&p_msg_in->buffer[element_infos->str_start_idx],
-											element_infos->str_size))
+									atcm_get_param_int(p_msg_in, element_infos))
 						}
 						if (element_infos->param_rank == 8U) {
 							/* param traced only */
 							PRINT_DBG("+CEREG: reject_cause=%ld",
-									ATutil_convertStringToInt(
-											&p_msg_in->buffer[element_infos->str_start_idx],
-											element_infos->str_size))
+									atcm_get_param_int(p_msg_in, element_infos))
 						}
 					} else if ((n_val == 4U) || (n_val == 5U)) {
 						if (element_infos->param_rank == 7U) {
 							/* param traced only */
 							PRINT_DBG("+CEREG: cause_type=%ld",
-									ATutil_convertStringToInt(
-											&p_msg_in->buffer[element_infos->str_start_idx],
-											element_infos->str_size))
+									atcm_get_param_int(p_msg_in, element_infos))
 						}
 						if (element_infos->param_rank == 8U) {
 							/* param traced only */
 							PRINT_DBG("+CEREG: reject_cause=%ld",
-									ATutil_convertStringToInt(
-											&p_msg_in->buffer[element_infos->str_start_idx],
-											element_infos->str_size))
+									atcm_get_param_int(p_msg_in, element_infos))
 						}
 						if (element_infos->param_rank == 9U) {
 							/* active_time */
@@ -2411,9 +2357,7 @@ at_action_rsp_t fRspAnalyze_CEREG(at_context_t *p_at_ctxt,
 		/* this is an URC */
 		START_PARAM_LOOP()
 				if (element_infos->param_rank == 2U) {
-					uint32_t stat = ATutil_convertStringToInt(
-							&p_msg_in->buffer[element_infos->str_start_idx],
-							element_infos->str_size);
+					uint32_t stat = atcm_get_param_int(p_msg_in, element_infos);
 					p_modem_ctxt->persist.urc_avail_eps_network_registration =
 							AT_TRUE;
 					p_modem_ctxt->persist.eps_network_state =
@@ -2442,23 +2386,17 @@ at_action_rsp_t fRspAnalyze_CEREG(at_context_t *p_at_ctxt,
 				if (element_infos->param_rank == 5U) {
 					/* param traced only */
 					PRINT_DBG("+CEREG URC: act=%ld",
-							ATutil_convertStringToInt(
-									&p_msg_in->buffer[element_infos->str_start_idx],
-									element_infos->str_size))
+							atcm_get_param_int(p_msg_in, element_infos))
 				}
 				if (element_infos->param_rank == 6U) {
 					/* param traced only */
 					PRINT_DBG("+CEREG URC: cause_type=%ld",
-							ATutil_convertStringToInt(
-									&p_msg_in->buffer[element_infos->str_start_idx],
-									element_infos->str_size))
+							atcm_get_param_int(p_msg_in, element_infos))
 				}
 				if (element_infos->param_rank == 7U) {
 					/* param traced only */
 					PRINT_DBG("+CEREG URC: reject_cause=%ld",
-							ATutil_convertStringToInt(
-									&p_msg_in->buffer[element_infos->str_start_idx],
-									element_infos->str_size))
+							atcm_get_param_int(p_msg_in, element_infos))
 				}
 				if (element_infos->param_rank == 8U) {
 					/* active_time */
@@ -2744,18 +2682,14 @@ at_action_rsp_t fRspAnalyze_CSQ(at_context_t *p_at_ctxt,
 
 		START_PARAM_LOOP()
 				if (element_infos->param_rank == 2U) {
-					uint32_t rssi = ATutil_convertStringToInt(
-							&p_msg_in->buffer[element_infos->str_start_idx],
-							element_infos->str_size);
+					uint32_t rssi = atcm_get_param_int(p_msg_in, element_infos);
 					PRINT_DBG("+CSQ rssi=%ld", rssi)
 					PRINT_INFO("+CSQ rssi=%ld", rssi)
 					p_modem_ctxt->SID_ctxt.signal_quality->rssi =
 							(uint8_t) rssi;
 				}
 				if (element_infos->param_rank == 3U) {
-					uint32_t ber = ATutil_convertStringToInt(
-							&p_msg_in->buffer[element_infos->str_start_idx],
-							element_infos->str_size);
+					uint32_t ber = atcm_get_param_int(p_msg_in, element_infos);
 					PRINT_DBG("+CSQ ber=%ld", ber)
 					PRINT_INFO("+CSQ ber=%ld", ber)
 					p_modem_ctxt->SID_ctxt.signal_quality->ber = (uint8_t) ber;
@@ -2792,9 +2726,7 @@ at_action_rsp_t fRspAnalyze_CGPADDR(at_context_t *p_at_ctxt,
 		START_PARAM_LOOP()
 				PRINT_DBG("+CGPADDR param_rank = %d", element_infos->param_rank)
 				if (element_infos->param_rank == 2U) {
-					uint32_t modem_cid = ATutil_convertStringToInt(
-							&p_msg_in->buffer[element_infos->str_start_idx],
-							element_infos->str_size);
+					uint32_t modem_cid = atcm_get_param_int(p_msg_in, element_infos);
 					PRINT_DBG("+CGPADDR cid=%ld", modem_cid)
 					p_modem_ctxt->CMD_ctxt.modem_cid = modem_cid;
 				} else if ((element_infos->param_rank == 3U)
@@ -2873,9 +2805,7 @@ at_action_rsp_t fRspAnalyze_CPSMS(at_context_t *p_at_ctxt,
 				if (element_infos->param_rank == 2U) {
 					/* mode */
 					PRINT_INFO("+CPSMS: mode= %ld",
-							ATutil_convertStringToInt(
-									&p_msg_in->buffer[element_infos->str_start_idx],
-									element_infos->str_size))
+							atcm_get_param_int(p_msg_in, element_infos))
 				} else if (element_infos->param_rank == 3U) {
 					/* req_periodic_rau */
 					PRINT_INFO("+CPSMS: req_periodic_rau= 0x%lx",
@@ -2933,9 +2863,7 @@ at_action_rsp_t fRspAnalyze_CEDRXS(at_context_t *p_at_ctxt,
 					if (element_infos->param_rank == 2U) {
 						/* act_type */
 						PRINT_DBG("+CEDRXS: act_type= %ld",
-								ATutil_convertStringToInt(
-										&p_msg_in->buffer[element_infos->str_start_idx],
-										element_infos->str_size))
+								atcm_get_param_int(p_msg_in, element_infos))
 					} else if (element_infos->param_rank == 3U) {
 						/* req_edrx_value */
 						PRINT_INFO("+CEDRXS: req_edrx_value= 0x%lx",
@@ -2968,9 +2896,7 @@ at_action_rsp_t fRspAnalyze_CEDRXP(at_context_t *p_at_ctxt,
 			if (element_infos->param_rank == 2U) {
 				/* act_type */
 				PRINT_DBG("+CEDRXP URC: act_type= %ld",
-						ATutil_convertStringToInt(
-								&p_msg_in->buffer[element_infos->str_start_idx],
-								element_infos->str_size))
+						atcm_get_param_int(p_msg_in, element_infos))
 			} else if (element_infos->param_rank == 3U) {
 				/* req_edrx_value */
 				PRINT_INFO("+CEDRXP URC: req_edrx_value= 0x%lx",
@@ -3015,9 +2941,7 @@ at_action_rsp_t fRspAnalyze_CEDRXRDP(at_context_t *p_at_ctxt,
 			if (element_infos->param_rank == 2U) {
 				/* act_type */
 				PRINT_DBG("+CEDRXRDP: act_type= %ld",
-						ATutil_convertStringToInt(
-								&p_msg_in->buffer[element_infos->str_start_idx],
-								element_infos->str_size))
+						atcm_get_param_int(p_msg_in, element_infos))
 			} else if (element_infos->param_rank == 3U) {
 				/* req_edrx_value */
 				PRINT_INFO("+CEDRXRDP: req_edrx_value= 0x%lx",
@@ -3058,9 +2982,7 @@ at_action_rsp_t fRspAnalyze_CSIM(at_context_t *p_at_ctxt,
 	if (p_atp_ctxt->current_atcmd.type == ATTYPE_WRITE_CMD) {
 		START_PARAM_LOOP()
 				if (element_infos->param_rank == 2U) {
-					uint32_t rsp_length = ATutil_convertStringToInt(
-							&p_msg_in->buffer[element_infos->str_start_idx],
-							element_infos->str_size);
+					uint32_t rsp_length = atcm_get_param_int(p_msg_in, element_infos);
 
 					p_modem_ctxt->SID_ctxt.sim_generic_access.bytes_received =
 							rsp_length;
@@ -3144,9 +3066,7 @@ at_action_rsp_t fRspAnalyze_IPR(at_context_t *p_at_ctxt,
 				if (element_infos->param_rank == 2U) {
 					/* param trace only */
 					PRINT_INFO("+IPR baud rate=%ld",
-							ATutil_convertStringToInt(
-									&p_msg_in->buffer[element_infos->str_start_idx],
-									element_infos->str_size))
+							atcm_get_param_int(p_msg_in, element_infos))
 				}END_PARAM_LOOP()
 	}
 
@@ -3175,9 +3095,7 @@ at_action_rsp_t fRspAnalyze_IFC(at_context_t *p_at_ctxt,
 
 				if (element_infos->param_rank == 2U) {
 					/* dce_by_dte flow control: 0:None 2= RTS flow control */
-					uint32_t rts_fc = ATutil_convertStringToInt(
-							&p_msg_in->buffer[element_infos->str_start_idx],
-							element_infos->str_size);
+					uint32_t rts_fc = atcm_get_param_int(p_msg_in, element_infos);
 					PRINT_DBG("+IFC: RTS flow control=%ld", rts_fc)
 					if (rts_fc == 2U) {
 						p_modem_ctxt->persist.flowCtrl_RTS = 2U;
@@ -3188,9 +3106,7 @@ at_action_rsp_t fRspAnalyze_IFC(at_context_t *p_at_ctxt,
 				}
 				if (element_infos->param_rank == 3U) {
 					/* dte_by_dce flow control: 0:None 2= CTS flow control */
-					uint32_t cts_fc = ATutil_convertStringToInt(
-							&p_msg_in->buffer[element_infos->str_start_idx],
-							element_infos->str_size);
+					uint32_t cts_fc = atcm_get_param_int(p_msg_in, element_infos);
 					PRINT_DBG("+IFC: CTS flow control=%ld", cts_fc)
 					if (cts_fc == 2U) {
 						p_modem_ctxt->persist.flowCtrl_CTS = 2U;
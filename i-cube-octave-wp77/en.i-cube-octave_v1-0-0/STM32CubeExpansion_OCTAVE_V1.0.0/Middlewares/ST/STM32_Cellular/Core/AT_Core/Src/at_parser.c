@@ -338,8 +338,12 @@ at_action_rsp_t ATParser_parse_rsp(at_context_t *p_at_ctxt, IPC_RxMessage_t *p_m
 {
   at_action_rsp_t cmd_retval, param_retval, final_retval, clean_retval;
   at_endmsg_t msg_end;
+  /* fields of the line: on the stack, so that each parsing has its own */
+  at_line_tokens_t line_tokens = { .nb_fields = 0U };
   at_element_info_t element_infos = { .current_parse_idx = 0, .cmd_id_received = CMD_AT_INVALID, .param_rank = 0U,
-                                      .str_start_idx = 0, .str_end_idx = 0, .str_size = 0
+                                      .str_start_idx = 0, .str_end_idx = 0, .str_size = 0,
+                                      .param_type = ATPARAM_TYPE_UNKNOWN, .param_value = 0U,
+                                      .p_tokens = &line_tokens
                                     };
   uint16_t data_mode;
 
@@ -22,6 +22,7 @@
 #include <stdbool.h>
 #include "at_util.h"
 #include "plf_config.h"
+#include "cellular_runtime_standard.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private defines -----------------------------------------------------------*/
@@ -60,23 +61,15 @@ uint32_t ATutil_convertStringToInt(const uint8_t *p_string, uint16_t size) {
 	{
 		conv_nbr = ATutil_convertHexaStringToInt32(p_string, size);
 	} else {
-		uint16_t idx;
-		uint16_t nb_digit_ignored = 0U;
-		uint16_t loop = 0U;
-
-		/* decimal value */
-		for (idx = 0U; idx < size; idx++) {
-			/* consider only the numbers */
-			if ((p_string[idx] >= 48U) && (p_string[idx] <= 57U)) {
-				loop++;
-				conv_nbr = conv_nbr
-						+ (((uint32_t) p_string[idx] - 48U)
-								* ATutil_ipow(10U,
-										(size - loop - nb_digit_ignored)));
-			} else {
-				nb_digit_ignored++;
-			}
+		uint16_t idx = 0U;
+
+		/* skip leading characters which are not numbers (spaces, sign, quote...) */
+		while ((idx < size) && ((p_string[idx] < 48U) || (p_string[idx] > 57U))) {
+			idx++;
 		}
+
+		/* decimal value (saturated to 0xFFFFFFFF if too big) */
+		(void) crs_strtou32(&p_string[idx], (uint32_t) size - (uint32_t) idx, 10U, &conv_nbr, NULL);
 	}
 
 	return (conv_nbr);
@@ -84,9 +77,7 @@ uint32_t ATutil_convertStringToInt(const uint8_t *p_string, uint16_t size) {
 
 uint32_t ATutil_convertHexaStringToInt32(const uint8_t *p_string, uint16_t size) {
 	uint32_t conv_nbr = 0U; /* returned value = converted numder (0 if an error occurs) */
-	uint16_t idx;
 	uint16_t nb_digit_ignored;
-	uint16_t loop = 0U;
 	uint16_t str_size_to_convert;
 
 	/* This function assumes that the string value is an hexadecimal value with or without Ox prefix
@@ -112,33 +103,8 @@ uint32_t ATutil_convertHexaStringToInt32(const uint8_t *p_string, uint16_t size)
 
 	/* check maximum string size */
 	if (str_size_to_convert <= MAX_32BITS_STRING_SIZE) {
-		/* convert string to hexa value */
-		for (idx = nb_digit_ignored; idx < size; idx++) {
-			if ((p_string[idx] >= 48U) && (p_string[idx] <= 57U)) {
-				/* 0 to 9 */
-				loop++;
-				conv_nbr = conv_nbr
-						+ (((uint32_t) p_string[idx] - 48U)
-								* ATutil_ipow(16U,
-										(size - loop - nb_digit_ignored)));
-			} else if ((p_string[idx] >= 97U) && (p_string[idx] <= 102U)) {
-				/* a to f */
-				loop++;
-				conv_nbr = conv_nbr
-						+ (((uint32_t) p_string[idx] - 97U + 10U)
-								* ATutil_ipow(16U,
-										(size - loop - nb_digit_ignored)));
-			} else if ((p_string[idx] >= 65U) && (p_string[idx] <= 70U)) {
-				/* A to F */
-				loop++;
-				conv_nbr = conv_nbr
-						+ (((uint32_t) p_string[idx] - 65U + 10U)
-								* ATutil_ipow(16U,
-										(size - loop - nb_digit_ignored)));
-			} else {
-				nb_digit_ignored++;
-			}
-		}
+		/* convert string to hexa value (max size checked: no overflow possible) */
+		(void) crs_strtou32(&p_string[nb_digit_ignored], (uint32_t) str_size_to_convert, 16U, &conv_nbr, NULL);
 	}
 
 	return (conv_nbr);
@@ -210,10 +176,9 @@ uint32_t ATutil_convertBinStringToInt32(const uint8_t *p_string, uint16_t size)
 
 	for (uint16_t i = 0; i < size; i++) {
 		/* convert ASCII character to its value (0x31 for 1, 0x30 for 0) */
-		uint32_t bit = (p_string[size - i - 1U] == 0x31U) ? 1U : 0U;
-		/* bit weight */
-		uint32_t weight = ATutil_ipow(2U, i);
-		conv_nbr += bit * weight;
+		uint32_t bit = (p_string[i] == 0x31U) ? 1U : 0U;
+		/* previous bits have a higher weight */
+		conv_nbr = (conv_nbr << 1) | bit;
 	}
 
 	return (conv_nbr);
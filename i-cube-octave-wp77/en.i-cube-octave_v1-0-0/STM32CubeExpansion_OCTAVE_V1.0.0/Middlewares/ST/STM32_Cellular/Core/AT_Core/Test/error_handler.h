@@ -0,0 +1,58 @@
+/**
+  ******************************************************************************
+  * @file    error_handler.h
+  * @author  MCD Application Team
+  * @brief   Error handler used by the host test of the AT commands latency
+  *          statistics (aborts the test)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef ERROR_HANDLER_H
+#define ERROR_HANDLER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  DBG_CHAN_ATCMD = 0,
+} dbg_channels_t;
+
+typedef enum
+{
+  ERROR_FATAL = 0,
+} error_gravity_t;
+
+/* Exported functions ------------------------------------------------------- */
+static inline void ERROR_Handler(dbg_channels_t chan, int32_t errorId, error_gravity_t gravity)
+{
+  (void)gravity;
+  (void)fprintf(stderr, "ERROR_Handler chan:%d id:%d\n", (int)chan, (int)errorId);
+  abort();
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ERROR_HANDLER_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
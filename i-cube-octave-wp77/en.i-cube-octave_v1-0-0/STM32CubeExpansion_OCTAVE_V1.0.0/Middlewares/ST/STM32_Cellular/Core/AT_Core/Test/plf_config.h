@@ -0,0 +1,60 @@
+/**
+  ******************************************************************************
+  * @file    plf_config.h
+  * @author  MCD Application Team
+  * @brief   Platform configuration used by the host test of the AT commands latency
+  *          statistics (replaces the project plf_config.h)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef PLF_CONFIG_H
+#define PLF_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define ATCORE_LATENCY_STATS          (1U)
+#define ATCORE_ADAPTIVE_TIMEOUT       (1U)
+#define ATCORE_ADAPTIVE_TIMEOUT_FLOOR (1000U) /* same default as plf_features.h */
+#define USE_CMD_CONSOLE               (0)
+#define USE_PRINTF                    (1U)
+
+/* Exported types ------------------------------------------------------------*/
+/* HAL types used by the AT Core and IPC headers */
+typedef struct
+{
+  uint32_t dummy;
+} UART_HandleTypeDef;
+
+typedef enum
+{
+  GPIO_PIN_RESET = 0,
+  GPIO_PIN_SET
+} GPIO_PinState;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLF_CONFIG_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
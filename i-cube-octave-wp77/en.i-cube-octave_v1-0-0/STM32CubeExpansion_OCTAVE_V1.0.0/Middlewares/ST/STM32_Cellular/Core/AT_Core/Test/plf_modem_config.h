@@ -0,0 +1,39 @@
+/**
+  ******************************************************************************
+  * @file    plf_modem_config.h
+  * @author  MCD Application Team
+  * @brief   Modem configuration used by the host test of the AT commands latency
+  *          statistics (replaces the modem plf_modem_config.h)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef PLF_MODEM_CONFIG_H
+#define PLF_MODEM_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* small LUT, so that the test fills the statistics table */
+#define CONFIG_MODEM_ATCMD_NB  ((uint32_t)4U)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLF_MODEM_CONFIG_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
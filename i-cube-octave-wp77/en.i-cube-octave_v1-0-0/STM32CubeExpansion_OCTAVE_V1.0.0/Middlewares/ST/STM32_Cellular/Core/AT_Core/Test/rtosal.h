@@ -0,0 +1,79 @@
+/**
+  ******************************************************************************
+  * @file    rtosal.h
+  * @author  MCD Application Team
+  * @brief   RTOS abstraction used by the host test of the AT commands latency
+  *          statistics: mutexes are mapped on POSIX threads
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef RTOSAL_H
+#define RTOSAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define RTOSAL_WAIT_FOREVER  (0xFFFFFFFFU)
+
+/* Exported types ------------------------------------------------------------*/
+typedef uint8_t          rtosal_char_t;
+typedef int32_t          rtosalStatus;
+typedef pthread_mutex_t *osMutexId;
+/* types used by the AT Core headers only */
+typedef void            *osSemaphoreId;
+typedef void            *osMessageQId;
+typedef void            *osThreadId;
+typedef int32_t          osPriority;
+
+#define osOK             ((rtosalStatus)0)
+#define osErrorTimeout   ((rtosalStatus)-2)
+
+/* Exported functions ------------------------------------------------------- */
+static inline osMutexId rtosalMutexNew(const rtosal_char_t *p_name)
+{
+  osMutexId mutex_id = (osMutexId)malloc(sizeof(pthread_mutex_t));
+  (void)p_name;
+  if (mutex_id != NULL)
+  {
+    (void)pthread_mutex_init(mutex_id, NULL);
+  }
+  return mutex_id;
+}
+
+static inline rtosalStatus rtosalMutexAcquire(osMutexId mutex_id, uint32_t timeout)
+{
+  (void)timeout;
+  return (pthread_mutex_lock(mutex_id) == 0) ? osOK : osErrorTimeout;
+}
+
+static inline rtosalStatus rtosalMutexRelease(osMutexId mutex_id)
+{
+  return (pthread_mutex_unlock(mutex_id) == 0) ? osOK : osErrorTimeout;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RTOSAL_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,224 @@
+/**
+ ******************************************************************************
+ * @file    test_at_latency.c
+ * @author  MCD Application Team
+ * @brief   Host test of the AT commands latency statistics and adaptive timeout
+ *          (at_latency.c)
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+ * All rights reserved.</center></h2>
+ *
+ * This software component is licensed by ST under Ultimate Liberty license
+ * SLA0044, the "License"; You may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at:
+ *                             www.st.com/SLA0044
+ *
+ ******************************************************************************
+ *
+ * This file is not part of the target build. From this directory, build and run it
+ * on the host:
+ *
+ *   gcc -O2 -Wall -I. -I../Inc -I../../Ipc/Inc -I../../Runtime_Library/Inc \
+ *       -I../../../../../../Projects/B-L4S5I-IOT01A/Demonstrations/Cellular/STM32_Cellular/Config \
+ *       test_at_latency.c ../Src/at_latency.c -lpthread -o test_atlat
+ *   ./test_atlat
+ *
+ * The headers of this directory replace the target ones: the modem LUT has
+ * CONFIG_MODEM_ATCMD_NB (4) commands, so the statistics table has 6 entries and the
+ * test fills it. Checked:
+ *   - LUT timeout is applied until ATLAT_MIN_SAMPLES answers are received,
+ *     and again after a command timeout,
+ *   - learned timeout is above the latencies measured, and bounded by
+ *     ATCORE_ADAPTIVE_TIMEOUT_FLOOR and by the LUT timeout,
+ *   - learned timeout follows a latency increase (histogram ageing),
+ *   - commands beyond the table size are not tracked (LUT timeout, no heap used),
+ *   - reset clears the learned timeouts.
+ * The process exit code is the number of failures (0: all tests passed).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "at_latency.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_TABLE_SIZE  (4U + 2U)  /* CONFIG_MODEM_ATCMD_NB + ATLAT_EXTRA_CMD_NB */
+#define TEST_MIN_SAMPLES (16U)      /* ATLAT_MIN_SAMPLES */
+#define TEST_LUT_TIMEOUT (180000U)  /* long LUT timeout (as +COPS) */
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t test_nb = 0U;
+static uint32_t test_fail_nb = 0U;
+
+/* Private function prototypes -----------------------------------------------*/
+static void test_check(bool ok, const char *p_label, uint32_t value);
+static void test_record_n(uint32_t cmd_id, uint32_t latency, uint32_t nb);
+static void test_min_samples(void);
+static void test_bounds(void);
+static void test_timeout_reset(void);
+static void test_ageing(void);
+static void test_table_full(void);
+static void test_reset(void);
+
+/* Private function Definition -----------------------------------------------*/
+static void test_check(bool ok, const char *p_label, uint32_t value)
+{
+  test_nb++;
+  if (ok == false)
+  {
+    test_fail_nb++;
+    printf("FAIL %s (%u)\n", p_label, value);
+  }
+}
+
+static void test_record_n(uint32_t cmd_id, uint32_t latency, uint32_t nb)
+{
+  for (uint32_t i = 0U; i < nb; i++)
+  {
+    (void)ATlatency_get_timeout(cmd_id, NULL, TEST_LUT_TIMEOUT);
+    ATlatency_record(cmd_id, latency, AT_FALSE);
+  }
+}
+
+/**
+ * @brief  LUT timeout until enough answers are received
+ */
+static void test_min_samples(void)
+{
+  uint32_t timeout;
+
+  ATlatency_reset();
+  timeout = ATlatency_get_timeout(1U, NULL, TEST_LUT_TIMEOUT);
+  test_check(timeout == TEST_LUT_TIMEOUT, "no sample: LUT timeout", timeout);
+
+  test_record_n(1U, 200U, TEST_MIN_SAMPLES - 1U);
+  timeout = ATlatency_get_timeout(1U, NULL, TEST_LUT_TIMEOUT);
+  test_check(timeout == TEST_LUT_TIMEOUT, "not enough samples: LUT timeout", timeout);
+
+  test_record_n(1U, 200U, 1U);
+  timeout = ATlatency_get_timeout(1U, NULL, TEST_LUT_TIMEOUT);
+  test_check(timeout < TEST_LUT_TIMEOUT, "enough samples: learned timeout", timeout);
+}
+
+/**
+ * @brief  learned timeout is above the latencies, bounded by floor and LUT timeout
+ */
+static void test_bounds(void)
+{
+  static const uint32_t latencies[] = { 5U, 90U, 700U, 2000U, 9000U, 40000U };
+  uint32_t timeout;
+
+  for (uint32_t i = 0U; i < (sizeof(latencies) / sizeof(latencies[0])); i++)
+  {
+    ATlatency_reset();
+    /* latency with a +/- 25% jitter */
+    for (uint32_t n = 0U; n < (4U * TEST_MIN_SAMPLES); n++)
+    {
+      uint32_t latency = latencies[i] - (latencies[i] / 4U) + ((latencies[i] / 2U) * (n % 5U)) / 4U;
+      (void)ATlatency_get_timeout(2U, NULL, TEST_LUT_TIMEOUT);
+      ATlatency_record(2U, latency, AT_FALSE);
+    }
+    timeout = ATlatency_get_timeout(2U, NULL, TEST_LUT_TIMEOUT);
+    test_check(timeout >= ATCORE_ADAPTIVE_TIMEOUT_FLOOR, "floor", timeout);
+    test_check(timeout <= TEST_LUT_TIMEOUT, "LUT ceiling", timeout);
+    test_check(timeout >= (latencies[i] + (latencies[i] / 4U)), "above max latency", timeout);
+
+    /* LUT timeout shorter than the latencies: LUT timeout is kept */
+    timeout = ATlatency_get_timeout(2U, NULL, latencies[i] / 2U);
+    test_check(timeout == (latencies[i] / 2U), "short LUT timeout", timeout);
+  }
+}
+
+/**
+ * @brief  LUT timeout applied again after a command timeout
+ */
+static void test_timeout_reset(void)
+{
+  uint32_t timeout;
+
+  ATlatency_reset();
+  test_record_n(3U, 100U, TEST_MIN_SAMPLES);
+  timeout = ATlatency_get_timeout(3U, NULL, TEST_LUT_TIMEOUT);
+  test_check(timeout == ATCORE_ADAPTIVE_TIMEOUT_FLOOR, "short latency: floor", timeout);
+
+  ATlatency_record(3U, timeout, AT_TRUE);
+  timeout = ATlatency_get_timeout(3U, NULL, TEST_LUT_TIMEOUT);
+  test_check(timeout == TEST_LUT_TIMEOUT, "after timeout: LUT timeout", timeout);
+
+  test_record_n(3U, 100U, TEST_MIN_SAMPLES);
+  timeout = ATlatency_get_timeout(3U, NULL, TEST_LUT_TIMEOUT);
+  test_check(timeout == ATCORE_ADAPTIVE_TIMEOUT_FLOOR, "relearned", timeout);
+}
+
+/**
+ * @brief  learned timeout follows a latency increase
+ */
+static void test_ageing(void)
+{
+  uint32_t timeout;
+
+  ATlatency_reset();
+  test_record_n(4U, 300U, 1000U);
+  test_record_n(4U, 6000U, 300U);
+  timeout = ATlatency_get_timeout(4U, NULL, TEST_LUT_TIMEOUT);
+  test_check(timeout >= 6000U, "latency increase", timeout);
+}
+
+/**
+ * @brief  commands beyond the table size are not tracked
+ */
+static void test_table_full(void)
+{
+  uint32_t timeout;
+
+  ATlatency_reset();
+  for (uint32_t cmd_id = 10U; cmd_id < (10U + TEST_TABLE_SIZE + 2U); cmd_id++)
+  {
+    test_record_n(cmd_id, 100U, TEST_MIN_SAMPLES);
+    timeout = ATlatency_get_timeout(cmd_id, NULL, TEST_LUT_TIMEOUT);
+    if (cmd_id < (10U + TEST_TABLE_SIZE))
+    {
+      test_check(timeout == ATCORE_ADAPTIVE_TIMEOUT_FLOOR, "tracked command", cmd_id);
+    }
+    else
+    {
+      test_check(timeout == TEST_LUT_TIMEOUT, "untracked command", cmd_id);
+    }
+  }
+  ATlatency_display();
+}
+
+/**
+ * @brief  reset clears the learned timeouts
+ */
+static void test_reset(void)
+{
+  uint32_t timeout;
+
+  test_record_n(5U, 100U, TEST_MIN_SAMPLES);
+  ATlatency_reset();
+  timeout = ATlatency_get_timeout(5U, NULL, TEST_LUT_TIMEOUT);
+  test_check(timeout == TEST_LUT_TIMEOUT, "reset", timeout);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(void)
+{
+  ATlatency_init();
+
+  test_min_samples();
+  test_bounds();
+  test_timeout_reset();
+  test_ageing();
+  test_table_full();
+  test_reset();
+  printf("AT latency: %u tests, %u failures\n", test_nb, test_fail_nb);
+
+  return (test_fail_nb > 255U) ? 255 : (int)test_fail_nb;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,105 @@
+/**
+  ******************************************************************************
+  * @file    cellular_service_activity.h
+  * @author  MCD Application Team
+  * @brief   Header for cellular_service_activity.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CELLULAR_SERVICE_ACTIVITY_H
+#define CELLULAR_SERVICE_ACTIVITY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "plf_config.h"
+
+#if (USE_LOW_POWER == 1)
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+/* Origins of activity tokens: low power is not entered while a token is held */
+typedef enum
+{
+  CSA_ACTIVITY_SOCKET           = 0,     /*!< socket transaction in progress                  */
+  CSA_ACTIVITY_SOCKET_RX        = 1,     /*!< socket data received and not yet read           */
+  CSA_ACTIVITY_MDM              = 2,     /*!< modem (ORP) transaction in progress             */
+  CSA_ACTIVITY_MDM_RX           = 3,     /*!< modem (ORP) message received and not yet read   */
+  CSA_ACTIVITY_NB               = 4      /*!< number of activity origins                      */
+} CSA_Activity_t;
+
+/* External variables --------------------------------------------------------*/
+/* Exported macros -----------------------------------------------------------*/
+
+/* Exported functions ------------------------------------------------------- */
+
+/**
+  * @brief  initializes the activity tokens (no token held)
+  * @param  -
+  * @retval -
+  */
+void CSA_Init(void);
+
+/**
+  * @brief  takes an activity token: low power is not entered until it is released
+  * @note   transaction tokens (socket, mdm) also leave low power if needed
+  * @param  activity - origin of the activity
+  * @retval -
+  */
+void CSA_Acquire(CSA_Activity_t activity);
+
+/**
+  * @brief  releases an activity token
+  * @note   when the last token is released, low power is requested after lp_inactivity_timeout
+  * @param  activity  - origin of the activity
+  * @param  immediate - true: request low power without waiting if no token is held
+  * @retval -
+  */
+void CSA_Release(CSA_Activity_t activity, bool immediate);
+
+/**
+  * @brief  arms the low power request if no activity token is held (e.g. when network comes up)
+  * @param  -
+  * @retval -
+  */
+void CSA_Check(void);
+
+/**
+  * @brief  checks if an activity token is held
+  * @param  -
+  * @retval bool - true if nothing is in progress
+  */
+bool CSA_IsIdle(void);
+
+/**
+  * @brief  gets the number of tokens held by an origin
+  * @param  activity - origin of the activity
+  * @retval uint16_t - tokens held
+  */
+uint16_t CSA_GetCount(CSA_Activity_t activity);
+
+#endif /* (USE_LOW_POWER == 1) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CELLULAR_SERVICE_ACTIVITY_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -448,6 +448,38 @@ typedef struct
 } dc_cellular_power_status_t;
 #endif  /* (USE_LOW_POWER == 1) */
 
+#if (CST_FAST_REATTACH == 1U)
+/**
+  * @brief  Structure definition of DC_CELLULAR_ATTACH_INFO entry.
+  * This DC entry contains the network attachment metrics.
+  * An attachment starts with the first registration request or with a network loss
+  * and ends when the modem is registered.
+  */
+typedef struct
+{
+  dc_service_rt_header_t header;     /*!< Internal use */
+  /** @brief rt_state: entry state.
+    *!<
+    * - DC_SERVICE_OFF          : no attachment done yet,
+    *                             only fail_nb, retry_delay and network fields are significant
+    * - DC_SERVICE_ON           : at least one attachment done, all fields are significant
+    * - Other state values not used.
+    */
+  dc_service_rt_state_t rt_state;
+
+  uint32_t attach_nb;           /*!< number of attachments done                              */
+  uint32_t fast_attach_nb;      /*!< number of attachments done on the last network registered */
+  uint32_t fail_nb;             /*!< number of registration attempts failed                  */
+  uint32_t last_time;           /*!< duration of last attachment, in ms                      */
+  uint32_t min_time;            /*!< minimum attachment duration, in ms                      */
+  uint32_t max_time;            /*!< maximum attachment duration, in ms                      */
+  uint32_t avg_time;            /*!< average attachment duration, in ms                      */
+  uint32_t retry_delay;         /*!< delay before next registration attempt, in ms (0: none) */
+  uint8_t  mno_name[CA_MNO_NAME_SIZE_MAX]; /*!< last network registered, used first to attach again */
+  ca_access_techno_t access_techno;        /*!< access techno of last network registered          */
+} dc_cellular_attach_info_t;
+#endif  /* (CST_FAST_REATTACH == 1U) */
+
 
 /* ===================================================== */
 /* Structures definition of Data Cache entries - END     */
@@ -555,6 +587,14 @@ extern dc_com_res_id_t    DC_CELLULAR_POWER_CONFIG;    /*<! see dc_cellular_powe
 extern dc_com_res_id_t    DC_CELLULAR_POWER_STATUS;    /*<! see dc_cellular_power_status_t */
 #endif /* USE_LOW_POWER == 1 */
 
+#if (CST_FAST_REATTACH == 1U)
+/**
+  * @brief  contains network attachment metrics (number, duration, failures, last network registered).
+  *         This Data Cache Entry is associated with dc_cellular_attach_info_t data structure
+  */
+extern dc_com_res_id_t    DC_CELLULAR_ATTACH_INFO;    /*<! see dc_cellular_attach_info_t */
+#endif /* CST_FAST_REATTACH == 1U */
+
 /* =============================================== */
 /* List of Cellular Data Cache entries - END       */
 /* =============================================== */
@@ -0,0 +1,108 @@
+/**
+  ******************************************************************************
+  * @file    cellular_service_evtlog.h
+  * @author  MCD Application Team
+  * @brief   Header for cellular_service_evtlog.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CELLULAR_SERVICE_EVTLOG_H
+#define CELLULAR_SERVICE_EVTLOG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include "plf_config.h"
+
+#if (CST_EVENT_LOG == 1U)
+
+/* Exported constants --------------------------------------------------------*/
+/* Record types
+ * A record is 8 bytes: tick (ms, 32 bits), type (8 bits), id (8 bits), value (16 bits)
+ * Warning : to be consistent with Scripts/cst_evtlog_decode.py
+ */
+typedef uint8_t CSE_type_t;
+#define CSE_TYPE_BOOT         ((CSE_type_t)0x01U) /* log (re)started:  id = 0                 value = 0              */
+#define CSE_TYPE_STATE        ((CSE_type_t)0x02U) /* automaton state:  id = new state         value = previous state */
+#define CSE_TYPE_EVENT        ((CSE_type_t)0x03U) /* automaton event:  id = event             value = current state  */
+#define CSE_TYPE_MODEM_STATE  ((CSE_type_t)0x04U) /* modem state:      id = ca_modem_state_t  value = 0              */
+#define CSE_TYPE_AT_START     ((CSE_type_t)0x05U) /* AT request start: id = 0                 value = SID            */
+#define CSE_TYPE_AT_END       ((CSE_type_t)0x06U) /* AT request end:   id = at_status_t       value = SID            */
+#define CSE_TYPE_AT_CMD       ((CSE_type_t)0x07U) /* AT command sent:  id = 0                 value = AT command ID  */
+#define CSE_TYPE_DATA         ((CSE_type_t)0x08U) /* first data after data ready:
+                                                     id = CSE_DATA_SEND or CSE_DATA_RECEIVE   value = length         */
+
+#define CSE_DATA_SEND         (0U)
+#define CSE_DATA_RECEIVE      (1U)
+
+/* Exported types ------------------------------------------------------------*/
+/* External variables --------------------------------------------------------*/
+/* Exported macros -----------------------------------------------------------*/
+
+/* Exported functions ------------------------------------------------------- */
+
+/**
+  * @brief  initializes the event log and registers the AT Core trace callback
+  * @note   must be called before any other CSE function
+  * @param  -
+  * @retval -
+  */
+void CSE_Init(void);
+
+/**
+  * @brief  adds a record to the event log (oldest record is overwritten when the log is full)
+  * @note   may be called from any task
+  * @param  type   - record type
+  * @param  id     - record id (see record types)
+  * @param  value  - record value (see record types)
+  * @retval -
+  */
+void CSE_Record(CSE_type_t type, uint8_t id, uint16_t value);
+
+/**
+  * @brief  notifies data transfer: only the first data after a modem data ready is recorded
+  * @param  direction - CSE_DATA_SEND or CSE_DATA_RECEIVE
+  * @param  len       - data length
+  * @retval -
+  */
+void CSE_DataNotify(uint8_t direction, uint32_t len);
+
+/**
+  * @brief  clears the event log
+  * @param  -
+  * @retval -
+  */
+void CSE_Reset(void);
+
+/**
+  * @brief  dumps the event log on the console, oldest record first
+  * @note   output is decoded by Scripts/cst_evtlog_decode.py
+  * @param  -
+  * @retval -
+  */
+void CSE_Dump(void);
+
+#endif /* (CST_EVENT_LOG == 1U) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CELLULAR_SERVICE_EVTLOG_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
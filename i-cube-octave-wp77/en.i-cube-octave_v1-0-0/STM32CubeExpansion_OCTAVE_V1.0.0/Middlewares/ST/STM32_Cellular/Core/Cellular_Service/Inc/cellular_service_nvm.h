@@ -0,0 +1,93 @@
+/**
+  ******************************************************************************
+  * @file    cellular_service_nvm.h
+  * @author  MCD Application Team
+  * @brief   Header for cellular_service_nvm.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CELLULAR_SERVICE_NVM_H
+#define CELLULAR_SERVICE_NVM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include "plf_config.h"
+#include "cellular_service_datacache.h"
+
+#if (CST_MODEM_CONFIG_CACHE == 1U)
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+/* External variables --------------------------------------------------------*/
+/* Exported macros -----------------------------------------------------------*/
+
+/* Exported functions ------------------------------------------------------- */
+
+/**
+  * @brief  checks if modem configuration stored in flash matches the current configuration
+  * @note   the configuration fingerprint is kept to be used by CSN_ConfigStore()
+  * @param  p_params    - current cellular parameters
+  * @param  slot_index  - index of the active SIM slot
+  * @param  p_imsi      - IMSI stored in flash (set only on match, CA_IMSI_SIZE_MAX bytes)
+  * @retval bool        - true: configuration already applied in modem, false: full init needed
+  */
+bool CSN_ConfigCheck(const dc_cellular_params_t *p_params, uint8_t slot_index, uint8_t *p_imsi);
+
+/**
+  * @brief  gets modem identity stored in flash
+  * @note   available only if CSN_ConfigCheck() has returned true
+  * @param  p_info  - cellular info updated with stored identity (imei, manufacturer, model...)
+  * @retval bool    - true: identity updated, false: identity must be requested to modem
+  */
+bool CSN_IdentityGet(dc_cellular_info_t *p_info);
+
+/**
+  * @brief  stores applied modem configuration in flash (flash is written only if content has changed)
+  * @param  p_info  - cellular info containing modem identity
+  * @param  p_imsi  - IMSI of the SIM in use
+  * @retval bool    - false: SIM has changed since the configuration has been stored,
+  *                   cache is invalidated and a full modem init is needed
+  */
+bool CSN_ConfigStore(const dc_cellular_info_t *p_info, const uint8_t *p_imsi);
+
+/**
+  * @brief  invalidates modem configuration stored in flash: next boot will do a full modem init
+  * @param  -
+  * @retval -
+  */
+void CSN_ConfigInvalidate(void);
+
+/**
+  * @brief  handles a flash ECC double error NMI
+  * @note   to call from NMI_Handler
+  * @param  -
+  * @retval bool - true: error raised by a record read, the record is discarded and the NMI is cleared
+  *                false: error not related to the modem configuration cache
+  */
+bool CSN_FlashEccErrorCallback(void);
+
+#endif /* (CST_MODEM_CONFIG_CACHE == 1U) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CELLULAR_SERVICE_NVM_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -63,6 +63,7 @@ void CSP_WakeupComplete(void);
 void CSP_ResetPowerStatus(void);
 void CSP_InitPowerConfig(void);
 CSP_PowerState_t CSP_GetTargetPowerState(void);
+CSP_PowerState_t CSP_GetPowerState(void);
 void CSP_StopTimeout(void);
 
 #endif  /* (USE_LOW_POWER == 1) */
@@ -0,0 +1,90 @@
+/**
+  ******************************************************************************
+  * @file    cellular_service_reattach.h
+  * @author  MCD Application Team
+  * @brief   Header for cellular_service_reattach.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CELLULAR_SERVICE_REATTACH_H
+#define CELLULAR_SERVICE_REATTACH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include "plf_config.h"
+#include "cellular_service.h"
+
+#if (CST_FAST_REATTACH == 1U)
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+/* External variables --------------------------------------------------------*/
+/* Exported macros -----------------------------------------------------------*/
+
+/* Exported functions ------------------------------------------------------- */
+
+/**
+  * @brief  initializes reattach context (last network registered unknown)
+  * @param  -
+  * @retval -
+  */
+void CSR_Init(void);
+
+/**
+  * @brief  starts a network attachment: boot registration or network loss
+  * @param  -
+  * @retval bool - true: new attachment started, false: attachment already on going
+  */
+bool CSR_AttachStart(void);
+
+/**
+  * @brief  selects the last network registered for a registration request
+  * @note   only applied when the configured network selection is automatic:
+  *         the modem falls back to automatic selection if the last network is not found
+  * @param  p_operator - operator selector to update
+  * @retval bool - true: last network selected, automatic selection to restore once the request is done
+  */
+bool CSR_OperatorSelect(CS_OperatorSelector_t *p_operator);
+
+/**
+  * @brief  notifies the modem is registered: ends on going attachment and keeps the network registered
+  * @param  p_reg_status - registration status returned by the modem
+  * @retval -
+  */
+void CSR_AttachDone(const CS_RegistrationStatus_t *p_reg_status);
+
+/**
+  * @brief  notifies a registration attempt has failed and computes the delay before next attempt
+  * @note   jittered exponential backoff from CST_REATTACH_BACKOFF_MIN to CST_REATTACH_BACKOFF_MAX
+  * @param  min_delay - minimal delay required (NFMC tempo), 0 if none
+  * @param  scheduled - true: caller requests registration again after the returned delay
+  *                     false: next attempt driven by the modem reset (no retry delay published)
+  * @retval uint32_t  - delay before next registration attempt (ms)
+  */
+uint32_t CSR_AttachFailed(uint32_t min_delay, bool scheduled);
+
+#endif /* (CST_FAST_REATTACH == 1U) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CELLULAR_SERVICE_REATTACH_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
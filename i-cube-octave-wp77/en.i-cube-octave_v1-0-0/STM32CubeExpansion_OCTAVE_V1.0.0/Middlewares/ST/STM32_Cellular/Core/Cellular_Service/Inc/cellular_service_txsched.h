@@ -0,0 +1,103 @@
+/**
+  ******************************************************************************
+  * @file    cellular_service_txsched.h
+  * @author  MCD Application Team
+  * @brief   Header for cellular_service_txsched.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CELLULAR_SERVICE_TXSCHED_H
+#define CELLULAR_SERVICE_TXSCHED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include "plf_config.h"
+#include "cellular_service.h"
+
+#if (USE_LOW_POWER == 1)
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+/* Callback used to let the application transmit deferred data */
+typedef void (* CSX_Callback_t)(void *p_ctx);
+
+typedef struct
+{
+  uint32_t posted;          /*!< Number of scheduled transmissions                          */
+  uint32_t flushed;         /*!< Number of transmissions called back                        */
+  uint32_t flush_nb;        /*!< Number of grouped flushes of pending transmissions         */
+  uint32_t wakeups_saved;   /*!< Modem wakeups avoided by grouping deferred transmissions   */
+} CSX_Stats_t;
+
+/* External variables --------------------------------------------------------*/
+/* Exported macros -----------------------------------------------------------*/
+
+/* Exported functions ------------------------------------------------------- */
+
+/**
+  * @brief  initializes the deferred transmission scheduler (no transmission pending)
+  * @param  -
+  * @retval -
+  */
+void CSX_Init(void);
+
+/**
+  * @brief  schedules a deferrable transmission
+  * @note   if the modem is awake the callback is called immediately, else it is called
+  *         at the next modem wake window or at the latest when the deadline expires.
+  *         The callback should only post a message to the application task.
+  * @param  callback - function called when the application can transmit
+  * @param  p_ctx    - context given to callback
+  * @param  deadline - maximum delay before callback is called (in ms)
+  * @retval CS_Status_t - CELLULAR_ERROR if callback is NULL
+  */
+CS_Status_t CSX_Schedule(CSX_Callback_t callback, void *p_ctx, uint32_t deadline);
+
+/**
+  * @brief  calls back all pending deferred transmissions
+  * @note   to call when the modem wakes up or doesn't enter low power
+  * @param  wakeup_needed - true: flush forced by a deadline or a full table
+  *                         false: modem is already awake
+  * @retval -
+  */
+void CSX_Flush(bool wakeup_needed);
+
+/**
+  * @brief  gets deferred transmission statistics
+  * @param  p_stats - statistics (out)
+  * @retval -
+  */
+void CSX_GetStats(CSX_Stats_t *p_stats);
+
+/**
+  * @brief  gets the number of transmissions waiting for the next modem wake window
+  * @param  -
+  * @retval uint8_t - pending transmissions
+  */
+uint8_t CSX_GetPendingNb(void);
+
+#endif /* (USE_LOW_POWER == 1) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CELLULAR_SERVICE_TXSCHED_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -62,6 +62,14 @@ void CST_cellular_power_status_callback(CS_LowPower_status_t lp_status);
   */
 void CST_modem_sim_init(void);
 
+/**
+  * @brief  requests device identity postponed during modem init (see CST_OVERLAPPED_BRINGUP)
+  * @note   called once network registration has been launched, or has failed or timed out
+  * @param  -
+  * @retval -
+  */
+void CST_get_device_identity_deferred(void);
+
 /**
   * @brief  update Cellular Info entry of Data Cache
   * @param  dc_service_state - new entry state to set
@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+#
+# Decodes the Cellular Service event log displayed by the console command 'cst evtlog'
+# (see cellular_service_evtlog.h) into a timeline and the duration of the modem bring-up phases:
+# power-on, SIM ready, registered, PDN active, first data.
+#
+# usage: cst_evtlog_decode.py [-t] [console_capture.txt]   (stdin if no file)
+#        -t : also display the full timeline
+#
+
+import re
+import sys
+from collections import OrderedDict
+
+# Warning : to be consistent with cellular_service_evtlog.h
+TYPE_BOOT = 0x01
+TYPE_STATE = 0x02
+TYPE_EVENT = 0x03
+TYPE_MODEM_STATE = 0x04
+TYPE_AT_START = 0x05
+TYPE_AT_END = 0x06
+TYPE_AT_CMD = 0x07
+TYPE_DATA = 0x08
+
+# Warning : to be consistent with cellular_service_task.h
+STATE_NAME = [
+    "BOOT", "MODEM_INIT", "MODEM_READY", "WAITING_FOR_SIGNAL_QUALITY_OK", "WAITING_FOR_NETWORK_STATUS",
+    "NETWORK_STATUS_OK", "MODEM_REGISTERED", "MODEM_PDN_ACTIVATING", "MODEM_DATA_READY", "MODEM_REPROG",
+    "MODEM_FAIL", "MODEM_SIM_ONLY", "MODEM_RESET", "MODEM_REBOOT", "MODEM_OFF", "MODEM_POWER_ON_ONLY",
+    "MODEM_POWER_DATA_IDLE", "APN_CONFIG", "PPP_CONFIG_ON_GOING", "PPP_CLOSE_ON_GOING",
+]
+STATE_MODEM_INIT = 1
+
+EVENT_NAME = [
+    "BOOT", "MODEM_INIT", "MODEM_READY", "SIGNAL_QUALITY_TO_CHECK", "NETWORK_STATUS_TO_CHECK",
+    "NETWORK_STATUS_OK", "MODEM_ATTACHED", "PDP_ACTIVATED", "PDN_STATUS_TO_CHECK", "PDN_ACTIVATE_RETRY_TIMER",
+    "CELLULAR_DATA_FAIL", "POLLING_TIMER", "MODEM_URC", "NO_EVENT", "CMD_UNKWOWN", "TARGET_STATE_CMD",
+    "APN_CONFIG", "REBOOT_MODEM", "MODEM_POWER_ON_ONLY", "NETWORK_CALLBACK", "NW_REG_TIMEOUT_TIMER",
+    "FOTA_START", "FOTA_END", "FOTA_TIMEOUT", "MODEM_RESET", "MODEM_REBOOT", "PPP_OPENED", "PPP_CLOSED",
+    "MODEM_POWER_DOWN", "SIM_RESET", "POWER_SLEEP_TIMEOUT", "POWER_SLEEP_REQUEST", "POWER_SLEEP_COMPLETE",
+    "POWER_WAKEUP", "POWER_MODEM_WAKEUP", "POWER_SLEEP_ABORT",
+]
+
+# Warning : to be consistent with ca_modem_state_t in cellular_control_api.h
+MODEM_STATE_NAME = {
+    0x01: "POWERED_ON", 0x02: "SIM_CONNECTED", 0x03: "NETWORK_SEARCHING", 0x04: "NETWORK_REGISTERED",
+    0x05: "DATAREADY", 0x07: "REBOOTING", 0x08: "FOTA_INPROGRESS", 0xFF: "POWER_OFF",
+}
+
+AT_STATUS_NAME = ["OK", "ERROR", "TIMEOUT", "OK_PENDING_URC"]
+
+# bring-up phases: (name, modem state ending the phase), first data ends the last phase
+PHASES = [("power-on", 0x01), ("SIM ready", 0x02), ("registered", 0x04), ("PDN active", 0x05)]
+PHASE_FIRST_DATA = "first data"
+
+RE_BEGIN = re.compile(r"cse begin (\d+) (\d+) (\d+) (\d+)")
+RE_RECORD = re.compile(r"cse ([0-9a-fA-F]{16})\b")
+
+
+def name(table, index):
+    if isinstance(table, dict):
+        return table.get(index, "%d" % index)
+    return table[index] if index < len(table) else "%d" % index
+
+
+def elapsed(start, end):
+    return (end - start) & 0xFFFFFFFF
+
+
+def parse(lines):
+    header = None
+    records = []
+    for line in lines:
+        match = RE_BEGIN.search(line)
+        if match is not None:
+            # keep the last dump of the capture
+            header = tuple(int(v) for v in match.groups())
+            records = []
+            continue
+        match = RE_RECORD.search(line)
+        if match is not None:
+            raw = match.group(1)
+            records.append((int(raw[0:8], 16), int(raw[8:10], 16), int(raw[10:12], 16), int(raw[12:16], 16)))
+    return header, records
+
+
+def describe(rec_type, rec_id, value):
+    if rec_type == TYPE_BOOT:
+        return "log start"
+    if rec_type == TYPE_STATE:
+        return "state  %s -> %s" % (name(STATE_NAME, value), name(STATE_NAME, rec_id))
+    if rec_type == TYPE_EVENT:
+        return "event  %s (in %s)" % (name(EVENT_NAME, rec_id), name(STATE_NAME, value))
+    if rec_type == TYPE_MODEM_STATE:
+        return "modem  %s" % name(MODEM_STATE_NAME, rec_id)
+    if rec_type == TYPE_AT_START:
+        return "at     SID %d start" % value
+    if rec_type == TYPE_AT_END:
+        return "at     SID %d end %s" % (value, name(AT_STATUS_NAME, rec_id))
+    if rec_type == TYPE_AT_CMD:
+        return "at     cmd 0x%04x" % value
+    if rec_type == TYPE_DATA:
+        return "data   first %s %d bytes" % ("receive" if rec_id == 1 else "send", value)
+    return "unknown type %d" % rec_type
+
+
+class Cycle(object):
+    """ one modem bring-up: from MODEM_INIT state entry to first data """
+
+    def __init__(self, tick):
+        self.start = tick
+        self.milestones = OrderedDict()
+        self.at_nb = 0
+        self.at_time = 0
+        self.phase_at = OrderedDict()
+
+    def next_phase(self):
+        for phase, _ in PHASES:
+            if phase not in self.milestones:
+                return phase
+        return PHASE_FIRST_DATA if PHASE_FIRST_DATA not in self.milestones else None
+
+
+def analyze(records):
+    cycles = []
+    cycle = None
+    at_start = None
+    at_stats = OrderedDict()
+
+    for tick, rec_type, rec_id, value in records:
+        if (rec_type == TYPE_STATE) and (rec_id == STATE_MODEM_INIT) and (value != STATE_MODEM_INIT):
+            cycle = Cycle(tick)
+            cycles.append(cycle)
+        elif (rec_type == TYPE_MODEM_STATE) and (cycle is not None):
+            for phase, modem_state in PHASES:
+                if (modem_state == rec_id) and (phase not in cycle.milestones):
+                    cycle.milestones[phase] = tick
+        elif (rec_type == TYPE_DATA) and (cycle is not None):
+            if (PHASES[-1][0] in cycle.milestones) and (PHASE_FIRST_DATA not in cycle.milestones):
+                cycle.milestones[PHASE_FIRST_DATA] = tick
+        elif rec_type == TYPE_AT_START:
+            at_start = (tick, value)
+        elif (rec_type == TYPE_AT_END) and (at_start is not None) and (at_start[1] == value):
+            duration = elapsed(at_start[0], tick)
+            stat = at_stats.setdefault(value, [0, 0, 0, 0])
+            stat[0] += 1
+            stat[1] += duration
+            stat[2] = max(stat[2], duration)
+            if rec_id != 0:
+                stat[3] += 1
+            if cycle is not None:
+                phase = cycle.next_phase()
+                if phase is not None:
+                    cycle.at_nb += 1
+                    cycle.at_time += duration
+                    phase_at = cycle.phase_at.setdefault(phase, [0, 0])
+                    phase_at[0] += 1
+                    phase_at[1] += duration
+            at_start = None
+    return cycles, at_stats
+
+
+def main(argv):
+    timeline = False
+    if (len(argv) > 1) and (argv[1] == "-t"):
+        timeline = True
+        argv = argv[1:]
+    stream = open(argv[1]) if len(argv) > 1 else sys.stdin
+    header, records = parse(stream)
+    if header is None:
+        sys.stderr.write("no 'cse begin' line found: capture the output of 'cst evtlog'\n")
+        return 1
+
+    version, count, size, now = header
+    if version != 1:
+        sys.stderr.write("unsupported event log version %d\n" % version)
+        return 1
+    print("event log: %d records (%d lost), dumped at tick %d ms" % (len(records), max(0, count - size), now))
+    if count > size:
+        print("warning: log has wrapped, oldest records are lost: "
+              "clear it with 'cst evtlog reset' before the sequence to profile")
+
+    if timeline and records:
+        print("\n   tick(ms)    delta  record")
+        previous = records[0][0]
+        for tick, rec_type, rec_id, value in records:
+            print("%11d %8d  %s" % (tick, elapsed(previous, tick), describe(rec_type, rec_id, value)))
+            previous = tick
+
+    cycles, at_stats = analyze(records)
+    for index, cycle in enumerate(cycles):
+        print("\nbring-up #%d: modem init at tick %d ms" % (index + 1, cycle.start))
+        print("  %-12s %10s %10s %8s %10s" % ("phase", "duration", "total", "AT req", "AT time"))
+        previous = cycle.start
+        for phase in [p for p, _ in PHASES] + [PHASE_FIRST_DATA]:
+            if phase not in cycle.milestones:
+                print("  %-12s %10s" % (phase, "not reached"))
+                break
+            tick = cycle.milestones[phase]
+            phase_at = cycle.phase_at.get(phase, [0, 0])
+            print("  %-12s %8d ms %7d ms %8d %7d ms" % (phase, elapsed(previous, tick), elapsed(cycle.start, tick),
+                                                        phase_at[0], phase_at[1]))
+            previous = tick
+
+    if at_stats:
+        print("\nAT requests per SID")
+        print("  %6s %6s %8s %10s %10s" % ("SID", "nb", "errors", "mean(ms)", "max(ms)"))
+        for sid, (nb, total, longest, errors) in sorted(at_stats.items(), key=lambda item: -item[1][1]):
+            print("  %6d %6d %8d %10d %10d" % (sid, nb, errors, total // nb, longest))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+#
+# Host test of cst_evtlog_decode.py against the console captures of Test/ produced by the
+# event log itself (see Test/cse_bringup_capture.c): a modem bring-up replayed across the
+# 32 bits tick wrap, dumped twice, with a 128 records log and with an 8 records log.
+#
+# usage: test_cst_evtlog_decode.py   (from any directory)
+#
+# Checked:
+#   - the last dump of the capture is decoded, console noise is ignored,
+#   - records are decoded in order (tick, type, id, saturated data length),
+#   - bring-up phase milestones and durations across the tick wrap,
+#   - AT requests per SID and per phase (count, total, max, errors),
+#   - wrapped log: lost records are reported, no bring-up without its start,
+#   - missing dump and unsupported version are rejected.
+# The process exit code is the number of failures (0: all tests passed).
+#
+
+import io
+import os
+import sys
+import tempfile
+from contextlib import redirect_stderr, redirect_stdout
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import cst_evtlog_decode as decode  # noqa: E402
+
+TEST_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "Test")
+CAPTURE = os.path.join(TEST_DIR, "cse_bringup_capture.txt")
+CAPTURE_NB8 = os.path.join(TEST_DIR, "cse_bringup_capture_nb8.txt")
+
+# Warning : to be consistent with Test/cse_bringup_capture.c
+TICK_START = 0xFFFFF000
+TICK_DUMP = (TICK_START + 8000) & 0xFFFFFFFF
+RECORD_NB = 21
+
+failures = 0
+tests = 0
+
+
+def check(ok, label, value=None):
+    global failures, tests
+    tests += 1
+    if not ok:
+        failures += 1
+        print("FAIL: %s (%r)" % (label, value))
+
+
+def tick(offset):
+    return (TICK_START + offset) & 0xFFFFFFFF
+
+
+def run_main(argv):
+    out = io.StringIO()
+    err = io.StringIO()
+    with redirect_stdout(out), redirect_stderr(err):
+        ret = decode.main(["cst_evtlog_decode.py"] + argv)
+    return ret, out.getvalue(), err.getvalue()
+
+
+def test_parse():
+    with open(CAPTURE) as stream:
+        header, records = decode.parse(stream)
+    check(header == (1, RECORD_NB, 128, TICK_DUMP), "last dump header", header)
+    check(len(records) == RECORD_NB, "last dump record count", len(records))
+    check(records[0] == (tick(0), decode.TYPE_BOOT, 0, 0), "first record: log start", records[0])
+    check(records[1] == (tick(10), decode.TYPE_STATE, 1, 0), "state BOOT -> MODEM_INIT", records[1])
+    check(records[3] == (tick(25), decode.TYPE_AT_CMD, 0, 0x10A), "AT command sent", records[3])
+    check(records[8] == (tick(1400), decode.TYPE_AT_END, 1, 11), "AT request end in error", records[8])
+    check(records[14] == (tick(5010), decode.TYPE_MODEM_STATE, 0x04, 0), "registered after tick wrap", records[14])
+    check(records[15] == (tick(5100), decode.TYPE_DATA, 0, 10), "data before PDN active", records[15])
+    check(records[-1] == (tick(7510), decode.TYPE_DATA, 1, 0xFFFF), "first data, saturated length", records[-1])
+    check(sorted(records, key=lambda r: (r[0] - TICK_START) & 0xFFFFFFFF) == records, "records in order")
+
+
+def test_analyze():
+    with open(CAPTURE) as stream:
+        _, records = decode.parse(stream)
+    cycles, at_stats = decode.analyze(records)
+    check(len(cycles) == 1, "one bring-up", len(cycles))
+    cycle = cycles[0]
+    check(cycle.start == tick(10), "bring-up start", cycle.start)
+    expected = [("power-on", 1000), ("SIM ready", 2000), ("registered", 5000), ("PDN active", 7000),
+                ("first data", 7500)]
+    check(list(cycle.milestones.keys()) == [phase for phase, _ in expected], "phases reached",
+          list(cycle.milestones.keys()))
+    for phase, total in expected:
+        value = decode.elapsed(cycle.start, cycle.milestones.get(phase, cycle.start))
+        check(value == total, "%s total duration" % phase, value)
+    expected_at = {"power-on": [1, 500], "SIM ready": [1, 300], "registered": [1, 100], "PDN active": [1, 1000]}
+    check(dict(cycle.phase_at) == expected_at, "AT requests per phase", dict(cycle.phase_at))
+    check((cycle.at_nb, cycle.at_time) == (4, 1900), "AT requests of the bring-up", (cycle.at_nb, cycle.at_time))
+    # [nb, total, max, errors]
+    expected_stats = {10: [1, 500, 500, 0], 11: [2, 400, 300, 1], 12: [1, 1000, 1000, 0]}
+    check(dict(at_stats) == expected_stats, "AT requests per SID", dict(at_stats))
+
+
+def test_main():
+    ret, out, _ = run_main(["-t", CAPTURE])
+    check(ret == 0, "decoding status", ret)
+    check("event log: %d records (0 lost)" % RECORD_NB in out, "summary line", out)
+    check("warning" not in out, "no wrap warning")
+    check("bring-up #2" not in out and "bring-up #1" in out, "one bring-up displayed")
+    check("  first data        500 ms    7500 ms" in out, "first data phase line", out)
+    check("  registered       3000 ms    5000 ms        1     100 ms" in out, "registered phase line", out)
+    check("     914     1910  modem  NETWORK_REGISTERED" in out, "timeline delta across tick wrap", out)
+    check("      11      2        1        200        300" in out, "SID 11 statistics line", out)
+
+
+def test_wrapped_log():
+    with open(CAPTURE_NB8) as stream:
+        header, records = decode.parse(stream)
+    check(header == (1, RECORD_NB, 8, TICK_DUMP), "wrapped log header", header)
+    check(len(records) == 8, "wrapped log: last 8 records", len(records))
+    check(records[0] == (tick(3100), decode.TYPE_AT_END, 0, 11), "wrapped log: oldest record kept", records[0])
+    cycles, at_stats = decode.analyze(records)
+    check(cycles == [], "wrapped log: bring-up start lost", cycles)
+    check(dict(at_stats) == {12: [1, 1000, 1000, 0]}, "wrapped log: unmatched AT end ignored", dict(at_stats))
+    ret, out, _ = run_main([CAPTURE_NB8])
+    check(ret == 0, "wrapped log decoding status", ret)
+    check("8 records (13 lost)" in out and "warning: log has wrapped" in out, "wrapped log reported", out)
+
+
+def test_errors():
+    header, records = decode.parse(["cse fffff00001000000\n", "no dump\n"])
+    check(header is None, "no header without 'cse begin'", header)
+    with open(CAPTURE) as stream:
+        capture = stream.read()
+    with tempfile.NamedTemporaryFile("w", suffix=".txt", delete=False) as stream:
+        stream.write(capture.replace("cse begin 1 ", "cse begin 2 "))
+        bad_version = stream.name
+    try:
+        ret, _, err = run_main([bad_version])
+    finally:
+        os.remove(bad_version)
+    check(ret == 1 and "unsupported event log version 2" in err, "unsupported version rejected", (ret, err))
+
+
+if __name__ == "__main__":
+    test_parse()
+    test_analyze()
+    test_main()
+    test_wrapped_log()
+    test_errors()
+    print("%d tests, %d failures" % (tests, failures))
+    sys.exit(failures)
@@ -0,0 +1,256 @@
+/**
+  ******************************************************************************
+  * @file    cellular_service_activity.c
+  * @author  MCD Application Team
+  * @brief   This file defines the activity tokens: sockets and com_mdm hold a
+  *          token while a transaction or a received message is in progress,
+  *          low power is requested once no token is held
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "plf_config.h"
+
+#if (USE_LOW_POWER == 1)
+#include <string.h>
+
+#include "cellular_service_activity.h"
+#include "cellular_service_datacache.h"
+#include "cellular_service_power.h"
+#include "cellular_service_task.h"
+#include "dc_common.h"
+#include "rtosal.h"
+#include "at_core.h"
+#include "error_handler.h"
+
+#if (USE_PRINTF == 0U)
+#include "trace_interface.h"
+#else
+#include <stdio.h>
+#endif  /* (USE_PRINTF == 0U) */
+
+/* Private defines -----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private macros ------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static osTimerId     csa_timer_handle;
+static osMutexId     csa_mutex = NULL;
+static osMutexId     csa_wakeup_mutex = NULL;
+static uint16_t      csa_count[CSA_ACTIVITY_NB];
+static uint16_t      csa_total;
+
+/* Global variables ----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static void CSA_timer_callback(void *argument);
+static void CSA_idle_request(void);
+
+/* Private function Definition -----------------------------------------------*/
+
+/**
+  * @brief  timer callback when no activity token is held
+  * @param  argument - argument (not used)
+  * @retval -
+  */
+static void CSA_timer_callback(void *argument)
+{
+  bool idle;
+
+  UNUSED(argument);
+  (void)rtosalMutexAcquire(csa_mutex, RTOSAL_WAIT_FOREVER);
+  idle = (csa_total == 0U) ? true : false;
+  (void)rtosalMutexRelease(csa_mutex);
+
+  if (idle == true)
+  {
+    CSA_idle_request();
+  }
+}
+
+/**
+  * @brief  requests low power when nothing is in progress
+  * @param  -
+  * @retval -
+  */
+static void CSA_idle_request(void)
+{
+  dc_nifman_info_t dc_nifman_info;
+
+  if (AT_is_processing() == AT_TRUE)
+  {
+    /* an AT transaction is in progress: check again later */
+    PRINT_CELLULAR_SERVICE("++++++++++++++++ Activity: AT command ongoing - check again later\n\r")
+    (void)rtosalTimerStart(csa_timer_handle, cst_cellular_params.lp_inactivity_timeout);
+  }
+  else if ((dc_com_read(&dc_com_db, DC_CELLULAR_NIFMAN_INFO, (void *)&dc_nifman_info,
+                        sizeof(dc_nifman_info_t)) == DC_COM_OK)
+           && (dc_nifman_info.rt_state == DC_SERVICE_ON))
+  {
+    /* network is up: IdleMode can be requested */
+    if (CSP_DataIdle() == CELLULAR_OK)
+    {
+      PRINT_CELLULAR_SERVICE("++++++++++++++++ Activity: IdleMode request OK\n\r")
+    }
+    else
+    {
+      /* CSP_DataIdle may be NOK because CSP already in Idle */
+      PRINT_CELLULAR_SERVICE("++++++++++++++++ Activity: IdleMode request NOK\n\r")
+    }
+  }
+  else
+  {
+    PRINT_CELLULAR_SERVICE("++++++++++++++++ Activity: IdleMode NOT requested because network is down\n\r")
+  }
+}
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  initializes the activity tokens (no token held)
+  * @param  -
+  * @retval -
+  */
+void CSA_Init(void)
+{
+  csa_total = 0U;
+  (void)memset((void *)csa_count, 0, sizeof(csa_count));
+  csa_timer_handle = rtosalTimerNew(NULL, (os_ptimer)CSA_timer_callback, osTimerOnce, NULL);
+  csa_wakeup_mutex = rtosalMutexNew(NULL);
+  csa_mutex = rtosalMutexNew(NULL);
+  if ((csa_mutex == NULL) || (csa_wakeup_mutex == NULL))
+  {
+    ERROR_Handler(DBG_CHAN_CELLULAR_SERVICE, 2, ERROR_FATAL);
+  }
+}
+
+/**
+  * @brief  takes an activity token: low power is not entered until it is released
+  * @note   transaction tokens (socket, mdm) also leave low power if needed
+  * @param  activity - origin of the activity
+  * @retval -
+  */
+void CSA_Acquire(CSA_Activity_t activity)
+{
+  if (csa_mutex != NULL)
+  {
+    (void)rtosalMutexAcquire(csa_mutex, RTOSAL_WAIT_FOREVER);
+    csa_count[activity]++;
+    csa_total++;
+    (void)rtosalTimerStop(csa_timer_handle);
+    (void)rtosalMutexRelease(csa_mutex);
+
+    if ((activity == CSA_ACTIVITY_SOCKET) || (activity == CSA_ACTIVITY_MDM))
+    {
+      /* transaction needs the modem: one wakeup request at a time */
+      (void)rtosalMutexAcquire(csa_wakeup_mutex, RTOSAL_WAIT_FOREVER);
+      if (CSP_DataWakeup(HOST_WAKEUP) != CELLULAR_OK)
+      {
+        PRINT_CELLULAR_SERVICE("++++++++++++++++ Activity: WakeUp request NOK\n\r")
+      }
+      (void)rtosalMutexRelease(csa_wakeup_mutex);
+    }
+  }
+}
+
+/**
+  * @brief  releases an activity token
+  * @note   when the last token is released, low power is requested after lp_inactivity_timeout
+  * @param  activity  - origin of the activity
+  * @param  immediate - true: request low power without waiting if no token is held
+  * @retval -
+  */
+void CSA_Release(CSA_Activity_t activity, bool immediate)
+{
+  bool idle;
+
+  idle = false;
+  if (csa_mutex != NULL)
+  {
+    (void)rtosalMutexAcquire(csa_mutex, RTOSAL_WAIT_FOREVER);
+    if (csa_count[activity] != 0U)
+    {
+      csa_count[activity]--;
+      csa_total--;
+    }
+    if (csa_total == 0U)
+    {
+      if (immediate == true)
+      {
+        (void)rtosalTimerStop(csa_timer_handle);
+        idle = true;
+      }
+      else
+      {
+        /* Start or Restart timer */
+        (void)rtosalTimerStart(csa_timer_handle, cst_cellular_params.lp_inactivity_timeout);
+      }
+    }
+    (void)rtosalMutexRelease(csa_mutex);
+  }
+
+  if (idle == true)
+  {
+    CSA_idle_request();
+  }
+}
+
+/**
+  * @brief  arms the low power request if no activity token is held (e.g. when network comes up)
+  * @param  -
+  * @retval -
+  */
+void CSA_Check(void)
+{
+  if (csa_mutex != NULL)
+  {
+    (void)rtosalMutexAcquire(csa_mutex, RTOSAL_WAIT_FOREVER);
+    if (csa_total == 0U)
+    {
+      (void)rtosalTimerStart(csa_timer_handle, cst_cellular_params.lp_inactivity_timeout);
+    }
+    (void)rtosalMutexRelease(csa_mutex);
+  }
+}
+
+/**
+  * @brief  checks if an activity token is held
+  * @param  -
+  * @retval bool - true if nothing is in progress
+  */
+bool CSA_IsIdle(void)
+{
+  bool idle;
+
+  idle = true;
+  if (csa_mutex != NULL)
+  {
+    (void)rtosalMutexAcquire(csa_mutex, RTOSAL_WAIT_FOREVER);
+    idle = (csa_total == 0U) ? true : false;
+    (void)rtosalMutexRelease(csa_mutex);
+  }
+  return idle;
+}
+
+/**
+  * @brief  gets the number of tokens held by an origin
+  * @param  activity - origin of the activity
+  * @retval uint16_t - tokens held
+  */
+uint16_t CSA_GetCount(CSA_Activity_t activity)
+{
+  return csa_count[activity];
+}
+
+#endif /* (USE_LOW_POWER == 1) */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -37,6 +37,9 @@
 #include "error_handler.h"
 #include "cellular_runtime_custom.h"
 #include "cellular_service_config.h"
+#if (CST_EVENT_LOG == 1U)
+#include "cellular_service_evtlog.h"
+#endif /* (CST_EVENT_LOG == 1U) */
 
 #if defined(USE_MODEM_WP77)
 /* MODEM WP77 */
@@ -439,6 +442,10 @@ static void CST_HelpCmd(void) {
 	PRINT_FORCE("%s apnuser [on|off] (set apn user define for active sim slot)",
 			CST_cmd_label)
 	PRINT_FORCE("%s apnempty (Set APN to an empty string)", CST_cmd_label)
+#if (CST_EVENT_LOG == 1U)
+	PRINT_FORCE("%s evtlog [reset] (dump or clear the automaton event log)",
+			CST_cmd_label)
+#endif /* (CST_EVENT_LOG == 1U) */
 	PRINT_FORCE("%s power [on|off]  (modem switch ON or OFF)", CST_cmd_label)
 	PRINT_FORCE("%s operator  (operator selection)", CST_cmd_label)
 	PRINT_FORCE("%s techno off", CST_cmd_label)
@@ -1075,7 +1082,28 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p) {
 					PRINT_FORCE("%s bad command. Usage:", cmd_p)
 					CST_HelpCmd();
 				}
-			} else {
+			}
+#if (CST_EVENT_LOG == 1U)
+			/* -- evtlog -------------------------------------------------------------------------------------------------- */
+			else if (memcmp((CRC_CHAR_t*) argv_p[0], "evtlog",
+					crs_strlen(argv_p[0])) == 0) {
+				/* 'cst evtlog [reset]' command */
+				if (argc == 2U) {
+					if (memcmp((CRC_CHAR_t*) argv_p[1], "reset",
+							crs_strlen(argv_p[1])) == 0) {
+						CSE_Reset();
+						PRINT_FORCE("%s event log cleared", CST_cmd_label)
+					} else {
+						cmd_status = CMD_SYNTAX_ERROR;
+						PRINT_FORCE("%s bad command. Usage:", cmd_p)
+						CST_HelpCmd();
+					}
+				} else {
+					CSE_Dump();
+				}
+			}
+#endif /* (CST_EVENT_LOG == 1U) */
+			else {
 				/* Bad cst command: displays help  */
 				cmd_status = CMD_SYNTAX_ERROR;
 				PRINT_FORCE("%s bad command. Usage:", cmd_p)
@@ -45,6 +45,9 @@ dc_com_res_id_t DC_CELLULAR_TARGET_STATE_CMD = DC_COM_INVALID_ENTRY;
 dc_com_res_id_t    DC_CELLULAR_POWER_CONFIG     = DC_COM_INVALID_ENTRY;
 dc_com_res_id_t    DC_CELLULAR_POWER_STATUS     = DC_COM_INVALID_ENTRY;
 #endif /* (USE_LOW_POWER == 1) */
+#if (CST_FAST_REATTACH == 1U)
+dc_com_res_id_t    DC_CELLULAR_ATTACH_INFO      = DC_COM_INVALID_ENTRY;
+#endif /* (CST_FAST_REATTACH == 1U) */
 
 /* Private function prototypes -----------------------------------------------*/
 
@@ -67,6 +70,9 @@ void cellular_service_datacache_init(void) {
   static dc_cellular_power_config_t  dc_cellular_power_config;
   static dc_cellular_power_status_t  dc_cellular_power_status;
 #endif  /* (USE_LOW_POWER == 1) */
+#if (CST_FAST_REATTACH == 1U)
+  static dc_cellular_attach_info_t   dc_cellular_attach_info;
+#endif  /* (CST_FAST_REATTACH == 1U) */
 
 	(void) memset((void*) &dc_cellular_info, 0, sizeof(dc_cellular_info_t));
 	(void) memset((void*) &dc_cellular_data_info, 0,
@@ -82,6 +88,9 @@ void cellular_service_datacache_init(void) {
   (void)memset((void *)&dc_cellular_power_config, 0, sizeof(dc_cellular_power_config_t));
   (void)memset((void *)&dc_cellular_power_status, 0, sizeof(dc_cellular_power_status_t));
 #endif  /* (USE_LOW_POWER == 1) */
+#if (CST_FAST_REATTACH == 1U)
+  (void)memset((void *)&dc_cellular_attach_info, 0, sizeof(dc_cellular_attach_info_t));
+#endif  /* (CST_FAST_REATTACH == 1U) */
 
 	/* register all all cellular entries of Data Cache */
 	DC_CELLULAR_INFO = dc_com_register_serv(&dc_com_db,
@@ -109,6 +118,10 @@ void cellular_service_datacache_init(void) {
   DC_CELLULAR_POWER_STATUS     = dc_com_register_serv(&dc_com_db, (void *)&dc_cellular_power_status,
                                                       (uint16_t)sizeof(dc_cellular_power_status));
 #endif  /* (USE_LOW_POWER == 1) */
+#if (CST_FAST_REATTACH == 1U)
+  DC_CELLULAR_ATTACH_INFO      = dc_com_register_serv(&dc_com_db, (void *)&dc_cellular_attach_info,
+                                                      (uint16_t)sizeof(dc_cellular_attach_info));
+#endif  /* (CST_FAST_REATTACH == 1U) */
 }
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,204 @@
+/**
+  ******************************************************************************
+  * @file    cellular_service_evtlog.c
+  * @author  MCD Application Team
+  * @brief   This file defines the Cellular Service event log: a compact binary
+  *          trace of automaton states and events, modem states and AT requests
+  *          kept in a RAM ring buffer, used to profile modem bring-up timing
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "plf_config.h"
+
+#if (CST_EVENT_LOG == 1U)
+#include <stdbool.h>
+
+#include "cellular_service_evtlog.h"
+#include "cellular_service_task.h"
+#include "at_core.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define CSE_LOG_VERSION      (1U)        /* to change if record format is modified */
+#define CSE_VALUE_MAX        (0xFFFFU)   /* record value is saturated to 16 bits   */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint32_t tick;    /*!< HAL tick (ms) when the record has been added */
+  uint8_t  type;    /*!< CSE_type_t                                   */
+  uint8_t  id;
+  uint16_t value;
+} cse_record_t;
+
+/* Private macros ------------------------------------------------------------*/
+#if (USE_PRINTF == 0U)
+/* Trace macro definition */
+#include "trace_interface.h"
+#define PRINT_FORCE(format, args...) \
+  TRACE_PRINT_FORCE(DBG_CHAN_CELLULAR_SERVICE, DBL_LVL_P0, "" format "", ## args)
+
+#else
+#include <stdio.h>
+#define PRINT_FORCE(format, args...)                (void)printf(format , ## args);
+#endif  /* (USE_PRINTF == 1) */
+
+/* Private variables ---------------------------------------------------------*/
+static cse_record_t cse_log[CST_EVENT_LOG_NB];
+static uint32_t     cse_count = 0U;          /* records added since last reset: next slot is cse_count % size */
+static bool         cse_data_logged = false; /* first data since last modem state change already recorded */
+
+/* Global variables ----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static void CSE_at_trace_callback(at_trace_t trace, uint32_t id, at_status_t status);
+
+/* Private function Definition -----------------------------------------------*/
+
+/**
+  * @brief  AT Core trace callback: records AT requests and commands
+  * @param  trace   - trace type
+  * @param  id      - SID or AT command ID
+  * @param  status  - request result (ATTRACE_SID_END only)
+  * @retval -
+  */
+static void CSE_at_trace_callback(at_trace_t trace, uint32_t id, at_status_t status)
+{
+  switch (trace)
+  {
+    case ATTRACE_SID_START:
+      CSE_Record(CSE_TYPE_AT_START, 0U, (uint16_t)id);
+      break;
+    case ATTRACE_SID_END:
+      CSE_Record(CSE_TYPE_AT_END, (uint8_t)status, (uint16_t)id);
+      break;
+    case ATTRACE_CMD_SENT:
+      CSE_Record(CSE_TYPE_AT_CMD, 0U, (uint16_t)id);
+      break;
+    default:
+      /* Nothing to do */
+      break;
+  }
+}
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  initializes the event log and registers the AT Core trace callback
+  * @param  -
+  * @retval -
+  */
+void CSE_Init(void)
+{
+  CSE_Reset();
+  AT_set_trace_callback(CSE_at_trace_callback);
+}
+
+/**
+  * @brief  adds a record to the event log (oldest record is overwritten when the log is full)
+  * @note   interrupts are masked while the slot is written: no RTOS object needed,
+  *         so records can be added before the scheduler is started
+  * @param  type   - record type
+  * @param  id     - record id
+  * @param  value  - record value
+  * @retval -
+  */
+void CSE_Record(CSE_type_t type, uint8_t id, uint16_t value)
+{
+  uint32_t primask;
+  cse_record_t *p_record;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  p_record = &cse_log[cse_count % CST_EVENT_LOG_NB];
+  cse_count++;
+  p_record->tick  = HAL_GetTick();
+  p_record->type  = type;
+  p_record->id    = id;
+  p_record->value = value;
+  if (type == CSE_TYPE_MODEM_STATE)
+  {
+    /* record the first data exchanged in this new modem state */
+    cse_data_logged = false;
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  notifies data transfer: only the first data after a modem state change is recorded
+  * @param  direction - CSE_DATA_SEND or CSE_DATA_RECEIVE
+  * @param  len       - data length
+  * @retval -
+  */
+void CSE_DataNotify(uint8_t direction, uint32_t len)
+{
+  if (cse_data_logged == false)
+  {
+    cse_data_logged = true;
+    CSE_Record(CSE_TYPE_DATA, direction, (len > CSE_VALUE_MAX) ? (uint16_t)CSE_VALUE_MAX : (uint16_t)len);
+  }
+}
+
+/**
+  * @brief  clears the event log
+  * @param  -
+  * @retval -
+  */
+void CSE_Reset(void)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  cse_count = 0U;
+  __set_PRIMASK(primask);
+  CSE_Record(CSE_TYPE_BOOT, 0U, 0U);
+}
+
+/**
+  * @brief  dumps the event log on the console, oldest record first
+  * @note   format: 'cse begin <version> <records added> <log size> <current tick>'
+  *         then one 'cse <tick:8><type:2><id:2><value:4>' line (hexadecimal) per record
+  *         and 'cse end'
+  * @param  -
+  * @retval -
+  */
+void CSE_Dump(void)
+{
+  uint32_t primask;
+  uint32_t count;
+  uint32_t i;
+  cse_record_t record;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  count = cse_count;
+  __set_PRIMASK(primask);
+
+  PRINT_FORCE("cse begin %d %ld %d %ld\n\r", CSE_LOG_VERSION, count, CST_EVENT_LOG_NB, HAL_GetTick())
+  i = (count > CST_EVENT_LOG_NB) ? (count - CST_EVENT_LOG_NB) : 0U;
+  for (; i < count; i++)
+  {
+    /* copy the record: it may be overwritten while the log is displayed */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    record = cse_log[i % CST_EVENT_LOG_NB];
+    __set_PRIMASK(primask);
+    PRINT_FORCE("cse %08lx%02x%02x%04x\n\r", record.tick, record.type, record.id, record.value)
+  }
+  PRINT_FORCE("cse end\n\r")
+}
+
+#endif /* (CST_EVENT_LOG == 1U) */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,456 @@
+/**
+  ******************************************************************************
+  * @file    cellular_service_nvm.c
+  * @author  MCD Application Team
+  * @brief   This file defines the modem configuration cache stored in flash
+  *          used to speed up modem init at boot
+  * @note    Two records are written alternately in two flash pages, each with a sequence number:
+  *          a reset during a write leaves the previous record valid.
+  *          A double word partially programmed by an interrupted write raises an ECC double error
+  *          NMI when it is read: CSN_FlashEccErrorCallback(), called by the NMI handler,
+  *          discards the record being read and lets the execution resume.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "plf_config.h"
+
+#if (CST_MODEM_CONFIG_CACHE == 1U)
+#include <stddef.h>
+#include <string.h>
+
+#include "cellular_service_nvm.h"
+#include "cellular_service_task.h"
+#include "cellular_runtime_standard.h"
+
+#if (USE_PRINTF == 0U)
+#include "trace_interface.h"
+#else
+#include <stdio.h>
+#endif  /* (USE_PRINTF == 0U) */
+
+/* Private defines -----------------------------------------------------------*/
+#define CSN_RECORD_MAGIC       (0x43534E02U)  /* 'CSN' + record version: to change if record format is modified */
+#define CSN_SLOT_NB            (2U)           /* records written alternately                                  */
+#define CSN_SLOT_SIZE          (0x2000U)      /* 8KB: a full page in any bank mode                           */
+#define CSN_FNV_OFFSET_BASIS   (0x811C9DC5U)  /* FNV-1a 32 bits offset basis */
+#define CSN_FNV_PRIME          (0x01000193U)  /* FNV-1a 32 bits prime        */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Record stored in flash */
+typedef struct
+{
+  uint32_t magic;                                          /*!< CSN_RECORD_MAGIC                  */
+  uint32_t sequence;                                       /*!< incremented at each write         */
+  uint32_t fingerprint;                                    /*!< fingerprint of modem configuration */
+  uint8_t  imsi[CA_IMSI_SIZE_MAX];                         /*!< IMSI of the SIM in use            */
+  uint8_t  imei[CA_IMEI_SIZE_MAX];
+  uint8_t  manufacturer_name[CA_MANUFACTURER_ID_SIZE_MAX];
+  uint8_t  model[CA_MODEL_ID_SIZE_MAX];
+  uint8_t  revision[CA_REVISION_ID_SIZE_MAX];
+  uint8_t  serial_number[CA_SERIAL_NUMBER_ID_SIZE_MAX];
+  uint8_t  iccid[CA_ICCID_SIZE_MAX];
+  uint32_t checksum;                                       /*!< FNV-1a of all previous fields     */
+} csn_record_t;
+
+/* Flash is programmed by double word */
+#define CSN_RECORD_DWORD_NB    ((sizeof(csn_record_t) + sizeof(uint64_t) - 1U) / sizeof(uint64_t))
+
+typedef union
+{
+  csn_record_t record;
+  uint64_t     dword[CSN_RECORD_DWORD_NB];
+} csn_buffer_t;
+
+typedef struct
+{
+  uint32_t fingerprint;   /*!< fingerprint of current modem configuration          */
+  bool     applied;       /*!< true: stored configuration used to skip modem init */
+  uint8_t  slot;          /*!< slot of the last valid record read                  */
+  bool     other_valid;   /*!< the other slot contains an older valid record       */
+} csn_context_t;
+
+/* Private macros ------------------------------------------------------------*/
+#define CSN_SLOT_ADDR(slot)    (CST_MODEM_CONFIG_CACHE_ADDR + ((uint32_t)(slot) * CSN_SLOT_SIZE))
+
+/* Private variables ---------------------------------------------------------*/
+static csn_context_t csn_context = {0U, false, 0U, false};
+
+/* last valid record read from flash */
+static csn_buffer_t csn_stored;
+
+/* record read from a slot or built in RAM before to be programmed in flash (double word aligned) */
+static csn_buffer_t csn_buffer;
+
+/* ECC double error detection while a record is read */
+static volatile bool csn_read_on_going = false;
+static volatile bool csn_read_ecc_error;
+
+/* Global variables ----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t CSN_hash(uint32_t hash, const void *p_data, uint32_t size);
+static uint32_t CSN_record_checksum(const csn_record_t *p_record);
+static bool CSN_record_read(uint8_t slot);
+static const csn_record_t *CSN_record_get(void);
+static bool CSN_flash_erase(uint8_t slot);
+static bool CSN_flash_write(uint8_t slot);
+
+/* Private function Definition -----------------------------------------------*/
+
+/**
+  * @brief  FNV-1a hash update
+  * @param  hash    - current hash value
+  * @param  p_data  - data to add to hash
+  * @param  size    - data size
+  * @retval uint32_t - updated hash value
+  */
+static uint32_t CSN_hash(uint32_t hash, const void *p_data, uint32_t size)
+{
+  const uint8_t *p_byte = (const uint8_t *)p_data;
+  uint32_t result = hash;
+
+  for (uint32_t i = 0U; i < size; i++)
+  {
+    result ^= (uint32_t)p_byte[i];
+    result *= CSN_FNV_PRIME;
+  }
+
+  return (result);
+}
+
+/**
+  * @brief  computes record checksum
+  * @param  p_record - record
+  * @retval uint32_t - checksum
+  */
+static uint32_t CSN_record_checksum(const csn_record_t *p_record)
+{
+  return (CSN_hash(CSN_FNV_OFFSET_BASIS, (const void *)p_record, (uint32_t)offsetof(csn_record_t, checksum)));
+}
+
+/**
+  * @brief  reads the record of a slot in csn_buffer
+  * @note   a double word partially programmed raises an ECC double error NMI:
+  *         CSN_FlashEccErrorCallback() marks the read in error and the execution resumes
+  * @param  slot - slot to read
+  * @retval bool - true: valid record read
+  */
+static bool CSN_record_read(uint8_t slot)
+{
+  const volatile uint64_t *p_flash = (const volatile uint64_t *)(uintptr_t)CSN_SLOT_ADDR(slot);
+  bool result;
+
+  csn_read_ecc_error = false;
+  __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ECCD);
+  csn_read_on_going = true;
+  for (uint32_t i = 0U; i < CSN_RECORD_DWORD_NB; i++)
+  {
+    csn_buffer.dword[i] = p_flash[i];
+  }
+  __DSB();
+  csn_read_on_going = false;
+
+  /* erased flash reads 0xFF: magic doesn't match */
+  result = ((csn_read_ecc_error == false)
+            && (csn_buffer.record.magic == CSN_RECORD_MAGIC)
+            && (csn_buffer.record.checksum == CSN_record_checksum(&csn_buffer.record)));
+
+  return (result);
+}
+
+/**
+  * @brief  gets the last record stored in flash
+  * @note   csn_buffer is used to read the slots
+  * @param  -
+  * @retval csn_record_t - copy of the last valid record (NULL if no valid record)
+  */
+static const csn_record_t *CSN_record_get(void)
+{
+  const csn_record_t *p_record = NULL;
+
+  csn_context.other_valid = false;
+  for (uint8_t slot = 0U; slot < CSN_SLOT_NB; slot++)
+  {
+    if (CSN_record_read(slot) == true)
+    {
+      if (p_record == NULL)
+      {
+        csn_stored = csn_buffer;
+        csn_context.slot = slot;
+        p_record = &csn_stored.record;
+      }
+      else
+      {
+        /* most recent record: sequence difference to handle the wrap around */
+        if ((int32_t)(csn_buffer.record.sequence - csn_stored.record.sequence) > 0)
+        {
+          csn_stored = csn_buffer;
+          csn_context.slot = slot;
+        }
+        csn_context.other_valid = true;
+      }
+    }
+  }
+
+  return (p_record);
+}
+
+/**
+  * @brief  erases the flash page of a slot
+  * @note   flash must be unlocked
+  * @param  slot - slot to erase
+  * @retval bool - true: erase OK
+  */
+static bool CSN_flash_erase(uint8_t slot)
+{
+  FLASH_EraseInitTypeDef erase;
+  uint32_t page_error;
+  uint32_t offset;
+
+  offset = CSN_SLOT_ADDR(slot) - FLASH_BASE;
+
+  erase.TypeErase = FLASH_TYPEERASE_PAGES;
+  erase.NbPages   = 1U;
+  if (READ_BIT(FLASH->OPTR, FLASH_OPTR_DBANK) != 0U)
+  {
+    /* dual bank mode */
+    if (offset >= FLASH_BANK_SIZE)
+    {
+      erase.Banks = FLASH_BANK_2;
+      offset -= FLASH_BANK_SIZE;
+    }
+    else
+    {
+      erase.Banks = FLASH_BANK_1;
+    }
+    erase.Page = offset / FLASH_PAGE_SIZE;
+  }
+  else
+  {
+    /* single bank mode: 128 bits pages */
+    erase.Banks = FLASH_BANK_1;
+    erase.Page  = offset / FLASH_PAGE_SIZE_128_BITS;
+  }
+
+  return (HAL_FLASHEx_Erase(&erase, &page_error) == HAL_OK);
+}
+
+/**
+  * @brief  writes record built in csn_buffer to a slot
+  * @param  slot - slot to write
+  * @retval bool - true: write OK
+  */
+static bool CSN_flash_write(uint8_t slot)
+{
+  bool result;
+
+  (void)HAL_FLASH_Unlock();
+  __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+
+  result = CSN_flash_erase(slot);
+  for (uint32_t i = 0U; (i < CSN_RECORD_DWORD_NB) && (result == true); i++)
+  {
+    result = (HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD,
+                                CSN_SLOT_ADDR(slot) + (i * sizeof(uint64_t)),
+                                csn_buffer.dword[i]) == HAL_OK);
+  }
+
+  (void)HAL_FLASH_Lock();
+
+  return (result);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  checks if modem configuration stored in flash matches the current configuration
+  * @note   the configuration fingerprint is kept to be used by CSN_ConfigStore()
+  * @param  p_params    - current cellular parameters
+  * @param  slot_index  - index of the active SIM slot
+  * @param  p_imsi      - IMSI stored in flash (set only on match, CA_IMSI_SIZE_MAX bytes)
+  * @retval bool        - true: configuration already applied in modem, false: full init needed
+  */
+bool CSN_ConfigCheck(const dc_cellular_params_t *p_params, uint8_t slot_index, uint8_t *p_imsi)
+{
+  const dc_sim_slot_t *p_slot = &p_params->sim_slot[slot_index];
+  const csn_record_t  *p_record;
+  uint32_t hash;
+
+  /* fingerprint of the parameters used to configure the modem during init:
+   * fields are hashed one by one to not depend on structure padding */
+  hash = CSN_hash(CSN_FNV_OFFSET_BASIS, (const void *)&p_params->target_state, sizeof(p_params->target_state));
+  hash = CSN_hash(hash, (const void *)&slot_index, sizeof(slot_index));
+  hash = CSN_hash(hash, (const void *)&p_slot->sim_slot_type, sizeof(p_slot->sim_slot_type));
+  hash = CSN_hash(hash, (const void *)&p_slot->apnSendToModem, sizeof(p_slot->apnSendToModem));
+  hash = CSN_hash(hash, (const void *)&p_slot->apnPresent, sizeof(p_slot->apnPresent));
+  hash = CSN_hash(hash, (const void *)&p_slot->cid, sizeof(p_slot->cid));
+  hash = CSN_hash(hash, (const void *)p_slot->apn, crs_strlen(p_slot->apn));
+  hash = CSN_hash(hash, (const void *)p_slot->username, crs_strlen(p_slot->username));
+  hash = CSN_hash(hash, (const void *)p_slot->password, crs_strlen(p_slot->password));
+  csn_context.fingerprint = hash;
+
+  p_record = CSN_record_get();
+  csn_context.applied = ((p_record != NULL) && (p_record->fingerprint == hash));
+  if (csn_context.applied == true)
+  {
+    (void)memcpy((void *)p_imsi, (const void *)p_record->imsi, CA_IMSI_SIZE_MAX);
+  }
+
+  PRINT_CELLULAR_SERVICE("CSN_ConfigCheck: fingerprint %lx %s\n\r", hash,
+                         (csn_context.applied == true) ? "match" : "mismatch")
+
+  return (csn_context.applied);
+}
+
+/**
+  * @brief  gets modem identity stored in flash
+  * @note   available only if CSN_ConfigCheck() has returned true
+  * @param  p_info  - cellular info updated with stored identity (imei, manufacturer, model...)
+  * @retval bool    - true: identity updated, false: identity must be requested to modem
+  */
+bool CSN_IdentityGet(dc_cellular_info_t *p_info)
+{
+  const csn_record_t *p_record = NULL;
+
+  if (csn_context.applied == true)
+  {
+    p_record = CSN_record_get();
+  }
+
+  if (p_record != NULL)
+  {
+    (void)memcpy((void *)p_info->imei, (const void *)p_record->imei, CA_IMEI_SIZE_MAX);
+    (void)memcpy((void *)p_info->manufacturer_name, (const void *)p_record->manufacturer_name,
+                 CA_MANUFACTURER_ID_SIZE_MAX);
+    (void)memcpy((void *)p_info->model, (const void *)p_record->model, CA_MODEL_ID_SIZE_MAX);
+    (void)memcpy((void *)p_info->revision, (const void *)p_record->revision, CA_REVISION_ID_SIZE_MAX);
+    (void)memcpy((void *)p_info->serial_number, (const void *)p_record->serial_number,
+                 CA_SERIAL_NUMBER_ID_SIZE_MAX);
+    (void)memcpy((void *)p_info->iccid, (const void *)p_record->iccid, CA_ICCID_SIZE_MAX);
+  }
+
+  return (p_record != NULL);
+}
+
+/**
+  * @brief  stores applied modem configuration in flash (flash is written only if content has changed)
+  * @param  p_info  - cellular info containing modem identity
+  * @param  p_imsi  - IMSI of the SIM in use
+  * @retval bool    - false: SIM has changed since the configuration has been stored,
+  *                   cache is invalidated and a full modem init is needed
+  */
+bool CSN_ConfigStore(const dc_cellular_info_t *p_info, const uint8_t *p_imsi)
+{
+  const csn_record_t *p_record;
+  uint8_t slot;
+  bool result = true;
+
+  /* csn_buffer used to read the records: get the stored record before to build the new one */
+  p_record = CSN_record_get();
+
+  (void)memset((void *)&csn_buffer, 0, sizeof(csn_buffer));
+  csn_buffer.record.magic       = CSN_RECORD_MAGIC;
+  csn_buffer.record.sequence    = (p_record != NULL) ? (p_record->sequence + 1U) : 0U;
+  csn_buffer.record.fingerprint = csn_context.fingerprint;
+  (void)memcpy((void *)csn_buffer.record.imsi, (const void *)p_imsi, CA_IMSI_SIZE_MAX);
+  (void)memcpy((void *)csn_buffer.record.imei, (const void *)p_info->imei, CA_IMEI_SIZE_MAX);
+  (void)memcpy((void *)csn_buffer.record.manufacturer_name, (const void *)p_info->manufacturer_name,
+               CA_MANUFACTURER_ID_SIZE_MAX);
+  (void)memcpy((void *)csn_buffer.record.model, (const void *)p_info->model, CA_MODEL_ID_SIZE_MAX);
+  (void)memcpy((void *)csn_buffer.record.revision, (const void *)p_info->revision, CA_REVISION_ID_SIZE_MAX);
+  (void)memcpy((void *)csn_buffer.record.serial_number, (const void *)p_info->serial_number,
+               CA_SERIAL_NUMBER_ID_SIZE_MAX);
+  (void)memcpy((void *)csn_buffer.record.iccid, (const void *)p_info->iccid, CA_ICCID_SIZE_MAX);
+  csn_buffer.record.checksum = CSN_record_checksum(&csn_buffer.record);
+
+  if ((csn_context.applied == true)
+      && ((p_record == NULL) || (memcmp((const void *)p_record->imsi, (const void *)p_imsi, CA_IMSI_SIZE_MAX) != 0)))
+  {
+    /* modem init has been skipped with the configuration of another SIM */
+    PRINT_CELLULAR_SERVICE("CSN_ConfigStore: SIM changed, modem config cache invalidated\n\r")
+    CSN_ConfigInvalidate();
+    result = false;
+  }
+  else if ((p_record != NULL)
+           && (memcmp((const void *)&p_record->fingerprint, (const void *)&csn_buffer.record.fingerprint,
+                      offsetof(csn_record_t, checksum) - offsetof(csn_record_t, fingerprint)) == 0))
+  {
+    /* nothing changed: avoid useless flash erase */
+    __NOP();
+  }
+  else
+  {
+    /* write in the other slot: the stored record stays valid if the write is interrupted */
+    slot = (p_record != NULL) ? (uint8_t)(CSN_SLOT_NB - 1U - csn_context.slot) : 0U;
+    if (CSN_flash_write(slot) == true)
+    {
+      PRINT_CELLULAR_SERVICE("CSN_ConfigStore: modem config cache updated\n\r")
+    }
+    else
+    {
+      PRINT_CELLULAR_SERVICE("CSN_ConfigStore: flash write error\n\r")
+    }
+  }
+
+  return (result);
+}
+
+/**
+  * @brief  invalidates modem configuration stored in flash: next boot will do a full modem init
+  * @param  -
+  * @retval -
+  */
+void CSN_ConfigInvalidate(void)
+{
+  csn_context.applied = false;
+
+  /* erase only if needed to limit flash wear */
+  if (CSN_record_get() != NULL)
+  {
+    (void)HAL_FLASH_Unlock();
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+    /* older record first: if interrupted, the last record stays the valid one */
+    if (csn_context.other_valid == true)
+    {
+      (void)CSN_flash_erase((uint8_t)(CSN_SLOT_NB - 1U - csn_context.slot));
+    }
+    (void)CSN_flash_erase(csn_context.slot);
+    (void)HAL_FLASH_Lock();
+  }
+}
+
+/**
+  * @brief  handles a flash ECC double error NMI
+  * @note   to call from NMI_Handler
+  * @param  -
+  * @retval bool - true: error raised by a record read, the record is discarded and the NMI is cleared
+  *                false: error not related to the modem configuration cache
+  */
+bool CSN_FlashEccErrorCallback(void)
+{
+  bool result = false;
+
+  if ((csn_read_on_going == true) && (__HAL_FLASH_GET_FLAG(FLASH_FLAG_ECCD) != 0U))
+  {
+    csn_read_ecc_error = true;
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ECCD);
+    result = true;
+  }
+
+  return (result);
+}
+
+#endif /* (CST_MODEM_CONFIG_CACHE == 1U) */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
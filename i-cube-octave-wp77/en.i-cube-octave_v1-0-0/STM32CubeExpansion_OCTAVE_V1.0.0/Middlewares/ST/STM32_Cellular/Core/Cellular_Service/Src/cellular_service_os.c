@@ -24,18 +24,141 @@
 #include "cellular_service_os.h"
 
 /* Private typedef -----------------------------------------------------------*/
+typedef uint8_t cso_class_t;
 
 /* Private defines -----------------------------------------------------------*/
+/* Classes of requests: one per socket, one for Com MDM (ORP) transactions, one for other services */
+#define CSO_CLASS_COM_MDM  ((cso_class_t)CELLULAR_MAX_SOCKETS)
+#define CSO_CLASS_SERVICE  ((cso_class_t)(CELLULAR_MAX_SOCKETS + 1U))
+#define CSO_CLASS_NB       (CELLULAR_MAX_SOCKETS + 2U)
 
 /* Private macros ------------------------------------------------------------*/
+#define CSO_SOCKET_CLASS(handle) ((((handle) >= 0) && ((handle) < (socket_handle_t)CELLULAR_MAX_SOCKETS)) ? \
+                                  (cso_class_t)(handle) : CSO_CLASS_SERVICE)
 
 /* Private variables ---------------------------------------------------------*/
+/* protects the Cellular Service access: held by the owner during the whole request */
 static osMutexId CellularServiceMutexHandle;
 static osMutexId CellularServiceGeneralMutexHandle;
 
+#if (CS_FAIR_SCHEDULING == 1U)
+static osMutexId CellularServiceSchedMutexHandle;       /* protects the scheduler context */
+static osSemaphoreId cso_class_semaphore[CSO_CLASS_NB]; /* selection of the next request of a class */
+static uint8_t cso_class_waiting[CSO_CLASS_NB];         /* number of requests waiting per class */
+static bool cso_busy;                                   /* Cellular Service access in use */
+static bool cso_next_selected;                          /* next request selected, waits for the access */
+static cso_class_t cso_last_class;                      /* class of the last selected request */
+#endif /* CS_FAIR_SCHEDULING == 1U */
+
 /* Global variables ----------------------------------------------------------*/
 
 /* Private function prototypes -----------------------------------------------*/
+#if (CS_FAIR_SCHEDULING == 1U)
+static void cso_select_next(void);
+#endif /* CS_FAIR_SCHEDULING == 1U */
+static void cso_lock(cso_class_t req_class);
+static void cso_unlock(void);
+
+/* Private function Definition -----------------------------------------------*/
+#if (CS_FAIR_SCHEDULING == 1U)
+/**
+ * @brief  Select the next request to get the Cellular Service access
+ * @note   Called with the scheduler context protected. The next class having a waiting request
+ *         (round robin) is selected and one of its requests is woken up: it waits on the access mutex,
+ *         so the current owner inherits its priority until the access is released.
+ * @param  -
+ * @retval -
+ */
+static void cso_select_next(void) {
+	uint8_t i;
+	cso_class_t next_class;
+	bool found;
+
+	if (cso_next_selected == false) {
+		found = false;
+		next_class = cso_last_class;
+		for (i = 1U; (i <= CSO_CLASS_NB) && (found == false); i++) {
+			next_class = (cso_class_t) (((uint32_t) cso_last_class + i) % CSO_CLASS_NB);
+			if (cso_class_waiting[next_class] != 0U) {
+				found = true;
+			}
+		}
+		if (found == true) {
+			cso_class_waiting[next_class]--;
+			cso_last_class = next_class;
+			cso_next_selected = true;
+			(void) rtosalSemaphoreRelease(cso_class_semaphore[next_class]);
+		}
+	}
+}
+#endif /* CS_FAIR_SCHEDULING == 1U */
+
+/**
+ * @brief  Get the Cellular Service access for a request
+ * @note   If the access is in use the request waits until its class is selected (round robin),
+ *         then waits for the access mutex (the owner inherits the priority of the selected request)
+ * @param  req_class - class of the request
+ * @retval -
+ */
+static void cso_lock(cso_class_t req_class) {
+#if (CS_FAIR_SCHEDULING == 1U)
+	bool granted;
+
+	(void) rtosalMutexAcquire(CellularServiceSchedMutexHandle, RTOSAL_WAIT_FOREVER);
+	if (cso_busy == false) {
+		cso_busy = true;
+		cso_last_class = req_class;
+		/* access not in use: access mutex is free (see cso_unlock) */
+		(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+		granted = true;
+	} else {
+		cso_class_waiting[req_class]++;
+		/* if no request is selected yet, this one may be selected right now */
+		cso_select_next();
+		granted = false;
+	}
+	(void) rtosalMutexRelease(CellularServiceSchedMutexHandle);
+
+	if (granted == false) {
+		/* Wait to be selected by cso_select_next() */
+		(void) rtosalSemaphoreAcquire(cso_class_semaphore[req_class],
+				RTOSAL_WAIT_FOREVER);
+
+		/* Access mutex: released by the current owner in cso_unlock() */
+		(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+
+		/* Access obtained: select the following request, it will wait on the access mutex */
+		(void) rtosalMutexAcquire(CellularServiceSchedMutexHandle, RTOSAL_WAIT_FOREVER);
+		cso_next_selected = false;
+		cso_select_next();
+		(void) rtosalMutexRelease(CellularServiceSchedMutexHandle);
+	}
+#else
+	(void) req_class;
+	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+#endif /* CS_FAIR_SCHEDULING == 1U */
+}
+
+/**
+ * @brief  Release the Cellular Service access
+ * @note   If a request is selected, the access stays in use and the selected request gets the access mutex
+ * @param  -
+ * @retval -
+ */
+static void cso_unlock(void) {
+#if (CS_FAIR_SCHEDULING == 1U)
+	/* access mutex is released with the scheduler context protected:
+	 * when cso_busy is false, the access mutex is free */
+	(void) rtosalMutexAcquire(CellularServiceSchedMutexHandle, RTOSAL_WAIT_FOREVER);
+	if (cso_next_selected == false) {
+		cso_busy = false;
+	}
+	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	(void) rtosalMutexRelease(CellularServiceSchedMutexHandle);
+#else
+	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+#endif /* CS_FAIR_SCHEDULING == 1U */
+}
 
 /* Functions Definition ------------------------------------------------------*/
 /**
@@ -47,11 +170,11 @@ static osMutexId CellularServiceGeneralMutexHandle;
 CS_Status_t osCS_get_signal_quality(CS_SignalQuality_t *p_sig_qual) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 
 	result = CS_get_signal_quality(p_sig_qual);
 
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -66,10 +189,10 @@ socket_handle_t osCDS_socket_create(CS_IPaddrType_t addr_type,
 		CS_TransportProtocol_t protocol, CS_PDN_conf_id_t cid) {
 	socket_handle_t socket_handle;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 
 	socket_handle = CDS_socket_create(addr_type, protocol, cid);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (socket_handle);
 }
@@ -87,12 +210,12 @@ CS_Status_t osCDS_socket_set_callbacks(socket_handle_t sockHandle,
 		cellular_socket_closed_callback_t remote_close_cb) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_SOCKET_CLASS(sockHandle));
 
 	result = CDS_socket_set_callbacks(sockHandle, data_ready_cb, data_sent_cb,
 			remote_close_cb);
 
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -111,11 +234,11 @@ CS_Status_t osCDS_socket_set_option(socket_handle_t sockHandle,
 		void *p_opt_val) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_SOCKET_CLASS(sockHandle));
 
 	result = CDS_socket_set_option(sockHandle, opt_level, opt_name, p_opt_val);
 
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -133,12 +256,11 @@ CS_Status_t osCDS_socket_get_option(void) {
 	CS_Status_t result = CELLULAR_ERROR;
 
 	if (CST_get_state() == CST_MODEM_DATA_READY_STATE) {
-		(void) rtosalMutexAcquire(CellularServiceMutexHandle,
-				RTOSAL_WAIT_FOREVER);
+		cso_lock(CSO_CLASS_SERVICE);
 
 		result = CDS_socket_get_option();
 
-		(void) rtosalMutexRelease(CellularServiceMutexHandle);
+		cso_unlock();
 	}
 
 	return (result);
@@ -155,12 +277,11 @@ CS_Status_t osCDS_socket_bind(socket_handle_t sockHandle, uint16_t local_port) {
 	CS_Status_t result = CELLULAR_ERROR;
 
 	if (CST_get_state() == CST_MODEM_DATA_READY_STATE) {
-		(void) rtosalMutexAcquire(CellularServiceMutexHandle,
-				RTOSAL_WAIT_FOREVER);
+		cso_lock(CSO_SOCKET_CLASS(sockHandle));
 
 		result = CDS_socket_bind(sockHandle, local_port);
 
-		(void) rtosalMutexRelease(CellularServiceMutexHandle);
+		cso_unlock();
 	}
 
 	return (result);
@@ -180,13 +301,12 @@ CS_Status_t osCDS_socket_connect(socket_handle_t sockHandle,
 	CS_Status_t result = CELLULAR_ERROR;
 
 	if (CST_get_state() == CST_MODEM_DATA_READY_STATE) {
-		(void) rtosalMutexAcquire(CellularServiceMutexHandle,
-				RTOSAL_WAIT_FOREVER);
+		cso_lock(CSO_SOCKET_CLASS(sockHandle));
 
 		result = CDS_socket_connect(sockHandle, addr_type, p_ip_addr_value,
 				remote_port);
 
-		(void) rtosalMutexRelease(CellularServiceMutexHandle);
+		cso_unlock();
 	}
 
 	return (result);
@@ -203,12 +323,11 @@ CS_Status_t osCDS_socket_listen(socket_handle_t sockHandle) {
 	CS_Status_t result = CELLULAR_ERROR;
 
 	if (CST_get_state() == CST_MODEM_DATA_READY_STATE) {
-		(void) rtosalMutexAcquire(CellularServiceMutexHandle,
-				RTOSAL_WAIT_FOREVER);
+		cso_lock(CSO_SOCKET_CLASS(sockHandle));
 
 		result = CDS_socket_listen(sockHandle);
 
-		(void) rtosalMutexRelease(CellularServiceMutexHandle);
+		cso_unlock();
 	}
 
 	return (result);
@@ -227,12 +346,11 @@ CS_Status_t osCDS_socket_send(socket_handle_t sockHandle,
 	CS_Status_t result = CELLULAR_ERROR;
 
 	if (CST_get_state() == CST_MODEM_DATA_READY_STATE) {
-		(void) rtosalMutexAcquire(CellularServiceMutexHandle,
-				RTOSAL_WAIT_FOREVER);
+		cso_lock(CSO_SOCKET_CLASS(sockHandle));
 
 		result = CDS_socket_send(sockHandle, p_buf, length);
 
-		(void) rtosalMutexRelease(CellularServiceMutexHandle);
+		cso_unlock();
 	}
 
 	return (result);
@@ -251,12 +369,11 @@ int32_t osCDS_socket_receive(socket_handle_t sockHandle, CS_CHAR_t *p_buf,
 
 	result = 0;
 	if (CST_get_state() == CST_MODEM_DATA_READY_STATE) {
-		(void) rtosalMutexAcquire(CellularServiceMutexHandle,
-				RTOSAL_WAIT_FOREVER);
+		cso_lock(CSO_SOCKET_CLASS(sockHandle));
 
 		result = CDS_socket_receive(sockHandle, p_buf, max_buf_length);
 
-		(void) rtosalMutexRelease(CellularServiceMutexHandle);
+		cso_unlock();
 	}
 
 	return (result);
@@ -278,13 +395,12 @@ CS_Status_t osCDS_socket_sendto(socket_handle_t sockHandle,
 	CS_Status_t result = CELLULAR_ERROR;
 
 	if (CST_get_state() == CST_MODEM_DATA_READY_STATE) {
-		(void) rtosalMutexAcquire(CellularServiceMutexHandle,
-				RTOSAL_WAIT_FOREVER);
+		cso_lock(CSO_SOCKET_CLASS(sockHandle));
 
 		result = CDS_socket_sendto(sockHandle, p_buf, length, addr_type,
 				p_ip_addr_value, remote_port);
 
-		(void) rtosalMutexRelease(CellularServiceMutexHandle);
+		cso_unlock();
 	}
 
 	return (result);
@@ -304,13 +420,12 @@ int32_t osCDS_socket_receivefrom(socket_handle_t sockHandle, CS_CHAR_t *p_buf,
 
 	result = 0;
 	if (CST_get_state() == CST_MODEM_DATA_READY_STATE) {
-		(void) rtosalMutexAcquire(CellularServiceMutexHandle,
-				RTOSAL_WAIT_FOREVER);
+		cso_lock(CSO_SOCKET_CLASS(sockHandle));
 
 		result = CDS_socket_receivefrom(sockHandle, p_buf, max_buf_length,
 				p_addr_type, p_ip_addr_value, p_remote_port);
 
-		(void) rtosalMutexRelease(CellularServiceMutexHandle);
+		cso_unlock();
 	}
 
 	return (result);
@@ -326,11 +441,11 @@ int32_t osCDS_socket_receivefrom(socket_handle_t sockHandle, CS_CHAR_t *p_buf,
 CS_Status_t osCDS_socket_close(socket_handle_t sockHandle, uint8_t force) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_SOCKET_CLASS(sockHandle));
 
 	result = CDS_socket_close(sockHandle, force);
 
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -346,11 +461,11 @@ CS_Status_t osCDS_socket_cnx_status(socket_handle_t sockHandle,
 		CS_SocketCnxInfos_t *infos) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_SOCKET_CLASS(sockHandle));
 
 	result = CDS_socket_cnx_status(sockHandle, infos);
 
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -363,6 +478,9 @@ CS_Status_t osCDS_socket_cnx_status(socket_handle_t sockHandle,
 CS_Bool_t osCDS_cellular_service_init(void) {
 	static CS_Bool_t CellularServiceInitialized = CELLULAR_FALSE;
 	CS_Bool_t result;
+#if (CS_FAIR_SCHEDULING == 1U)
+	uint8_t i;
+#endif /* CS_FAIR_SCHEDULING == 1U */
 
 	result = CELLULAR_TRUE;
 	if (CellularServiceInitialized == CELLULAR_FALSE) {
@@ -378,6 +496,29 @@ CS_Bool_t osCDS_cellular_service_init(void) {
 			/* Platform is reset */
 			ERROR_Handler(DBG_CHAN_CELLULAR_SERVICE, 2, ERROR_FATAL);
 		}
+#if (CS_FAIR_SCHEDULING == 1U)
+		CellularServiceSchedMutexHandle = rtosalMutexNew(NULL);
+		if (CellularServiceSchedMutexHandle == NULL) {
+			result = CELLULAR_FALSE;
+			/* Platform is reset */
+			ERROR_Handler(DBG_CHAN_CELLULAR_SERVICE, 3, ERROR_FATAL);
+		}
+		cso_busy = false;
+		cso_next_selected = false;
+		cso_last_class = CSO_CLASS_SERVICE;
+		for (i = 0U; i < CSO_CLASS_NB; i++) {
+			cso_class_waiting[i] = 0U;
+			cso_class_semaphore[i] = rtosalSemaphoreNew(NULL, 1U);
+			if (cso_class_semaphore[i] == NULL) {
+				result = CELLULAR_FALSE;
+				/* Platform is reset */
+				ERROR_Handler(DBG_CHAN_CELLULAR_SERVICE, 4, ERROR_FATAL);
+			} else {
+				/* Semaphore is created available: take it */
+				(void) rtosalSemaphoreAcquire(cso_class_semaphore[i], 0U);
+			}
+		}
+#endif /* CS_FAIR_SCHEDULING == 1U */
 
 		/* To do next line of code not done under if result == CELLULAR_TRUE
 		 because if result == CELLULAR_FALSE platform is reset (avoid quality error)
@@ -401,9 +542,9 @@ CS_Bool_t osCDS_cellular_service_init(void) {
 CS_Status_t osCDS_get_net_status(CS_RegistrationStatus_t *p_reg_status) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_get_net_status(p_reg_status);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -417,9 +558,9 @@ CS_Status_t osCDS_get_net_status(CS_RegistrationStatus_t *p_reg_status) {
 CS_Status_t osCDS_get_device_info(CS_DeviceInfo_t *p_devinfo) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_get_device_info(p_devinfo);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -436,9 +577,9 @@ CS_Status_t osCDS_subscribe_net_event(CS_UrcEvent_t event,
 		cellular_urc_callback_t urc_callback) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_subscribe_net_event(event, urc_callback);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -455,9 +596,9 @@ CS_Status_t osCDS_subscribe_modem_event(CS_ModemEvent_t events_mask,
 		cellular_modem_event_callback_t modem_evt_cb) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_subscribe_modem_event(events_mask, modem_evt_cb);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -472,10 +613,9 @@ CS_Status_t osCDS_power_on(void) {
 	CS_Status_t result = CELLULAR_OK;
 
 	if (cst_context.modem_on == false) {
-		(void) rtosalMutexAcquire(CellularServiceMutexHandle,
-				RTOSAL_WAIT_FOREVER);
+		cso_lock(CSO_CLASS_SERVICE);
 		result = CS_power_on();
-		(void) rtosalMutexRelease(CellularServiceMutexHandle);
+		cso_unlock();
 		if (result == CELLULAR_OK) {
 			cst_context.modem_on = true;
 		}
@@ -493,10 +633,9 @@ CS_Status_t osCDS_power_off(void) {
 	CS_Status_t result = CELLULAR_OK;
 
 	if (cst_context.modem_on == true) {
-		(void) rtosalMutexAcquire(CellularServiceMutexHandle,
-				RTOSAL_WAIT_FOREVER);
+		cso_lock(CSO_CLASS_SERVICE);
 		result = CS_power_off();
-		(void) rtosalMutexRelease(CellularServiceMutexHandle);
+		cso_unlock();
 		if (result == CELLULAR_OK) {
 			cst_context.modem_on = false;
 		}
@@ -513,9 +652,9 @@ CS_Status_t osCDS_power_off(void) {
 CS_Status_t osCDS_reset(CS_Reset_t rst_type) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_reset(rst_type);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -531,9 +670,9 @@ CS_Status_t osCDS_init_modem(CS_ModemInit_t init, CS_Bool_t reset,
 		const CS_CHAR_t *pin_code) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_init_modem(init, reset, pin_code);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -569,9 +708,9 @@ CS_Status_t osCDS_register_net(CS_OperatorSelector_t *p_operator,
 		CS_RegistrationStatus_t *p_reg_status) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_register_net(p_operator, p_reg_status);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -584,9 +723,9 @@ CS_Status_t osCDS_register_net(CS_OperatorSelector_t *p_operator,
 CS_Status_t osCS_detach_PS_domain(void) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_detach_PS_domain();
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -600,9 +739,9 @@ CS_Status_t osCS_detach_PS_domain(void) {
 CS_Status_t osCDS_get_attach_status(CS_PSattach_t *p_attach) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_get_attach_status(p_attach);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -616,9 +755,9 @@ CS_Status_t osCDS_get_attach_status(CS_PSattach_t *p_attach) {
 CS_Status_t osCDS_attach_PS_domain(void) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_attach_PS_domain();
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -633,9 +772,9 @@ CS_Status_t osCDS_define_pdn(CS_PDN_conf_id_t cid, const CS_CHAR_t *apn,
 		CS_PDN_configuration_t *pdn_conf) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_define_pdn(cid, apn, pdn_conf);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -653,9 +792,9 @@ CS_Status_t osCDS_register_pdn_event(CS_PDN_conf_id_t cid,
 		cellular_pdn_event_callback_t pdn_event_callback) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_register_pdn_event(cid, pdn_event_callback);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -670,9 +809,9 @@ CS_Status_t osCDS_register_pdn_event(CS_PDN_conf_id_t cid,
 CS_Status_t osCDS_set_default_pdn(CS_PDN_conf_id_t cid) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_set_default_pdn(cid);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -688,9 +827,9 @@ CS_Status_t osCDS_set_default_pdn(CS_PDN_conf_id_t cid) {
 CS_Status_t osCDS_activate_pdn(CS_PDN_conf_id_t cid) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_activate_pdn(cid);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -704,9 +843,9 @@ CS_Status_t osCDS_activate_pdn(CS_PDN_conf_id_t cid) {
 CS_Status_t osCDS_suspend_data(void) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_suspend_data();
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -720,9 +859,9 @@ CS_Status_t osCDS_suspend_data(void) {
 CS_Status_t osCDS_resume_data(void) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_resume_data();
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -738,9 +877,9 @@ CS_Status_t osCDS_dns_request(CS_PDN_conf_id_t cid, CS_DnsReq_t *dns_req,
 		CS_DnsResp_t *dns_resp) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_dns_request(cid, dns_req, dns_resp);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -756,9 +895,9 @@ CS_Status_t osCDS_ping(CS_PDN_conf_id_t cid, CS_Ping_params_t *ping_params,
 		cellular_ping_response_callback_t cs_ping_rsp_cb) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CDS_ping(cid, ping_params, cs_ping_rsp_cb);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -774,9 +913,9 @@ CS_Status_t osCDS_direct_cmd(CS_direct_cmd_tx_t *direct_cmd_tx,
 		cellular_direct_cmd_callback_t direct_cmd_callback) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_direct_cmd(direct_cmd_tx, direct_cmd_callback);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -791,9 +930,9 @@ CS_Status_t osCDS_get_dev_IP_address(CS_PDN_conf_id_t cid,
 		CS_IPaddrType_t *ip_addr_type, CS_CHAR_t *p_ip_addr_value) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_get_dev_IP_address(cid, ip_addr_type, p_ip_addr_value);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -808,9 +947,9 @@ CS_Status_t osCDS_get_dev_IP_address(CS_PDN_conf_id_t cid,
 CS_Status_t osCS_sim_select(CS_SimSlot_t simSelected) {
 	CS_Status_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_sim_select(simSelected);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -826,9 +965,9 @@ CS_Status_t osCS_sim_select(CS_SimSlot_t simSelected) {
 int32_t osCS_sim_generic_access(CS_sim_generic_access_t *sim_generic_access) {
 	int32_t result;
 
-	(void) rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+	cso_lock(CSO_CLASS_SERVICE);
 	result = CS_sim_generic_access(sim_generic_access);
-	(void) rtosalMutexRelease(CellularServiceMutexHandle);
+	cso_unlock();
 
 	return (result);
 }
@@ -849,9 +988,9 @@ CS_Status_t osCS_InitPowerConfig(CS_init_power_config_t *p_power_config,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cso_lock(CSO_CLASS_SERVICE);
   result = CS_InitPowerConfig(p_power_config, power_status_callback);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cso_unlock();
 
   return (result);
 }
@@ -866,9 +1005,9 @@ CS_Status_t osCS_PowerWakeup(CS_wakeup_origin_t wakeup_origin)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cso_lock(CSO_CLASS_SERVICE);
   result = CS_PowerWakeup(wakeup_origin);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cso_unlock();
 
   return (result);
 }
@@ -884,9 +1023,9 @@ CS_Status_t osCS_SleepCancel(void)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cso_lock(CSO_CLASS_SERVICE);
   result = CS_SleepCancel();
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cso_unlock();
 
   return (result);
 }
@@ -901,9 +1040,9 @@ CS_Status_t osCS_SleepRequest(void)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cso_lock(CSO_CLASS_SERVICE);
   result = CS_SleepRequest();
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cso_unlock();
 
   return (result);
 }
@@ -918,9 +1057,9 @@ CS_Status_t osCS_SleepComplete(void)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cso_lock(CSO_CLASS_SERVICE);
   result = CS_SleepComplete();
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cso_unlock();
 
   return (result);
 }
@@ -935,9 +1074,9 @@ CS_Status_t osCS_SetPowerConfig(CS_set_power_config_t *p_power_config)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cso_lock(CSO_CLASS_SERVICE);
   result = CS_SetPowerConfig(p_power_config);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cso_unlock();
 
   return (result);
 }
@@ -962,9 +1101,9 @@ CS_Status_t osCS_SetPowerConfig(CS_set_power_config_t *p_power_config)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cso_lock(CSO_CLASS_SERVICE);
   result = CS_ComMdm_subscribe_event(commdm_urc_cb);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cso_unlock();
 
   return (result);
 }
@@ -981,9 +1120,9 @@ CS_Status_t osCS_ComMdm_transaction(CS_Tx_Buffer_t *txBuf, CS_Rx_Buffer_t *rxBuf
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cso_lock(CSO_CLASS_COM_MDM);
   result = CS_ComMdm_transaction(txBuf, rxBuf, errorCode);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cso_unlock();
 
   return (result);
 }
@@ -999,9 +1138,9 @@ CS_Status_t osCS_ComMdm_send(CS_Tx_Buffer_t *txBuf, int32_t *errorCode)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cso_lock(CSO_CLASS_COM_MDM);
   result = CS_ComMdm_send(txBuf, errorCode);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cso_unlock();
 
   return (result);
 }
@@ -1017,9 +1156,9 @@ CS_Status_t osCS_ComMdm_receive(CS_Rx_Buffer_t *rxBuf, int32_t *errorCode)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cso_lock(CSO_CLASS_COM_MDM);
   result = CS_ComMdm_receive(rxBuf, errorCode);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cso_unlock();
 
   return (result);
 }
@@ -28,9 +28,12 @@
 #include "cellular_service_task.h"
 #include "cellular_service_utils.h"
 #include "cellular_service_power.h"
+#include "cellular_service_txsched.h"
+#include "cellular_service_activity.h"
 #include "cellular_service_os.h"
 
 #include "rtosal.h"
+#include "at_core.h"
 
 #if (USE_CMD_CONSOLE == 1)
 #include "cmd.h"
@@ -79,6 +82,7 @@ static const uint8_t *CSP_power_state_name[] =
 };
 /*  mutual exclusion */
 /* static osMutexId         CSP_mutex = NULL; */
+
 #if (USE_CMD_CONSOLE == 1)
 typedef struct
 {
@@ -167,6 +171,8 @@ static void CSP_HelpCmd(void)
   PRINT_FORCE("%s mode [runrealtime|runinteractive|idle|ildllp|lp|ulp] (select power mode)\n\r", CSP_cmd_label)
   PRINT_FORCE("%s idle  (enter in low power)\n\r", CSP_cmd_label)
   PRINT_FORCE("%s wakeup  (leave low power)\n\r", CSP_cmd_label)
+  PRINT_FORCE("%s activity  (Displays the activity tokens preventing low power)\n\r", CSP_cmd_label)
+  PRINT_FORCE("%s txsched  (Displays deferred transmission statistics)\n\r", CSP_cmd_label)
 
   PRINT_FORCE("\n\r")
   PRINT_FORCE("PSM and eDRX configuration can be modified using '%s config set'\n\r", CSP_cmd_label)
@@ -538,6 +544,26 @@ static cmd_status_t CSP_cmd(uint8_t *cmd_line_p)
         PRINT_FORCE("Current power mode: %s\n\r", CSP_power_mode_name[csp_cmd_dc_power_config.power_mode])
 
       }
+      else if (memcmp((CRC_CHAR_t *)argv_p[0], "activity", crs_strlen(argv_p[0])) == 0)
+      {
+        /* 'csp activity' command */
+        PRINT_FORCE("socket transactions  %d\n\r", CSA_GetCount(CSA_ACTIVITY_SOCKET))
+        PRINT_FORCE("socket rx pending    %d\n\r", CSA_GetCount(CSA_ACTIVITY_SOCKET_RX))
+        PRINT_FORCE("mdm transactions     %d\n\r", CSA_GetCount(CSA_ACTIVITY_MDM))
+        PRINT_FORCE("mdm rx pending       %d\n\r", CSA_GetCount(CSA_ACTIVITY_MDM_RX))
+        PRINT_FORCE("AT command ongoing   %d\n\r", (AT_is_processing() == AT_TRUE) ? 1 : 0)
+      }
+      else if (memcmp((CRC_CHAR_t *)argv_p[0], "txsched", crs_strlen(argv_p[0])) == 0)
+      {
+        /* 'csp txsched' command */
+        CSX_Stats_t tx_stats;
+        CSX_GetStats(&tx_stats);
+        PRINT_FORCE("deferred tx pending  %d\n\r", CSX_GetPendingNb())
+        PRINT_FORCE("deferred tx posted   %ld\n\r", tx_stats.posted)
+        PRINT_FORCE("deferred tx flushed  %ld\n\r", tx_stats.flushed)
+        PRINT_FORCE("flush count          %ld\n\r", tx_stats.flush_nb)
+        PRINT_FORCE("wakeups saved        %ld\n\r", tx_stats.wakeups_saved)
+      }
       else if (memcmp((CRC_CHAR_t *)argv_p[0], "idle", crs_strlen(argv_p[0])) == 0)
       {
         /* 'csp idle' command */
@@ -587,6 +613,9 @@ static void CSP_TimeoutTimerCallback(void *argument)
   (void)dc_com_write(&dc_com_db, DC_CELLULAR_POWER_STATUS, (void *)&dc_power_status,
                      sizeof(dc_cellular_power_status_t));
 
+  /* modem did not enter low power: transmit what was waiting for it */
+  CSX_Flush(false);
+
   CST_send_message(CST_MESSAGE_CS_EVENT, CST_POWER_SLEEP_TIMEOUT_EVENT);
 }
 
@@ -608,9 +637,10 @@ void CSP_WakeupComplete(void)
   (void)dc_com_write(&dc_com_db, DC_CELLULAR_POWER_STATUS, (void *)&dc_power_status,
                      sizeof(dc_cellular_power_status_t));
 
-
-
   PRINT_FORCE("++++++++++++++++ power state %s\n\r", CSP_power_state_name[CSP_Context.power_state])
+
+  /* modem wake window: transmit all deferred data together */
+  CSX_Flush(false);
 }
 
 /**
@@ -1122,6 +1152,12 @@ void CSP_Start(void)
   /* init timer for timeout management */
   /* creates timer */
   CSP_timeout_timer_handle = rtosalTimerNew(NULL, (os_ptimer)CSP_TimeoutTimerCallback, osTimerOnce, NULL);
+
+  /* init activity tokens */
+  CSA_Init();
+
+  /* init deferred transmission scheduler */
+  CSX_Init();
 }
 #endif  /* (USE_LOW_POWER == 1) */
 
@@ -1135,6 +1171,16 @@ CSP_PowerState_t CSP_GetTargetPowerState(void)
 {
   return CSP_Context.target_power_state;
 }
+
+/**
+  * @brief  CS power get current power state
+  * @param  none
+  * @retval The actual value of the power state
+  */
+CSP_PowerState_t CSP_GetPowerState(void)
+{
+  return CSP_Context.power_state;
+}
 #endif /* (USE_LOW_POWER == 1) */
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,308 @@
+/**
+  ******************************************************************************
+  * @file    cellular_service_reattach.c
+  * @author  MCD Application Team
+  * @brief   This file defines the network reattach management: the last network
+  *          registered is tried first after a network loss, registration retries
+  *          use a jittered exponential backoff and attachment durations are
+  *          published in Data Cache
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "plf_config.h"
+
+#if (CST_FAST_REATTACH == 1U)
+#include <string.h>
+#include <stdlib.h>
+
+#include "cellular_service_reattach.h"
+#include "cellular_service_task.h"
+#include "cellular_service_utils.h"
+#include "cellular_service_datacache.h"
+#include "dc_common.h"
+#include "rng.h" /* Random functions used for backoff jitter */
+
+#if (USE_PRINTF == 0U)
+#include "trace_interface.h"
+#else
+#include <stdio.h>
+#endif  /* (USE_PRINTF == 0U) */
+
+/* Private defines -----------------------------------------------------------*/
+#define CSR_RETRY_NB_MAX       (16U)  /* backoff exponent is no more increased after CSR_RETRY_NB_MAX failures */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  bool                    on_going;       /*!< attachment on going                                         */
+  bool                    hint_valid;     /*!< last network registered known                               */
+  bool                    hint_used;      /*!< last network requested in current attachment                */
+  bool                    hint_failed;    /*!< last network not found: automatic selection until next one */
+  uint8_t                 retry_nb;       /*!< failed registration attempts in current attachment          */
+  uint32_t                start_tick;     /*!< HAL tick at attachment start                                */
+  uint64_t                time_sum;       /*!< sum of attachment durations (ms)                            */
+  CS_OperatorNameFormat_t format;         /*!< last network registered                                     */
+  CS_CHAR_t               operator_name[MAX_SIZE_OPERATOR_NAME];
+  CS_Bool_t               AcT_present;
+  CS_AccessTechno_t       AcT;
+} csr_context_t;
+
+/* Private macros ------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static csr_context_t csr_context;
+
+/* Global variables ----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t CSR_random(void);
+static void CSR_publish(uint32_t duration, bool failed, uint32_t retry_delay);
+
+/* Private function Definition -----------------------------------------------*/
+
+/**
+  * @brief  returns a random value
+  * @param  -
+  * @retval uint32_t - random value
+  */
+static uint32_t CSR_random(void)
+{
+  uint32_t random;
+
+  if (HAL_OK != HAL_RNG_GenerateRandomNumber(&hrng, &random))
+  {
+    random = (uint32_t)rand();
+  }
+
+  return (random);
+}
+
+/**
+  * @brief  updates attachment metrics in Data Cache
+  * @param  duration    - duration of the attachment just done (ms), 0 if no attachment done
+  * @param  failed      - true: a registration attempt has failed
+  * @param  retry_delay - delay before next registration attempt (ms), 0 if none scheduled
+  * @retval -
+  */
+static void CSR_publish(uint32_t duration, bool failed, uint32_t retry_delay)
+{
+  dc_cellular_attach_info_t attach_info;
+
+  (void)dc_com_read(&dc_com_db, DC_CELLULAR_ATTACH_INFO, (void *)&attach_info, sizeof(attach_info));
+
+  if (duration != 0U)
+  {
+    if (csr_context.hint_used == true)
+    {
+      attach_info.fast_attach_nb++;
+    }
+    attach_info.attach_nb++;
+    attach_info.last_time = duration;
+    if ((attach_info.min_time == 0U) || (duration < attach_info.min_time))
+    {
+      attach_info.min_time = duration;
+    }
+    if (duration > attach_info.max_time)
+    {
+      attach_info.max_time = duration;
+    }
+    attach_info.avg_time = (uint32_t)(csr_context.time_sum / attach_info.attach_nb);
+    attach_info.rt_state = DC_SERVICE_ON;
+  }
+  else if (failed == true)
+  {
+    attach_info.fail_nb++;
+  }
+  else
+  {
+    __NOP();
+  }
+  attach_info.retry_delay = retry_delay;
+  (void)memcpy((void *)attach_info.mno_name, (const void *)csr_context.operator_name, CA_MNO_NAME_SIZE_MAX - 1U);
+  attach_info.mno_name[CA_MNO_NAME_SIZE_MAX - 1U] = 0U;  /* to avoid a non null terminated string */
+  attach_info.access_techno = cst_convert_access_techno(csr_context.AcT);
+
+  (void)dc_com_write(&dc_com_db, DC_CELLULAR_ATTACH_INFO, (void *)&attach_info, sizeof(attach_info));
+}
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  initializes reattach context (last network registered unknown)
+  * @param  -
+  * @retval -
+  */
+void CSR_Init(void)
+{
+  (void)memset((void *)&csr_context, 0, sizeof(csr_context));
+}
+
+/**
+  * @brief  starts a network attachment: boot registration or network loss
+  * @param  -
+  * @retval bool - true: new attachment started, false: attachment already on going
+  */
+bool CSR_AttachStart(void)
+{
+  bool result = false;
+
+  if (csr_context.on_going == false)
+  {
+    csr_context.on_going    = true;
+    csr_context.hint_used   = false;
+    csr_context.hint_failed = false;
+    csr_context.retry_nb    = 0U;
+    csr_context.start_tick  = HAL_GetTick();
+    result = true;
+  }
+
+  return (result);
+}
+
+/**
+  * @brief  selects the last network registered for a registration request
+  * @note   only applied when the configured network selection is automatic:
+  *         the modem falls back to automatic selection if the last network is not found
+  *         Registration is requested by the host after a modem (re)initialization or a registration timeout,
+  *         never on a network loss: the modem is then already reselecting a network on its own
+  * @param  p_operator - operator selector to update
+  * @retval bool - true: last network selected, automatic selection to restore once the request is done
+  */
+bool CSR_OperatorSelect(CS_OperatorSelector_t *p_operator)
+{
+  bool result = false;
+
+  if ((csr_context.hint_valid == true) && (csr_context.hint_failed == false)
+      && (p_operator->mode == CS_NRM_AUTO))
+  {
+    p_operator->mode        = CS_NRM_MANUAL_THEN_AUTO;
+    p_operator->format      = csr_context.format;
+    (void)memcpy((void *)p_operator->operator_name, (const void *)csr_context.operator_name,
+                 sizeof(p_operator->operator_name));
+    p_operator->AcT_present = csr_context.AcT_present;
+    p_operator->AcT         = csr_context.AcT;
+    csr_context.hint_used   = true;
+    result = true;
+    PRINT_CELLULAR_SERVICE("CSR: register with last network %s\n\r", csr_context.operator_name)
+  }
+
+  return (result);
+}
+
+/**
+  * @brief  notifies the modem is registered: ends on going attachment and keeps the network registered
+  * @param  p_reg_status - registration status returned by the modem
+  * @retval -
+  */
+void CSR_AttachDone(const CS_RegistrationStatus_t *p_reg_status)
+{
+  uint32_t duration;
+  bool hint_found = false;
+
+  if ((((uint16_t)p_reg_status->optional_fields_presence & (uint16_t)CS_RSF_FORMAT_PRESENT) != 0U)
+      && (((uint16_t)p_reg_status->optional_fields_presence & (uint16_t)CS_RSF_OPERATOR_NAME_PRESENT) != 0U))
+  {
+    /* fast attachment only if registered on the last network requested:
+     * the modem may have fallen back to automatic selection on another network */
+    if ((csr_context.hint_used == true) && (csr_context.format == p_reg_status->format)
+        && (strncmp((const CRC_CHAR_t *)csr_context.operator_name, (const CRC_CHAR_t *)p_reg_status->operator_name,
+                    MAX_SIZE_OPERATOR_NAME) == 0))
+    {
+      hint_found = true;
+    }
+
+    /* keep the network registered for next attachment */
+    csr_context.format = p_reg_status->format;
+    (void)memcpy((void *)csr_context.operator_name, (const void *)p_reg_status->operator_name,
+                 sizeof(csr_context.operator_name));
+    csr_context.operator_name[MAX_SIZE_OPERATOR_NAME - 1U] = 0U;
+    if (((uint16_t)p_reg_status->optional_fields_presence & (uint16_t)CS_RSF_ACT_PRESENT) != 0U)
+    {
+      csr_context.AcT_present = (CS_Bool_t)true;
+      csr_context.AcT         = p_reg_status->AcT;
+    }
+    else
+    {
+      csr_context.AcT_present = (CS_Bool_t)false;
+    }
+    csr_context.hint_valid = true;
+  }
+
+  if (csr_context.on_going == true)
+  {
+    csr_context.on_going = false;
+    duration = HAL_GetTick() - csr_context.start_tick;
+    if (duration == 0U)
+    {
+      duration = 1U; /* 0 means no attachment done */
+    }
+    csr_context.time_sum += duration;
+    /* fast attachment only if the last network has been found */
+    csr_context.hint_used = hint_found && (csr_context.hint_failed == false);
+    PRINT_CELLULAR_SERVICE("CSR: attached in %ld ms (%d failed attempts)\n\r", duration, csr_context.retry_nb)
+    CSR_publish(duration, false, 0U);
+    csr_context.retry_nb = 0U;
+  }
+}
+
+/**
+  * @brief  notifies a registration attempt has failed and computes the delay before next attempt
+  * @note   jittered exponential backoff from CST_REATTACH_BACKOFF_MIN to CST_REATTACH_BACKOFF_MAX
+  * @param  min_delay - minimal delay required (NFMC tempo), 0 if none
+  * @param  scheduled - true: caller requests registration again after the returned delay
+  *                     false: next attempt driven by the modem reset (no retry delay published)
+  * @retval uint32_t  - delay before next registration attempt (ms)
+  */
+uint32_t CSR_AttachFailed(uint32_t min_delay, bool scheduled)
+{
+  uint32_t backoff;
+  uint32_t delay;
+  uint8_t  i;
+
+  /* last network not found: next attempts with configured network selection */
+  if (csr_context.hint_used == true)
+  {
+    csr_context.hint_failed = true;
+  }
+
+  /* backoff doubles at each failure: CST_REATTACH_BACKOFF_MIN * 2^retry_nb */
+  backoff = CST_REATTACH_BACKOFF_MIN;
+  for (i = 0U; (i < csr_context.retry_nb) && (backoff < CST_REATTACH_BACKOFF_MAX); i++)
+  {
+    backoff = backoff * 2U;
+  }
+  if (backoff > CST_REATTACH_BACKOFF_MAX)
+  {
+    backoff = CST_REATTACH_BACKOFF_MAX;
+  }
+  if (csr_context.retry_nb < CSR_RETRY_NB_MAX)
+  {
+    csr_context.retry_nb++;
+  }
+
+  /* jitter: delay in [backoff/2, backoff] to avoid synchronized retries of a fleet of devices */
+  delay = (backoff / 2U) + (CSR_random() % ((backoff / 2U) + 1U));
+  if (delay < min_delay)
+  {
+    delay = min_delay;
+  }
+
+  PRINT_CELLULAR_SERVICE("CSR: registration attempt %d failed, retry in %ld ms\n\r", csr_context.retry_nb, delay)
+  CSR_publish(0U, true, (scheduled == true) ? delay : 0U);
+
+  return (delay);
+}
+
+#endif /* (CST_FAST_REATTACH == 1U) */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -55,8 +55,21 @@
 
 #if (USE_LOW_POWER == 1)
 #include "cellular_service_power.h"
+#include "cellular_service_activity.h"
 #endif  /* (USE_LOW_POWER == 1) */
 
+#if (CST_MODEM_CONFIG_CACHE == 1U)
+#include "cellular_service_nvm.h"
+#endif  /* (CST_MODEM_CONFIG_CACHE == 1U) */
+
+#if (CST_EVENT_LOG == 1U)
+#include "cellular_service_evtlog.h"
+#endif  /* (CST_EVENT_LOG == 1U) */
+
+#if (CST_FAST_REATTACH == 1U)
+#include "cellular_service_reattach.h"
+#endif  /* (CST_FAST_REATTACH == 1U) */
+
 /* Private defines -----------------------------------------------------------*/
 
 /* Ashu Modified teh below Queue to 15 based on ST recommendation - Workaround */
@@ -156,6 +169,13 @@ static void CST_modem_activate_pdn_mngt(void);
 static void CST_cellular_data_fail_mngt(void);
 static void CST_pdn_event_mngt(void);
 static void CST_polling_timer_mngt(void);
+#if ((CST_MODEM_POLLING_PERIOD != 0) && (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP))
+static void CST_polling_data_mode_mngt(void);
+#endif /* (CST_MODEM_POLLING_PERIOD != 0) && (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP) */
+#if ((CST_MODEM_POLLING_PERIOD != 0) && (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP) && (CST_MODEM_POLLING_ADAPTIVE == 1U))
+static bool CST_polling_is_deferred(void);
+static void CST_polling_backoff_update(bool sig_quality_changed);
+#endif /* (CST_MODEM_POLLING_PERIOD != 0) && (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP) && (CST_MODEM_POLLING_ADAPTIVE == 1U) */
 static void CST_apn_set_new_config_mngt(void);
 static void CST_data_mode_target_state_event_mngt(void);
 static void CST_sim_only_target_state_event_mngt(void);
@@ -190,6 +210,10 @@ static void CST_cellular_service_task(void *argument);
 /* Global variables ----------------------------------------------------------*/
 bool CST_polling_active; /* modem polling activation flag */
 static bool CST_polling_on_going; /* modem polling already asked, and on going */
+#if ((CST_MODEM_POLLING_PERIOD != 0) && (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP) && (CST_MODEM_POLLING_ADAPTIVE == 1U))
+static uint8_t CST_polling_backoff = 1U; /* polling period multiplier */
+static uint8_t CST_polling_skipped = 0U; /* polling timer expirations skipped in current period */
+#endif /* (CST_MODEM_POLLING_PERIOD != 0) && (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP) && (CST_MODEM_POLLING_ADAPTIVE == 1U) */
 
 #if (( USE_TRACE_CELLULAR_SERVICE == 1) || ( USE_CMD_CONSOLE == 1 ))
 /* State names to display */
@@ -357,11 +381,22 @@ static void CST_pdn_activate_retry_timer_callback(void *argument) {
  */
 static void CST_register_retry_timer_callback(void *argument) {
 	UNUSED(argument);
-	/* automaton to reinitialize : sends a message to automaton */
-	cst_nfmc_context.nfmc_timer_on_going = false;
+#if (CST_FAST_REATTACH == 1U)
+	if (cst_nfmc_context.active == false) {
+		/* modem still powered on: request registration again if not registered meanwhile */
+		if (cst_context.current_state == CST_WAITING_FOR_NETWORK_STATUS_STATE) {
+			CST_set_state(CST_MODEM_READY_STATE);
+			CST_send_message(CST_MESSAGE_CS_EVENT, CST_MODEM_READY_EVENT);
+		}
+	} else
+#endif /* (CST_FAST_REATTACH == 1U) */
+	{
+		/* automaton to reinitialize : sends a message to automaton */
+		cst_nfmc_context.nfmc_timer_on_going = false;
 
-	CST_set_state(CST_MODEM_INIT_STATE);
-	CST_send_message(CST_MESSAGE_CS_EVENT, CST_MODEM_INIT_EVENT);
+		CST_set_state(CST_MODEM_INIT_STATE);
+		CST_send_message(CST_MESSAGE_CS_EVENT, CST_MODEM_INIT_EVENT);
+	}
 }
 
 /**
@@ -435,7 +470,11 @@ static void CST_lp_inactivity_timer_callback(void *argument)
   UNUSED(argument);
   /* Netwok inactivity timeout has occurred: enter in low power mode */
   PRINT_CELLULAR_SERVICE("*********** CST_lp_inactivity_timer_callback ********\n\r")
-  (void)CSP_CSIdle();
+  /* Not while a transaction or unread data is pending: the last activity release requests low power */
+  if (CSA_IsIdle() == true)
+  {
+    (void)CSP_CSIdle();
+  }
 }
 #endif /* (USE_LOW_POWER == 1) */
 /* ===================================================================
@@ -672,6 +711,10 @@ static void CST_reboot_modem_event_mngt(void) {
 static void CST_fota_start_event_mngt(void) {
 	/* FOTA event: FOTA start */
 	PRINT_CELLULAR_SERVICE("Modem event received:  CS_MDMEVENT_FOTA_START\n\r")
+#if (CST_MODEM_CONFIG_CACHE == 1U)
+	/* modem firmware is updated: modem identity and configuration must be read again at next boot */
+	CSN_ConfigInvalidate();
+#endif /* (CST_MODEM_CONFIG_CACHE == 1U) */
 	/* DC_CELLULAR_DATA_INFO, is used for call back management on IP or rt_state modification. */
 	/* So, update this Data Cache structure */
 	(void) dc_com_read(&dc_com_db, DC_CELLULAR_DATA_INFO,
@@ -798,6 +841,10 @@ static void CST_net_register_mngt(void) {
 	CS_RegistrationStatus_t cst_ctxt_reg_status;
 	/* operator context */
 	static CS_OperatorSelector_t ctxt_operator;
+#if (CST_FAST_REATTACH == 1U)
+	static CS_OperatorSelector_t hint_operator;
+	bool hint_selected;
+#endif /* (CST_FAST_REATTACH == 1U) */
 
 	PRINT_CELLULAR_SERVICE("=== CST_net_register_mngt ===\n\r")
 
@@ -822,8 +869,25 @@ static void CST_net_register_mngt(void) {
 	ctxt_operator.AcT =
 			(CS_AccessTechno_t) cst_cellular_params.operator_selector.access_techno;
 
+#if (CST_FAST_REATTACH == 1U)
+	/* modem (re)initialized or registration timeout: try the last network registered */
+	(void) CSR_AttachStart();
+	hint_operator = ctxt_operator;
+	hint_selected = CSR_OperatorSelect(&hint_operator);
+
+	/* find network and register when found */
+	cs_status = osCDS_register_net(
+			(hint_selected == true) ? &hint_operator : &ctxt_operator,
+			&cst_ctxt_reg_status);
+	if ((cs_status == CELLULAR_OK) && (hint_selected == true)) {
+		/* back to automatic selection: the registered network is kept and
+		 * the modem is free to reselect another network later on */
+		cs_status = osCDS_register_net(&ctxt_operator, &cst_ctxt_reg_status);
+	}
+#else
 	/* find network and register when found */
 	cs_status = osCDS_register_net(&ctxt_operator, &cst_ctxt_reg_status);
+#endif /* (CST_FAST_REATTACH == 1U) */
 	if (cs_status == CELLULAR_OK) {
 		/* service OK: update current network status */
 		cst_context.current_EPS_NetworkRegState =
@@ -832,6 +896,9 @@ static void CST_net_register_mngt(void) {
 				cst_ctxt_reg_status.GPRS_NetworkRegState;
 		cst_context.current_CS_NetworkRegState =
 				cst_ctxt_reg_status.CS_NetworkRegState;
+		/* network search launched: get device identity meanwhile */
+		CST_get_device_identity_deferred();
+
 		/*   to force to attach to PS domain by default (in case the Modem does not perform automatic PS attach.) */
 		/*   need to check target state in future. */
 		(void) osCDS_attach_PS_domain();
@@ -844,9 +911,16 @@ static void CST_net_register_mngt(void) {
 		CST_send_message(CST_MESSAGE_CS_EVENT,
 				CST_SIGNAL_QUALITY_TO_CHECK_EVENT);
 	} else {
+		/* identity reads don't need the network: get it before a possible modem reset */
+		CST_get_device_identity_deferred();
+
 		/* unrecoverable error : fail */
 		CST_set_modem_state(&dc_com_db, CA_MODEM_NETWORK_SEARCHING,
 				(uint8_t*) "CA_MODEM_NETWORK_SEARCHING");
+#if (CST_FAST_REATTACH == 1U)
+		/* next attempt driven by CST_config_fail */
+		(void) CSR_AttachFailed(0U, false);
+#endif /* (CST_FAST_REATTACH == 1U) */
 
 		CST_config_fail(((uint8_t*) "CST_net_register_mngt"),
 				CST_MODEM_REGISTER_FAIL, &cst_context.register_reset_count,
@@ -1019,6 +1093,10 @@ static void CST_network_event_mngt(void) {
 #endif /* (USE_LOW_POWER == 1) */
 		CST_set_modem_state(&dc_com_db, CA_MODEM_NETWORK_SEARCHING,
 				(uint8_t*) "CA_MODEM_NETWORK_SEARCHING");
+#if (CST_FAST_REATTACH == 1U)
+		/* network lost: the modem reselects a network on its own, only measure the attachment */
+		(void) CSR_AttachStart();
+#endif /* (CST_FAST_REATTACH == 1U) */
 
 		/* Not event sent because waiting for network status modification (timer polling or modem urc */
 	} else if (ret == CST_NET_UNKNOWN) {
@@ -1063,6 +1141,10 @@ static void CST_data_ready_state_network_event_mngt(void) {
 #endif /* (USE_LOW_POWER == 1) */
 		CST_set_modem_state(&dc_com_db, CA_MODEM_NETWORK_SEARCHING,
 				(uint8_t*) "CA_MODEM_NETWORK_SEARCHING");
+#if (CST_FAST_REATTACH == 1U)
+		/* network lost: the modem reselects a network on its own, only measure the attachment */
+		(void) CSR_AttachStart();
+#endif /* (CST_FAST_REATTACH == 1U) */
 		/* Not event sent because waiting for network status modification (timer polling or modem urc */
 	} else if (ret == CST_NET_UNKNOWN) {
 		CST_send_message(CST_MESSAGE_CS_EVENT, CST_NO_EVENT);
@@ -1085,8 +1167,22 @@ static void CST_data_ready_state_network_event_mngt(void) {
  */
 
 static void CST_nw_reg_timeout_expiration_mngt(void) {
+	uint32_t retry_tempo;
+
 	PRINT_CELLULAR_SERVICE(
 			"-----> NW REG TIMEOUT TIMER EXPIRY WE PWDN THE MODEM \n\r")
+	/* identity reads don't need the network: get it before a possible modem power off */
+	CST_get_device_identity_deferred();
+
+#if (CST_FAST_REATTACH == 1U)
+	/* NFMC tempo is the minimal delay before next attempt */
+	retry_tempo = CSR_AttachFailed(
+			(cst_nfmc_context.active == true) ?
+					cst_nfmc_context.tempo[cst_context.register_retry_tempo_count] :
+					0U, true);
+#else
+	retry_tempo = cst_nfmc_context.tempo[cst_context.register_retry_tempo_count];
+#endif /* (CST_FAST_REATTACH == 1U) */
 	if (cst_nfmc_context.active == true) {
 		cst_nfmc_context.nfmc_timer_on_going = true;
 
@@ -1097,12 +1193,10 @@ static void CST_nw_reg_timeout_expiration_mngt(void) {
 				(uint8_t*) "CA_MODEM_POWER_OFF");
 
 		/* start retry NFMC tempo */
-		(void) rtosalTimerStart(cst_register_retry_timer_handle,
-				cst_nfmc_context.tempo[cst_context.register_retry_tempo_count]);
+		(void) rtosalTimerStart(cst_register_retry_timer_handle, retry_tempo);
 		PRINT_CELLULAR_SERVICE(
 				"-----> CST_waiting_for_network_status NOK - retry tempo %d : %ld\n\r",
-				cst_context.register_retry_tempo_count + 1U,
-				cst_nfmc_context.tempo[cst_context.register_retry_tempo_count])
+				cst_context.register_retry_tempo_count + 1U, retry_tempo)
 
 		cst_context.register_retry_tempo_count++;
 		if (cst_context.register_retry_tempo_count >= CA_NFMC_VALUES_MAX_NB) {
@@ -1110,6 +1204,15 @@ static void CST_nw_reg_timeout_expiration_mngt(void) {
 			cst_context.register_retry_tempo_count = 0U;
 		}
 	}
+#if (CST_FAST_REATTACH == 1U)
+	else {
+		/* modem keeps searching: registration requested again after backoff delay */
+		(void) rtosalTimerStart(cst_register_retry_timer_handle, retry_tempo);
+		PRINT_CELLULAR_SERVICE(
+				"-----> CST_waiting_for_network_status NOK - retry registration in %ld\n\r",
+				retry_tempo)
+	}
+#endif /* (CST_FAST_REATTACH == 1U) */
 }
 
 /**
@@ -1318,6 +1421,10 @@ static void CST_modem_activate_pdn_mngt(void) {
 	cs_status = osCDS_activate_pdn(CS_PDN_CONFIG_DEFAULT);
 
 	if (cs_status != CELLULAR_OK) {
+#if (CST_MODEM_CONFIG_CACHE == 1U)
+		/* PDN definition may have been skipped: do a full modem init at next modem reboot */
+		CSN_ConfigInvalidate();
+#endif /* (CST_MODEM_CONFIG_CACHE == 1U) */
 		if (cst_nfmc_context.active == false) {
 			(void) rtosalTimerStart(cst_pdn_activate_retry_timer_handle,
 					CST_PDN_ACTIVATE_RETRY_DELAY);
@@ -1438,8 +1545,88 @@ static void CST_target_state_cmd_event_mngt(void) {
 	}
 }
 
+#if ((CST_MODEM_POLLING_PERIOD != 0) && (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP) && (CST_MODEM_POLLING_ADAPTIVE == 1U))
+/**
+ * @brief  check if modem polling has to be deferred
+ * @note   polling suspends data mode: it is done only when period is elapsed
+ *         and no data traffic is in flight
+ * @param  -
+ * @retval bool - true: polling deferred, false: polling to do
+ */
+static bool CST_polling_is_deferred(void) {
+	bool deferred;
+
+	CST_polling_skipped++;
+	if (CST_polling_skipped < CST_polling_backoff) {
+		/* signal quality stable: polling period extended */
+		deferred = true;
+	} else if ((HAL_GetTick() - ppposif_get_last_data_tick())
+			< CST_MODEM_POLLING_IDLE_DELAY) {
+		/* data traffic in flight: wait next polling timer */
+		PRINT_CELLULAR_SERVICE("Modem polling deferred: data traffic in flight\n\r")
+		deferred = true;
+	} else {
+		CST_polling_skipped = 0U;
+		deferred = false;
+	}
+
+	return (deferred);
+}
+
+/**
+ * @brief  update modem polling period according to signal quality stability
+ * @param  sig_quality_changed - true: signal quality has changed since last polling
+ * @retval -
+ */
+static void CST_polling_backoff_update(bool sig_quality_changed) {
+	if (sig_quality_changed == true) {
+		CST_polling_backoff = 1U;
+	} else if (CST_polling_backoff < CST_MODEM_POLLING_BACKOFF_MAX) {
+		CST_polling_backoff = (uint8_t) (CST_polling_backoff * 2U);
+		if (CST_polling_backoff > CST_MODEM_POLLING_BACKOFF_MAX) {
+			CST_polling_backoff = CST_MODEM_POLLING_BACKOFF_MAX;
+		}
+	} else {
+		__NOP(); /* Nothing to do: maximum period reached */
+	}
+}
+#endif /* (CST_MODEM_POLLING_PERIOD != 0) && (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP) && (CST_MODEM_POLLING_ADAPTIVE == 1U) */
+
+#if ((CST_MODEM_POLLING_PERIOD != 0) && (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP))
+/**
+ * @brief  poll signal quality in LwIP mode: data mode is suspended during polling
+ * @param  -
+ * @retval -
+ */
+static void CST_polling_data_mode_mngt(void) {
+	CS_Status_t cs_status;
+#if (CST_MODEM_POLLING_ADAPTIVE == 1U)
+	CS_SignalQuality_t sig_quality_prev = cst_context.signal_quality;
+#endif /* CST_MODEM_POLLING_ADAPTIVE == 1U */
+
+	osCCS_get_wait_cs_resource();
+	/* we should read the status if connection lost while changing to at command mode */
+	cs_status = osCDS_suspend_data();
+
+	/* For instance disable the signal polling to test suspend resume  */
+	(void) CST_set_signal_quality();
+	/* we should read the status if connection lost while resuming data */
+	cs_status = osCDS_resume_data();
+	osCCS_get_release_cs_resource();
+	if (cs_status != CELLULAR_OK) {
+		/* to add resume_data failure */
+		CST_cellular_data_fail_mngt();
+	}
+#if (CST_MODEM_POLLING_ADAPTIVE == 1U)
+	CST_polling_backoff_update((sig_quality_prev.rssi != cst_context.signal_quality.rssi)
+			|| (sig_quality_prev.ber != cst_context.signal_quality.ber));
+#endif /* CST_MODEM_POLLING_ADAPTIVE == 1U */
+}
+#endif /* (CST_MODEM_POLLING_PERIOD != 0) && (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP) */
+
 /**
  * @brief  polling management to monitor Signal Quality in 'DATA READY mode'
+ * @note   for LwIP, data mode is suspended while modem is polled
  * @param  -
  * @retval -
  */
@@ -1449,20 +1636,16 @@ static void CST_polling_timer_mngt(void) {
 		if (CST_polling_on_going == false) {
 			CST_polling_on_going = true;
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP)
-      osCCS_get_wait_cs_resource();
-      /* we should read the status if connection lost while changing to at command mode */
-      cs_status = osCDS_suspend_data();
-
-      /* For instance disable the signal polling to test suspend resume  */
-      (void)CST_set_signal_quality();
-      /* we should read the status if connection lost while resuming data */
-      cs_status = osCDS_resume_data();
-      osCCS_get_release_cs_resource();
-      if (cs_status != CELLULAR_OK)
-      {
-        /* to add resume_data failure */
-        CST_cellular_data_fail_mngt();
-      }
+#if (CST_MODEM_POLLING_ADAPTIVE == 1U)
+			if (CST_polling_is_deferred() == true) {
+				/* Data mode is not suspended this time */
+				__NOP();
+			} else {
+				CST_polling_data_mode_mngt();
+			}
+#else
+			CST_polling_data_mode_mngt();
+#endif /* CST_MODEM_POLLING_ADAPTIVE == 1U */
 #else
 			/* For instance disable the signal polling to test suspend resume  */
 			(void) CST_set_signal_quality();
@@ -2387,6 +2570,10 @@ static void CST_cellular_service_task(void *argument) {
 		}
 
 		if (autom_event != CST_NO_EVENT) {
+#if (CST_EVENT_LOG == 1U)
+			CSE_Record(CSE_TYPE_EVENT, (uint8_t) autom_event,
+					cst_context.current_state);
+#endif /* (CST_EVENT_LOG == 1U) */
 			/* Call the right function according to the  automaton current state */
 			switch (cst_context.current_state) {
 			/* ===================================================== */
@@ -2505,6 +2692,9 @@ static void CST_cellular_service_task(void *argument) {
  * @retval -
  */
 void CST_set_state(CST_autom_state_t new_state) {
+#if (CST_EVENT_LOG == 1U)
+	CSE_Record(CSE_TYPE_STATE, (uint8_t) new_state, cst_context.current_state);
+#endif /* (CST_EVENT_LOG == 1U) */
 	cst_context.current_state = new_state;
 	PRINT_CELLULAR_SERVICE("-----> New State: %s <-----\n\r",
 			CST_StateName[new_state])
@@ -2571,6 +2761,12 @@ CS_Status_t CST_cellular_service_init(void) {
 	dc_cellular_target_state_t target_state;
 	CS_Status_t ret;
 
+#if (CST_EVENT_LOG == 1U)
+	CSE_Init();
+#endif /* (CST_EVENT_LOG == 1U) */
+#if (CST_FAST_REATTACH == 1U)
+	CSR_Init();
+#endif /* (CST_FAST_REATTACH == 1U) */
 	CST_set_state(CST_BOOT_STATE);
 
 	/* Init cellular service datacache entries */
@@ -2634,6 +2830,7 @@ CS_Status_t CST_cellular_service_start(void) {
 	dc_nfmc_info_t nfmc_info;
 	uint32_t cst_polling_period;
 	dc_com_status_t dc_ret;
+	dc_com_reg_id_t reg_id;
 	uint32_t cs_ret;
 	CS_Status_t cst_ret;
 	rtosalStatus os_ret;
@@ -2694,9 +2891,23 @@ CS_Status_t CST_cellular_service_start(void) {
 	}
 
 	/* register component to Data Cache  */
-	if (dc_com_core_register_gen_event_cb(&dc_com_db, CST_notif_callback,
-			(const void*) NULL) == DC_COM_INVALID_ENTRY) {
+	reg_id = dc_com_core_register_gen_event_cb(&dc_com_db, CST_notif_callback,
+			(const void*) NULL);
+	if (reg_id == DC_COM_INVALID_ENTRY) {
 		dc_ret = DC_COM_ERROR;
+	} else {
+		/* only entries managed by CST_notif_callback are notified */
+		(void) dc_com_set_res_mask(&dc_com_db, reg_id,
+				DC_COM_RES_MASK(DC_CELLULAR_DATA_INFO)
+						| DC_COM_RES_MASK(DC_CELLULAR_TARGET_STATE_CMD)
+						| DC_COM_RES_MASK(DC_CELLULAR_CONFIG)
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP)
+						| DC_COM_RES_MASK(DC_CELLULAR_INFO)
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP) */
+#if (USE_LOW_POWER == 1)
+						| DC_COM_RES_MASK(DC_CELLULAR_POWER_CONFIG)
+#endif /* (USE_LOW_POWER == 1) */
+						);
 	}
 
 	cst_cellular_info.mno_name[0] = 0U;
@@ -0,0 +1,279 @@
+/**
+  ******************************************************************************
+  * @file    cellular_service_txsched.c
+  * @author  MCD Application Team
+  * @brief   This file defines the deferred transmission scheduler: while the modem
+  *          is in low power (PSM/eDRX), deferrable transmissions wait for the next
+  *          modem wake window or their deadline and are called back together
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "plf_config.h"
+
+#if (USE_LOW_POWER == 1)
+#include <string.h>
+
+#include "cellular_service_txsched.h"
+#include "cellular_service_power.h"
+#include "cellular_service_task.h"
+#include "rtosal.h"
+#include "error_handler.h"
+
+#if (USE_PRINTF == 0U)
+#include "trace_interface.h"
+#else
+#include <stdio.h>
+#endif  /* (USE_PRINTF == 0U) */
+
+/* Private defines -----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Deferred transmission waiting for the next modem wake window */
+typedef struct
+{
+  CSX_Callback_t callback;     /* called to let the application transmit */
+  void           *p_ctx;       /* application context given to callback  */
+  uint32_t       deadline;     /* latest tick at which callback is called */
+} csx_entry_t;
+
+/* Private macros ------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static osTimerId     csx_timer_handle;
+static osMutexId     csx_mutex = NULL;
+static csx_entry_t   csx_table[CSP_TX_SCHEDULER_NB];
+static uint8_t       csx_nb;
+static CSX_Stats_t   csx_stats;
+
+/* Global variables ----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static bool CSX_modem_awake(void);
+static void CSX_timer_callback(void *argument);
+
+/* Private function Definition -----------------------------------------------*/
+
+/**
+  * @brief  checks if the modem can transmit without a wakeup
+  * @param  -
+  * @retval bool - true: low power disabled or not active
+  */
+static bool CSX_modem_awake(void)
+{
+  CSP_PowerState_t power_state = CSP_GetPowerState();
+
+  return ((power_state == CSP_LOW_POWER_DISABLED) || (power_state == CSP_LOW_POWER_INACTIVE));
+}
+
+/**
+  * @brief  timer callback of the earliest deferred transmission deadline
+  * @param  argument - argument (not used)
+  * @retval -
+  */
+static void CSX_timer_callback(void *argument)
+{
+  UNUSED(argument);
+  PRINT_CELLULAR_SERVICE("++++++++++++++++ CSX deadline\n\r")
+
+  /* deadline reached while modem may still be in low power: one wakeup for all pending transmissions */
+  CSX_Flush(true);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  initializes the deferred transmission scheduler (no transmission pending)
+  * @param  -
+  * @retval -
+  */
+void CSX_Init(void)
+{
+  csx_nb = 0U;
+  (void)memset((void *)&csx_stats, 0, sizeof(CSX_Stats_t));
+  csx_timer_handle = rtosalTimerNew(NULL, (os_ptimer)CSX_timer_callback, osTimerOnce, NULL);
+  csx_mutex = rtosalMutexNew(NULL);
+  if (csx_mutex == NULL)
+  {
+    ERROR_Handler(DBG_CHAN_CELLULAR_SERVICE, 1, ERROR_FATAL);
+  }
+}
+
+/**
+  * @brief  calls back all pending deferred transmissions
+  * @note   callbacks are called outside of the scheduler mutex
+  * @param  wakeup_needed - true: flush forced by a deadline or a full table
+  *                         false: modem is already awake
+  * @retval -
+  */
+void CSX_Flush(bool wakeup_needed)
+{
+  csx_entry_t tx_list[CSP_TX_SCHEDULER_NB];
+  uint8_t  tx_nb;
+  uint8_t  i;
+  uint32_t wakeup_nb;
+
+  (void)rtosalMutexAcquire(csx_mutex, RTOSAL_WAIT_FOREVER);
+  tx_nb = csx_nb;
+  for (i = 0U; i < tx_nb; i++)
+  {
+    tx_list[i] = csx_table[i];
+  }
+  csx_nb = 0U;
+  (void)rtosalTimerStop(csx_timer_handle);
+
+  if (tx_nb != 0U)
+  {
+    /* each pending transmission would have woken up the modem on its own */
+    wakeup_nb = ((wakeup_needed == true) && (CSX_modem_awake() == false)) ? 1U : 0U;
+    csx_stats.flushed += tx_nb;
+    csx_stats.flush_nb++;
+    csx_stats.wakeups_saved += (uint32_t)tx_nb - wakeup_nb;
+  }
+  (void)rtosalMutexRelease(csx_mutex);
+
+  if (tx_nb != 0U)
+  {
+    PRINT_CELLULAR_SERVICE("++++++++++++++++ CSX flush %d transmissions\n\r", tx_nb)
+  }
+  for (i = 0U; i < tx_nb; i++)
+  {
+    tx_list[i].callback(tx_list[i].p_ctx);
+  }
+}
+
+/**
+  * @brief  schedules a deferrable transmission
+  * @note   if the modem is awake the callback is called immediately, else it is called
+  *         at the next modem wake window or at the latest when the deadline expires.
+  *         The callback should only post a message to the application task.
+  * @param  callback - function called when the application can transmit
+  * @param  p_ctx    - context given to callback
+  * @param  deadline - maximum delay before callback is called (in ms)
+  * @retval CS_Status_t - CELLULAR_ERROR if callback is NULL
+  */
+CS_Status_t CSX_Schedule(CSX_Callback_t callback, void *p_ctx, uint32_t deadline)
+{
+  CS_Status_t status;
+  bool     immediate;
+  bool     table_full;
+  uint32_t now;
+  uint32_t remaining;
+  uint32_t delay;
+  uint8_t  i;
+
+  status = CELLULAR_OK;
+  immediate = false;
+  table_full = false;
+
+  if (callback == NULL)
+  {
+    status = CELLULAR_ERROR;
+  }
+  else if (csx_mutex == NULL)
+  {
+    /* scheduler not started */
+    immediate = true;
+  }
+  else
+  {
+    (void)rtosalMutexAcquire(csx_mutex, RTOSAL_WAIT_FOREVER);
+    csx_stats.posted++;
+    if ((CSX_modem_awake() == true) || (deadline == 0U))
+    {
+      /* modem awake or no delay allowed: transmit now */
+      csx_stats.flushed++;
+      immediate = true;
+    }
+    else
+    {
+      now = HAL_GetTick();
+      csx_table[csx_nb].callback = callback;
+      csx_table[csx_nb].p_ctx    = p_ctx;
+      csx_table[csx_nb].deadline = now + deadline;
+      csx_nb++;
+
+      if (csx_nb >= CSP_TX_SCHEDULER_NB)
+      {
+        table_full = true;
+      }
+      else
+      {
+        /* arm timer on the earliest deadline */
+        delay = deadline;
+        for (i = 0U; i < csx_nb; i++)
+        {
+          remaining = ((int32_t)(csx_table[i].deadline - now) > 0) ? (csx_table[i].deadline - now) : 1U;
+          if (remaining < delay)
+          {
+            delay = remaining;
+          }
+        }
+        (void)rtosalTimerStart(csx_timer_handle, delay);
+      }
+    }
+    (void)rtosalMutexRelease(csx_mutex);
+  }
+
+  if (immediate == true)
+  {
+    callback(p_ctx);
+  }
+  else if (table_full == true)
+  {
+    CSX_Flush(true);
+  }
+  else
+  {
+    /* Nothing to do */
+    __NOP();
+  }
+
+  return status;
+}
+
+/**
+  * @brief  gets deferred transmission statistics
+  * @param  p_stats - statistics (out)
+  * @retval -
+  */
+void CSX_GetStats(CSX_Stats_t *p_stats)
+{
+  if ((p_stats != NULL) && (csx_mutex != NULL))
+  {
+    (void)rtosalMutexAcquire(csx_mutex, RTOSAL_WAIT_FOREVER);
+    *p_stats = csx_stats;
+    (void)rtosalMutexRelease(csx_mutex);
+  }
+  else if (p_stats != NULL)
+  {
+    (void)memset((void *)p_stats, 0, sizeof(CSX_Stats_t));
+  }
+  else
+  {
+    /* Nothing to do */
+    __NOP();
+  }
+}
+
+/**
+  * @brief  gets the number of transmissions waiting for the next modem wake window
+  * @param  -
+  * @retval uint8_t - pending transmissions
+  */
+uint8_t CSX_GetPendingNb(void)
+{
+  return csx_nb;
+}
+
+#endif /* (USE_LOW_POWER == 1) */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -31,6 +31,15 @@
 #if (USE_LOW_POWER == 1)
 #include "cellular_service_power.h"
 #endif  /* (USE_LOW_POWER == 1) */
+#if (CST_MODEM_CONFIG_CACHE == 1U)
+#include "cellular_service_nvm.h"
+#endif  /* (CST_MODEM_CONFIG_CACHE == 1U) */
+#if (CST_EVENT_LOG == 1U)
+#include "cellular_service_evtlog.h"
+#endif  /* (CST_EVENT_LOG == 1U) */
+#if (CST_FAST_REATTACH == 1U)
+#include "cellular_service_reattach.h"
+#endif  /* (CST_FAST_REATTACH == 1U) */
 #include "error_handler.h"
 
 #include "at_util.h"
@@ -66,6 +75,14 @@ typedef struct
   uint8_t password[CA_PASSWORD_SIZE_MAX];
 } mmcmnc_apn_t;
 
+/* Private variables ---------------------------------------------------------*/
+/* true: modem configuration unchanged since last boot, SIM only init and PDN definition skipped */
+static bool cst_modem_config_cached = false;
+#if (CST_OVERLAPPED_BRINGUP == 1U)
+/* true: device identity not yet requested, done by CST_get_device_identity_deferred() */
+static bool cst_device_identity_pending = false;
+#endif /* (CST_OVERLAPPED_BRINGUP == 1U) */
+
 /* Private function prototypes -----------------------------------------------*/
 
 /**
@@ -98,6 +115,13 @@ static void CST_subscribe_all_net_events(void);
   */
 static void CST_get_device_all_infos(dc_cs_target_state_t  target_state);
 
+/**
+  * @brief  sets modem identity in cellular info
+  * @param  p_device_info  - buffer used for device info requests
+  * @retval -
+  */
+static void CST_get_device_identity(CS_DeviceInfo_t *p_device_info);
+
 /**
   * @brief  URC callback (Unsollicited Result Code from modem)
   * @param  -
@@ -404,7 +428,9 @@ void  CST_modem_sim_init(void)
 
 
   CS_Status_t cs_status;
+  bool        sim_changed;
   cs_status = CELLULAR_OK;
+  sim_changed = false;
   PRINT_CELLULAR_SERVICE("*********** CST_modem_sim_init ********\n\r")
   PRINT_FORCE("Modem Boot OK\r\n")
 
@@ -456,7 +482,21 @@ Reboot modem for modem to use the newly selected sim slot\n\r")
       /* CST_get_device_all_infos */
       /* first check SIM presence */
       CS_DeviceInfo_t cst_imsi_info;
-      cs_status = osCDS_init_modem(CS_CMI_SIM_ONLY, CELLULAR_FALSE, PLF_CELLULAR_SIM_PINCODE);
+#if (CST_MODEM_CONFIG_CACHE == 1U)
+      /* configuration already applied at previous boot: IMSI stored in flash is used to select APN,
+         it is checked against the SIM IMSI once modem is fully initialized */
+      cst_modem_config_cached = CSN_ConfigCheck(&cst_cellular_params, cst_context.sim_slot_index,
+                                                (uint8_t *)cst_imsi_info.u.imsi);
+#endif  /* (CST_MODEM_CONFIG_CACHE == 1U) */
+      if (cst_modem_config_cached == true)
+      {
+        PRINT_CELLULAR_SERVICE("CST_modem_sim_init : modem config unchanged, SIM only init skipped\n\r")
+        cs_status = CELLULAR_OK;
+      }
+      else
+      {
+        cs_status = osCDS_init_modem(CS_CMI_SIM_ONLY, CELLULAR_FALSE, PLF_CELLULAR_SIM_PINCODE);
+      }
       cst_cellular_params.sim_slot[cst_context.sim_slot_index].apnSendToModem =CA_APN_NOT_SEND_TO_MODEM;
       /* write new information to datacache */
       (void)dc_com_write(&dc_com_db, DC_CELLULAR_CONFIG, (void *)&cst_cellular_params, sizeof(cst_cellular_params));
@@ -473,8 +513,11 @@ Reboot modem for modem to use the newly selected sim slot\n\r")
       if (cs_status == CELLULAR_OK)
       {
         /* if SIM Present then read IMSI */
-        cst_imsi_info.field_requested = CS_DIF_IMSI_PRESENT;
-        (void)osCDS_get_device_info(&cst_imsi_info);
+        if (cst_modem_config_cached == false)
+        {
+          cst_imsi_info.field_requested = CS_DIF_IMSI_PRESENT;
+          (void)osCDS_get_device_info(&cst_imsi_info);
+        }
         /* IMSI available => SIM is present on this slot */
         uint32_t cst_imsi_high;
         uint32_t cst_imsi_low;
@@ -634,6 +677,11 @@ call CST_modem_define_pdn with APN not to be send to modem\n\r")
     {
       /* SIM Error: FAIL */
       PRINT_CELLULAR_SERVICE("CST_modem_sim_init : Can't find sim on current slot. Increment sim slot.\n\r")
+#if (CST_MODEM_CONFIG_CACHE == 1U)
+      /* next modem init must be a full one */
+      CSN_ConfigInvalidate();
+      cst_modem_config_cached = false;
+#endif  /* (CST_MODEM_CONFIG_CACHE == 1U) */
       /* No sim found/responding on current sim slot. Increment sim slot to use, to try the next sim slot */
       (void)dc_com_read(&dc_com_db, DC_CELLULAR_SIM_INFO, (void *)&cst_sim_info, sizeof(cst_sim_info));
       cst_sim_info.sim_status[cst_context.sim_slot_index] = CA_SIM_ERROR;
@@ -668,7 +716,30 @@ call CST_modem_define_pdn with APN not to be send to modem\n\r")
       CST_subscribe_all_net_events();
 
       CST_get_device_all_infos(cst_cellular_params.target_state);
-      if (cst_cellular_params.target_state != DC_TARGET_STATE_SIM_ONLY)
+#if (CST_MODEM_CONFIG_CACHE == 1U)
+      /* SIM ready: store applied configuration for next boot and check the SIM has not changed */
+      if ((cst_cellular_params.target_state == DC_TARGET_STATE_FULL)
+          && (cst_sim_info.sim_status[cst_context.sim_slot_index] == CA_SIM_READY)
+#if (CST_OVERLAPPED_BRINGUP == 1U)
+          /* identity not known yet: configuration stored by CST_get_device_identity_deferred() */
+          && (cst_device_identity_pending == false)
+#endif /* (CST_OVERLAPPED_BRINGUP == 1U) */
+          && (CSN_ConfigStore(&cst_cellular_info, cst_sim_info.imsi) == false))
+      {
+        /* modem init has been skipped with the configuration of another SIM: reboot modem for a full init */
+        sim_changed = true;
+        cst_modem_config_cached = false;
+        CST_config_fail(((uint8_t *)"CST_modem_sim_init"),
+                        CST_MODEM_SIM_FAIL,
+                        &cst_context.sim_reset_count,
+                        CST_SIM_RETRY_MAX);
+      }
+#endif  /* (CST_MODEM_CONFIG_CACHE == 1U) */
+      if (sim_changed == true)
+      {
+        __NOP(); /* modem reboot on going */
+      }
+      else if (cst_cellular_params.target_state != DC_TARGET_STATE_SIM_ONLY)
       {
         CST_set_state(CST_MODEM_READY_STATE);
         CST_send_message(CST_MESSAGE_CS_EVENT, CST_MODEM_READY_EVENT);
@@ -819,34 +890,19 @@ void  CST_data_cache_cellular_info_set(dc_service_rt_state_t dc_service_state, d
 }
 
 /**
-  * @brief  sets modem infos in data cache
-  * @param  target_state  - modem target state
+  * @brief  sets modem identity (IMEI, manufacturer, model, revision, serial number, ICCID) in cellular info
+  * @param  p_device_info  - buffer used for device info requests
   * @retval -
   */
-static void CST_get_device_all_infos(dc_cs_target_state_t  target_state)
+static void CST_get_device_identity(CS_DeviceInfo_t *p_device_info)
 {
-  static CS_DeviceInfo_t cst_device_info;
-  CS_Status_t            cs_status;
-  uint16_t               sim_poll_count;
-  bool                   end_of_loop;
-  uint32_t               cst_imsi_high;
-  uint32_t               cst_imsi_low;
-
-  sim_poll_count = 0U;
-
-  (void)memset((void *)&cst_device_info, 0, sizeof(CS_DeviceInfo_t));
-
-  /* read current device info in Data Cache */
-  (void)dc_com_read(&dc_com_db, DC_CELLULAR_INFO, (void *)&cst_cellular_info, sizeof(cst_cellular_info));
-
-
   /* gets IMEI */
-  cst_device_info.field_requested = CS_DIF_IMEI_PRESENT;
-  if (osCDS_get_device_info(&cst_device_info) == CELLULAR_OK)
+  p_device_info->field_requested = CS_DIF_IMEI_PRESENT;
+  if (osCDS_get_device_info(p_device_info) == CELLULAR_OK)
   {
-    (void)memcpy(cst_cellular_info.imei, cst_device_info.u.imei, CA_IMEI_SIZE_MAX - 1U);
+    (void)memcpy(cst_cellular_info.imei, p_device_info->u.imei, CA_IMEI_SIZE_MAX - 1U);
     cst_cellular_info.imei[CA_IMEI_SIZE_MAX - 1U] = 0U;     /* to avoid a non null terminated string */
-    PRINT_CELLULAR_SERVICE(" -IMEI: %s\n\r", cst_device_info.u.imei)
+    PRINT_CELLULAR_SERVICE(" -IMEI: %s\n\r", p_device_info->u.imei)
   }
   else
   {
@@ -856,15 +912,15 @@ static void CST_get_device_all_infos(dc_cs_target_state_t  target_state)
 
 
   /* gets Manufacturer Name  of modem*/
-  cst_device_info.field_requested = CS_DIF_MANUF_NAME_PRESENT;
-  if (osCDS_get_device_info(&cst_device_info) == CELLULAR_OK)
+  p_device_info->field_requested = CS_DIF_MANUF_NAME_PRESENT;
+  if (osCDS_get_device_info(p_device_info) == CELLULAR_OK)
   {
     (void)memcpy((CRC_CHAR_t *)cst_cellular_info.manufacturer_name,
-                 (CRC_CHAR_t *)cst_device_info.u.manufacturer_name,
+                 (CRC_CHAR_t *)p_device_info->u.manufacturer_name,
                  CA_MANUFACTURER_ID_SIZE_MAX - 1U);
     /* to avoid a non null terminated string */
     cst_cellular_info.manufacturer_name[CA_MANUFACTURER_ID_SIZE_MAX - 1U] = 0U;
-    PRINT_CELLULAR_SERVICE(" -MANUFACTURER: %s\n\r", cst_device_info.u.manufacturer_name)
+    PRINT_CELLULAR_SERVICE(" -MANUFACTURER: %s\n\r", p_device_info->u.manufacturer_name)
   }
   else
   {
@@ -873,14 +929,14 @@ static void CST_get_device_all_infos(dc_cs_target_state_t  target_state)
   }
 
   /* gets Model modem  */
-  cst_device_info.field_requested = CS_DIF_MODEL_PRESENT;
-  if (osCDS_get_device_info(&cst_device_info) == CELLULAR_OK)
+  p_device_info->field_requested = CS_DIF_MODEL_PRESENT;
+  if (osCDS_get_device_info(p_device_info) == CELLULAR_OK)
   {
     (void)memcpy((CRC_CHAR_t *)cst_cellular_info.model,
-                 (CRC_CHAR_t *)cst_device_info.u.model,
+                 (CRC_CHAR_t *)p_device_info->u.model,
                  CA_MODEL_ID_SIZE_MAX - 1U);
     cst_cellular_info.model[CA_MODEL_ID_SIZE_MAX - 1U] = 0U; /* to avoid a non null terminated string */
-    PRINT_CELLULAR_SERVICE(" -MODEL: %s\n\r", cst_device_info.u.model)
+    PRINT_CELLULAR_SERVICE(" -MODEL: %s\n\r", p_device_info->u.model)
   }
   else
   {
@@ -889,14 +945,14 @@ static void CST_get_device_all_infos(dc_cs_target_state_t  target_state)
   }
 
   /* gets revision of modem  */
-  cst_device_info.field_requested = CS_DIF_REV_PRESENT;
-  if (osCDS_get_device_info(&cst_device_info) == CELLULAR_OK)
+  p_device_info->field_requested = CS_DIF_REV_PRESENT;
+  if (osCDS_get_device_info(p_device_info) == CELLULAR_OK)
   {
     (void)memcpy((CRC_CHAR_t *)cst_cellular_info.revision,
-                 (CRC_CHAR_t *)cst_device_info.u.revision,
+                 (CRC_CHAR_t *)p_device_info->u.revision,
                  CA_REVISION_ID_SIZE_MAX - 1U);
     cst_cellular_info.revision[CA_REVISION_ID_SIZE_MAX - 1U] = 0U; /* to avoid a non null terminated string */
-    PRINT_CELLULAR_SERVICE(" -REVISION: %s\n\r", cst_device_info.u.revision)
+    PRINT_CELLULAR_SERVICE(" -REVISION: %s\n\r", p_device_info->u.revision)
   }
   else
   {
@@ -905,14 +961,14 @@ static void CST_get_device_all_infos(dc_cs_target_state_t  target_state)
   }
 
   /* gets serial number of modem  */
-  cst_device_info.field_requested = CS_DIF_SN_PRESENT;
-  if (osCDS_get_device_info(&cst_device_info) == CELLULAR_OK)
+  p_device_info->field_requested = CS_DIF_SN_PRESENT;
+  if (osCDS_get_device_info(p_device_info) == CELLULAR_OK)
   {
     (void)memcpy((CRC_CHAR_t *)cst_cellular_info.serial_number,
-                 (CRC_CHAR_t *)cst_device_info.u.serial_number,
+                 (CRC_CHAR_t *)p_device_info->u.serial_number,
                  CA_SERIAL_NUMBER_ID_SIZE_MAX - 1U);
     cst_cellular_info.serial_number[CA_SERIAL_NUMBER_ID_SIZE_MAX - 1U] = 0U; /* to avoid a non null terminated string */
-    PRINT_CELLULAR_SERVICE(" -SERIAL NBR: %s\n\r", cst_device_info.u.serial_number)
+    PRINT_CELLULAR_SERVICE(" -SERIAL NBR: %s\n\r", p_device_info->u.serial_number)
   }
   else
   {
@@ -921,20 +977,92 @@ static void CST_get_device_all_infos(dc_cs_target_state_t  target_state)
   }
 
   /* gets CCCID  */
-  cst_device_info.field_requested = CS_DIF_ICCID_PRESENT;
-  if (osCDS_get_device_info(&cst_device_info) == CELLULAR_OK)
+  p_device_info->field_requested = CS_DIF_ICCID_PRESENT;
+  if (osCDS_get_device_info(p_device_info) == CELLULAR_OK)
   {
     (void)memcpy((CRC_CHAR_t *)cst_cellular_info.iccid,
-                 (CRC_CHAR_t *)cst_device_info.u.iccid,
+                 (CRC_CHAR_t *)p_device_info->u.iccid,
                  CA_ICCID_SIZE_MAX - 1U);
     cst_cellular_info.iccid[CA_ICCID_SIZE_MAX - 1U] = 0U; /* to avoid a non null terminated string */
-    PRINT_CELLULAR_SERVICE(" -ICCID: %s\n\r", cst_device_info.u.iccid)
+    PRINT_CELLULAR_SERVICE(" -ICCID: %s\n\r", p_device_info->u.iccid)
   }
   else
   {
     cst_cellular_info.serial_number[0] = 0U;
     PRINT_CELLULAR_SERVICE("Serial Number error\n\r")
   }
+}
+
+/**
+  * @brief  requests device identity postponed by CST_get_device_all_infos() and sets it in data cache
+  * @param  -
+  * @retval -
+  */
+void CST_get_device_identity_deferred(void)
+{
+#if (CST_OVERLAPPED_BRINGUP == 1U)
+  static CS_DeviceInfo_t cst_device_info_deferred;
+
+  if (cst_device_identity_pending == true)
+  {
+    cst_device_identity_pending = false;
+    (void)memset((void *)&cst_device_info_deferred, 0, sizeof(CS_DeviceInfo_t));
+
+    (void)dc_com_read(&dc_com_db, DC_CELLULAR_INFO, (void *)&cst_cellular_info, sizeof(cst_cellular_info));
+    CST_get_device_identity(&cst_device_info_deferred);
+    (void)dc_com_write(&dc_com_db, DC_CELLULAR_INFO, (void *)&cst_cellular_info, sizeof(cst_cellular_info));
+
+#if (CST_MODEM_CONFIG_CACHE == 1U)
+    /* identity now known: store applied configuration for next boot
+       (modem init has not been skipped, so the SIM change check can not fail) */
+    if (cst_sim_info.sim_status[cst_context.sim_slot_index] == CA_SIM_READY)
+    {
+      (void)CSN_ConfigStore(&cst_cellular_info, cst_sim_info.imsi);
+    }
+#endif  /* (CST_MODEM_CONFIG_CACHE == 1U) */
+  }
+#endif /* (CST_OVERLAPPED_BRINGUP == 1U) */
+}
+
+/**
+  * @brief  sets modem infos in data cache
+  * @param  target_state  - modem target state
+  * @retval -
+  */
+static void CST_get_device_all_infos(dc_cs_target_state_t  target_state)
+{
+  static CS_DeviceInfo_t cst_device_info;
+  CS_Status_t            cs_status;
+  uint16_t               sim_poll_count;
+  bool                   end_of_loop;
+  uint32_t               cst_imsi_high;
+  uint32_t               cst_imsi_low;
+
+  sim_poll_count = 0U;
+
+  (void)memset((void *)&cst_device_info, 0, sizeof(CS_DeviceInfo_t));
+
+  /* read current device info in Data Cache */
+  (void)dc_com_read(&dc_com_db, DC_CELLULAR_INFO, (void *)&cst_cellular_info, sizeof(cst_cellular_info));
+
+
+#if (CST_MODEM_CONFIG_CACHE == 1U)
+  /* modem identity doesn't change: use the one stored in flash when modem init has been skipped */
+  if (CSN_IdentityGet(&cst_cellular_info) == false)
+#endif  /* (CST_MODEM_CONFIG_CACHE == 1U) */
+  {
+#if (CST_OVERLAPPED_BRINGUP == 1U)
+    if (target_state == DC_TARGET_STATE_FULL)
+    {
+      /* identity is not needed to register: requested while the modem searches the network */
+      cst_device_identity_pending = true;
+    }
+    else
+#endif /* (CST_OVERLAPPED_BRINGUP == 1U) */
+    {
+      CST_get_device_identity(&cst_device_info);
+    }
+  }
 
   /* writes updated cellular info in Data Cache */
   (void)dc_com_write(&dc_com_db, DC_CELLULAR_INFO, (void *)&cst_cellular_info, sizeof(cst_cellular_info));
@@ -1050,10 +1178,19 @@ static void CST_modem_define_pdn(uint8_t *apn, uint8_t *username, uint8_t *passw
     }
   }
 
-  /* Set PDN with APN, CID, Username and Password */
-  cs_status = osCDS_define_pdn(cst_get_cid_value(cst_cellular_params.sim_slot[cst_context.sim_slot_index].cid),
-                               (const uint8_t *)apn,
-                               &pdn_conf);
+  if (cst_modem_config_cached == true)
+  {
+    /* PDN already defined with this configuration at previous boot: stored in modem NVM */
+    PRINT_CELLULAR_SERVICE("CST_modem_define_pdn : modem config unchanged, PDN definition skipped\n\r")
+    cs_status = CELLULAR_OK;
+  }
+  else
+  {
+    /* Set PDN with APN, CID, Username and Password */
+    cs_status = osCDS_define_pdn(cst_get_cid_value(cst_cellular_params.sim_slot[cst_context.sim_slot_index].cid),
+                                 (const uint8_t *)apn,
+                                 &pdn_conf);
+  }
 
   if (cs_status != CELLULAR_OK)
   {
@@ -1334,6 +1471,10 @@ cst_network_status_t  CST_get_network_status(void)
         (void)dc_com_write(&dc_com_db,  DC_CELLULAR_SIGNAL_INFO, (void *)&signal_info, sizeof(signal_info));
         PRINT_CELLULAR_SERVICE(" ->operator_name = %s", reg_status.operator_name)
       }
+#if (CST_FAST_REATTACH == 1U)
+      /* end of attachment: keep the network registered */
+      CSR_AttachDone(&reg_status);
+#endif  /* (CST_FAST_REATTACH == 1U) */
     }
   }
   else
@@ -1381,6 +1522,9 @@ void CST_set_modem_state(dc_com_db_t *db, ca_modem_state_t state, const uint8_t
   {
     cellular_info.modem_state = state;
     (void)dc_com_write(db, DC_CELLULAR_INFO, (void *)&cellular_info, sizeof(dc_cellular_info_t));
+#if (CST_EVENT_LOG == 1U)
+    CSE_Record(CSE_TYPE_MODEM_STATE, (uint8_t)state, 0U);
+#endif /* (CST_EVENT_LOG == 1U) */
 #if (USE_TRACE_CELLULAR_SERVICE == 1U)
     PRINT_CELLULAR_SERVICE("*********** modem state : %s\n\r", chr)
 #else
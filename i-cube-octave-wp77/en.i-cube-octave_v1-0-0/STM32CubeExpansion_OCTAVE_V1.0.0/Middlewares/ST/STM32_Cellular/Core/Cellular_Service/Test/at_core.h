@@ -0,0 +1,70 @@
+/**
+  ******************************************************************************
+  * @file    at_core.h
+  * @author  MCD Application Team
+  * @brief   AT Core definitions used by cellular_service.h and
+  *          cellular_service_evtlog.c (host build only)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef AT_CORE_H_
+#define AT_CORE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include "plf_config.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define ATCMD_MAX_BUF_SIZE   ((uint16_t) 128U) /* same value as the target at_core.h */
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  ATSTATUS_OK = 0,
+  ATSTATUS_ERROR,
+  ATSTATUS_TIMEOUT,
+  ATSTATUS_OK_PENDING_URC,
+} at_status_t;
+
+typedef bool at_bool_t;
+#define AT_FALSE  ((at_bool_t)false)
+#define AT_TRUE   ((at_bool_t)true)
+
+#if (CST_EVENT_LOG == 1U)
+typedef uint8_t at_trace_t;
+#define ATTRACE_SID_START        ((at_trace_t) 0U)  /* service request received: id = SID                    */
+#define ATTRACE_SID_END          ((at_trace_t) 1U)  /* service request processed: id = SID, status = result  */
+#define ATTRACE_CMD_SENT         ((at_trace_t) 2U)  /* AT command sent to modem: id = AT command ID          */
+typedef void (* at_trace_callback_t)(at_trace_t trace, uint32_t id, at_status_t status);
+#endif /* CST_EVENT_LOG == 1U */
+
+/* Exported functions ------------------------------------------------------- */
+at_bool_t AT_is_processing(void);
+
+#if (CST_EVENT_LOG == 1U)
+void AT_set_trace_callback(at_trace_callback_t trace_callback);
+#endif /* CST_EVENT_LOG == 1U */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT_CORE_H_ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
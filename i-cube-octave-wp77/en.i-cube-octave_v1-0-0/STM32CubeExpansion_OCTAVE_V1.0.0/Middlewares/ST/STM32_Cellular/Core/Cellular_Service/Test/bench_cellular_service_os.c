@@ -0,0 +1,311 @@
+/**
+ ******************************************************************************
+ * @file    bench_cellular_service_os.c
+ * @author  MCD Application Team
+ * @brief   Host benchmark of the Cellular Service access arbitration
+ *          (cso_lock / cso_unlock of cellular_service_os.c)
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+ * All rights reserved.</center></h2>
+ *
+ * This software component is licensed by ST under Ultimate Liberty license
+ * SLA0044, the "License"; You may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at:
+ *                             www.st.com/SLA0044
+ *
+ ******************************************************************************
+ *
+ * This file is not part of the target build. From this directory, build and run it
+ * on the host with the round robin arbitration and with the plain mutex:
+ *
+ *   gcc -O2 -Wall -I. -I../Inc -ffunction-sections -Wl,--gc-sections \
+ *       bench_cellular_service_os.c ../Src/cellular_service_os.c -lpthread -o bench_cso
+ *   ./bench_cso [duration in s]
+ *
+ *   add -DCS_FAIR_SCHEDULING=0U to measure the plain mutex.
+ *
+ * The headers of this directory replace the target ones: rtosal.h maps mutexes and
+ * semaphores on POSIX threads. The modem is simulated: each Cellular Service call
+ * holds the AT channel for a fixed time (sleep), like a task waiting for the modem answer.
+ * Load:
+ *   - BENCH_SOCKET_NB sockets sending continuously; socket 0 also runs a long connect
+ *     every BENCH_CONNECT_PERIOD sends,
+ *   - one Com MDM (ORP) push every BENCH_MDM_PERIOD_US,
+ *   - one signal quality request every BENCH_SERVICE_PERIOD_US.
+ * For each class, the benchmark reports the number of requests and the time waited to get
+ * the access (p50, p99, max), and the aggregate throughput. It also checks that two requests
+ * never hold the access at the same time (process exit code 1 if it happens).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "cellular_service_os.h"
+#include "cellular_service_task.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define BENCH_SOCKET_NB         (4U)
+#define BENCH_SEND_US           (1000U)   /* AT channel time of a socket send       */
+#define BENCH_CONNECT_US        (40000U)  /* AT channel time of a socket connect    */
+#define BENCH_CONNECT_PERIOD    (50U)     /* socket 0: one connect every 50 sends   */
+#define BENCH_MDM_US            (2000U)   /* AT channel time of a Com MDM push      */
+#define BENCH_MDM_PERIOD_US     (5000U)   /* pause between two Com MDM pushes       */
+#define BENCH_SERVICE_US        (1000U)   /* AT channel time of a signal quality    */
+#define BENCH_SERVICE_PERIOD_US (10000U)  /* pause between two signal qualities     */
+#define BENCH_DURATION_DEFAULT  (3U)      /* in s                                   */
+#define BENCH_SAMPLES_MAX       (100000U) /* wait samples recorded per class        */
+
+#define BENCH_CLASS_MDM         (BENCH_SOCKET_NB)
+#define BENCH_CLASS_SERVICE     (BENCH_SOCKET_NB + 1U)
+#define BENCH_CLASS_NB          (BENCH_SOCKET_NB + 2U)
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint32_t nb;
+  uint32_t samples[BENCH_SAMPLES_MAX]; /* wait to get the access, in us */
+} bench_class_stat_t;
+
+/* Global variables ----------------------------------------------------------*/
+cst_context_t cst_context;
+
+/* Private variables ---------------------------------------------------------*/
+static bench_class_stat_t bench_stat[BENCH_CLASS_NB];
+static volatile bool bench_running;
+static volatile uint32_t bench_in_access;   /* number of requests holding the access */
+static volatile uint32_t bench_overlap_nb;  /* mutual exclusion violations */
+static __thread uint64_t bench_request_start;
+static __thread uint32_t bench_class;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint64_t bench_time_us(void);
+static void bench_sleep_us(uint32_t duration);
+static void bench_at_channel(uint32_t duration);
+static int bench_compare(const void *p_a, const void *p_b);
+static void *bench_socket_thread(void *p_arg);
+static void *bench_mdm_thread(void *p_arg);
+static void *bench_service_thread(void *p_arg);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief  monotonic time in us
+ */
+static uint64_t bench_time_us(void)
+{
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000U) + ((uint64_t)ts.tv_nsec / 1000U);
+}
+
+/**
+ * @brief  sleep (the thread releases the CPU)
+ */
+static void bench_sleep_us(uint32_t duration)
+{
+  struct timespec ts;
+  ts.tv_sec = (time_t)(duration / 1000000U);
+  ts.tv_nsec = (long)(duration % 1000000U) * 1000L;
+  (void)nanosleep(&ts, NULL);
+}
+
+/**
+ * @brief  simulated modem transaction: record the wait to get the access, then hold the AT channel
+ */
+static void bench_at_channel(uint32_t duration)
+{
+  bench_class_stat_t *p_stat = &bench_stat[bench_class];
+
+  if (__atomic_add_fetch(&bench_in_access, 1U, __ATOMIC_SEQ_CST) != 1U)
+  {
+    (void)__atomic_add_fetch(&bench_overlap_nb, 1U, __ATOMIC_SEQ_CST);
+  }
+  if (p_stat->nb < BENCH_SAMPLES_MAX)
+  {
+    p_stat->samples[p_stat->nb] = (uint32_t)(bench_time_us() - bench_request_start);
+    p_stat->nb++;
+  }
+  bench_sleep_us(duration);
+  (void)__atomic_sub_fetch(&bench_in_access, 1U, __ATOMIC_SEQ_CST);
+}
+
+static int bench_compare(const void *p_a, const void *p_b)
+{
+  uint32_t a = *(const uint32_t *)p_a;
+  uint32_t b = *(const uint32_t *)p_b;
+  return (a > b) ? 1 : ((a < b) ? -1 : 0);
+}
+
+/**
+ * @brief  socket: sends continuously, socket 0 also connects periodically
+ */
+static void *bench_socket_thread(void *p_arg)
+{
+  socket_handle_t sock = (socket_handle_t)(intptr_t)p_arg;
+  uint32_t nb = 0U;
+
+  bench_class = (uint32_t)sock;
+  while (bench_running)
+  {
+    bench_request_start = bench_time_us();
+    if ((sock == 0) && ((nb % BENCH_CONNECT_PERIOD) == (BENCH_CONNECT_PERIOD - 1U)))
+    {
+      (void)osCDS_socket_connect(sock, CS_IPAT_IPV4, (CS_CHAR_t *)"1.2.3.4", 80U);
+    }
+    else
+    {
+      (void)osCDS_socket_send(sock, (const CS_CHAR_t *)"data", 4U);
+    }
+    nb++;
+  }
+  return NULL;
+}
+
+/**
+ * @brief  Com MDM (ORP) periodic push
+ */
+static void *bench_mdm_thread(void *p_arg)
+{
+  CS_Tx_Buffer_t tx_buf;
+  CS_Rx_Buffer_t rx_buf;
+  int32_t error_code;
+
+  (void)p_arg;
+  (void)memset(&tx_buf, 0, sizeof(tx_buf));
+  (void)memset(&rx_buf, 0, sizeof(rx_buf));
+  bench_class = BENCH_CLASS_MDM;
+  while (bench_running)
+  {
+    bench_request_start = bench_time_us();
+    (void)osCS_ComMdm_transaction(&tx_buf, &rx_buf, &error_code);
+    bench_sleep_us(BENCH_MDM_PERIOD_US);
+  }
+  return NULL;
+}
+
+/**
+ * @brief  Cellular Service task: periodic signal quality polling
+ */
+static void *bench_service_thread(void *p_arg)
+{
+  CS_SignalQuality_t sig_qual;
+
+  (void)p_arg;
+  bench_class = BENCH_CLASS_SERVICE;
+  while (bench_running)
+  {
+    bench_request_start = bench_time_us();
+    (void)osCS_get_signal_quality(&sig_qual);
+    bench_sleep_us(BENCH_SERVICE_PERIOD_US);
+  }
+  return NULL;
+}
+
+/* Functions Definition ------------------------------------------------------*/
+/* Cellular Service functions called by cellular_service_os.c: simulated modem */
+cst_autom_state_t CST_get_state(void)
+{
+  return CST_MODEM_DATA_READY_STATE;
+}
+
+CS_Status_t CDS_socket_send(socket_handle_t sockHandle, const CS_CHAR_t *p_buf, uint32_t length)
+{
+  (void)sockHandle;
+  (void)p_buf;
+  (void)length;
+  bench_at_channel(BENCH_SEND_US);
+  return CELLULAR_OK;
+}
+
+CS_Status_t CDS_socket_connect(socket_handle_t sockHandle, CS_IPaddrType_t addr_type, CS_CHAR_t *p_ip_addr_value,
+                               uint16_t remote_port)
+{
+  (void)sockHandle;
+  (void)addr_type;
+  (void)p_ip_addr_value;
+  (void)remote_port;
+  bench_at_channel(BENCH_CONNECT_US);
+  return CELLULAR_OK;
+}
+
+CS_Status_t CS_ComMdm_transaction(CS_Tx_Buffer_t *txBuf, CS_Rx_Buffer_t *rxBuf, int32_t *errorCode)
+{
+  (void)txBuf;
+  (void)rxBuf;
+  *errorCode = 0;
+  bench_at_channel(BENCH_MDM_US);
+  return CELLULAR_OK;
+}
+
+CS_Status_t CS_get_signal_quality(CS_SignalQuality_t *p_sig_qual)
+{
+  (void)memset(p_sig_qual, 0, sizeof(CS_SignalQuality_t));
+  bench_at_channel(BENCH_SERVICE_US);
+  return CELLULAR_OK;
+}
+
+int main(int argc, char *argv[])
+{
+  static const char *const class_name[BENCH_CLASS_NB] =
+  {
+    "socket 0 (+connect)", "socket 1", "socket 2", "socket 3", "com mdm (ORP)", "service (CST)"
+  };
+  pthread_t threads[BENCH_CLASS_NB];
+  uint32_t duration = BENCH_DURATION_DEFAULT;
+  uint32_t total = 0U;
+  uint32_t i;
+
+  if (argc > 1)
+  {
+    duration = (uint32_t)strtoul(argv[1], NULL, 10);
+  }
+
+  (void)osCDS_cellular_service_init();
+  bench_running = true;
+  for (i = 0U; i < BENCH_SOCKET_NB; i++)
+  {
+    (void)pthread_create(&threads[i], NULL, bench_socket_thread, (void *)(intptr_t)i);
+  }
+  (void)pthread_create(&threads[BENCH_CLASS_MDM], NULL, bench_mdm_thread, NULL);
+  (void)pthread_create(&threads[BENCH_CLASS_SERVICE], NULL, bench_service_thread, NULL);
+
+  bench_sleep_us(duration * 1000000U);
+  bench_running = false;
+  for (i = 0U; i < BENCH_CLASS_NB; i++)
+  {
+    (void)pthread_join(threads[i], NULL);
+  }
+
+  printf("Cellular Service access (%s), %u s\n",
+         (CS_FAIR_SCHEDULING == 1U) ? "round robin per class" : "plain mutex", duration);
+  printf("%-20s %8s %9s %9s %9s\n", "class", "requests", "p50 (us)", "p99 (us)", "max (us)");
+  for (i = 0U; i < BENCH_CLASS_NB; i++)
+  {
+    bench_class_stat_t *p_stat = &bench_stat[i];
+    uint32_t p50 = 0U;
+    uint32_t p99 = 0U;
+    uint32_t max = 0U;
+    if (p_stat->nb != 0U)
+    {
+      qsort(p_stat->samples, p_stat->nb, sizeof(uint32_t), bench_compare);
+      p50 = p_stat->samples[(p_stat->nb * 50U) / 100U];
+      p99 = p_stat->samples[(p_stat->nb * 99U) / 100U];
+      max = p_stat->samples[p_stat->nb - 1U];
+    }
+    printf("%-20s %8u %9u %9u %9u\n", class_name[i], p_stat->nb, p50, p99, max);
+    total += p_stat->nb;
+  }
+  printf("aggregate throughput: %.1f requests/s, mutual exclusion violations: %u\n",
+         (double)total / (double)duration, bench_overlap_nb);
+
+  return (bench_overlap_nb == 0U) ? 0 : 1;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
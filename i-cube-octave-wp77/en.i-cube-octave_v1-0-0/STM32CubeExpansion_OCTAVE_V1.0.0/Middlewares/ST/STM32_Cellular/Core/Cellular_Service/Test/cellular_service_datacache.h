@@ -0,0 +1,128 @@
+/**
+  ******************************************************************************
+  * @file    cellular_service_datacache.h
+  * @author  MCD Application Team
+  * @brief   Cellular Data Cache entries used by cellular_service_reattach.c and
+  *          cellular_service_nvm.c (host build only)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CELLULAR_SERVICE_DATACACHE_H
+#define CELLULAR_SERVICE_DATACACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "plf_config.h"
+#include "dc_common.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Same values as cellular_control_api.h and the target cellular_service_datacache.h */
+#define CA_MNO_NAME_SIZE_MAX                (uint8_t)(32U + 1U)
+#define CA_ICCID_SIZE_MAX                   (uint8_t)(20U + 1U)
+#define CA_IMSI_SIZE_MAX                    (uint8_t)(15U + 1U)
+#define CA_IMEI_SIZE_MAX                    (uint8_t)(16U + 1U)
+#define CA_MANUFACTURER_ID_SIZE_MAX         (uint8_t)(32U + 1U)
+#define CA_MODEL_ID_SIZE_MAX                (uint8_t)(32U + 1U)
+#define CA_REVISION_ID_SIZE_MAX             (uint8_t)(32U + 1U)
+#define CA_SERIAL_NUMBER_ID_SIZE_MAX        (uint8_t)(32U + 1U)
+#define CA_APN_SIZE_MAX                     (uint8_t)(32U + 1U)
+#define CA_USERNAME_SIZE_MAX                (uint8_t)(32U + 1U)
+#define CA_PASSWORD_SIZE_MAX                (uint8_t)(32U + 1U)
+#define DC_SIM_SLOT_NB                      3U
+
+/* Exported types ------------------------------------------------------------*/
+/** @brief  Access techno list (same values as cellular_control_api.h) */
+typedef enum
+{
+  CA_ACT_GSM                      = (uint8_t)0x00,
+  CA_ACT_E_UTRAN                  = (uint8_t)0x07,
+  CA_ACT_E_UTRAN_NBS1             = (uint8_t)0x09
+} ca_access_techno_t;
+
+/** @brief  Structure definition of DC_CELLULAR_ATTACH_INFO entry (same as the target header) */
+typedef struct
+{
+  dc_service_rt_header_t header;
+  dc_service_rt_state_t rt_state;
+  uint32_t attach_nb;
+  uint32_t fast_attach_nb;
+  uint32_t fail_nb;
+  uint32_t last_time;
+  uint32_t min_time;
+  uint32_t max_time;
+  uint32_t avg_time;
+  uint32_t retry_delay;
+  uint8_t  mno_name[CA_MNO_NAME_SIZE_MAX];
+  ca_access_techno_t access_techno;
+} dc_cellular_attach_info_t;
+
+/** @brief  Modem identity of DC_CELLULAR_INFO entry (fields used by cellular_service_nvm.c) */
+typedef struct
+{
+  dc_service_rt_header_t header;
+  dc_service_rt_state_t  rt_state;
+  uint8_t                imei[CA_IMEI_SIZE_MAX];
+  uint8_t                mno_name[CA_MNO_NAME_SIZE_MAX];
+  uint8_t                manufacturer_name[CA_MANUFACTURER_ID_SIZE_MAX];
+  uint8_t                model[CA_MODEL_ID_SIZE_MAX];
+  uint8_t                revision[CA_REVISION_ID_SIZE_MAX];
+  uint8_t                serial_number[CA_SERIAL_NUMBER_ID_SIZE_MAX];
+  uint8_t                iccid[CA_ICCID_SIZE_MAX];
+} dc_cellular_info_t;
+
+/** @brief  SIM slot parameters (same fields as the target header, enums replaced by uint8_t) */
+typedef struct
+{
+  uint8_t                sim_slot_type;
+  uint8_t                apnSendToModem;
+  bool                   apnPresent;
+  uint8_t                apn[CA_APN_SIZE_MAX];
+  uint8_t                cid;
+  uint8_t                username[CA_USERNAME_SIZE_MAX];
+  uint8_t                password[CA_PASSWORD_SIZE_MAX];
+  bool                   apnChanged;
+} dc_sim_slot_t;
+
+/** @brief  Cellular parameters of DC_CELLULAR_CONFIG entry (fields used by cellular_service_nvm.c) */
+typedef struct
+{
+  dc_service_rt_header_t header;
+  dc_service_rt_state_t  rt_state;
+  uint8_t                sim_slot_nb;
+  dc_sim_slot_t          sim_slot[DC_SIM_SLOT_NB];
+  uint8_t                target_state;
+  uint32_t               lp_inactivity_timeout;
+} dc_cellular_params_t;
+
+typedef struct
+{
+  dc_service_rt_header_t header;
+  dc_service_rt_state_t  rt_state;
+} dc_nifman_info_t;
+
+/* External variables --------------------------------------------------------*/
+extern dc_com_res_id_t    DC_CELLULAR_ATTACH_INFO;
+extern dc_com_res_id_t    DC_CELLULAR_NIFMAN_INFO;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CELLULAR_SERVICE_DATACACHE_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
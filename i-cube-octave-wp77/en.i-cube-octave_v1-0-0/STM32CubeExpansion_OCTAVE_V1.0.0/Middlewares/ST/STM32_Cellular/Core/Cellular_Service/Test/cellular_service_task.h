@@ -0,0 +1,65 @@
+/**
+  ******************************************************************************
+  * @file    cellular_service_task.h
+  * @author  MCD Application Team
+  * @brief   Cellular Service task definitions used by cellular_service_os.c
+  *          and cellular_service_reattach.c (host build only)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CELLULAR_SERVICE_TASK_H
+#define CELLULAR_SERVICE_TASK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "plf_config.h"
+#include "cellular_service.h"
+#include "cellular_service_datacache.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  CST_MODEM_INIT_STATE = 0,
+  CST_MODEM_DATA_READY_STATE,
+} cst_autom_state_t;
+
+typedef struct
+{
+  bool modem_on;
+} cst_context_t;
+
+/* Exported macros -----------------------------------------------------------*/
+#define PRINT_CELLULAR_SERVICE(...)        __NOP(); /* Nothing to do */
+#define PRINT_CELLULAR_SERVICE_ERR(...)    __NOP(); /* Nothing to do */
+
+/* External variables --------------------------------------------------------*/
+extern cst_context_t cst_context;
+extern dc_cellular_params_t cst_cellular_params;
+
+/* Exported functions ------------------------------------------------------- */
+cst_autom_state_t CST_get_state(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CELLULAR_SERVICE_TASK_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
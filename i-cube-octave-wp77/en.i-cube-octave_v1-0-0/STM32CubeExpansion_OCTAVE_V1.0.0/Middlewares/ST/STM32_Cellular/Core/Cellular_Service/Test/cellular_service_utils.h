@@ -0,0 +1,44 @@
+/**
+  ******************************************************************************
+  * @file    cellular_service_utils.h
+  * @author  MCD Application Team
+  * @brief   Cellular Service utilities used by cellular_service_reattach.c (host build only)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CELLULAR_SERVICE_UTILS_H
+#define CELLULAR_SERVICE_UTILS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "plf_config.h"
+#include "cellular_runtime_custom.h"
+#include "cellular_service.h"
+#include "cellular_service_task.h"
+#include "cellular_service_datacache.h"
+
+/* Exported functions ------------------------------------------------------- */
+ca_access_techno_t cst_convert_access_techno(CS_AccessTechno_t access_techno);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CELLULAR_SERVICE_UTILS_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
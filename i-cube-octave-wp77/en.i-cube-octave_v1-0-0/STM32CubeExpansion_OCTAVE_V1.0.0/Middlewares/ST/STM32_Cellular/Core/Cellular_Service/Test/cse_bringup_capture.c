@@ -0,0 +1,166 @@
+/**
+ ******************************************************************************
+ * @file    cse_bringup_capture.c
+ * @author  MCD Application Team
+ * @brief   Host replay of a modem bring-up through the Cellular Service event log
+ *          (cellular_service_evtlog.c): produces the console capture decoded by
+ *          Scripts/test_cst_evtlog_decode.py
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+ * All rights reserved.</center></h2>
+ *
+ * This software component is licensed by ST under Ultimate Liberty license
+ * SLA0044, the "License"; You may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at:
+ *                             www.st.com/SLA0044
+ *
+ ******************************************************************************
+ *
+ * This file is not part of the target build. From this directory, build it on the host
+ * and regenerate the capture when the record format or the dump is modified:
+ *
+ *   gcc -O2 -Wall -Wno-format -I. -I../Inc cse_bringup_capture.c ../Src/cellular_service_evtlog.c \
+ *       -o cse_capture
+ *   ./cse_capture > cse_bringup_capture.txt
+ *   gcc -O2 -Wall -Wno-format -DCST_EVENT_LOG_NB=8U -I. -I../Inc cse_bringup_capture.c \
+ *       ../Src/cellular_service_evtlog.c -o cse_capture_nb8
+ *   ./cse_capture_nb8 > cse_bringup_capture_nb8.txt
+ *
+ *   (-Wno-format: the dump uses %ld for uint32_t values, long is 32 bits on the target)
+ *
+ * The headers of this directory replace the target ones: HAL_GetTick is driven by the
+ * replay and the AT Core trace callback registered by CSE_Init is called directly.
+ * The replay starts 4 s before the 32 bits tick wraps. Two dumps are displayed: one in
+ * the middle of the bring-up, one after the first data. Expected decoding:
+ *   phase        duration    total   AT req  AT time
+ *   power-on      1000 ms  1000 ms        1   500 ms
+ *   SIM ready     1000 ms  2000 ms        1   300 ms
+ *   registered    3000 ms  5000 ms        1   100 ms
+ *   PDN active    2000 ms  7000 ms        1  1000 ms
+ *   first data     500 ms  7500 ms        0     0 ms
+ * With an 8 records log, the second dump only displays the last 8 records, oldest first.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "cellular_service_evtlog.h"
+#include "at_core.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define CAPTURE_TICK_START      (0xFFFFF000U) /* 4096 ms before the tick wraps */
+
+/* Warning : to be consistent with cellular_service_task.h and cellular_control_api.h */
+#define CAPTURE_STATE_BOOT      (0U)
+#define CAPTURE_STATE_INIT      (1U)
+#define CAPTURE_MODEM_POWERED   (0x01U)
+#define CAPTURE_MODEM_SIM       (0x02U)
+#define CAPTURE_MODEM_SEARCHING (0x03U)
+#define CAPTURE_MODEM_REGISTERED (0x04U)
+#define CAPTURE_MODEM_DATAREADY (0x05U)
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t capture_tick;
+static at_trace_callback_t capture_trace_callback = NULL;
+
+/* Private function prototypes -----------------------------------------------*/
+static void capture_at_request(uint32_t start, uint32_t duration, uint16_t sid, at_status_t status);
+
+/* Private function Definition -----------------------------------------------*/
+
+/**
+  * @brief  replays an AT request (start, one command sent, end)
+  * @param  start    - request start, relative to CAPTURE_TICK_START (ms)
+  * @param  duration - request duration (ms)
+  * @param  sid      - request SID
+  * @param  status   - request result
+  * @retval -
+  */
+static void capture_at_request(uint32_t start, uint32_t duration, uint16_t sid, at_status_t status)
+{
+  capture_tick = CAPTURE_TICK_START + start;
+  capture_trace_callback(ATTRACE_SID_START, sid, ATSTATUS_OK);
+  capture_tick += 5U;
+  capture_trace_callback(ATTRACE_CMD_SENT, 0x100U + (uint32_t)sid, ATSTATUS_OK);
+  capture_tick = CAPTURE_TICK_START + start + duration;
+  capture_trace_callback(ATTRACE_SID_END, sid, status);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  HAL tick of the replay
+  * @param  -
+  * @retval tick (ms)
+  */
+uint32_t HAL_GetTick(void)
+{
+  return capture_tick;
+}
+
+/**
+  * @brief  AT Core trace callback registration: keeps the callback of the event log
+  * @param  trace_callback - callback
+  * @retval -
+  */
+void AT_set_trace_callback(at_trace_callback_t trace_callback)
+{
+  capture_trace_callback = trace_callback;
+}
+
+int main(void)
+{
+  capture_tick = CAPTURE_TICK_START;
+  CSE_Init();
+  if (capture_trace_callback == NULL)
+  {
+    (void)fprintf(stderr, "CSE_Init has not registered the AT Core trace callback\n");
+    return 1;
+  }
+
+  (void)printf("console noise before the dump: cse state 1\n\r");
+  capture_tick = CAPTURE_TICK_START + 10U;
+  CSE_Record(CSE_TYPE_STATE, CAPTURE_STATE_INIT, CAPTURE_STATE_BOOT);
+  capture_at_request(20U, 500U, 10U, ATSTATUS_OK);
+  capture_tick = CAPTURE_TICK_START + 1010U;
+  CSE_Record(CSE_TYPE_MODEM_STATE, CAPTURE_MODEM_POWERED, 0U);
+  capture_at_request(1100U, 300U, 11U, ATSTATUS_ERROR);
+  capture_tick = CAPTURE_TICK_START + 2010U;
+  CSE_Record(CSE_TYPE_MODEM_STATE, CAPTURE_MODEM_SIM, 0U);
+
+  /* first dump: bring-up in progress */
+  capture_tick = CAPTURE_TICK_START + 2100U;
+  CSE_Dump();
+
+  capture_tick = CAPTURE_TICK_START + 2500U;
+  CSE_Record(CSE_TYPE_MODEM_STATE, CAPTURE_MODEM_SEARCHING, 0U);
+  capture_at_request(3000U, 100U, 11U, ATSTATUS_OK);
+  /* the tick wraps here */
+  capture_tick = CAPTURE_TICK_START + 5010U;
+  CSE_Record(CSE_TYPE_MODEM_STATE, CAPTURE_MODEM_REGISTERED, 0U);
+  /* data before the PDN activation: recorded once, not a bring-up milestone */
+  capture_tick = CAPTURE_TICK_START + 5100U;
+  CSE_DataNotify(CSE_DATA_SEND, 10U);
+  CSE_DataNotify(CSE_DATA_SEND, 20U);
+  capture_at_request(5200U, 1000U, 12U, ATSTATUS_OK);
+  capture_tick = CAPTURE_TICK_START + 7010U;
+  CSE_Record(CSE_TYPE_MODEM_STATE, CAPTURE_MODEM_DATAREADY, 0U);
+  /* first data: length saturated to 16 bits, next data not recorded */
+  capture_tick = CAPTURE_TICK_START + 7510U;
+  CSE_DataNotify(CSE_DATA_RECEIVE, 70000U);
+  capture_tick = CAPTURE_TICK_START + 7600U;
+  CSE_DataNotify(CSE_DATA_SEND, 5U);
+
+  /* second dump: the decoder keeps the last one */
+  capture_tick = CAPTURE_TICK_START + 8000U;
+  CSE_Dump();
+  (void)printf("console noise after the dump\n\r");
+
+  return 0;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
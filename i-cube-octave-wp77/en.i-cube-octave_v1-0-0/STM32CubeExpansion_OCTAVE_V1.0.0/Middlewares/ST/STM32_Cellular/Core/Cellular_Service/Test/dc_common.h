@@ -0,0 +1,79 @@
+/**
+  ******************************************************************************
+  * @file    dc_common.h
+  * @author  MCD Application Team
+  * @brief   Data Cache definitions used by cellular_service_reattach.c (host build only)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef DC_COMMON_H
+#define DC_COMMON_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Exported types ------------------------------------------------------------*/
+typedef uint16_t dc_com_res_id_t;   /*!< type of identifier of the registered Data Cache entry */
+
+typedef bool  dc_com_status_t;   /*!< type of Data Cache return code  */
+#define   DC_COM_OK     (dc_com_status_t)true   /*!< Ok  */
+#define   DC_COM_ERROR  (dc_com_status_t)false  /*!< Error  */
+
+/** @brief type of entry/service state */
+typedef enum
+{
+  DC_SERVICE_UNAVAIL = 0x00,
+  DC_SERVICE_RESET,
+  DC_SERVICE_CALIB,
+  DC_SERVICE_OFF,
+  DC_SERVICE_SHUTTING_DOWN,
+  DC_SERVICE_STARTING,
+  DC_SERVICE_RUN,
+  DC_SERVICE_ON,
+  DC_SERVICE_FAIL
+} dc_service_rt_state_t;
+
+/** @brief type of Data Cache structure header */
+typedef struct
+{
+  dc_com_res_id_t res_id;
+  uint32_t size;
+} dc_service_rt_header_t;
+
+/** @brief type of Data Cache global structure: a single entry is enough for the host test */
+typedef struct
+{
+  uint8_t entry[256];
+} dc_com_db_t;
+
+/* External variables --------------------------------------------------------*/
+extern dc_com_db_t dc_com_db;
+
+/* Exported functions ------------------------------------------------------- */
+dc_com_status_t dc_com_write(dc_com_db_t *p_dc, dc_com_res_id_t res_id, const void *p_data, uint32_t len);
+dc_com_status_t dc_com_read(dc_com_db_t *p_dc, dc_com_res_id_t res_id, void *p_data, uint32_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DC_COMMON_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,88 @@
+/**
+  ******************************************************************************
+  * @file    plf_config.h
+  * @author  MCD Application Team
+  * @brief   Platform configuration used by the host build of the Cellular Service
+  *          benchmark (replaces the project plf_config.h)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef PLF_CONFIG_H
+#define PLF_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "stm32l4xx_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Same default as plf_features.h, can be overridden with -DCS_FAIR_SCHEDULING=0U */
+#if !defined CS_FAIR_SCHEDULING
+#define CS_FAIR_SCHEDULING        (1U) /* 0: not activated, 1: activated */
+#endif /* !defined CS_FAIR_SCHEDULING */
+
+#if !defined USE_LOW_POWER
+#define USE_LOW_POWER             (0)
+#endif /* !defined USE_LOW_POWER */
+#if !defined CSP_TX_SCHEDULER_NB
+#define CSP_TX_SCHEDULER_NB       (8U) /* same default as plf_sw_config.h */
+#endif /* !defined CSP_TX_SCHEDULER_NB */
+#define USE_COM_MDM
+#define USE_PRINTF                (1U)
+
+/* Same defaults as plf_sw_config.h, can be overridden with -DCST_REATTACH_BACKOFF_MIN=... */
+#define CST_FAST_REATTACH         (1U)
+#if !defined CST_REATTACH_BACKOFF_MIN
+#define CST_REATTACH_BACKOFF_MIN  (5000U)   /* first retry delay, in ms */
+#endif /* !defined CST_REATTACH_BACKOFF_MIN */
+#if !defined CST_REATTACH_BACKOFF_MAX
+#define CST_REATTACH_BACKOFF_MAX  (300000U) /* maximum retry delay, in ms */
+#endif /* !defined CST_REATTACH_BACKOFF_MAX */
+
+/* Same defaults as plf_features.h, can be overridden with -DCST_EVENT_LOG_NB=... */
+#if !defined CST_EVENT_LOG
+#define CST_EVENT_LOG             (1U) /* 0: not activated, 1: activated */
+#endif /* !defined CST_EVENT_LOG */
+#if !defined CST_EVENT_LOG_NB
+#define CST_EVENT_LOG_NB          (128U) /* number of records */
+#endif /* !defined CST_EVENT_LOG_NB */
+
+/* Same defaults as plf_sw_config.h: the host test maps the simulated flash at this address */
+#define CST_MODEM_CONFIG_CACHE    (1U)
+#if !defined CST_MODEM_CONFIG_CACHE_ADDR
+#define CST_MODEM_CONFIG_CACHE_ADDR (0x081FC000U) /* last 16KB of flash: two full pages in any bank mode */
+#endif /* !defined CST_MODEM_CONFIG_CACHE_ADDR */
+
+/* CMSIS intrinsics and HAL services used by the tested modules */
+#define __NOP()                   do {} while (0)
+#define __get_PRIMASK()           (0U)
+#define __set_PRIMASK(primask)    ((void)(primask))
+#define __disable_irq()           do {} while (0)
+
+/* Exported functions ------------------------------------------------------- */
+uint32_t HAL_GetTick(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLF_CONFIG_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
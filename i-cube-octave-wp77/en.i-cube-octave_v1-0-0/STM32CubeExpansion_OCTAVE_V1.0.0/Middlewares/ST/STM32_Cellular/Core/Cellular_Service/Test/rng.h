@@ -0,0 +1,50 @@
+/**
+  ******************************************************************************
+  * @file    rng.h
+  * @author  MCD Application Team
+  * @brief   RNG HAL definitions used by cellular_service_reattach.c (host build only)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef RNG_H
+#define RNG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include "stm32l4xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t dummy;
+} RNG_HandleTypeDef;
+
+/* External variables --------------------------------------------------------*/
+extern RNG_HandleTypeDef hrng;
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef HAL_RNG_GenerateRandomNumber(RNG_HandleTypeDef *hrng, uint32_t *random32bit);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RNG_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,131 @@
+/**
+  ******************************************************************************
+  * @file    rtosal.h
+  * @author  MCD Application Team
+  * @brief   RTOS abstraction layer of the host build, on top of POSIX threads.
+  *          Mutexes use priority inheritance when available, as FreeRTOS mutexes.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef RTOSAL_H
+#define RTOSAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <semaphore.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define RTOSAL_WAIT_FOREVER  (0xFFFFFFFFU)
+
+/* Exported types ------------------------------------------------------------*/
+typedef uint8_t          rtosal_char_t;
+typedef int32_t          rtosalStatus;
+typedef pthread_mutex_t *osMutexId;
+typedef sem_t           *osSemaphoreId;
+typedef void            *osTimerId;
+
+/* Timers are driven by the host test using them */
+typedef void (*os_ptimer)(void const *argument);
+typedef enum
+{
+  osTimerOnce     = 0,
+  osTimerPeriodic = 1
+} os_timer_type;
+
+#define osOK             ((rtosalStatus)0)
+#define osErrorTimeout   ((rtosalStatus)-2)
+
+/* Exported functions ------------------------------------------------------- */
+static inline osMutexId rtosalMutexNew(const rtosal_char_t *p_name)
+{
+  pthread_mutexattr_t attr;
+  osMutexId mutex_id = (osMutexId)malloc(sizeof(pthread_mutex_t));
+  (void)p_name;
+  if (mutex_id != NULL)
+  {
+    (void)pthread_mutexattr_init(&attr);
+#if defined(_POSIX_THREAD_PRIO_INHERIT)
+    (void)pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+#endif /* defined(_POSIX_THREAD_PRIO_INHERIT) */
+    (void)pthread_mutex_init(mutex_id, &attr);
+    (void)pthread_mutexattr_destroy(&attr);
+  }
+  return mutex_id;
+}
+
+static inline rtosalStatus rtosalMutexAcquire(osMutexId mutex_id, uint32_t timeout)
+{
+  (void)timeout;
+  return (pthread_mutex_lock(mutex_id) == 0) ? osOK : osErrorTimeout;
+}
+
+static inline rtosalStatus rtosalMutexRelease(osMutexId mutex_id)
+{
+  return (pthread_mutex_unlock(mutex_id) == 0) ? osOK : osErrorTimeout;
+}
+
+static inline osSemaphoreId rtosalSemaphoreNew(const rtosal_char_t *p_name, uint32_t count)
+{
+  osSemaphoreId semaphore_id = (osSemaphoreId)malloc(sizeof(sem_t));
+  (void)p_name;
+  if (semaphore_id != NULL)
+  {
+    (void)sem_init(semaphore_id, 0, count);
+  }
+  return semaphore_id;
+}
+
+static inline rtosalStatus rtosalSemaphoreAcquire(osSemaphoreId semaphore_id, uint32_t timeout)
+{
+  int ret;
+  if (timeout == RTOSAL_WAIT_FOREVER)
+  {
+    do
+    {
+      ret = sem_wait(semaphore_id);
+    } while ((ret != 0) && (errno == EINTR));
+  }
+  else
+  {
+    /* only 0 (no wait) is used by cellular_service_os.c */
+    ret = sem_trywait(semaphore_id);
+  }
+  return (ret == 0) ? osOK : osErrorTimeout;
+}
+
+static inline rtosalStatus rtosalSemaphoreRelease(osSemaphoreId semaphore_id)
+{
+  return (sem_post(semaphore_id) == 0) ? osOK : osErrorTimeout;
+}
+
+osTimerId rtosalTimerNew(const rtosal_char_t *p_name, os_ptimer func, os_timer_type type, void *p_arg);
+rtosalStatus rtosalTimerStart(osTimerId timer_id, uint32_t ticks);
+rtosalStatus rtosalTimerStop(osTimerId timer_id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RTOSAL_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
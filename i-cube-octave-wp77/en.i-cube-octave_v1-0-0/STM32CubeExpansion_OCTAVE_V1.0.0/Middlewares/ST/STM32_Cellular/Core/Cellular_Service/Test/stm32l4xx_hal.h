@@ -0,0 +1,98 @@
+/**
+  ******************************************************************************
+  * @file    stm32l4xx_hal.h
+  * @author  MCD Application Team
+  * @brief   HAL status and flash definitions used by the host tests (host build only):
+  *          the flash services are implemented by test_cellular_service_nvm.c
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32L4xx_HAL_H
+#define STM32L4xx_HAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Same values as STM32L4S5 (2MB flash) */
+#define FLASH_BASE                    (0x08000000U)
+#define FLASH_BANK_SIZE               (0x00100000U)  /* dual bank mode            */
+#define FLASH_PAGE_SIZE               (0x00001000U)  /* dual bank mode: 4KB pages */
+#define FLASH_PAGE_SIZE_128_BITS      (0x00002000U)  /* single bank mode: 8KB pages */
+
+#define FLASH_OPTR_DBANK              (0x00400000U)
+#define FLASH_TYPEERASE_PAGES         (0x00U)
+#define FLASH_BANK_1                  (0x01U)
+#define FLASH_BANK_2                  (0x02U)
+#define FLASH_TYPEPROGRAM_DOUBLEWORD  (0x00U)
+
+#define FLASH_FLAG_ECCD               (0x80000000U)
+#define FLASH_FLAG_ALL_ERRORS         (0x0000C3FAU)
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef struct
+{
+  uint32_t TypeErase;
+  uint32_t Banks;
+  uint32_t Page;
+  uint32_t NbPages;
+} FLASH_EraseInitTypeDef;
+
+typedef struct
+{
+  volatile uint32_t SR;
+  volatile uint32_t ECCR;
+  volatile uint32_t OPTR;
+} FLASH_TypeDef;
+
+/* External variables --------------------------------------------------------*/
+extern FLASH_TypeDef test_flash_registers;
+
+/* Exported macros -----------------------------------------------------------*/
+#define FLASH                         (&test_flash_registers)
+#define READ_BIT(REG, BIT)            ((REG) & (BIT))
+#define __HAL_FLASH_GET_FLAG(flag)    \
+  (((flag) == FLASH_FLAG_ECCD) ? (FLASH->ECCR & FLASH_FLAG_ECCD) : (FLASH->SR & (flag)))
+#define __HAL_FLASH_CLEAR_FLAG(flag)  \
+  do { if (((flag) & FLASH_FLAG_ECCD) != 0U) { FLASH->ECCR &= ~FLASH_FLAG_ECCD; } \
+       FLASH->SR &= ~((flag) & ~FLASH_FLAG_ECCD); } while (0)
+#define __DSB()                       __sync_synchronize()
+#define UNUSED(X)                     (void)(X)
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef HAL_FLASH_Unlock(void);
+HAL_StatusTypeDef HAL_FLASH_Lock(void);
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uint32_t Address, uint64_t Data);
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *PageError);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32L4xx_HAL_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,476 @@
+/**
+ ******************************************************************************
+ * @file    test_cellular_service_activity.c
+ * @author  MCD Application Team
+ * @brief   Host test of the activity tokens (low power request of
+ *          cellular_service_activity.c)
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+ * All rights reserved.</center></h2>
+ *
+ * This software component is licensed by ST under Ultimate Liberty license
+ * SLA0044, the "License"; You may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at:
+ *                             www.st.com/SLA0044
+ *
+ ******************************************************************************
+ *
+ * This file is not part of the target build. From this directory, build and run it
+ * on the host:
+ *
+ *   gcc -O2 -Wall -DUSE_LOW_POWER=1 -I. -I../Inc \
+ *       test_cellular_service_activity.c ../Src/cellular_service_activity.c -lpthread -o test_csa
+ *   ./test_csa
+ *
+ * The headers of this directory replace the target ones: the RTOS timer, the AT core busy
+ * state, the network state (Data Cache) and the power requests (CSP_DataIdle, CSP_DataWakeup)
+ * are driven by the test. Checked:
+ *   - tokens not initialized: no effect,
+ *   - transaction tokens (socket, mdm) request a wakeup, received data tokens don't,
+ *   - low power requested lp_inactivity_timeout after the last token release, never while a
+ *     token is held, immediately on an immediate release,
+ *   - AT command in progress: request postponed by lp_inactivity_timeout,
+ *     network down: no request,
+ *   - extra release of an origin without token: other origins not released,
+ *   - CSA_Check arms the request only when no token is held,
+ *   - tokens taken and released by several threads: counts back to 0, one wakeup request
+ *     per transaction token.
+ * The process exit code is the number of failures (0: all tests passed).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "cellular_service_activity.h"
+#include "cellular_service_power.h"
+#include "cellular_service_datacache.h"
+#include "cellular_service_task.h"
+#include "at_core.h"
+#include "rtosal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_INACTIVITY_TIMEOUT    (5000U)   /* lp_inactivity_timeout in ms */
+#define TEST_THREAD_NB             (4U)
+#define TEST_THREAD_LOOP_NB        (100000U)
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  os_ptimer func;
+  bool      armed;
+  uint32_t  remaining;   /* ms before the timer expires */
+  uint32_t  period;      /* last delay given to rtosalTimerStart */
+} test_timer_t;
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t test_nb = 0U;
+static uint32_t test_fail_nb = 0U;
+static test_timer_t test_timer;
+static uint32_t test_timer_nb = 0U;
+static bool test_at_processing = false;
+static dc_service_rt_state_t test_network_state = DC_SERVICE_ON;
+static uint32_t test_idle_nb = 0U;        /* CSP_DataIdle calls */
+static uint32_t test_wakeup_nb = 0U;      /* CSP_DataWakeup calls */
+static uint32_t test_wakeup_origin_error_nb = 0U;
+static pthread_barrier_t test_barrier;        /* threads start together */
+
+/* Global variables ----------------------------------------------------------*/
+dc_com_db_t dc_com_db;
+dc_com_res_id_t DC_CELLULAR_NIFMAN_INFO = 1U;
+dc_cellular_params_t cst_cellular_params;
+
+/* Private function prototypes -----------------------------------------------*/
+static void test_check(bool ok, const char *p_label, uint32_t value);
+static void test_advance(uint32_t duration);
+static void test_reset(void);
+static bool test_counts(uint16_t socket, uint16_t socket_rx, uint16_t mdm, uint16_t mdm_rx);
+static void *test_thread(void *p_arg);
+static void test_not_initialized(void);
+static void test_wakeup(void);
+static void test_inactivity(void);
+static void test_immediate(void);
+static void test_at_busy(void);
+static void test_network_down(void);
+static void test_extra_release(void);
+static void test_activity_check(void);
+static void test_threads(void);
+
+/* Private function Definition -----------------------------------------------*/
+static void test_check(bool ok, const char *p_label, uint32_t value)
+{
+  test_nb++;
+  if (ok == false)
+  {
+    test_fail_nb++;
+    printf("FAIL %s (%u)\n", p_label, value);
+  }
+}
+
+/**
+ * @brief  time goes on: the timer expires when its delay is elapsed
+ */
+static void test_advance(uint32_t duration)
+{
+  for (uint32_t i = 0U; i < duration; i++)
+  {
+    if (test_timer.armed == true)
+    {
+      test_timer.remaining--;
+      if (test_timer.remaining == 0U)
+      {
+        test_timer.armed = false;
+        test_timer.func(NULL);
+      }
+    }
+  }
+}
+
+/**
+ * @brief  no token held, network up, AT core idle, counters cleared
+ */
+static void test_reset(void)
+{
+  CSA_Init();
+  test_at_processing = false;
+  test_network_state = DC_SERVICE_ON;
+  test_idle_nb = 0U;
+  test_wakeup_nb = 0U;
+}
+
+static bool test_counts(uint16_t socket, uint16_t socket_rx, uint16_t mdm, uint16_t mdm_rx)
+{
+  return ((CSA_GetCount(CSA_ACTIVITY_SOCKET) == socket) && (CSA_GetCount(CSA_ACTIVITY_SOCKET_RX) == socket_rx)
+          && (CSA_GetCount(CSA_ACTIVITY_MDM) == mdm) && (CSA_GetCount(CSA_ACTIVITY_MDM_RX) == mdm_rx));
+}
+
+/**
+ * @brief  thread taking and releasing tokens of two origins
+ */
+static void *test_thread(void *p_arg)
+{
+  uint32_t index = (uint32_t)(uintptr_t)p_arg;
+  CSA_Activity_t transaction = ((index % 2U) == 0U) ? CSA_ACTIVITY_SOCKET : CSA_ACTIVITY_MDM;
+  CSA_Activity_t rx = ((index % 2U) == 0U) ? CSA_ACTIVITY_SOCKET_RX : CSA_ACTIVITY_MDM_RX;
+
+  (void)pthread_barrier_wait(&test_barrier);
+  for (uint32_t i = 0U; i < TEST_THREAD_LOOP_NB; i++)
+  {
+    CSA_Acquire(transaction);
+    CSA_Acquire(rx);
+    CSA_Release(transaction, false);
+    CSA_Release(rx, false);
+  }
+  return NULL;
+}
+
+/**
+ * @brief  tokens not initialized (low power not started): no effect
+ */
+static void test_not_initialized(void)
+{
+  CSA_Acquire(CSA_ACTIVITY_SOCKET);
+  test_check(CSA_IsIdle() == true, "not initialized: idle", 0U);
+  test_check(test_wakeup_nb == 0U, "not initialized: no wakeup request", test_wakeup_nb);
+  CSA_Release(CSA_ACTIVITY_SOCKET, true);
+  CSA_Check();
+  test_check(test_idle_nb == 0U, "not initialized: no idle request", test_idle_nb);
+  test_check(test_timer_nb == 0U, "not initialized: no timer", test_timer_nb);
+}
+
+/**
+ * @brief  transaction tokens leave low power, received data tokens don't
+ */
+static void test_wakeup(void)
+{
+  test_reset();
+  test_check(test_timer_nb == 1U, "one timer created", test_timer_nb);
+  test_check(CSA_IsIdle() == true, "init: idle", 0U);
+  test_check(test_counts(0U, 0U, 0U, 0U) == true, "init: no token", 0U);
+
+  CSA_Acquire(CSA_ACTIVITY_SOCKET_RX);
+  CSA_Acquire(CSA_ACTIVITY_MDM_RX);
+  test_check(test_wakeup_nb == 0U, "received data: no wakeup request", test_wakeup_nb);
+  CSA_Acquire(CSA_ACTIVITY_SOCKET);
+  test_check(test_wakeup_nb == 1U, "socket transaction: wakeup request", test_wakeup_nb);
+  CSA_Acquire(CSA_ACTIVITY_MDM);
+  CSA_Acquire(CSA_ACTIVITY_MDM);
+  test_check(test_wakeup_nb == 3U, "mdm transaction: wakeup request", test_wakeup_nb);
+  test_check(test_wakeup_origin_error_nb == 0U, "wakeup requested by host", test_wakeup_origin_error_nb);
+  test_check(test_counts(1U, 1U, 2U, 1U) == true, "tokens counted per origin", 0U);
+  test_check(CSA_IsIdle() == false, "tokens held: not idle", 0U);
+  test_check(test_timer.armed == false, "tokens held: timer not armed", test_timer.period);
+
+  CSA_Release(CSA_ACTIVITY_MDM, false);
+  CSA_Release(CSA_ACTIVITY_MDM, false);
+  CSA_Release(CSA_ACTIVITY_SOCKET, false);
+  CSA_Release(CSA_ACTIVITY_MDM_RX, false);
+  test_check(test_timer.armed == false, "last token held: timer not armed", test_timer.period);
+  CSA_Release(CSA_ACTIVITY_SOCKET_RX, false);
+  test_check(test_counts(0U, 0U, 0U, 0U) == true, "all tokens released", 0U);
+  test_check(CSA_IsIdle() == true, "all tokens released: idle", 0U);
+}
+
+/**
+ * @brief  low power requested lp_inactivity_timeout after the last release
+ */
+static void test_inactivity(void)
+{
+  test_reset();
+  CSA_Acquire(CSA_ACTIVITY_SOCKET);
+  CSA_Release(CSA_ACTIVITY_SOCKET, false);
+  test_check((test_timer.armed == true) && (test_timer.period == TEST_INACTIVITY_TIMEOUT),
+             "last release: timer armed on lp_inactivity_timeout", test_timer.period);
+  test_advance(TEST_INACTIVITY_TIMEOUT - 1U);
+  test_check(test_idle_nb == 0U, "inactivity: no request before the timeout", test_idle_nb);
+  test_advance(1U);
+  test_check(test_idle_nb == 1U, "inactivity: idle requested at the timeout", test_idle_nb);
+  test_advance(TEST_INACTIVITY_TIMEOUT * 2U);
+  test_check(test_idle_nb == 1U, "inactivity: one request", test_idle_nb);
+
+  /* new activity before the timeout */
+  CSA_Acquire(CSA_ACTIVITY_MDM);
+  CSA_Release(CSA_ACTIVITY_MDM, false);
+  test_advance(TEST_INACTIVITY_TIMEOUT - 1U);
+  CSA_Acquire(CSA_ACTIVITY_MDM_RX);
+  test_check(test_timer.armed == false, "new token: timer stopped", test_timer.remaining);
+  test_advance(TEST_INACTIVITY_TIMEOUT * 2U);
+  test_check(test_idle_nb == 1U, "new token: no request", test_idle_nb);
+  CSA_Release(CSA_ACTIVITY_MDM_RX, false);
+  test_advance(TEST_INACTIVITY_TIMEOUT - 1U);
+  test_check(test_idle_nb == 1U, "timeout restarted at the last release", test_idle_nb);
+  test_advance(1U);
+  test_check(test_idle_nb == 2U, "idle requested after the restarted timeout", test_idle_nb);
+
+  /* timer expired while a token was taken: the callback sees the token */
+  CSA_Acquire(CSA_ACTIVITY_SOCKET);
+  test_timer.func(NULL);
+  test_check(test_idle_nb == 2U, "late timer callback, token held: no request", test_idle_nb);
+  CSA_Release(CSA_ACTIVITY_SOCKET, false);
+}
+
+/**
+ * @brief  immediate release (last socket closed)
+ */
+static void test_immediate(void)
+{
+  test_reset();
+  CSA_Acquire(CSA_ACTIVITY_SOCKET);
+  CSA_Acquire(CSA_ACTIVITY_MDM_RX);
+  CSA_Release(CSA_ACTIVITY_SOCKET, true);
+  test_check(test_idle_nb == 0U, "immediate release, token held: no request", test_idle_nb);
+  test_check(test_timer.armed == false, "immediate release, token held: timer not armed", test_timer.period);
+  CSA_Release(CSA_ACTIVITY_MDM_RX, false);
+  CSA_Acquire(CSA_ACTIVITY_SOCKET);
+  CSA_Release(CSA_ACTIVITY_SOCKET, true);
+  test_check(test_idle_nb == 1U, "immediate release: idle requested", test_idle_nb);
+  test_check(test_timer.armed == false, "immediate release: timer stopped", test_timer.period);
+  test_advance(TEST_INACTIVITY_TIMEOUT * 2U);
+  test_check(test_idle_nb == 1U, "immediate release: one request", test_idle_nb);
+}
+
+/**
+ * @brief  AT command in progress: request postponed
+ */
+static void test_at_busy(void)
+{
+  test_reset();
+  test_at_processing = true;
+  CSA_Acquire(CSA_ACTIVITY_SOCKET);
+  CSA_Release(CSA_ACTIVITY_SOCKET, false);
+  test_advance(TEST_INACTIVITY_TIMEOUT);
+  test_check(test_idle_nb == 0U, "AT busy: no request", test_idle_nb);
+  test_check((test_timer.armed == true) && (test_timer.period == TEST_INACTIVITY_TIMEOUT),
+             "AT busy: request postponed", test_timer.period);
+  test_advance(TEST_INACTIVITY_TIMEOUT);
+  test_check(test_idle_nb == 0U, "AT still busy: no request", test_idle_nb);
+  test_at_processing = false;
+  test_advance(TEST_INACTIVITY_TIMEOUT);
+  test_check(test_idle_nb == 1U, "AT done: idle requested", test_idle_nb);
+
+  test_at_processing = true;
+  CSA_Acquire(CSA_ACTIVITY_SOCKET);
+  CSA_Release(CSA_ACTIVITY_SOCKET, true);
+  test_check(test_idle_nb == 1U, "immediate release, AT busy: no request", test_idle_nb);
+  test_check(test_timer.armed == true, "immediate release, AT busy: request postponed", test_timer.period);
+  test_at_processing = false;
+  test_advance(TEST_INACTIVITY_TIMEOUT);
+  test_check(test_idle_nb == 2U, "immediate release, AT done: idle requested", test_idle_nb);
+}
+
+/**
+ * @brief  network down: no request
+ */
+static void test_network_down(void)
+{
+  static const dc_service_rt_state_t states[] = { DC_SERVICE_OFF, DC_SERVICE_FAIL, DC_SERVICE_SHUTTING_DOWN };
+
+  for (uint32_t s = 0U; s < (sizeof(states) / sizeof(states[0])); s++)
+  {
+    test_reset();
+    test_network_state = states[s];
+    CSA_Acquire(CSA_ACTIVITY_SOCKET);
+    CSA_Release(CSA_ACTIVITY_SOCKET, false);
+    test_advance(TEST_INACTIVITY_TIMEOUT);
+    test_check(test_idle_nb == 0U, "network down: no request", (uint32_t)states[s]);
+    test_check(test_timer.armed == false, "network down: request not postponed", (uint32_t)states[s]);
+    CSA_Acquire(CSA_ACTIVITY_SOCKET);
+    CSA_Release(CSA_ACTIVITY_SOCKET, true);
+    test_check(test_idle_nb == 0U, "network down, immediate release: no request", (uint32_t)states[s]);
+  }
+}
+
+/**
+ * @brief  extra release of an origin without token
+ */
+static void test_extra_release(void)
+{
+  test_reset();
+  CSA_Acquire(CSA_ACTIVITY_MDM);
+  CSA_Release(CSA_ACTIVITY_SOCKET, true);
+  CSA_Release(CSA_ACTIVITY_SOCKET_RX, false);
+  test_check(CSA_IsIdle() == false, "extra release: other token still held", 0U);
+  test_check(test_counts(0U, 0U, 1U, 0U) == true, "extra release: counts unchanged", 0U);
+  test_check(test_idle_nb == 0U, "extra release: no request", test_idle_nb);
+  test_check(test_timer.armed == false, "extra release: timer not armed", test_timer.period);
+  CSA_Release(CSA_ACTIVITY_MDM, false);
+  test_check(CSA_IsIdle() == true, "extra release: idle after the real release", 0U);
+}
+
+/**
+ * @brief  network comes up: request armed if no token is held
+ */
+static void test_activity_check(void)
+{
+  test_reset();
+  CSA_Acquire(CSA_ACTIVITY_SOCKET_RX);
+  CSA_Check();
+  test_check(test_timer.armed == false, "check, token held: timer not armed", test_timer.period);
+  CSA_Release(CSA_ACTIVITY_SOCKET_RX, true);
+  test_check(test_idle_nb == 1U, "check: immediate release requested idle", test_idle_nb);
+  CSA_Check();
+  test_check((test_timer.armed == true) && (test_timer.period == TEST_INACTIVITY_TIMEOUT),
+             "check, no token: timer armed", test_timer.period);
+  test_advance(TEST_INACTIVITY_TIMEOUT);
+  test_check(test_idle_nb == 2U, "check, no token: idle requested", test_idle_nb);
+}
+
+/**
+ * @brief  tokens taken and released by several threads
+ */
+static void test_threads(void)
+{
+  pthread_t threads[TEST_THREAD_NB];
+
+  test_reset();
+  (void)pthread_barrier_init(&test_barrier, NULL, TEST_THREAD_NB);
+  for (uint32_t i = 0U; i < TEST_THREAD_NB; i++)
+  {
+    (void)pthread_create(&threads[i], NULL, test_thread, (void *)(uintptr_t)i);
+  }
+  for (uint32_t i = 0U; i < TEST_THREAD_NB; i++)
+  {
+    (void)pthread_join(threads[i], NULL);
+  }
+  (void)pthread_barrier_destroy(&test_barrier);
+  test_check(test_counts(0U, 0U, 0U, 0U) == true, "threads: all tokens released", CSA_GetCount(CSA_ACTIVITY_SOCKET));
+  test_check(CSA_IsIdle() == true, "threads: idle", 0U);
+  test_check(test_wakeup_nb == (TEST_THREAD_NB * TEST_THREAD_LOOP_NB), "threads: one wakeup request per transaction",
+             test_wakeup_nb);
+  test_check((test_timer.armed == true) && (test_timer.period == TEST_INACTIVITY_TIMEOUT),
+             "threads: timer armed by the last release", test_timer.period);
+  test_advance(TEST_INACTIVITY_TIMEOUT);
+  test_check(test_idle_nb == 1U, "threads: idle requested", test_idle_nb);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+
+at_bool_t AT_is_processing(void)
+{
+  return (test_at_processing == true) ? AT_TRUE : AT_FALSE;
+}
+
+dc_com_status_t dc_com_read(dc_com_db_t *p_dc, dc_com_res_id_t res_id, void *p_data, uint32_t len)
+{
+  dc_nifman_info_t *p_nifman_info = (dc_nifman_info_t *)p_data;
+
+  (void)p_dc;
+  test_check((res_id == DC_CELLULAR_NIFMAN_INFO) && (len == sizeof(dc_nifman_info_t)), "NIFMAN entry read", res_id);
+  (void)memset(p_data, 0, len);
+  p_nifman_info->rt_state = test_network_state;
+  return DC_COM_OK;
+}
+
+CS_Status_t CSP_DataIdle(void)
+{
+  test_idle_nb++;
+  return CELLULAR_OK;
+}
+
+CS_Status_t CSP_DataWakeup(CS_wakeup_origin_t wakeup_origin)
+{
+  /* called under the wakeup mutex: counters not shared with another thread */
+  test_wakeup_nb++;
+  if (wakeup_origin != HOST_WAKEUP)
+  {
+    test_wakeup_origin_error_nb++;
+  }
+  return CELLULAR_OK;
+}
+
+osTimerId rtosalTimerNew(const rtosal_char_t *p_name, os_ptimer func, os_timer_type type, void *p_arg)
+{
+  (void)p_name;
+  (void)p_arg;
+  test_check(type == osTimerOnce, "one-shot timer", (uint32_t)type);
+  test_timer_nb++;
+  (void)memset((void *)&test_timer, 0, sizeof(test_timer));
+  test_timer.func = func;
+  return (osTimerId)&test_timer;
+}
+
+rtosalStatus rtosalTimerStart(osTimerId timer_id, uint32_t ticks)
+{
+  test_timer_t *p_timer = (test_timer_t *)timer_id;
+
+  p_timer->armed = true;
+  p_timer->period = ticks;
+  p_timer->remaining = ticks;
+  return osOK;
+}
+
+rtosalStatus rtosalTimerStop(osTimerId timer_id)
+{
+  ((test_timer_t *)timer_id)->armed = false;
+  return osOK;
+}
+
+int main(void)
+{
+  (void)memset((void *)&cst_cellular_params, 0, sizeof(cst_cellular_params));
+  cst_cellular_params.lp_inactivity_timeout = TEST_INACTIVITY_TIMEOUT;
+
+  test_not_initialized();
+  test_wakeup();
+  test_timer_nb = 1U; /* a new timer at each CSA_Init: only the first one is counted */
+  test_inactivity();
+  test_immediate();
+  test_at_busy();
+  test_network_down();
+  test_extra_release();
+  test_activity_check();
+  test_threads();
+
+  printf("activity tokens (inactivity %u ms): %u tests, %u failures\n", TEST_INACTIVITY_TIMEOUT, test_nb,
+         test_fail_nb);
+
+  return (int)test_fail_nb;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
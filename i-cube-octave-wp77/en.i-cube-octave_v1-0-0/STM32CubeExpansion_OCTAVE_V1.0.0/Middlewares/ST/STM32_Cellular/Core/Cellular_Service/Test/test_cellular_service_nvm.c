@@ -0,0 +1,645 @@
+/**
+ ******************************************************************************
+ * @file    test_cellular_service_nvm.c
+ * @author  MCD Application Team
+ * @brief   Host test of the modem configuration cache stored in flash
+ *          (record validation of cellular_service_nvm.c)
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+ * All rights reserved.</center></h2>
+ *
+ * This software component is licensed by ST under Ultimate Liberty license
+ * SLA0044, the "License"; You may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at:
+ *                             www.st.com/SLA0044
+ *
+ ******************************************************************************
+ *
+ * This file is not part of the target build. From this directory, build and run it
+ * on a Linux host:
+ *
+ *   gcc -O2 -Wall -I. -I../Inc -I../../Runtime_Library/Inc -include cellular_service_datacache.h \
+ *       test_cellular_service_nvm.c ../Src/cellular_service_nvm.c \
+ *       ../../Runtime_Library/Src/cellular_runtime_standard.c -o test_csn
+ *   ./test_csn
+ *
+ *   (-include: cellular_service_nvm.h includes the target cellular_service_datacache.h of its directory)
+ *
+ * The headers of this directory replace the target ones. The two flash slots are mapped
+ * at CST_MODEM_CONFIG_CACHE_ADDR and the flash HAL is implemented here: erase checks the
+ * page computed by the module (single and dual bank modes), program refuses a double word
+ * not erased and can fail after a number of double words (reset during a write).
+ * A double word partially programmed is simulated by a protected page: the SIGSEGV handler
+ * plays the ECC double error NMI handler and calls CSN_FlashEccErrorCallback(). Checked:
+ *   - erased flash: no record, full modem init,
+ *   - stored configuration is found back with its IMSI and modem identity,
+ *   - fingerprint mismatch (APN, user name, SIM slot, target state),
+ *   - no flash write when nothing has changed, slots written alternately,
+ *   - corrupted record (checksum, magic): the other slot is used,
+ *   - interrupted write and ECC error: the previous record stays the valid one,
+ *   - most recent record selected across the sequence number wrap,
+ *   - SIM change and invalidation erase both slots, older record first,
+ *   - flash is locked again after each operation.
+ * The process exit code is the number of failures (0: all tests passed).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "cellular_service_nvm.h"
+#include "stm32l4xx_hal.h"
+
+/* Private defines -----------------------------------------------------------*/
+/* Warning : to be consistent with cellular_service_nvm.c */
+#define TEST_RECORD_MAGIC      (0x43534E02U)
+#define TEST_SLOT_NB           (2U)
+#define TEST_SLOT_SIZE         (0x2000U)
+#define TEST_FNV_OFFSET_BASIS  (0x811C9DC5U)
+#define TEST_FNV_PRIME         (0x01000193U)
+
+#define TEST_FLASH_SIZE        (TEST_SLOT_NB * TEST_SLOT_SIZE)
+#define TEST_ERASE_LOG_NB      (8U)
+#define TEST_PROGRAM_NO_LIMIT  (0xFFFFFFFFU)
+
+/* Private typedef -----------------------------------------------------------*/
+/* Record stored in flash: same layout as csn_record_t */
+typedef struct
+{
+  uint32_t magic;
+  uint32_t sequence;
+  uint32_t fingerprint;
+  uint8_t  imsi[CA_IMSI_SIZE_MAX];
+  uint8_t  imei[CA_IMEI_SIZE_MAX];
+  uint8_t  manufacturer_name[CA_MANUFACTURER_ID_SIZE_MAX];
+  uint8_t  model[CA_MODEL_ID_SIZE_MAX];
+  uint8_t  revision[CA_REVISION_ID_SIZE_MAX];
+  uint8_t  serial_number[CA_SERIAL_NUMBER_ID_SIZE_MAX];
+  uint8_t  iccid[CA_ICCID_SIZE_MAX];
+  uint32_t checksum;
+} test_record_t;
+
+#define TEST_RECORD_DWORD_NB   ((sizeof(test_record_t) + sizeof(uint64_t) - 1U) / sizeof(uint64_t))
+
+/* Global variables ----------------------------------------------------------*/
+FLASH_TypeDef test_flash_registers;
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t test_nb = 0U;
+static uint32_t test_fail_nb = 0U;
+
+static uint8_t *test_flash = NULL;            /* slots mapped at CST_MODEM_CONFIG_CACHE_ADDR */
+static bool     test_flash_unlocked = false;
+static uint32_t test_program_budget = TEST_PROGRAM_NO_LIMIT; /* double words programmed before a failure */
+static uint32_t test_program_nb = 0U;
+static uint8_t  test_erase_log[TEST_ERASE_LOG_NB];          /* slots erased, in order */
+static uint32_t test_erase_nb = 0U;
+static uint8_t *test_ecc_page = NULL;         /* protected page: ECC error when read */
+static uint32_t test_ecc_nmi_nb = 0U;
+static uint32_t test_ecc_handled_nb = 0U;
+
+static dc_cellular_params_t test_params;
+static dc_cellular_info_t   test_info;
+
+/* Private function prototypes -----------------------------------------------*/
+static void test_check(bool ok, const char *p_label, uint32_t value);
+static void test_ecc_nmi(int sig);
+static void test_flash_map(void);
+static void test_flash_reset(void);
+static void test_ecc_arm(uint8_t slot);
+static test_record_t *test_slot(uint8_t slot);
+static uint32_t test_checksum(const test_record_t *p_record);
+static void test_set_params(const char *p_apn, const char *p_username);
+static void test_set_info(const char *p_revision);
+static bool test_check_config(const char *p_imsi);
+static bool test_identity_revision(const char *p_revision);
+static void test_erased(void);
+static void test_store_and_check(void);
+static void test_fingerprint(void);
+static void test_alternate(void);
+static void test_corrupted(void);
+static void test_interrupted_write(void);
+static void test_ecc_error(void);
+static void test_sequence_wrap(void);
+static void test_sim_change(void);
+static void test_invalidate(void);
+
+/* Private function Definition -----------------------------------------------*/
+static void test_check(bool ok, const char *p_label, uint32_t value)
+{
+  test_nb++;
+  if (ok == false)
+  {
+    test_fail_nb++;
+    printf("FAIL %s (%u) %s bank\n", p_label, value,
+           ((FLASH->OPTR & FLASH_OPTR_DBANK) != 0U) ? "dual" : "single");
+  }
+}
+
+/**
+ * @brief  SIGSEGV handler: ECC double error NMI raised by a read of the protected page
+ */
+static void test_ecc_nmi(int sig)
+{
+  (void)sig;
+  if (test_ecc_page == NULL)
+  {
+    /* not a simulated ECC error */
+    abort();
+  }
+  test_ecc_nmi_nb++;
+  FLASH->ECCR |= FLASH_FLAG_ECCD;
+  if (CSN_FlashEccErrorCallback() == true)
+  {
+    test_ecc_handled_nb++;
+  }
+  /* the faulty read is replayed when the handler returns */
+  (void)mprotect((void *)test_ecc_page, (size_t)sysconf(_SC_PAGESIZE), PROT_READ | PROT_WRITE);
+  test_ecc_page = NULL;
+}
+
+static void test_flash_map(void)
+{
+  void *p_map;
+
+  p_map = mmap((void *)(uintptr_t)CST_MODEM_CONFIG_CACHE_ADDR, TEST_FLASH_SIZE, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+  if (p_map != (void *)(uintptr_t)CST_MODEM_CONFIG_CACHE_ADDR)
+  {
+    printf("flash simulation can't be mapped at 0x%08x\n", CST_MODEM_CONFIG_CACHE_ADDR);
+    exit(EXIT_FAILURE);
+  }
+  test_flash = (uint8_t *)p_map;
+  (void)signal(SIGSEGV, test_ecc_nmi);
+}
+
+/**
+ * @brief  erased flash, no failure injected
+ */
+static void test_flash_reset(void)
+{
+  (void)memset((void *)test_flash, 0xFF, TEST_FLASH_SIZE);
+  test_program_budget = TEST_PROGRAM_NO_LIMIT;
+  test_program_nb = 0U;
+  test_erase_nb = 0U;
+  test_ecc_nmi_nb = 0U;
+  test_ecc_handled_nb = 0U;
+  FLASH->SR = 0U;
+  FLASH->ECCR = 0U;
+}
+
+/**
+ * @brief  ECC double error raised by the next read of a slot (the error stays until the slot is erased:
+ *         to arm again before each read)
+ */
+static void test_ecc_arm(uint8_t slot)
+{
+  size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+
+  test_ecc_page = (uint8_t *)((uintptr_t)&test_flash[slot * TEST_SLOT_SIZE] & ~((uintptr_t)page_size - 1U));
+  (void)mprotect((void *)test_ecc_page, page_size, PROT_NONE);
+}
+
+static test_record_t *test_slot(uint8_t slot)
+{
+  return (test_record_t *)(void *)&test_flash[slot * TEST_SLOT_SIZE];
+}
+
+static uint32_t test_checksum(const test_record_t *p_record)
+{
+  const uint8_t *p_byte = (const uint8_t *)p_record;
+  uint32_t hash = TEST_FNV_OFFSET_BASIS;
+
+  for (uint32_t i = 0U; i < (uint32_t)offsetof(test_record_t, checksum); i++)
+  {
+    hash ^= (uint32_t)p_byte[i];
+    hash *= TEST_FNV_PRIME;
+  }
+  return hash;
+}
+
+static void test_set_params(const char *p_apn, const char *p_username)
+{
+  dc_sim_slot_t *p_slot;
+
+  (void)memset((void *)&test_params, 0, sizeof(test_params));
+  test_params.sim_slot_nb = 2U;
+  test_params.target_state = 2U;
+  for (uint8_t i = 0U; i < test_params.sim_slot_nb; i++)
+  {
+    p_slot = &test_params.sim_slot[i];
+    p_slot->sim_slot_type = i;
+    p_slot->apnSendToModem = 1U;
+    p_slot->apnPresent = true;
+    p_slot->cid = 1U;
+    (void)strncpy((char *)p_slot->apn, p_apn, CA_APN_SIZE_MAX - 1U);
+    (void)strncpy((char *)p_slot->username, p_username, CA_USERNAME_SIZE_MAX - 1U);
+  }
+}
+
+static void test_set_info(const char *p_revision)
+{
+  (void)memset((void *)&test_info, 0, sizeof(test_info));
+  (void)strcpy((char *)test_info.imei, "352653090123456");
+  (void)strcpy((char *)test_info.manufacturer_name, "Sierra Wireless");
+  (void)strcpy((char *)test_info.model, "WP7702");
+  (void)strncpy((char *)test_info.revision, p_revision, CA_REVISION_ID_SIZE_MAX - 1U);
+  (void)strcpy((char *)test_info.serial_number, "VU123456789");
+  (void)strcpy((char *)test_info.iccid, "89332401000012345678");
+}
+
+/**
+ * @brief  CSN_ConfigCheck() on SIM slot 0: on match, the stored IMSI must be p_imsi
+ */
+static bool test_check_config(const char *p_imsi)
+{
+  uint8_t imsi[CA_IMSI_SIZE_MAX];
+  bool result;
+
+  (void)memset((void *)imsi, 0, sizeof(imsi));
+  result = CSN_ConfigCheck(&test_params, 0U, imsi);
+  if (result == true)
+  {
+    test_check(strcmp((const char *)imsi, p_imsi) == 0, "stored IMSI", 0U);
+  }
+  test_check(test_flash_unlocked == false, "flash locked after check", 0U);
+  return result;
+}
+
+/**
+ * @brief  CSN_IdentityGet(): stored identity with the expected revision
+ */
+static bool test_identity_revision(const char *p_revision)
+{
+  dc_cellular_info_t info;
+  dc_cellular_info_t expected;
+
+  (void)memset((void *)&info, 0, sizeof(info));
+  if (CSN_IdentityGet(&info) == false)
+  {
+    return false;
+  }
+  expected = test_info;
+  (void)memset((void *)expected.revision, 0, sizeof(expected.revision));
+  (void)strncpy((char *)expected.revision, p_revision, CA_REVISION_ID_SIZE_MAX - 1U);
+  return ((memcmp((const void *)info.imei, (const void *)expected.imei, sizeof(info.imei)) == 0)
+          && (memcmp((const void *)info.model, (const void *)expected.model, sizeof(info.model)) == 0)
+          && (memcmp((const void *)info.revision, (const void *)expected.revision, sizeof(info.revision)) == 0)
+          && (memcmp((const void *)info.serial_number, (const void *)expected.serial_number,
+                     sizeof(info.serial_number)) == 0)
+          && (memcmp((const void *)info.iccid, (const void *)expected.iccid, sizeof(info.iccid)) == 0));
+}
+
+/**
+ * @brief  erased flash: no record, full init, identity requested to modem
+ */
+static void test_erased(void)
+{
+  test_flash_reset();
+  test_set_params("orange", "");
+  test_set_info("SWI9X06Y_02.32.02.00");
+  test_check(test_check_config("") == false, "erased flash: mismatch", 0U);
+  test_check(test_identity_revision("") == false, "erased flash: no identity", 0U);
+  test_check((test_erase_nb == 0U) && (test_program_nb == 0U), "erased flash: no write", test_program_nb);
+}
+
+/**
+ * @brief  first store in slot 0, found back at next boot
+ */
+static void test_store_and_check(void)
+{
+  test_erased();
+  test_check(CSN_ConfigStore(&test_info, (const uint8_t *)"208011234567890") == true, "first store", 0U);
+  test_check(test_flash_unlocked == false, "flash locked after store", 0U);
+  test_check((test_erase_nb == 1U) && (test_erase_log[0] == 0U), "first store: slot 0 erased", test_erase_nb);
+  test_check(test_program_nb == TEST_RECORD_DWORD_NB, "first store: record programmed", test_program_nb);
+  test_check(test_slot(0U)->magic == TEST_RECORD_MAGIC, "slot 0 magic", test_slot(0U)->magic);
+  test_check(test_slot(0U)->sequence == 0U, "slot 0 sequence", test_slot(0U)->sequence);
+  test_check(test_slot(0U)->checksum == test_checksum(test_slot(0U)), "slot 0 checksum (record layout)", 0U);
+  test_check(test_slot(1U)->magic == 0xFFFFFFFFU, "slot 1 still erased", test_slot(1U)->magic);
+
+  /* next boot */
+  test_check(test_check_config("208011234567890") == true, "stored configuration: match", 0U);
+  test_check(test_identity_revision("SWI9X06Y_02.32.02.00") == true, "stored identity", 0U);
+}
+
+/**
+ * @brief  any parameter used by the modem init changes the fingerprint
+ */
+static void test_fingerprint(void)
+{
+  uint8_t imsi[CA_IMSI_SIZE_MAX];
+
+  test_store_and_check();
+
+  test_set_params("free", "");
+  test_check(test_check_config("") == false, "APN changed: mismatch", 0U);
+  test_check(test_identity_revision("") == false, "mismatch: no identity", 0U);
+  test_set_params("orange", "user");
+  test_check(test_check_config("") == false, "user name changed: mismatch", 0U);
+  test_set_params("orange", "");
+  test_params.target_state = 3U;
+  test_check(test_check_config("") == false, "target state changed: mismatch", 0U);
+  test_set_params("orange", "");
+  test_check(CSN_ConfigCheck(&test_params, 1U, imsi) == false,
+             "other SIM slot: mismatch", 0U);
+  test_check(test_check_config("208011234567890") == true, "same parameters: match", 0U);
+}
+
+/**
+ * @brief  no write when nothing changed, then slots written alternately
+ */
+static void test_alternate(void)
+{
+  test_store_and_check();
+
+  test_erase_nb = 0U;
+  test_program_nb = 0U;
+  test_check(CSN_ConfigStore(&test_info, (const uint8_t *)"208011234567890") == true, "same store", 0U);
+  test_check((test_erase_nb == 0U) && (test_program_nb == 0U), "nothing changed: no flash write", test_erase_nb);
+
+  test_set_info("SWI9X06Y_02.36.00.00");
+  (void)test_check_config("208011234567890");
+  test_check(CSN_ConfigStore(&test_info, (const uint8_t *)"208011234567890") == true, "second store", 0U);
+  test_check((test_erase_nb == 1U) && (test_erase_log[0] == 1U), "second store: slot 1 erased", test_erase_nb);
+  test_check(test_slot(1U)->sequence == 1U, "slot 1 sequence", test_slot(1U)->sequence);
+  test_check(test_check_config("208011234567890") == true, "second store: match", 0U);
+  test_check(test_identity_revision("SWI9X06Y_02.36.00.00") == true, "second store: new identity", 0U);
+
+  test_set_info("SWI9X06Y_02.37.00.00");
+  test_check(CSN_ConfigStore(&test_info, (const uint8_t *)"208011234567890") == true, "third store", 0U);
+  test_check((test_erase_nb == 2U) && (test_erase_log[1] == 0U), "third store: slot 0 erased", test_erase_nb);
+  test_check(test_slot(0U)->sequence == 2U, "slot 0 sequence", test_slot(0U)->sequence);
+  test_check(test_slot(1U)->sequence == 1U, "previous record kept in slot 1", test_slot(1U)->sequence);
+  test_check(test_check_config("208011234567890") == true, "third store: match", 0U);
+  test_check(test_identity_revision("SWI9X06Y_02.37.00.00") == true, "third store: new identity", 0U);
+}
+
+/**
+ * @brief  corrupted record: the other slot is used, both corrupted: no record
+ */
+static void test_corrupted(void)
+{
+  test_alternate();
+
+  /* most recent record in slot 0 */
+  test_slot(0U)->revision[0] ^= 0x01U;
+  test_check(test_check_config("208011234567890") == true, "checksum error: older record match", 0U);
+  test_check(test_identity_revision("SWI9X06Y_02.36.00.00") == true, "checksum error: older identity", 0U);
+
+  test_slot(1U)->magic = TEST_RECORD_MAGIC + 1U;
+  test_slot(1U)->checksum = test_checksum(test_slot(1U));
+  test_check(test_check_config("") == false, "magic error: no record", 0U);
+
+  /* new record written over the corrupted one */
+  test_set_info("SWI9X06Y_02.38.00.00");
+  test_check(CSN_ConfigStore(&test_info, (const uint8_t *)"208011234567890") == true, "store after errors", 0U);
+  test_check(test_slot(0U)->sequence == 0U, "no valid record: sequence restarted in slot 0",
+             test_slot(0U)->sequence);
+  test_check(test_identity_revision("") == false, "no identity before check", 0U);
+  test_check(test_check_config("208011234567890") == true, "store after errors: match", 0U);
+  test_check(test_identity_revision("SWI9X06Y_02.38.00.00") == true, "store after errors: identity", 0U);
+}
+
+/**
+ * @brief  reset during a write: the previous record stays the valid one
+ */
+static void test_interrupted_write(void)
+{
+  for (uint32_t budget = 0U; budget < TEST_RECORD_DWORD_NB; budget++)
+  {
+    test_alternate();
+    /* slot 0: sequence 2 (02.37), slot 1: sequence 1 (02.36), next write in slot 1 */
+    test_set_info("SWI9X06Y_02.40.00.00");
+    test_program_budget = budget;
+    (void)CSN_ConfigStore(&test_info, (const uint8_t *)"208011234567890");
+    test_check(test_flash_unlocked == false, "flash locked after write error", budget);
+    test_program_budget = TEST_PROGRAM_NO_LIMIT;
+    test_check(test_check_config("208011234567890") == true, "interrupted write: match", budget);
+    test_check(test_identity_revision("SWI9X06Y_02.37.00.00") == true, "interrupted write: previous identity",
+               budget);
+
+    /* write again at next boot */
+    test_check(CSN_ConfigStore(&test_info, (const uint8_t *)"208011234567890") == true, "store again", budget);
+    test_check(test_check_config("208011234567890") == true, "store again: match", budget);
+    test_check(test_identity_revision("SWI9X06Y_02.40.00.00") == true, "store again: identity", budget);
+  }
+}
+
+/**
+ * @brief  ECC double error while the most recent record is read: the other slot is used
+ */
+static void test_ecc_error(void)
+{
+  test_alternate();
+
+  test_ecc_arm(0U);
+  test_check(test_check_config("208011234567890") == true, "ECC error: older record match", 0U);
+  test_check(test_ecc_nmi_nb == 1U, "ECC error raised", test_ecc_nmi_nb);
+  test_check(test_ecc_handled_nb == 1U, "ECC error handled by CSN_FlashEccErrorCallback", test_ecc_handled_nb);
+  test_check((FLASH->ECCR & FLASH_FLAG_ECCD) == 0U, "ECC error flag cleared", FLASH->ECCR);
+  test_ecc_arm(0U);
+  test_check(test_identity_revision("SWI9X06Y_02.36.00.00") == true, "ECC error: older identity", 0U);
+  test_check(test_ecc_handled_nb == 2U, "ECC error handled at each read", test_ecc_handled_nb);
+
+  /* error outside a record read: not handled */
+  FLASH->ECCR |= FLASH_FLAG_ECCD;
+  test_check(CSN_FlashEccErrorCallback() == false, "ECC error outside a record read: not handled", 0U);
+  FLASH->ECCR = 0U;
+  test_check(test_check_config("208011234567890") == true, "no ECC error: match", 0U);
+  test_check(test_identity_revision("SWI9X06Y_02.37.00.00") == true, "no ECC error: last identity", 0U);
+}
+
+/**
+ * @brief  most recent record across the sequence number wrap
+ */
+static void test_sequence_wrap(void)
+{
+  static const uint32_t sequences[2][TEST_SLOT_NB] = { { 0xFFFFFFFFU, 0U }, { 0U, 0xFFFFFFFFU } };
+
+  for (uint8_t i = 0U; i < 2U; i++)
+  {
+    test_alternate();
+    /* slot 0: 02.37, slot 1: 02.36 */
+    for (uint8_t slot = 0U; slot < TEST_SLOT_NB; slot++)
+    {
+      test_slot(slot)->sequence = sequences[i][slot];
+      test_slot(slot)->checksum = test_checksum(test_slot(slot));
+    }
+    test_check(test_check_config("208011234567890") == true, "sequence wrap: match", i);
+    test_check(test_identity_revision((i == 0U) ? "SWI9X06Y_02.36.00.00" : "SWI9X06Y_02.37.00.00") == true,
+               "sequence wrap: most recent identity", i);
+
+    /* next write in the slot of the older record */
+    test_erase_nb = 0U;
+    test_set_info("SWI9X06Y_02.40.00.00");
+    (void)CSN_ConfigStore(&test_info, (const uint8_t *)"208011234567890");
+    test_check((test_erase_nb == 1U) && (test_erase_log[0] == i), "sequence wrap: older slot written", i);
+    test_check(test_slot(i)->sequence == 1U, "sequence wrap: next sequence", test_slot(i)->sequence);
+    test_check(test_check_config("208011234567890") == true, "sequence wrap: new record match", i);
+    test_check(test_identity_revision("SWI9X06Y_02.40.00.00") == true, "sequence wrap: new identity", i);
+  }
+}
+
+/**
+ * @brief  init skipped with the configuration of another SIM: cache invalidated
+ */
+static void test_sim_change(void)
+{
+  test_alternate();
+
+  test_erase_nb = 0U;
+  test_check(CSN_ConfigStore(&test_info, (const uint8_t *)"208019999999999") == false, "SIM changed", 0U);
+  test_check(test_flash_unlocked == false, "flash locked after invalidation", 0U);
+  /* slot 0: sequence 2, slot 1: sequence 1 */
+  test_check(test_erase_nb == 2U, "SIM changed: both slots erased", test_erase_nb);
+  test_check((test_erase_log[0] == 1U) && (test_erase_log[1] == 0U), "SIM changed: older record erased first",
+             test_erase_log[0]);
+  test_check(test_check_config("") == false, "SIM changed: full init at next boot", 0U);
+
+  /* full init done: new SIM stored */
+  test_check(CSN_ConfigStore(&test_info, (const uint8_t *)"208019999999999") == true, "new SIM stored", 0U);
+  test_check(test_check_config("208019999999999") == true, "new SIM: match", 0U);
+}
+
+/**
+ * @brief  invalidation erases only the slots containing a record
+ */
+static void test_invalidate(void)
+{
+  test_store_and_check();
+
+  test_erase_nb = 0U;
+  CSN_ConfigInvalidate();
+  test_check((test_erase_nb == 1U) && (test_erase_log[0] == 0U), "invalidate: slot 0 erased", test_erase_nb);
+  test_check(test_flash_unlocked == false, "flash locked after invalidate", 0U);
+  test_check(test_check_config("") == false, "invalidate: full init", 0U);
+  test_check(test_identity_revision("") == false, "invalidate: no identity", 0U);
+
+  test_erase_nb = 0U;
+  CSN_ConfigInvalidate();
+  test_check(test_erase_nb == 0U, "invalidate erased flash: no erase", test_erase_nb);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void)
+{
+  test_flash_unlocked = true;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Lock(void)
+{
+  test_flash_unlocked = false;
+  return HAL_OK;
+}
+
+/**
+ * @brief  erases the page computed by the module: must be the first page of a slot
+ */
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *PageError)
+{
+  uint32_t address;
+  uint32_t page_size;
+
+  *PageError = 0xFFFFFFFFU;
+  if ((FLASH->OPTR & FLASH_OPTR_DBANK) != 0U)
+  {
+    page_size = FLASH_PAGE_SIZE;
+    address = FLASH_BASE + ((pEraseInit->Banks == FLASH_BANK_2) ? FLASH_BANK_SIZE : 0U)
+              + (pEraseInit->Page * page_size);
+  }
+  else
+  {
+    page_size = FLASH_PAGE_SIZE_128_BITS;
+    test_check(pEraseInit->Banks == FLASH_BANK_1, "single bank: bank 1 erased", pEraseInit->Banks);
+    address = FLASH_BASE + (pEraseInit->Page * page_size);
+  }
+
+  if ((test_flash_unlocked == false) || (pEraseInit->TypeErase != FLASH_TYPEERASE_PAGES)
+      || (pEraseInit->NbPages != 1U) || (address < CST_MODEM_CONFIG_CACHE_ADDR)
+      || (((address - CST_MODEM_CONFIG_CACHE_ADDR) % TEST_SLOT_SIZE) != 0U)
+      || ((address - CST_MODEM_CONFIG_CACHE_ADDR) >= TEST_FLASH_SIZE))
+  {
+    test_check(false, "erase of a slot page", address);
+    return HAL_ERROR;
+  }
+
+  (void)memset((void *)(uintptr_t)address, 0xFF, page_size);
+  if (test_erase_nb < TEST_ERASE_LOG_NB)
+  {
+    test_erase_log[test_erase_nb] = (uint8_t)((address - CST_MODEM_CONFIG_CACHE_ADDR) / TEST_SLOT_SIZE);
+  }
+  test_erase_nb++;
+  return HAL_OK;
+}
+
+/**
+ * @brief  programs a double word: fails on a double word not erased or when the budget is spent
+ */
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uint32_t Address, uint64_t Data)
+{
+  uint64_t *p_dword = (uint64_t *)(uintptr_t)Address;
+
+  if ((test_flash_unlocked == false) || (TypeProgram != FLASH_TYPEPROGRAM_DOUBLEWORD)
+      || ((Address % sizeof(uint64_t)) != 0U) || (Address < CST_MODEM_CONFIG_CACHE_ADDR)
+      || ((Address - CST_MODEM_CONFIG_CACHE_ADDR) >= TEST_FLASH_SIZE))
+  {
+    test_check(false, "program of a slot double word", Address);
+    return HAL_ERROR;
+  }
+  if (test_program_budget == 0U)
+  {
+    return HAL_ERROR;
+  }
+  if (*p_dword != 0xFFFFFFFFFFFFFFFFU)
+  {
+    test_check(false, "program of an erased double word", Address);
+    return HAL_ERROR;
+  }
+
+  *p_dword = Data;
+  if (test_program_budget != TEST_PROGRAM_NO_LIMIT)
+  {
+    test_program_budget--;
+  }
+  test_program_nb++;
+  return HAL_OK;
+}
+
+int main(void)
+{
+  test_flash_map();
+
+  for (uint32_t bank_mode = 0U; bank_mode < 2U; bank_mode++)
+  {
+    FLASH->OPTR = (bank_mode == 0U) ? 0U : FLASH_OPTR_DBANK;
+    test_erased();
+    test_store_and_check();
+    test_fingerprint();
+    test_alternate();
+    test_corrupted();
+    test_interrupted_write();
+    test_ecc_error();
+    test_sequence_wrap();
+    test_sim_change();
+    test_invalidate();
+  }
+
+  printf("modem config cache (record %u bytes): %u tests, %u failures\n",
+         (uint32_t)sizeof(test_record_t), test_nb, test_fail_nb);
+
+  return (int)test_fail_nb;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
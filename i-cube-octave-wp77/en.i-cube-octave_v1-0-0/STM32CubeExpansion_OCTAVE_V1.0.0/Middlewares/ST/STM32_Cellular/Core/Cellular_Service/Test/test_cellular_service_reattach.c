@@ -0,0 +1,391 @@
+/**
+ ******************************************************************************
+ * @file    test_cellular_service_reattach.c
+ * @author  MCD Application Team
+ * @brief   Host test of the network reattach management
+ *          (backoff and jitter of cellular_service_reattach.c)
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+ * All rights reserved.</center></h2>
+ *
+ * This software component is licensed by ST under Ultimate Liberty license
+ * SLA0044, the "License"; You may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at:
+ *                             www.st.com/SLA0044
+ *
+ ******************************************************************************
+ *
+ * This file is not part of the target build. From this directory, build and run it
+ * on the host:
+ *
+ *   gcc -O2 -Wall -I. -I../Inc -I../../Runtime_Library/Inc \
+ *       test_cellular_service_reattach.c ../Src/cellular_service_reattach.c -o test_csr
+ *   ./test_csr
+ *
+ *   add -DCST_REATTACH_BACKOFF_MIN=... -DCST_REATTACH_BACKOFF_MAX=... to test other bounds.
+ *
+ * The headers of this directory replace the target ones: the RNG and HAL_GetTick are
+ * driven by the test, the Data Cache is a single entry in memory. Checked:
+ *   - retry delay of attempt n is in [backoff/2, backoff] with
+ *     backoff = min(CST_REATTACH_BACKOFF_MIN * 2^n, CST_REATTACH_BACKOFF_MAX),
+ *     for the RNG extreme values, random values and the rand() fallback,
+ *   - the jitter spreads the delays over the whole interval,
+ *   - the minimal delay (NFMC tempo) is applied, even above the maximum backoff,
+ *   - the backoff restarts from the minimum after an attachment,
+ *   - the last network registered is requested once, then automatic selection after a failure,
+ *   - attachment metrics published in Data Cache (counters, durations, retry delay).
+ * The process exit code is the number of failures (0: all tests passed).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "cellular_service_reattach.h"
+#include "cellular_service_datacache.h"
+#include "rng.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_ATTEMPT_NB     (24U)    /* more attempts than needed to reach the maximum backoff */
+#define TEST_JITTER_DRAW_NB (10000U) /* random draws to check the jitter spread */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef enum
+{
+  TEST_RNG_ZERO = 0,  /* RNG returns 0          */
+  TEST_RNG_MAX,       /* RNG returns 0xFFFFFFFF */
+  TEST_RNG_RANDOM,    /* RNG returns rand()     */
+  TEST_RNG_FAIL,      /* RNG fails: rand() fallback in CSR_random() */
+} test_rng_mode_t;
+
+/* Global variables ----------------------------------------------------------*/
+dc_com_db_t dc_com_db;
+dc_com_res_id_t DC_CELLULAR_ATTACH_INFO = 0U;
+RNG_HandleTypeDef hrng;
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t test_nb = 0U;
+static uint32_t test_fail_nb = 0U;
+static test_rng_mode_t test_rng_mode = TEST_RNG_RANDOM;
+static uint32_t test_tick = 0U;
+
+/* Private function prototypes -----------------------------------------------*/
+static void test_check(bool ok, const char *p_label, uint32_t value);
+static uint32_t test_backoff(uint32_t attempt);
+static void test_attach_info(dc_cellular_attach_info_t *p_attach_info);
+static void test_registered(const char *p_name);
+static void test_start(void);
+static void test_backoff_bounds(void);
+static void test_jitter_spread(void);
+static void test_min_delay(void);
+static void test_backoff_restart(void);
+static void test_last_network(void);
+static void test_metrics(void);
+
+/* Private function Definition -----------------------------------------------*/
+static void test_check(bool ok, const char *p_label, uint32_t value)
+{
+  test_nb++;
+  if (ok == false)
+  {
+    test_fail_nb++;
+    printf("FAIL %s (%u)\n", p_label, value);
+  }
+}
+
+/**
+ * @brief  expected backoff of an attempt (0: first failure)
+ */
+static uint32_t test_backoff(uint32_t attempt)
+{
+  uint64_t backoff = CST_REATTACH_BACKOFF_MIN;
+
+  for (uint32_t i = 0U; (i < attempt) && (backoff < CST_REATTACH_BACKOFF_MAX); i++)
+  {
+    backoff *= 2U;
+  }
+  return (backoff > CST_REATTACH_BACKOFF_MAX) ? CST_REATTACH_BACKOFF_MAX : (uint32_t)backoff;
+}
+
+static void test_attach_info(dc_cellular_attach_info_t *p_attach_info)
+{
+  (void)dc_com_read(&dc_com_db, DC_CELLULAR_ATTACH_INFO, (void *)p_attach_info, sizeof(dc_cellular_attach_info_t));
+}
+
+/**
+ * @brief  modem registered on a network (format, name and AcT reported)
+ */
+static void test_registered(const char *p_name)
+{
+  CS_RegistrationStatus_t reg_status;
+
+  (void)memset((void *)&reg_status, 0, sizeof(reg_status));
+  reg_status.optional_fields_presence = (CS_RegistrationStatusFields_t)(CS_RSF_FORMAT_PRESENT
+                                                                       | CS_RSF_OPERATOR_NAME_PRESENT
+                                                                       | CS_RSF_ACT_PRESENT);
+  reg_status.format = CS_ONF_NUMERIC;
+  (void)strncpy((char *)reg_status.operator_name, p_name, MAX_SIZE_OPERATOR_NAME - 1U);
+  reg_status.AcT = CS_ACT_E_UTRAN;
+  CSR_AttachDone(&reg_status);
+}
+
+/**
+ * @brief  new reattach context and new attachment
+ */
+static void test_start(void)
+{
+  (void)memset((void *)&dc_com_db, 0, sizeof(dc_com_db));
+  CSR_Init();
+  (void)CSR_AttachStart();
+}
+
+/**
+ * @brief  retry delay of attempt n in [backoff/2, backoff]
+ */
+static void test_backoff_bounds(void)
+{
+  static const test_rng_mode_t modes[] = { TEST_RNG_ZERO, TEST_RNG_MAX, TEST_RNG_RANDOM, TEST_RNG_FAIL };
+  uint32_t delay;
+  uint32_t backoff;
+
+  for (uint32_t m = 0U; m < (sizeof(modes) / sizeof(modes[0])); m++)
+  {
+    test_rng_mode = modes[m];
+    test_start();
+    for (uint32_t attempt = 0U; attempt < TEST_ATTEMPT_NB; attempt++)
+    {
+      backoff = test_backoff(attempt);
+      delay = CSR_AttachFailed(0U, true);
+      test_check(delay >= (backoff / 2U), "delay >= backoff/2", delay);
+      test_check(delay <= backoff, "delay <= backoff", delay);
+      test_check(delay <= CST_REATTACH_BACKOFF_MAX, "delay <= CST_REATTACH_BACKOFF_MAX", delay);
+      if (test_rng_mode == TEST_RNG_ZERO)
+      {
+        test_check(delay == (backoff / 2U), "RNG 0: delay == backoff/2", delay);
+      }
+    }
+    test_check(backoff == CST_REATTACH_BACKOFF_MAX, "maximum backoff reached", backoff);
+  }
+  test_rng_mode = TEST_RNG_RANDOM;
+}
+
+/**
+ * @brief  jitter: delays spread over [backoff/2, backoff] (devices of a fleet do not retry together)
+ */
+static void test_jitter_spread(void)
+{
+  uint32_t backoff = CST_REATTACH_BACKOFF_MAX;
+  uint32_t min = 0xFFFFFFFFU;
+  uint32_t max = 0U;
+  uint32_t low_half = 0U;
+  uint32_t delay;
+
+  test_rng_mode = TEST_RNG_RANDOM;
+  test_start();
+  for (uint32_t i = 0U; i < TEST_JITTER_DRAW_NB; i++)
+  {
+    delay = CSR_AttachFailed(0U, true);
+    if (i < TEST_ATTEMPT_NB)
+    {
+      continue; /* maximum backoff not reached yet */
+    }
+    min = (delay < min) ? delay : min;
+    max = (delay > max) ? delay : max;
+    if (delay < ((backoff / 2U) + (backoff / 4U)))
+    {
+      low_half++;
+    }
+  }
+  /* extremes within 1% of the interval bounds, about half of the draws in each half */
+  test_check(min <= ((backoff / 2U) + (backoff / 200U)), "jitter reaches backoff/2", min);
+  test_check(max >= (backoff - (backoff / 200U)), "jitter reaches backoff", max);
+  test_check((low_half > ((TEST_JITTER_DRAW_NB * 4U) / 10U)) && (low_half < ((TEST_JITTER_DRAW_NB * 6U) / 10U)),
+             "jitter uniform", low_half);
+}
+
+/**
+ * @brief  minimal delay (NFMC tempo) applied
+ */
+static void test_min_delay(void)
+{
+  uint32_t delay;
+
+  test_start();
+  delay = CSR_AttachFailed(CST_REATTACH_BACKOFF_MAX * 2U, true);
+  test_check(delay == (CST_REATTACH_BACKOFF_MAX * 2U), "min delay above maximum backoff", delay);
+  delay = CSR_AttachFailed(CST_REATTACH_BACKOFF_MIN / 4U, true);
+  test_check(delay >= (test_backoff(1U) / 2U), "min delay below backoff: backoff kept", delay);
+}
+
+/**
+ * @brief  backoff restarts from the minimum after an attachment
+ */
+static void test_backoff_restart(void)
+{
+  uint32_t delay;
+
+  test_rng_mode = TEST_RNG_MAX;
+  test_start();
+  for (uint32_t attempt = 0U; attempt < TEST_ATTEMPT_NB; attempt++)
+  {
+    (void)CSR_AttachFailed(0U, true);
+  }
+  test_registered("20801");
+  (void)CSR_AttachStart();
+  delay = CSR_AttachFailed(0U, true);
+  test_check(delay <= CST_REATTACH_BACKOFF_MIN, "backoff restarted", delay);
+  test_rng_mode = TEST_RNG_RANDOM;
+}
+
+/**
+ * @brief  last network registered requested first, automatic selection after a failure
+ */
+static void test_last_network(void)
+{
+  CS_OperatorSelector_t operator;
+
+  test_start();
+  (void)memset((void *)&operator, 0, sizeof(operator));
+  operator.mode = CS_NRM_AUTO;
+  test_check(CSR_OperatorSelect(&operator) == false, "no last network at boot", 0U);
+  test_registered("20801");
+
+  /* network loss: last network requested */
+  (void)CSR_AttachStart();
+  test_check(CSR_OperatorSelect(&operator) == true, "last network requested", 0U);
+  test_check(operator.mode == CS_NRM_MANUAL_THEN_AUTO, "manual then automatic selection", operator.mode);
+  test_check(strcmp((const char *)operator.operator_name, "20801") == 0, "last network name", 0U);
+
+  /* last network not found: automatic selection until next attachment */
+  (void)CSR_AttachFailed(0U, true);
+  operator.mode = CS_NRM_AUTO;
+  test_check(CSR_OperatorSelect(&operator) == false, "automatic selection after failure", 0U);
+
+  /* manual selection configured: not changed */
+  test_registered("20810");
+  (void)CSR_AttachStart();
+  operator.mode = CS_NRM_MANUAL;
+  test_check(CSR_OperatorSelect(&operator) == false, "manual selection kept", 0U);
+}
+
+/**
+ * @brief  attachment metrics in Data Cache
+ */
+static void test_metrics(void)
+{
+  dc_cellular_attach_info_t attach_info;
+  CS_OperatorSelector_t operator;
+  uint32_t delay;
+
+  test_start();
+  test_tick = 1000U;
+  (void)CSR_AttachStart();
+  delay = CSR_AttachFailed(0U, true);
+  test_attach_info(&attach_info);
+  test_check(attach_info.fail_nb == 1U, "fail_nb", attach_info.fail_nb);
+  test_check(attach_info.retry_delay == delay, "retry delay published", attach_info.retry_delay);
+  test_check(attach_info.rt_state != DC_SERVICE_ON, "no attachment yet", (uint32_t)attach_info.rt_state);
+
+  (void)CSR_AttachFailed(0U, false);
+  test_attach_info(&attach_info);
+  test_check(attach_info.fail_nb == 2U, "fail_nb", attach_info.fail_nb);
+  test_check(attach_info.retry_delay == 0U, "no retry delay when not scheduled", attach_info.retry_delay);
+
+  /* first attachment: started at CSR_AttachStart() of test_start() (tick 0) */
+  test_tick = 4000U;
+  test_registered("20801");
+  test_attach_info(&attach_info);
+  test_check(attach_info.rt_state == DC_SERVICE_ON, "attachment done", (uint32_t)attach_info.rt_state);
+  test_check(attach_info.attach_nb == 1U, "attach_nb", attach_info.attach_nb);
+  test_check(attach_info.last_time == 4000U, "last_time", attach_info.last_time);
+  test_check(attach_info.retry_delay == 0U, "retry delay cleared", attach_info.retry_delay);
+  test_check(strcmp((const char *)attach_info.mno_name, "20801") == 0, "mno_name", 0U);
+
+  /* fast attachment on the last network */
+  test_tick = 10000U;
+  (void)CSR_AttachStart();
+  operator.mode = CS_NRM_AUTO;
+  (void)CSR_OperatorSelect(&operator);
+  test_tick = 12000U;
+  test_registered("20801");
+  test_attach_info(&attach_info);
+  test_check(attach_info.attach_nb == 2U, "attach_nb", attach_info.attach_nb);
+  test_check(attach_info.fast_attach_nb == 1U, "fast_attach_nb", attach_info.fast_attach_nb);
+  test_check(attach_info.min_time == 2000U, "min_time", attach_info.min_time);
+  test_check(attach_info.max_time == 4000U, "max_time", attach_info.max_time);
+  test_check(attach_info.avg_time == 3000U, "avg_time", attach_info.avg_time);
+  test_tick = 0U;
+}
+
+/* Functions Definition ------------------------------------------------------*/
+/* Services used by cellular_service_reattach.c */
+uint32_t HAL_GetTick(void)
+{
+  return test_tick;
+}
+
+HAL_StatusTypeDef HAL_RNG_GenerateRandomNumber(RNG_HandleTypeDef *p_hrng, uint32_t *random32bit)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  (void)p_hrng;
+  switch (test_rng_mode)
+  {
+    case TEST_RNG_ZERO:
+      *random32bit = 0U;
+      break;
+    case TEST_RNG_MAX:
+      *random32bit = 0xFFFFFFFFU;
+      break;
+    case TEST_RNG_RANDOM:
+      *random32bit = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+      break;
+    default:
+      status = HAL_ERROR;
+      break;
+  }
+  return status;
+}
+
+ca_access_techno_t cst_convert_access_techno(CS_AccessTechno_t access_techno)
+{
+  return (access_techno == CS_ACT_E_UTRAN) ? CA_ACT_E_UTRAN : CA_ACT_GSM;
+}
+
+dc_com_status_t dc_com_write(dc_com_db_t *p_dc, dc_com_res_id_t res_id, const void *p_data, uint32_t len)
+{
+  (void)res_id;
+  (void)memcpy((void *)p_dc->entry, p_data, len);
+  return DC_COM_OK;
+}
+
+dc_com_status_t dc_com_read(dc_com_db_t *p_dc, dc_com_res_id_t res_id, void *p_data, uint32_t len)
+{
+  (void)res_id;
+  (void)memcpy(p_data, (const void *)p_dc->entry, len);
+  return DC_COM_OK;
+}
+
+int main(void)
+{
+  srand(1U);
+
+  test_backoff_bounds();
+  test_jitter_spread();
+  test_min_delay();
+  test_backoff_restart();
+  test_last_network();
+  test_metrics();
+
+  printf("reattach (backoff %u..%u ms): %u tests, %u failures\n",
+         CST_REATTACH_BACKOFF_MIN, CST_REATTACH_BACKOFF_MAX, test_nb, test_fail_nb);
+
+  return (int)test_fail_nb;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,424 @@
+/**
+ ******************************************************************************
+ * @file    test_cellular_service_txsched.c
+ * @author  MCD Application Team
+ * @brief   Host test of the deferred transmission scheduler
+ *          (grouping of cellular_service_txsched.c)
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+ * All rights reserved.</center></h2>
+ *
+ * This software component is licensed by ST under Ultimate Liberty license
+ * SLA0044, the "License"; You may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at:
+ *                             www.st.com/SLA0044
+ *
+ ******************************************************************************
+ *
+ * This file is not part of the target build. From this directory, build and run it
+ * on the host:
+ *
+ *   gcc -O2 -Wall -DUSE_LOW_POWER=1 -I. -I../Inc \
+ *       test_cellular_service_txsched.c ../Src/cellular_service_txsched.c -lpthread -o test_csx
+ *   ./test_csx
+ *
+ *   add -DCSP_TX_SCHEDULER_NB=... (4 at least) to test another table size.
+ *
+ * The headers of this directory replace the target ones: HAL_GetTick, the modem power
+ * state (CSP_GetPowerState) and the RTOS timer are driven by the test. Checked:
+ *   - scheduler not started, modem awake, low power disabled or no deadline: immediate call,
+ *   - modem in low power: callbacks wait, the timer is armed on the earliest deadline,
+ *     including a deadline already passed and across the 32 bits tick wrap,
+ *   - deadline reached, full table or modem wake window: all pending callbacks are called
+ *     together, in order, with their context, and the timer is stopped,
+ *   - wakeups saved: one wakeup per grouped flush when the modem was in low power,
+ *     none when the modem was already awake,
+ *   - a callback can schedule again (callbacks are called outside of the scheduler mutex).
+ * The process exit code is the number of failures (0: all tests passed).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "cellular_service_txsched.h"
+#include "cellular_service_power.h"
+#include "rtosal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_CALL_NB_MAX       (64U)   /* callbacks recorded */
+
+#if (CSP_TX_SCHEDULER_NB < 4U)
+#error "the deadline tests group 3 transmissions: CSP_TX_SCHEDULER_NB must be 4 at least"
+#endif /* CSP_TX_SCHEDULER_NB < 4U */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  os_ptimer func;
+  bool      armed;
+  uint32_t  expiry;   /* tick at which the timer expires */
+  uint32_t  period;   /* last delay given to rtosalTimerStart */
+} test_timer_t;
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t test_nb = 0U;
+static uint32_t test_fail_nb = 0U;
+static uint32_t test_tick = 0U;
+static CSP_PowerState_t test_power_state = CSP_LOW_POWER_ACTIVE;
+static test_timer_t test_timer;
+static uint32_t test_timer_nb = 0U;
+static uint32_t test_calls[TEST_CALL_NB_MAX];     /* contexts of the callbacks called, in order */
+static uint32_t test_call_nb = 0U;
+static uint32_t test_reschedule_nb = 0U;           /* callbacks scheduling again */
+
+/* Private function prototypes -----------------------------------------------*/
+static void test_check(bool ok, const char *p_label, uint32_t value);
+static void test_callback(void *p_ctx);
+static void test_reschedule_callback(void *p_ctx);
+static void test_advance(uint32_t duration);
+static void test_start(uint32_t tick);
+static bool test_stats(uint32_t posted, uint32_t flushed, uint32_t flush_nb, uint32_t wakeups_saved);
+static bool test_called(uint32_t first_ctx, uint32_t nb);
+static void test_not_started(void);
+static void test_immediate(void);
+static void test_deadline(void);
+static void test_deadline_passed(void);
+static void test_tick_wrap(void);
+static void test_wake_window(void);
+static void test_table_full(void);
+static void test_reschedule(void);
+
+/* Private function Definition -----------------------------------------------*/
+static void test_check(bool ok, const char *p_label, uint32_t value)
+{
+  test_nb++;
+  if (ok == false)
+  {
+    test_fail_nb++;
+    printf("FAIL %s (%u)\n", p_label, value);
+  }
+}
+
+/**
+ * @brief  application callback: records its context
+ */
+static void test_callback(void *p_ctx)
+{
+  if (test_call_nb < TEST_CALL_NB_MAX)
+  {
+    test_calls[test_call_nb] = (uint32_t)(uintptr_t)p_ctx;
+  }
+  test_call_nb++;
+}
+
+/**
+ * @brief  application callback scheduling a new transmission
+ */
+static void test_reschedule_callback(void *p_ctx)
+{
+  test_callback(p_ctx);
+  test_reschedule_nb++;
+  (void)CSX_Schedule(test_callback, (void *)(uintptr_t)((uint32_t)(uintptr_t)p_ctx + 100U), 1000U);
+}
+
+/**
+ * @brief  time goes on: the timer expires when its expiry tick is reached
+ */
+static void test_advance(uint32_t duration)
+{
+  for (uint32_t i = 0U; i < duration; i++)
+  {
+    test_tick++;
+    if ((test_timer.armed == true) && (test_tick == test_timer.expiry))
+    {
+      test_timer.armed = false;
+      test_timer.func(NULL);
+    }
+  }
+}
+
+/**
+ * @brief  new scheduler, modem in low power
+ */
+static void test_start(uint32_t tick)
+{
+  test_tick = tick;
+  test_power_state = CSP_LOW_POWER_ACTIVE;
+  test_call_nb = 0U;
+  test_reschedule_nb = 0U;
+  CSX_Init();
+}
+
+static bool test_stats(uint32_t posted, uint32_t flushed, uint32_t flush_nb, uint32_t wakeups_saved)
+{
+  CSX_Stats_t stats;
+
+  CSX_GetStats(&stats);
+  return ((stats.posted == posted) && (stats.flushed == flushed) && (stats.flush_nb == flush_nb)
+          && (stats.wakeups_saved == wakeups_saved));
+}
+
+/**
+ * @brief  the nb callbacks called are first_ctx, first_ctx + 1...
+ */
+static bool test_called(uint32_t first_ctx, uint32_t nb)
+{
+  bool result = (test_call_nb == nb);
+
+  for (uint32_t i = 0U; (i < nb) && (i < TEST_CALL_NB_MAX) && (result == true); i++)
+  {
+    result = (test_calls[i] == (first_ctx + i));
+  }
+  return result;
+}
+
+/**
+ * @brief  scheduler not started: immediate call, no statistics
+ */
+static void test_not_started(void)
+{
+  CSX_Stats_t stats;
+
+  test_power_state = CSP_LOW_POWER_ACTIVE;
+  test_call_nb = 0U;
+  test_check(CSX_Schedule(test_callback, (void *)1U, 1000U) == CELLULAR_OK, "not started: schedule OK", 0U);
+  test_check(test_called(1U, 1U) == true, "not started: immediate call", test_call_nb);
+  (void)memset((void *)&stats, 0xFF, sizeof(stats));
+  CSX_GetStats(&stats);
+  test_check((stats.posted == 0U) && (stats.wakeups_saved == 0U), "not started: no statistics", stats.posted);
+  test_check(test_timer_nb == 0U, "not started: no timer", test_timer_nb);
+}
+
+/**
+ * @brief  modem awake, low power disabled or no deadline: immediate call
+ */
+static void test_immediate(void)
+{
+  test_start(1000U);
+  test_check(test_timer_nb == 1U, "one timer created", test_timer_nb);
+  test_check(CSX_Schedule(NULL, NULL, 1000U) == CELLULAR_ERROR, "NULL callback rejected", 0U);
+  test_check(test_stats(0U, 0U, 0U, 0U) == true, "NULL callback not posted", 0U);
+
+  test_power_state = CSP_LOW_POWER_INACTIVE;
+  (void)CSX_Schedule(test_callback, (void *)1U, 1000U);
+  test_power_state = CSP_LOW_POWER_DISABLED;
+  (void)CSX_Schedule(test_callback, (void *)2U, 1000U);
+  test_power_state = CSP_LOW_POWER_ACTIVE;
+  (void)CSX_Schedule(test_callback, (void *)3U, 0U);
+  test_check(test_called(1U, 3U) == true, "immediate calls", test_call_nb);
+  test_check(CSX_GetPendingNb() == 0U, "immediate: nothing pending", CSX_GetPendingNb());
+  test_check(test_timer.armed == false, "immediate: timer not armed", test_timer.period);
+  test_check(test_stats(3U, 3U, 0U, 0U) == true, "immediate: statistics", 0U);
+}
+
+/**
+ * @brief  modem in low power: callbacks grouped at the earliest deadline
+ */
+static void test_deadline(void)
+{
+  static const CSP_PowerState_t states[] = { CSP_LOW_POWER_ACTIVE, CSP_LOW_POWER_ON_GOING };
+
+  for (uint32_t s = 0U; s < (sizeof(states) / sizeof(states[0])); s++)
+  {
+    test_start(1000U);
+    test_power_state = states[s];
+    (void)CSX_Schedule(test_callback, (void *)10U, 5000U);
+    test_check((test_timer.armed == true) && (test_timer.period == 5000U), "first deadline armed", test_timer.period);
+    test_advance(1000U);
+    (void)CSX_Schedule(test_callback, (void *)11U, 2000U);
+    test_check(test_timer.period == 2000U, "earlier deadline armed", test_timer.period);
+    test_advance(500U);
+    (void)CSX_Schedule(test_callback, (void *)12U, 8000U);
+    test_check(test_timer.period == 1500U, "earliest remaining deadline armed", test_timer.period);
+    test_check(CSX_GetPendingNb() == 3U, "3 transmissions pending", CSX_GetPendingNb());
+    test_check(test_call_nb == 0U, "nothing called before the deadline", test_call_nb);
+
+    test_advance(1499U);
+    test_check(test_call_nb == 0U, "nothing called 1 ms before the deadline", test_call_nb);
+    test_advance(1U);
+    test_check(test_called(10U, 3U) == true, "all called at the earliest deadline, in order", test_call_nb);
+    test_check(CSX_GetPendingNb() == 0U, "deadline: nothing pending", CSX_GetPendingNb());
+    /* 3 transmissions, 1 wakeup */
+    test_check(test_stats(3U, 3U, 1U, 2U) == true, "deadline: 2 wakeups saved", s);
+    test_advance(10000U);
+    test_check(test_call_nb == 3U, "deadline: no call after the flush", test_call_nb);
+
+    /* single transmission: nothing saved */
+    (void)CSX_Schedule(test_callback, (void *)13U, 100U);
+    test_advance(100U);
+    test_check(test_call_nb == 4U, "single transmission called", test_call_nb);
+    test_check(test_stats(4U, 4U, 2U, 2U) == true, "single transmission: no wakeup saved", s);
+
+    /* empty flush */
+    CSX_Flush(true);
+    test_check(test_stats(4U, 4U, 2U, 2U) == true, "empty flush: statistics unchanged", s);
+  }
+}
+
+/**
+ * @brief  timer callback late: a deadline already passed arms the timer on 1 ms
+ */
+static void test_deadline_passed(void)
+{
+  test_start(1000U);
+  (void)CSX_Schedule(test_callback, (void *)20U, 1000U);
+  /* time goes on, timer task not scheduled */
+  test_timer.armed = false;
+  test_tick += 1500U;
+  (void)CSX_Schedule(test_callback, (void *)21U, 5000U);
+  test_check((test_timer.armed == true) && (test_timer.period == 1U), "deadline passed: timer on 1 ms",
+             test_timer.period);
+  test_advance(1U);
+  test_check(test_called(20U, 2U) == true, "deadline passed: all called", test_call_nb);
+}
+
+/**
+ * @brief  deadlines across the 32 bits tick wrap
+ */
+static void test_tick_wrap(void)
+{
+  test_start(0xFFFFFF00U);
+  (void)CSX_Schedule(test_callback, (void *)30U, 3000U);
+  test_advance(0x200U);
+  (void)CSX_Schedule(test_callback, (void *)31U, 4000U);
+  test_check(test_timer.period == (3000U - 0x200U), "tick wrap: earliest deadline armed", test_timer.period);
+  test_advance(3000U - 0x200U - 1U);
+  test_check(test_call_nb == 0U, "tick wrap: nothing called before the deadline", test_call_nb);
+  test_advance(1U);
+  test_check(test_called(30U, 2U) == true, "tick wrap: all called at the deadline", test_call_nb);
+}
+
+/**
+ * @brief  modem wake window or sleep request timeout: all called, no wakeup needed
+ */
+static void test_wake_window(void)
+{
+  test_start(1000U);
+  (void)CSX_Schedule(test_callback, (void *)40U, 5000U);
+  (void)CSX_Schedule(test_callback, (void *)41U, 6000U);
+  test_advance(1000U);
+  /* CSP_WakeupComplete */
+  test_power_state = CSP_LOW_POWER_INACTIVE;
+  CSX_Flush(false);
+  test_check(test_called(40U, 2U) == true, "wake window: all called", test_call_nb);
+  test_check(test_timer.armed == false, "wake window: timer stopped", test_timer.period);
+  test_check(test_stats(2U, 2U, 1U, 2U) == true, "wake window: 2 wakeups saved", 0U);
+  test_advance(10000U);
+  test_check(test_call_nb == 2U, "wake window: no call at the deadlines", test_call_nb);
+
+  /* deadline reached while the modem is awake: no wakeup */
+  test_power_state = CSP_LOW_POWER_ACTIVE;
+  (void)CSX_Schedule(test_callback, (void *)42U, 5000U);
+  test_power_state = CSP_LOW_POWER_INACTIVE;
+  test_advance(5000U);
+  test_check(test_call_nb == 3U, "deadline, modem awake: called", test_call_nb);
+  test_check(test_stats(3U, 3U, 2U, 3U) == true, "deadline, modem awake: wakeup saved", 0U);
+}
+
+/**
+ * @brief  full table: all called when the last entry is scheduled
+ */
+static void test_table_full(void)
+{
+  test_start(1000U);
+  for (uint32_t i = 0U; i < (CSP_TX_SCHEDULER_NB - 1U); i++)
+  {
+    (void)CSX_Schedule(test_callback, (void *)(uintptr_t)(50U + i), 10000U + i);
+  }
+  test_check(test_call_nb == 0U, "table not full: nothing called", test_call_nb);
+  test_check(CSX_GetPendingNb() == (CSP_TX_SCHEDULER_NB - 1U), "table not full: pending", CSX_GetPendingNb());
+  (void)CSX_Schedule(test_callback, (void *)(uintptr_t)(50U + CSP_TX_SCHEDULER_NB - 1U), 20000U);
+  test_check(test_called(50U, CSP_TX_SCHEDULER_NB) == true, "table full: all called, in order", test_call_nb);
+  test_check(test_timer.armed == false, "table full: timer stopped", test_timer.period);
+  test_check(test_stats(CSP_TX_SCHEDULER_NB, CSP_TX_SCHEDULER_NB, 1U, CSP_TX_SCHEDULER_NB - 1U) == true,
+             "table full: one wakeup", 0U);
+}
+
+/**
+ * @brief  callbacks schedule again: no deadlock, new transmissions wait for the next window
+ */
+static void test_reschedule(void)
+{
+  test_start(1000U);
+  (void)CSX_Schedule(test_reschedule_callback, (void *)60U, 1000U);
+  (void)CSX_Schedule(test_reschedule_callback, (void *)61U, 2000U);
+  test_advance(1000U);
+  test_check(test_reschedule_nb == 2U, "reschedule: both called", test_reschedule_nb);
+  test_check(CSX_GetPendingNb() == 2U, "reschedule: modem in low power, new ones pending", CSX_GetPendingNb());
+  test_advance(1000U);
+  test_check((test_call_nb == 4U) && (test_calls[2] == 160U) && (test_calls[3] == 161U),
+             "reschedule: new ones called at their deadline", test_call_nb);
+
+  /* modem awake: called immediately from the flush */
+  (void)CSX_Schedule(test_reschedule_callback, (void *)62U, 1000U);
+  test_power_state = CSP_LOW_POWER_INACTIVE;
+  CSX_Flush(false);
+  test_check((test_call_nb == 6U) && (test_calls[5] == 162U), "reschedule, modem awake: immediate call",
+             test_call_nb);
+  test_check(CSX_GetPendingNb() == 0U, "reschedule, modem awake: nothing pending", CSX_GetPendingNb());
+}
+
+/* Functions Definition ------------------------------------------------------*/
+
+uint32_t HAL_GetTick(void)
+{
+  return test_tick;
+}
+
+CSP_PowerState_t CSP_GetPowerState(void)
+{
+  return test_power_state;
+}
+
+osTimerId rtosalTimerNew(const rtosal_char_t *p_name, os_ptimer func, os_timer_type type, void *p_arg)
+{
+  (void)p_name;
+  (void)p_arg;
+  test_check(type == osTimerOnce, "one-shot timer", (uint32_t)type);
+  test_timer_nb++;
+  (void)memset((void *)&test_timer, 0, sizeof(test_timer));
+  test_timer.func = func;
+  return (osTimerId)&test_timer;
+}
+
+rtosalStatus rtosalTimerStart(osTimerId timer_id, uint32_t ticks)
+{
+  test_timer_t *p_timer = (test_timer_t *)timer_id;
+
+  test_check(ticks != 0U, "timer started with a delay", ticks);
+  p_timer->armed = true;
+  p_timer->period = ticks;
+  p_timer->expiry = test_tick + ticks;
+  return osOK;
+}
+
+rtosalStatus rtosalTimerStop(osTimerId timer_id)
+{
+  ((test_timer_t *)timer_id)->armed = false;
+  return osOK;
+}
+
+int main(void)
+{
+  test_not_started();
+  test_immediate();
+  test_timer_nb = 1U; /* a new timer at each CSX_Init: only the first one is counted */
+  test_deadline();
+  test_deadline_passed();
+  test_tick_wrap();
+  test_wake_window();
+  test_table_full();
+  test_reschedule();
+
+  printf("tx scheduler (%u entries): %u tests, %u failures\n", CSP_TX_SCHEDULER_NB, test_nb, test_fail_nb);
+
+  return (int)test_fail_nb;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
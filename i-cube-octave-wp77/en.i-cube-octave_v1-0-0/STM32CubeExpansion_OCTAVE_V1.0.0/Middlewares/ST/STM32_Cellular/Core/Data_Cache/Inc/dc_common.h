@@ -207,7 +207,11 @@ extern "C" {
 #define DC_COM_MAX_NB_APPLI_SUBSCRIBER ((APPLICATION_DATACACHE_NB) + 1U) /* +1U for CellularControl */
 /* Number of internal core subscribers allowed for datacache */
 /* According to dc_com_reg_id_t type, and DC_COM_INVALID_ENTRY error code, should not exceed 254 */
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+#define DC_COM_MAX_NB_CORE_SUBSCRIBER  (4U) /* 4U: CellularServiceTask, ComIcc, ComSocketsIpModem, ComSocketsDnsCache */
+#else
 #define DC_COM_MAX_NB_CORE_SUBSCRIBER  (3U) /* 3U: CellularServiceTask, ComIcc, ComSocketsIpModem */
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
 /* Grand total of all subscribers allowed for datacache */
 /* According to dc_com_reg_id_t type, and DC_COM_INVALID_ENTRY error code, should not exceed 254 */
 #define DC_COM_MAX_NB_SUBSCRIBER (DC_COM_MAX_NB_CORE_SUBSCRIBER + DC_COM_MAX_NB_APPLI_SUBSCRIBER)
@@ -218,13 +222,31 @@ extern "C" {
 #else
 #define DC_CELLULAR_CORE_ENTRIES 8U
 #endif /* (USE_LOW_POWER == 1) */
+#if (CST_FAST_REATTACH == 1U)
+#define DC_CELLULAR_ATTACH_ENTRIES 1U /* DC_CELLULAR_ATTACH_INFO */
+#else
+#define DC_CELLULAR_ATTACH_ENTRIES 0U
+#endif /* (CST_FAST_REATTACH == 1U) */
 
 /** @brief Number max of Data Cache entries */
-#define DC_COM_ENTRY_MAX_NB   (DC_CELLULAR_CORE_ENTRIES)
+#define DC_COM_ENTRY_MAX_NB   (DC_CELLULAR_CORE_ENTRIES + DC_CELLULAR_ATTACH_ENTRIES)
 
 /** @brief Invalid entry: at creation, the Data Cache entries must be initialized with this value  */
 #define DC_COM_INVALID_ENTRY  0xFFU
 
+/** @brief All Data Cache entries: default subscription of a consumer */
+#define DC_COM_RES_MASK_ALL   ((dc_com_res_mask_t)0xFFFFFFFFU)
+
+/** @brief Subscription mask of a Data Cache entry (no subscription if entry is not registered) */
+#define DC_COM_RES_MASK(res_id) (((res_id) < DC_COM_ENTRY_MAX_NB) ? ((dc_com_res_mask_t)1U << (res_id)) : 0U)
+
+#if ((DC_COM_ENTRY_MAX_NB > 32U) || (DC_COM_MAX_NB_SUBSCRIBER > 32U))
+#error Data Cache subscription masks are limited to 32 entries and 32 subscribers
+#endif /* (DC_COM_ENTRY_MAX_NB > 32U) || (DC_COM_MAX_NB_SUBSCRIBER > 32U) */
+
+/** @brief Number max of lock-free read attempts of an entry being written before to wait the writer */
+#define DC_COM_READ_RETRY_MAX (4U)
+
 /**
   * @}
   */
@@ -240,6 +262,8 @@ typedef uint16_t dc_com_res_id_t;   /*!< type of identifier of the registered Da
 
 typedef uint16_t dc_com_event_id_t; /*!< type of Data Cache event */
 
+typedef uint32_t dc_com_res_mask_t; /*!< type of bitmask of Data Cache entries (bit n: entry n) */
+
 typedef bool  dc_com_status_t;   /*!< type of Data Cache return code  */
 #define   DC_COM_OK     (dc_com_status_t)true   /*!< Ok  */
 #define   DC_COM_ERROR  (dc_com_status_t)false  /*!< Error  */
@@ -304,6 +328,7 @@ typedef struct
   dc_com_reg_id_t consumer_reg_id;
   dc_com_gen_event_callback_t notif_cb;    /* Call back not registered by API                                         */
   const void *private_consumer_data;       /* Private data associated with call back                                  */
+  dc_com_res_mask_t res_mask;              /* Entries for which call back is called                                   */
 } dc_com_consumer_info_t;
 
 /** @brief type of Data Cache global structure (Data Cache internal use) */
@@ -315,6 +340,8 @@ typedef struct
   dc_com_consumer_info_t consumer_info[DC_COM_MAX_NB_SUBSCRIBER];
   void *p_dc_db[DC_COM_ENTRY_MAX_NB];
   uint16_t dc_db_len[DC_COM_ENTRY_MAX_NB];
+  volatile uint32_t dc_db_seq[DC_COM_ENTRY_MAX_NB]; /* entry sequence counter: odd while entry is written */
+  uint32_t dc_db_subscriber[DC_COM_ENTRY_MAX_NB];   /* entry subscribers: bit n set if consumer n is notified */
 } dc_com_db_t;
 
 /**
@@ -389,6 +416,17 @@ dc_com_reg_id_t dc_com_core_register_gen_event_cb(dc_com_db_t *p_dc_db,
 dc_com_reg_id_t dc_com_register_gen_event_cb(dc_com_db_t *p_dc_db, dc_com_gen_event_callback_t notif_cb,
                                              const void *p_private_data);
 
+/**
+  * @brief  Allow a registered consumer to be notified only for a set of Data Cache entries.
+  * @note   By default a consumer is notified for all entries.
+  *         Must not be called from a Data Cache notification callback.
+  * @param  p_dc_db         - data base reference (Must be set to &dc_com_db)
+  * @param  reg_id          - consumer identifier returned at registration
+  * @param  res_mask        - entries to be notified (DC_COM_RES_MASK(res_id) | ... or DC_COM_RES_MASK_ALL)
+  * @retval dc_com_status_t - return status with DC_COM_OK or DC_COM_ERROR
+  */
+dc_com_status_t dc_com_set_res_mask(dc_com_db_t *p_dc_db, dc_com_reg_id_t reg_id, dc_com_res_mask_t res_mask);
+
 /**
   * @brief  Allow a Data Cache producer to update data associated to a Data Cache entry.
   * @param  p_dc            - data base reference (Must be set to &dc_com_db)
@@ -401,6 +439,7 @@ dc_com_status_t dc_com_write(dc_com_db_t *p_dc, dc_com_res_id_t res_id, const vo
 
 /**
   * @brief  Allow a consumer to read the currents data associated to a Data Cache entry.
+  * @note   Read is done without lock: a consistent copy of the entry is returned even if it is written meanwhile.
   * @param  p_dc            - data base reference (Must be set to &dc_com_db)
   * @param  res_id          - entry/resource id
   * @param  p_data          - data to read
@@ -431,7 +470,8 @@ void dc_com_init(dc_com_db_t *p_dc);
 
 /**
   * @brief  Start Data Cache module.
-  * @param  p_dc - data base reference (Unused)
+  * @note   If DC_COM_DEFERRED_NOTIF is activated, the notification thread of application consumers is started.
+  * @param  p_dc - data base reference (Must be set to &dc_com_db)
   * @retval -
   */
 void dc_com_start(dc_com_db_t *p_dc);
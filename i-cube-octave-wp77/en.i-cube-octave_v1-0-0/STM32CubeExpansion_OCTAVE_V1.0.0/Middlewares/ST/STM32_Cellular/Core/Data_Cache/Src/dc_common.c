@@ -34,6 +34,9 @@ typedef struct {
 } dc_base_rt_info_t;
 
 /* Private defines -----------------------------------------------------------*/
+#if (DC_COM_DEFERRED_NOTIF == 1U)
+#define DC_COM_NOTIF_QUEUE_SIZE ((uint32_t) 8U) /* deferred notifications not yet dispatched */
+#endif /* DC_COM_DEFERRED_NOTIF == 1U */
 /* Private macros ------------------------------------------------------------*/
 
 #if (USE_TRACE_CELLULAR_SERVICE == 1U)
@@ -79,10 +82,30 @@ dc_com_db_t dc_com_db;
 void dc_com_register_gen_event_cb_common(dc_com_db_t *p_dc_db, uint8_t id,
 		dc_com_gen_event_callback_t notif_cb, const void *p_private_data);
 
+static void dc_com_notify(const dc_com_db_t *p_dc, dc_com_event_id_t event_id,
+		dc_com_reg_id_t reg_first, dc_com_reg_id_t reg_last);
+#if (DC_COM_DEFERRED_NOTIF == 1U)
+static void dc_com_notify_deferred(const dc_com_db_t *p_dc,
+		dc_com_event_id_t event_id);
+static void dc_com_notif_thread(void *p_argument);
+#endif /* DC_COM_DEFERRED_NOTIF == 1U */
+
 /* Private variables ---------------------------------------------------------*/
 
-/* Mutex to avoid  Data Cache concurrent access */
+/* Mutex to avoid  Data Cache concurrent write access */
 static osMutexId dc_common_mutex;
+/* Mutex to serialize Data Cache notifications, taken outside of write critical section */
+static osMutexId dc_common_notif_mutex;
+
+#if (DC_COM_DEFERRED_NOTIF == 1U)
+/* Mutex to serialize deferred notifications of application consumers:
+ * core notifications never wait for an application callback */
+static osMutexId dc_common_appli_notif_mutex;
+/* Queue of deferred notifications (event id) for application consumers */
+static osMessageQId dc_common_notif_queue;
+/* Entries with a deferred notification in queue: bit n set for entry n */
+static uint32_t dc_common_notif_pending;
+#endif /* DC_COM_DEFERRED_NOTIF == 1U */
 
 /* Functions Definition ------------------------------------------------------*/
 
@@ -202,9 +225,52 @@ dc_com_reg_id_t dc_com_register_gen_event_cb(dc_com_db_t *p_dc_db,
  */
 void dc_com_register_gen_event_cb_common(dc_com_db_t *p_dc_db, uint8_t id,
 		dc_com_gen_event_callback_t notif_cb, const void *p_private_data) {
+	dc_com_res_id_t res_id;
+
 	p_dc_db->consumer_info[id].consumer_reg_id = id;
 	p_dc_db->consumer_info[id].notif_cb = notif_cb;
 	p_dc_db->consumer_info[id].private_consumer_data = p_private_data;
+	/* By default consumer is notified for all entries */
+	p_dc_db->consumer_info[id].res_mask = DC_COM_RES_MASK_ALL;
+	for (res_id = 0U; res_id < DC_COM_ENTRY_MAX_NB; res_id++) {
+		p_dc_db->dc_db_subscriber[res_id] |= ((uint32_t) 1U << id);
+	}
+}
+
+/**
+ * @brief  Allow a registered consumer to be notified only for a set of Data Cache entries.
+ * @note   By default a consumer is notified for all entries.
+ *         Must not be called from a Data Cache notification callback.
+ * @param  p_dc_db         - data base reference (Must be set to &dc_com_db)
+ * @param  reg_id          - consumer identifier returned at registration
+ * @param  res_mask        - entries to be notified (DC_COM_RES_MASK(res_id) | ... or DC_COM_RES_MASK_ALL)
+ * @retval dc_com_status_t - return status with DC_COM_OK or DC_COM_ERROR
+ */
+dc_com_status_t dc_com_set_res_mask(dc_com_db_t *p_dc_db,
+		dc_com_reg_id_t reg_id, dc_com_res_mask_t res_mask) {
+	dc_com_res_id_t res_id;
+	dc_com_status_t res;
+
+	if ((p_dc_db != NULL) && (reg_id < p_dc_db->consumer_appli_number)
+			&& (p_dc_db->consumer_info[reg_id].notif_cb != NULL)) {
+		/* Subscription lists are read by notification */
+		(void) rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
+		p_dc_db->consumer_info[reg_id].res_mask = res_mask;
+		for (res_id = 0U; res_id < DC_COM_ENTRY_MAX_NB; res_id++) {
+			if ((res_mask & DC_COM_RES_MASK(res_id)) != 0U) {
+				p_dc_db->dc_db_subscriber[res_id] |= ((uint32_t) 1U << reg_id);
+			} else {
+				p_dc_db->dc_db_subscriber[res_id] &= ~((uint32_t) 1U << reg_id);
+			}
+		}
+		(void) rtosalMutexRelease(dc_common_mutex);
+		res = DC_COM_OK;
+	} else {
+		res = DC_COM_ERROR;
+		PRINT_ERR("dc_com_set_res_mask : Unknown consumer")
+	}
+
+	return res;
 }
 
 /**
@@ -217,40 +283,55 @@ void dc_com_register_gen_event_cb_common(dc_com_db_t *p_dc_db, uint8_t id,
  */
 dc_com_status_t dc_com_write(dc_com_db_t *p_dc, dc_com_res_id_t res_id,
 		const void *p_data, uint32_t len) {
-	dc_com_reg_id_t reg_id;
 	dc_base_rt_info_t *dc_base_rt_info;
 	dc_com_status_t res;
+	bool changed;
+#if (DC_COM_DEFERRED_NOTIF == 1U)
+	bool pending = true;
+#endif /* DC_COM_DEFERRED_NOTIF == 1U */
 	dc_com_db_t *com_db = (dc_com_db_t*) p_dc;
 
 	if ((p_dc != NULL) && (res_id != DC_COM_INVALID_ENTRY)
 			&& (res_id < com_db->serv_number)
 			&& (com_db->dc_db_len[res_id] >= len) && (p_data != NULL)) {
+		(void) rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
 		/* check that something has changed in data to write */
 		/* if nothing changed, just do nothing */
-		if (memcmp(com_db->p_dc_db[res_id], p_data, len) != 0) {
+		changed = (memcmp(com_db->p_dc_db[res_id], p_data, len) != 0);
+		if (changed == true) {
 			/* Something changed, in the input data (p_data). Write the new data to the Data Cache structure */
-			/* Avoid to be interrupted by another event before the end of first event processing */
-			(void) rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
-
+			/* Odd sequence: lock-free readers retry until the entry is fully written */
+			com_db->dc_db_seq[res_id]++;
+			__DMB();
 			(void) memcpy((void*) (com_db->p_dc_db[res_id]), p_data,
 					(uint32_t) len);
 			dc_base_rt_info = (dc_base_rt_info_t*) (com_db->p_dc_db[res_id]);
 			dc_base_rt_info->header.res_id = res_id;
 			dc_base_rt_info->header.size = len;
+			__DMB();
+			com_db->dc_db_seq[res_id]++;
+#if (DC_COM_DEFERRED_NOTIF == 1U)
+			/* Coalescing: only one deferred notification of an entry in queue */
+			pending = ((dc_common_notif_pending & ((uint32_t) 1U << res_id))
+					!= 0U);
+			dc_common_notif_pending |= ((uint32_t) 1U << res_id);
+#endif /* DC_COM_DEFERRED_NOTIF == 1U */
+		}
+		(void) rtosalMutexRelease(dc_common_mutex);
 
-			/* In consumer_info array, core consumers are place at the beginning, and application after */
-			/* So for loops from the beginning to the last application registered */
-			for (reg_id = 0U; reg_id < p_dc->consumer_appli_number; reg_id++) {
-				dc_com_consumer_info_t *consumer_info;
-				consumer_info = &(com_db->consumer_info[reg_id]);
-
-				if (consumer_info->notif_cb != NULL) {
-					/* let's call now the call back                                                  */
-					consumer_info->notif_cb((dc_com_event_id_t) res_id,
-							consumer_info->private_consumer_data);
-				}
+		/* Consumers are notified outside of write critical section:
+		 * a slow consumer callback does not block the other writers and readers */
+		if (changed == true) {
+#if (DC_COM_DEFERRED_NOTIF == 1U)
+			dc_com_notify(com_db, (dc_com_event_id_t) res_id, 0U,
+					DC_COM_MAX_NB_CORE_SUBSCRIBER);
+			if (pending == false) {
+				dc_com_notify_deferred(com_db, (dc_com_event_id_t) res_id);
 			}
-			(void) rtosalMutexRelease(dc_common_mutex);
+#else
+			dc_com_notify(com_db, (dc_com_event_id_t) res_id, 0U,
+					com_db->consumer_appli_number);
+#endif /* DC_COM_DEFERRED_NOTIF == 1U */
 		}
 		res = DC_COM_OK;
 	} else {
@@ -263,6 +344,7 @@ dc_com_status_t dc_com_write(dc_com_db_t *p_dc, dc_com_res_id_t res_id,
 
 /**
  * @brief  Allow a consumer to read the currents data associated to a Data Cache entry.
+ * @note   Read is done without lock: a consistent copy of the entry is returned even if it is written meanwhile.
  * @param  p_dc            - data base reference (Must be set to &dc_com_db)
  * @param  res_id          - entry/resource id
  * @param  p_data          - data to read
@@ -272,11 +354,33 @@ dc_com_status_t dc_com_write(dc_com_db_t *p_dc, dc_com_res_id_t res_id,
 dc_com_status_t dc_com_read(dc_com_db_t *p_dc, dc_com_res_id_t res_id,
 		void *p_data, uint32_t len) {
 	dc_com_status_t res;
+	uint32_t seq;
+	uint8_t retry;
+	bool consistent;
 
 	if ((p_dc != NULL) && (res_id != DC_COM_INVALID_ENTRY)
 			&& (res_id < p_dc->serv_number)
 			&& (p_dc->dc_db_len[res_id] >= len)) {
-		(void) memcpy(p_data, (void*) p_dc->p_dc_db[res_id], (uint32_t) len);
+		/* Lock-free read: copy is consistent if entry sequence is even and unchanged during the copy */
+		consistent = false;
+		for (retry = 0U; (retry < DC_COM_READ_RETRY_MAX) && (consistent == false);
+				retry++) {
+			seq = p_dc->dc_db_seq[res_id];
+			if ((seq & 1U) == 0U) {
+				__DMB();
+				(void) memcpy(p_data, (void*) p_dc->p_dc_db[res_id],
+						(uint32_t) len);
+				__DMB();
+				consistent = (seq == p_dc->dc_db_seq[res_id]);
+			}
+		}
+		if (consistent == false) {
+			/* Entry continuously written: wait the end of current write */
+			(void) rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
+			(void) memcpy(p_data, (void*) p_dc->p_dc_db[res_id],
+					(uint32_t) len);
+			(void) rtosalMutexRelease(dc_common_mutex);
+		}
 		res = DC_COM_OK;
 	} else {
 		(void) memset(p_data, 0, (uint32_t) len); /* p_data->rt_state == 0 is DC_SERVICE_UNAVAIL */
@@ -295,33 +399,125 @@ dc_com_status_t dc_com_read(dc_com_db_t *p_dc, dc_com_res_id_t res_id,
  */
 dc_com_status_t dc_com_write_event(dc_com_db_t *p_dc,
 		dc_com_event_id_t event_id) {
-	dc_com_reg_id_t reg_id;
-	const dc_com_db_t *com_db = (dc_com_db_t*) p_dc;
 	dc_com_status_t res;
 
 	if (p_dc != NULL) {
-		/* Avoid to be interrupted by another event before the end of first event processing */
+#if (DC_COM_DEFERRED_NOTIF == 1U)
+		dc_com_notify(p_dc, event_id, 0U, DC_COM_MAX_NB_CORE_SUBSCRIBER);
+		dc_com_notify_deferred(p_dc, event_id);
+#else
+		dc_com_notify(p_dc, event_id, 0U, p_dc->consumer_appli_number);
+#endif /* DC_COM_DEFERRED_NOTIF == 1U */
+		res = DC_COM_OK;
+	} else {
+		res = DC_COM_ERROR;
+	}
+	return res;
+}
+
+/**
+ * @brief  Notify registered consumers of a Data Cache event.
+ * @note   Called outside of write critical section.
+ *         Deferred notifications of application consumers are serialized by their own mutex.
+ * @param  p_dc            - data base reference (Must be set to &dc_com_db)
+ * @param  event_id        - event id
+ * @param  reg_first       - first consumer to notify
+ * @param  reg_last        - consumer following the last consumer to notify
+ * @retval -
+ */
+static void dc_com_notify(const dc_com_db_t *p_dc, dc_com_event_id_t event_id,
+		dc_com_reg_id_t reg_first, dc_com_reg_id_t reg_last) {
+	dc_com_reg_id_t reg_id;
+	uint32_t subscriber;
+	osMutexId notif_mutex;
+
+#if (DC_COM_DEFERRED_NOTIF == 1U)
+	notif_mutex = (reg_first < DC_COM_MAX_NB_CORE_SUBSCRIBER) ?
+			dc_common_notif_mutex : dc_common_appli_notif_mutex;
+#else
+	notif_mutex = dc_common_notif_mutex;
+#endif /* DC_COM_DEFERRED_NOTIF == 1U */
+
+	/* Event of an entry: only its subscribers are notified
+	 * Other event: all consumers are notified */
+	if (event_id < DC_COM_ENTRY_MAX_NB) {
 		(void) rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
+		subscriber = p_dc->dc_db_subscriber[event_id];
+		(void) rtosalMutexRelease(dc_common_mutex);
+	} else {
+		subscriber = 0xFFFFFFFFU;
+	}
+	subscriber >>= reg_first;
+
+	/* Avoid to be interrupted by another event before the end of first event processing */
+	(void) rtosalMutexAcquire(notif_mutex, RTOSAL_WAIT_FOREVER);
+
+	/* Calls registered callback notification */
+	/* In consumer_info array, core consumers are place at the beginning, and application after */
+	/* So for loops from the first to the last subscriber */
+	for (reg_id = reg_first; (reg_id < reg_last) && (subscriber != 0U);
+			reg_id++) {
+		const dc_com_consumer_info_t *consumer_info;
+		consumer_info = &(p_dc->consumer_info[reg_id]);
+		if (((subscriber & 1U) != 0U) && (consumer_info->notif_cb != NULL)) {
+			consumer_info->notif_cb(event_id,
+					consumer_info->private_consumer_data);
+		}
+		subscriber >>= 1U;
+	}
+	(void) rtosalMutexRelease(notif_mutex);
+}
 
-		/* Calls all registered callback notification */
-		/* In consumer_info array, core consumers are place at the beginning, and application after */
-		/* So for loops from the beginning to the last application registered */
+#if (DC_COM_DEFERRED_NOTIF == 1U)
+/**
+ * @brief  Post a Data Cache event to the notification thread of application consumers.
+ * @note   If the queue is full, application consumers are notified in the writer context.
+ * @param  p_dc            - data base reference (Must be set to &dc_com_db)
+ * @param  event_id        - event id
+ * @retval -
+ */
+static void dc_com_notify_deferred(const dc_com_db_t *p_dc,
+		dc_com_event_id_t event_id) {
+	if ((dc_common_notif_queue == NULL)
+			|| (rtosalMessageQueuePut(dc_common_notif_queue,
+					(uint32_t) event_id, 0U) != osOK)) {
+		PRINT_DBG("notification of event %d not deferred", event_id)
+		if (event_id < DC_COM_ENTRY_MAX_NB) {
+			(void) rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
+			dc_common_notif_pending &= ~((uint32_t) 1U << event_id);
+			(void) rtosalMutexRelease(dc_common_mutex);
+		}
+		dc_com_notify(p_dc, event_id, DC_COM_MAX_NB_CORE_SUBSCRIBER,
+				p_dc->consumer_appli_number);
+	}
+}
 
-		for (reg_id = 0U; reg_id < p_dc->consumer_appli_number; reg_id++) {
-			const dc_com_consumer_info_t *consumer_info;
-			consumer_info = &(com_db->consumer_info[reg_id]);
-			if (consumer_info->notif_cb != NULL) {
-				consumer_info->notif_cb(event_id,
-						consumer_info->private_consumer_data);
+/**
+ * @brief  Notification thread of application consumers.
+ * @param  p_argument - data base reference (Must be set to &dc_com_db)
+ * @retval -
+ */
+static void dc_com_notif_thread(void *p_argument) {
+	const dc_com_db_t *p_dc = (const dc_com_db_t*) p_argument;
+	rtosalStatus status;
+	uint32_t msg = 0U;
+
+	for (;;) {
+		status = rtosalMessageQueueGet(dc_common_notif_queue, &msg,
+				RTOSAL_WAIT_FOREVER);
+		if ((status == osEventMessage) || (status == osOK)) {
+			if (msg < DC_COM_ENTRY_MAX_NB) {
+				/* next write of the entry must be notified again */
+				(void) rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
+				dc_common_notif_pending &= ~((uint32_t) 1U << msg);
+				(void) rtosalMutexRelease(dc_common_mutex);
 			}
+			dc_com_notify(p_dc, (dc_com_event_id_t) msg,
+					DC_COM_MAX_NB_CORE_SUBSCRIBER, p_dc->consumer_appli_number);
 		}
-		(void) rtosalMutexRelease(dc_common_mutex);
-		res = DC_COM_OK;
-	} else {
-		res = DC_COM_ERROR;
 	}
-	return res;
 }
+#endif /* DC_COM_DEFERRED_NOTIF == 1U */
 
 /**
  * @brief  Initialize the Data Cache module.
@@ -337,17 +533,46 @@ void dc_com_init(dc_com_db_t *p_dc) {
 	if (dc_common_mutex == NULL) {
 		ERROR_Handler(DBG_CHAN_UTILITIES, 1, ERROR_FATAL);
 	}
+	dc_common_notif_mutex = rtosalMutexNew(NULL);
+	if (dc_common_notif_mutex == NULL) {
+		ERROR_Handler(DBG_CHAN_UTILITIES, 2, ERROR_FATAL);
+	}
+#if (DC_COM_DEFERRED_NOTIF == 1U)
+	dc_common_appli_notif_mutex = rtosalMutexNew(NULL);
+	if (dc_common_appli_notif_mutex == NULL) {
+		ERROR_Handler(DBG_CHAN_UTILITIES, 5, ERROR_FATAL);
+	}
+	dc_common_notif_pending = 0U;
+	dc_common_notif_queue = rtosalMessageQueueNew(
+			(const rtosal_char_t*) "DC_NOTIF_QUEUE", DC_COM_NOTIF_QUEUE_SIZE);
+	if (dc_common_notif_queue == NULL) {
+		ERROR_Handler(DBG_CHAN_UTILITIES, 3, ERROR_FATAL);
+	}
+#endif /* DC_COM_DEFERRED_NOTIF == 1U */
 }
 
 /**
  * @brief  Start Data Cache module.
- * @param  p_dc - data base reference (Unused)
+ * @param  p_dc - data base reference
  * @retval -
  */
 void dc_com_start(dc_com_db_t *p_dc) {
+#if (DC_COM_DEFERRED_NOTIF == 1U)
+	static osThreadId dc_common_notif_thread_id = NULL;
+
+	/* start notification thread of application consumers */
+	dc_common_notif_thread_id = rtosalThreadNew(
+			(const rtosal_char_t*) "DataCacheNotif",
+			(os_pthread) dc_com_notif_thread, DC_COM_NOTIF_THREAD_PRIO,
+			(uint32_t) DC_COM_NOTIF_THREAD_STACK_SIZE, (void*) p_dc);
+	if (dc_common_notif_thread_id == NULL) {
+		ERROR_Handler(DBG_CHAN_UTILITIES, 4, ERROR_FATAL);
+	}
+#else
 	UNUSED(p_dc);
 	/* Nothing to do */
 	__NOP();
+#endif /* DC_COM_DEFERRED_NOTIF == 1U */
 }
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
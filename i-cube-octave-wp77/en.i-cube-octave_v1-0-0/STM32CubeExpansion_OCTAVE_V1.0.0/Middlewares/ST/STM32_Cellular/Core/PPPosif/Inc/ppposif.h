@@ -104,6 +104,14 @@ extern void  ppposif_status_cb(ppp_pcb *pcb, int32_t err_code, void *ctx);
   */
 extern u32_t ppposif_output_cb(ppp_pcb *pcb, u8_t *data, u32_t len, void *ctx);
 
+/**
+  * @brief  Tick of the last data exchanged on the serial link
+  * @note   used to know if data traffic is in flight before suspending data mode
+  * @param  None
+  * @retval HAL tick of the last read or write
+  */
+extern uint32_t ppposif_get_last_data_tick(void);
+
 /**
   * @brief  sys_now
   * @param  None
@@ -42,6 +42,9 @@
 /* Private typedef -----------------------------------------------------------*/
 /* Private macros ------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/* Tick of the last data read or written on the serial link */
+static uint32_t ppposif_last_data_tick = 0U;
+
 /* Global variables ----------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
 
@@ -213,6 +216,7 @@ void ppposif_input(const struct netif *ppp_netif, ppp_pcb  *p_ppp_pcb, IPC_Devic
   rcv_size = ppposif_ipc_read(pDevice, rcvChar, RCV_SIZE_MAX);
   if (rcv_size != 0)
   {
+    ppposif_last_data_tick = HAL_GetTick();
     /* traceIF_hexPrint(DBG_CHAN_PPPOSIF, DBL_LVL_P0, rcvChar, rcv_size) */
     /* Pass received data to PPPoS to be decoded through lwIP TCPIP thread */
     (void)pppos_input_tcpip(p_ppp_pcb, rcvChar, rcv_size);
@@ -251,9 +255,21 @@ u32_t ppposif_output_cb(ppp_pcb *pcb, u8_t *data, u32_t len, void *ctx)
   osCCS_get_wait_cs_resource();
   ret = (u32_t)ppposif_ipc_write(device, data, (int16_t)len);
   osCCS_get_release_cs_resource();
+  ppposif_last_data_tick = HAL_GetTick();
   return ret;
 }
 
+/**
+  * @brief  Tick of the last data exchanged on the serial link
+  * @note   used to know if data traffic is in flight before suspending data mode
+  * @param  None
+  * @retval HAL tick of the last read or write
+  */
+uint32_t ppposif_get_last_data_tick(void)
+{
+  return ppposif_last_data_tick;
+}
+
 
 /**
   * @brief      Closing PPP connection
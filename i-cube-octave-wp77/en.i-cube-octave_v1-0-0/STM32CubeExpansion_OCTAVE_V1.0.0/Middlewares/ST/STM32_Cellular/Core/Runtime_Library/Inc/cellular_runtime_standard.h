@@ -36,6 +36,8 @@ extern "C" {
 extern uint8_t *crs_itoa(int32_t num, uint8_t *str, uint32_t base);
 extern int32_t  crs_atoi(const uint8_t *string);
 extern int32_t  crs_atoi_hex(const uint8_t *string);
+extern uint8_t  crs_strtou32(const uint8_t *string, uint32_t size, uint32_t base, uint32_t *p_value,
+                             uint32_t *p_nb_digits);
 extern uint32_t crs_strlen(const uint8_t *string);
 
 #ifdef __cplusplus
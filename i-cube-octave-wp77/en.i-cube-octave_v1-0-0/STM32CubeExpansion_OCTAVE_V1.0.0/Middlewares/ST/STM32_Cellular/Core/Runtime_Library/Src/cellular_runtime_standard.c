@@ -26,13 +26,117 @@
 
 /* Private defines -----------------------------------------------------------*/
 #define CRS_STRLEN_MAX 2048U
+#define CRS_DIGIT_INVALID 0xFFU /* value returned by crs_digit_value() for a non digit character */
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Global variables ----------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+static uint32_t crs_digit_value(uint8_t car);
+static uint8_t crs_convert_digits(const uint8_t *string, uint32_t size, uint32_t base, uint32_t *p_result,
+		uint32_t *p_offset);
+#if (CRS_SWAR_CONVERSION == 1U)
+static bool crs_is_8_digits(uint64_t chunk);
+static uint32_t crs_convert_8_digits(uint64_t chunk);
+#endif /* CRS_SWAR_CONVERSION == 1U */
+
 /* Private functions ---------------------------------------------------------*/
+/**
+ * @brief  get the value of a digit character ('0' to '9', 'a' to 'z', 'A' to 'Z')
+ * @param  car  character to convert
+ * @retval value of the digit (0 to 35), CRS_DIGIT_INVALID if not a digit
+ */
+static uint32_t crs_digit_value(uint8_t car) {
+	uint32_t digit;
+	uint32_t letter;
+
+	/* '0'..'9' => 0..9, other characters wrap above 9 */
+	digit = (uint32_t) car - (uint32_t) '0';
+	if (digit > 9U) {
+		/* 'a'..'z' and 'A'..'Z' (case removed) => 10..35 */
+		letter = ((uint32_t) car | 0x20U) - (uint32_t) 'a';
+		digit = (letter < 26U) ? (letter + 10U) : CRS_DIGIT_INVALID;
+	}
+	return digit;
+}
+
+/**
+ * @brief  convert the digits of a string byte per byte, from a conversion already started
+ * @note   conversion stops on the first character which is not a digit of the base
+ *         ('\0' included), or when size characters have been converted.
+ *         In case of overflow, the remaining digits are skipped and the result is not significant.
+ * @param  string  ascii string to convert
+ * @param  size  maximum number of characters to convert
+ * @param  base  base of the number (2 to 36)
+ * @param  p_result  (in/out) result of conversion
+ * @param  p_offset  (in/out) offset of the next character to convert
+ * @retval 0 if no error, 1 if an overflow occurred
+ */
+static uint8_t crs_convert_digits(const uint8_t *string, uint32_t size, uint32_t base, uint32_t *p_result,
+		uint32_t *p_offset) {
+	uint32_t result;
+	uint32_t digit;
+	uint32_t offset;
+	uint32_t max_result;
+	uint32_t max_digit;
+	uint8_t overflow;
+
+	result = *p_result;
+	offset = *p_offset;
+	overflow = 0U;
+	/* result * base + digit overflows if result > max_result or (result == max_result and digit > max_digit) */
+	max_result = 0xFFFFFFFFU / base;
+	max_digit = 0xFFFFFFFFU % base;
+
+	/* parsing string while digits are found */
+	while (offset < size) {
+		digit = crs_digit_value(string[offset]);
+		if (digit >= base) {
+			/* not a digit => end of number */
+			break;
+		}
+		if ((result > max_result) || ((result == max_result) && (digit > max_digit))) {
+			overflow = 1U;
+		}
+		result = (result * base) + digit;
+		offset++;
+	}
+
+	*p_result = result;
+	*p_offset = offset;
+	return overflow;
+}
+
+#if (CRS_SWAR_CONVERSION == 1U)
+/**
+ * @brief  check that the 8 characters of a chunk (little-endian) are decimal digits
+ * @param  chunk  8 characters
+ * @retval true if the 8 characters are digits
+ */
+static bool crs_is_8_digits(uint64_t chunk) {
+	/* high nibble of each byte must be 3, and adding 6 must not carry to the high nibble */
+	return ((chunk & 0xF0F0F0F0F0F0F0F0ULL)
+			| (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4))
+			== 0x3333333333333333ULL;
+}
+
+/**
+ * @brief  convert 8 decimal digits (little-endian chunk, first digit in lowest byte)
+ * @param  chunk  8 digits (checked by crs_is_8_digits)
+ * @retval result of conversion (0 to 99999999)
+ */
+static uint32_t crs_convert_8_digits(uint64_t chunk) {
+	uint64_t val = chunk & 0x0F0F0F0F0F0F0F0FULL;
+
+	/* combine digits by pairs, then by 4, then by 8 */
+	val = (val * 2561ULL) >> 8; /* 2561 = (10 << 8) + 1 */
+	val = ((val & 0x00FF00FF00FF00FFULL) * 6553601ULL) >> 16; /* 6553601 = (100 << 16) + 1 */
+	val = ((val & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32; /* 42949672960001 = (10000 << 32) + 1 */
+	return (uint32_t) val;
+}
+#endif /* CRS_SWAR_CONVERSION == 1U */
+
 /* functions ---------------------------------------------------------*/
 
 /**
@@ -105,21 +209,81 @@ uint8_t* crs_itoa(int32_t num, uint8_t *str, uint32_t base) {
 	return str;
 }
 
+/**
+ * @brief  convert the digits of a string to an unsigned 32bits integer (single pass)
+ * @note   conversion stops on the first character which is not a digit of the base,
+ *         or when size characters have been converted.
+ *         In case of overflow, the remaining digits are skipped and the result is 0xFFFFFFFF.
+ * @param  string  ascii string to convert
+ * @param  size  number of characters available in the string
+ * @param  base  base of the number (2 to 36)
+ * @param  p_value  (out) result of conversion
+ * @param  p_nb_digits  (out) number of digits parsed (can be NULL)
+ * @retval 0 if no error, 1 if an overflow occurred
+ */
+uint8_t crs_strtou32(const uint8_t *string, uint32_t size, uint32_t base, uint32_t *p_value,
+		uint32_t *p_nb_digits) {
+	uint32_t result;
+	uint32_t offset;
+	uint8_t overflow;
+
+	result = 0U;
+	offset = 0U;
+	overflow = 0U;
+
+#if (CRS_SWAR_CONVERSION == 1U)
+	if (base == 10U) {
+		/* fast path: convert 8 digits at once */
+		uint64_t chunk;
+		uint64_t acc;
+		bool leave = false;
+		while ((leave == false) && ((size - offset) >= 8U)) {
+			(void) memcpy((void*) &chunk, (const void*) &string[offset], 8U);
+			if (crs_is_8_digits(chunk) == false) {
+				/* end of number in this chunk => finish with the standard loop */
+				leave = true;
+			} else {
+				acc = ((uint64_t) result * 100000000ULL) + (uint64_t) crs_convert_8_digits(chunk);
+				if (acc > 0xFFFFFFFFULL) {
+					/* overflow => skip remaining digits in standard loop */
+					overflow = 1U;
+					leave = true;
+				} else {
+					result = (uint32_t) acc;
+					offset += 8U;
+				}
+			}
+		}
+	}
+#endif /* CRS_SWAR_CONVERSION == 1U */
+
+	/* remaining digits converted byte per byte */
+	if (crs_convert_digits(string, size, base, &result, &offset) != 0U) {
+		overflow = 1U;
+	}
+
+	*p_value = (overflow == 0U) ? result : 0xFFFFFFFFU;
+	if (p_nb_digits != NULL) {
+		*p_nb_digits = offset;
+	}
+	return overflow;
+}
+
 /**
  * @brief  convert a ascci number to an integer
+ * @note   result is saturated to INT32_MAX / -INT32_MAX in case of overflow
  * @param  string  ascii string number to convert
  * @retval result of conversion
  */
 int32_t crs_atoi(const uint8_t *string) {
 	int32_t result;
-	int32_t digit;
-
+	uint32_t value;
+	uint32_t nb_digits;
 	uint32_t offset;
 	int8_t sign;
-	uint8_t digit8;
-	bool leave;
 
-	result = 0;
+	value = 0U;
+	nb_digits = 0U;
 	offset = 0U;
 
 	if (*string == (uint8_t) '-') {
@@ -134,22 +298,13 @@ int32_t crs_atoi(const uint8_t *string) {
 		}
 	}
 
-	leave = false;
-
-	/* partsing string while decimal digit are found */
-	while (leave == false) {
-		if ((string[offset] < (uint8_t) '0')
-				|| (string[offset] > (uint8_t) '9')) {
-			/* not a digit => end of parsing */
-			leave = true;
-		} else {
-			/* digit found => adding it in the integer result */
-			digit8 = string[offset] - (uint8_t) '0';
-			digit = (int32_t) digit8;
-			result = (10 * result) + digit;
-			offset++;
-		}
+	/* parsing string while decimal digit are found: '\0' ends the conversion, no need of string length */
+	if ((crs_convert_digits(&string[offset], CRS_STRLEN_MAX, 10U, &value, &nb_digits) != 0U)
+			|| (value > 0x7FFFFFFFU)) {
+		/* overflow => saturate */
+		value = 0x7FFFFFFFU;
 	}
+	result = (int32_t) value;
 
 	if (sign != 0) {
 		/* negative number => set the opposite */
@@ -160,47 +315,27 @@ int32_t crs_atoi(const uint8_t *string) {
 
 /**
  * @brief  convert a ascci hex number to an integer
+ * @note   result is saturated to INT32_MAX if the number is greater than INT32_MAX,
+ *         use crs_strtou32() to convert an unsigned 32bits number and detect overflow
  * @param  string  ascii string hex number to convert
  * @retval result of conversion
  */
 int32_t crs_atoi_hex(const uint8_t *string) {
-	int32_t result;
-	uint32_t digit;
-	uint8_t digit8;
-	uint32_t offset;
+	uint32_t value;
+	uint32_t nb_digits;
 
-	result = 0;
-	offset = 0;
+	value = 0U;
+	nb_digits = 0U;
 
 	if (string != NULL) {
-		/* partsing string while hexadecimal digit are found */
-		while (true) {
-			if ((string[offset] >= (uint8_t) '0')
-					&& (string[offset] <= (uint8_t) '9')) {
-				/* decimal digit found */
-				digit8 = string[offset] - (uint8_t) '0';
-				digit = (uint32_t) digit8;
-			} else if ((string[offset] >= (uint8_t) 'a')
-					&& (string[offset] <= (uint8_t) 'f')) {
-				/* hexa decimal digit found */
-				digit8 = string[offset] - (uint8_t) 'a' + 10U;
-				digit = (uint32_t) digit8;
-			} else if ((string[offset] >= (uint8_t) 'A')
-					&& (string[offset] <= (uint8_t) 'F')) {
-				/* hexa decimal digit found */
-				digit8 = string[offset] - (uint8_t) 'A' + 10U;
-				digit = (uint32_t) digit8;
-			} else {
-				/* not a digit => end of number */
-				break;
-			}
-
-			/*  adding the current digit in the integer result */
-			result = (16 * result) + (int32_t) digit;
-			offset++;
+		/* parsing string while hexadecimal digit are found: '\0' ends the conversion */
+		if ((crs_convert_digits(string, CRS_STRLEN_MAX, 16U, &value, &nb_digits) != 0U)
+				|| (value > 0x7FFFFFFFU)) {
+			/* overflow => saturate */
+			value = 0x7FFFFFFFU;
 		}
 	}
-	return result;
+	return (int32_t) value;
 }
 
 /**
@@ -0,0 +1,47 @@
+/**
+  ******************************************************************************
+  * @file    plf_config.h
+  * @author  MCD Application Team
+  * @brief   Platform configuration used by the host build of the runtime
+  *          library tests (replaces the project plf_config.h)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef PLF_CONFIG_H
+#define PLF_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Same default as plf_features.h, can be overridden with -DCRS_SWAR_CONVERSION=0U */
+#if !defined CRS_SWAR_CONVERSION
+#define CRS_SWAR_CONVERSION       (1U) /* 0: not activated, 1: activated */
+#endif /* !defined CRS_SWAR_CONVERSION */
+
+/* CMSIS intrinsics used by the tested modules */
+#define __NOP()                   do {} while (0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLF_CONFIG_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
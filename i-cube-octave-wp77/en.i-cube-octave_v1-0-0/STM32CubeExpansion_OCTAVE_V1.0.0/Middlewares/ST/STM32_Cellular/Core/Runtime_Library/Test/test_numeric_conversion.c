@@ -0,0 +1,511 @@
+/**
+ ******************************************************************************
+ * @file    test_numeric_conversion.c
+ * @author  MCD Application Team
+ * @brief   Host test and benchmark of the numeric string conversions
+ *          (crs_strtou32, crs_atoi, crs_atoi_hex and ATutil conversions)
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+ * All rights reserved.</center></h2>
+ *
+ * This software component is licensed by ST under Ultimate Liberty license
+ * SLA0044, the "License"; You may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at:
+ *                             www.st.com/SLA0044
+ *
+ ******************************************************************************
+ *
+ * This file is not part of the target build. From this directory, build and run it
+ * on the host with and without the SWAR fast path:
+ *
+ *   gcc -O2 -Wall -I. -I../Inc -I../../AT_Core/Inc test_numeric_conversion.c \
+ *       ../Src/cellular_runtime_standard.c ../../AT_Core/Src/at_util.c -o test_conv
+ *   ./test_conv [random iterations]
+ *
+ *   add -DCRS_SWAR_CONVERSION=0U to test the byte per byte conversion only.
+ *
+ * Results are checked against strtoull(): all bases from 2 to 36, random strings
+ * (digits of both cases, leading zeros, trailing characters, truncated sizes) and
+ * exhaustive ranges around the 32bits limit and the 8 digits chunks boundaries.
+ * The benchmark reports the time per digit of the current and of the former
+ * (ATutil_ipow based) decimal conversion, on parameters captured from WP77 answers.
+ * The process exit code is the number of failures (0: all tests passed).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include "cellular_runtime_standard.h"
+#include "at_util.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_RANDOM_ITER_DEFAULT (2000000U) /* number of random strings per run */
+#define TEST_STRING_SIZE_MAX     (48U)      /* max size of a generated string */
+#define TEST_BENCH_LOOP          (200000U)  /* benchmark iterations per parameter */
+#define TEST_ERR_PRINT_MAX       (20U)      /* max number of failures displayed */
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t test_nb = 0U;
+static uint32_t test_fail_nb = 0U;
+static uint64_t test_rand_state = 0x2545F4914F6CDD1DULL;
+
+/* Captured WP77 answers parameters (+CSQ, +CEREG, +QIRD, ORP, +CCLK, +CGPADDR) */
+static const char *const test_captured_params[] =
+{
+  "23", "99", "2", "1", "\"A1B2\"", "\"01A2B3C4\"", "7", "1460", "0",
+  "65535", "4294967295", "1234567890", "20", "42", "255", "100000",
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t test_rand(void);
+static void test_check(bool ok, const char *p_label, const uint8_t *p_str, uint32_t size, uint32_t base,
+                       uint32_t value, uint32_t expected);
+static uint32_t test_digit_prefix(const uint8_t *p_str, uint32_t size, uint32_t base);
+static void test_strtou32_ref(const uint8_t *p_str, uint32_t size, uint32_t base);
+static void test_strtou32_random(uint32_t iter);
+static void test_strtou32_exhaustive(void);
+static void test_atoi(void);
+static void test_atutil(void);
+static uint32_t legacy_convertStringToInt(const uint8_t *p_string, uint16_t size);
+static double test_time_ns(void);
+static void test_benchmark(void);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief  xorshift pseudo random generator (reproducible runs)
+ * @retval random value
+ */
+static uint32_t test_rand(void)
+{
+  test_rand_state ^= test_rand_state >> 12;
+  test_rand_state ^= test_rand_state << 25;
+  test_rand_state ^= test_rand_state >> 27;
+  return (uint32_t)((test_rand_state * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+/**
+ * @brief  count a test result and display the first failures
+ */
+static void test_check(bool ok, const char *p_label, const uint8_t *p_str, uint32_t size, uint32_t base,
+                       uint32_t value, uint32_t expected)
+{
+  test_nb++;
+  if (!ok)
+  {
+    test_fail_nb++;
+    if (test_fail_nb <= TEST_ERR_PRINT_MAX)
+    {
+      printf("FAIL %s: \"%.*s\" size:%u base:%u => %u (expected %u)\n",
+             p_label, (int)size, (const char *)p_str, size, base, value, expected);
+    }
+  }
+}
+
+/**
+ * @brief  number of leading characters which are digits of the base
+ */
+static uint32_t test_digit_prefix(const uint8_t *p_str, uint32_t size, uint32_t base)
+{
+  static const char digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+  uint32_t n = 0U;
+  const char *p_digit;
+
+  while (n < size)
+  {
+    p_digit = ((p_str[n] >= (uint8_t)'A') && (p_str[n] <= (uint8_t)'Z')) ?
+              strchr(digits, (int)p_str[n] | 0x20) : ((p_str[n] != 0U) ? strchr(digits, (int)p_str[n]) : NULL);
+    if ((p_digit == NULL) || ((uint32_t)(p_digit - digits) >= base))
+    {
+      break;
+    }
+    n++;
+  }
+  return n;
+}
+
+/**
+ * @brief  check crs_strtou32 against strtoull on a string
+ */
+static void test_strtou32_ref(const uint8_t *p_str, uint32_t size, uint32_t base)
+{
+  char buf[TEST_STRING_SIZE_MAX + 1U];
+  uint32_t nb_digits_ref;
+  uint32_t nb_digits;
+  uint32_t expected;
+  uint32_t value;
+  uint8_t overflow_ref;
+  uint8_t overflow;
+  unsigned long long ref;
+
+  /* reference: strtoull on the digits only (no sign, no space, no 0x prefix interpretation) */
+  nb_digits_ref = test_digit_prefix(p_str, size, base);
+  (void)memcpy(buf, p_str, nb_digits_ref);
+  buf[nb_digits_ref] = '\0';
+  errno = 0;
+  ref = strtoull(buf, NULL, (int)base);
+  overflow_ref = ((errno == ERANGE) || (ref > 0xFFFFFFFFULL)) ? 1U : 0U;
+  expected = (overflow_ref == 1U) ? 0xFFFFFFFFU : (uint32_t)ref;
+
+  value = 0x5A5A5A5AU;
+  overflow = crs_strtou32(p_str, size, base, &value, &nb_digits);
+  test_check((value == expected) && (overflow == overflow_ref) && (nb_digits == nb_digits_ref),
+             "crs_strtou32", p_str, size, base, value, expected);
+}
+
+/**
+ * @brief  random strings: digits of both cases with leading zeros, trailing characters and truncation
+ */
+static void test_strtou32_random(uint32_t iter)
+{
+  static const char digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+  static const char stop_chars[] = ",\r\n\" :;.-+xX/~@[`{";
+  uint8_t str[TEST_STRING_SIZE_MAX];
+  uint32_t base;
+  uint32_t len;
+  uint32_t size;
+  uint32_t zeros;
+  uint32_t d;
+
+  for (uint32_t i = 0U; i < iter; i++)
+  {
+    /* base 10 and 16 are the most used ones */
+    switch (test_rand() % 4U)
+    {
+      case 0U:
+        base = 10U;
+        break;
+      case 1U:
+        base = 16U;
+        break;
+      default:
+        base = 2U + (test_rand() % 35U);
+        break;
+    }
+    len = test_rand() % (TEST_STRING_SIZE_MAX - 8U);
+    zeros = ((test_rand() % 4U) == 0U) ? (test_rand() % (len + 1U)) : 0U;
+    for (uint32_t j = 0U; j < len; j++)
+    {
+      d = (j < zeros) ? 0U : (test_rand() % base);
+      str[j] = (uint8_t)digits[d];
+      if ((d >= 10U) && ((test_rand() % 2U) == 0U))
+      {
+        str[j] = (uint8_t)(str[j] - 0x20U); /* upper case */
+      }
+    }
+    /* trailing characters which are not digits of the base */
+    for (uint32_t j = len; j < TEST_STRING_SIZE_MAX; j++)
+    {
+      str[j] = (uint8_t)stop_chars[test_rand() % (sizeof(stop_chars) - 1U)];
+      if ((str[j] == (uint8_t)'x') || (str[j] == (uint8_t)'X'))
+      {
+        str[j] = (base > 33U) ? (uint8_t)',' : str[j];
+      }
+    }
+    /* size: whole buffer, exact number length or truncated */
+    switch (test_rand() % 3U)
+    {
+      case 0U:
+        size = TEST_STRING_SIZE_MAX;
+        break;
+      case 1U:
+        size = len;
+        break;
+      default:
+        size = test_rand() % (len + 1U);
+        break;
+    }
+    test_strtou32_ref(str, size, base);
+  }
+}
+
+/**
+ * @brief  exhaustive checks: small values, values around 2^32 and chunk boundaries of the SWAR path
+ */
+static void test_strtou32_exhaustive(void)
+{
+  char str[TEST_STRING_SIZE_MAX];
+  int len;
+  uint64_t v;
+
+  /* all decimal values below 10^6, followed by a separator */
+  for (v = 0U; v < 1000000U; v++)
+  {
+    len = snprintf(str, sizeof(str), "%llu,", (unsigned long long)v);
+    test_strtou32_ref((const uint8_t *)str, (uint32_t)len, 10U);
+  }
+
+  /* values around the 32bits limit, in all bases */
+  for (uint32_t base = 2U; base <= 36U; base++)
+  {
+    for (v = 0xFFFFFFFFULL - 1000U; v <= 0xFFFFFFFFULL + 1000U; v++)
+    {
+      static const char digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+      char tmp[TEST_STRING_SIZE_MAX];
+      uint64_t n = v;
+      int i = 0;
+      do
+      {
+        tmp[i] = digits[n % base];
+        i++;
+        n /= base;
+      } while (n != 0U);
+      for (len = 0; len < i; len++)
+      {
+        str[len] = tmp[i - len - 1];
+      }
+      test_strtou32_ref((const uint8_t *)str, (uint32_t)len, base);
+    }
+  }
+
+  /* decimal: non digit character at each position of 1 to 3 chunks of 8 characters, all sizes */
+  for (uint32_t total = 1U; total <= 24U; total++)
+  {
+    for (uint32_t pos = 0U; pos <= total; pos++)
+    {
+      for (uint32_t k = 0U; k < total; k++)
+      {
+        str[k] = (char)('0' + ((k * 7U + pos) % 10U));
+      }
+      if (pos < total)
+      {
+        str[pos] = ((pos % 2U) == 0U) ? ':' : '/'; /* characters just above '9' and below '0' */
+      }
+      for (uint32_t size = 0U; size <= total; size++)
+      {
+        test_strtou32_ref((const uint8_t *)str, size, 10U);
+      }
+    }
+  }
+}
+
+/**
+ * @brief  crs_atoi and crs_atoi_hex (sign, saturation to INT32_MAX)
+ */
+static void test_atoi(void)
+{
+  static const struct
+  {
+    const char *p_str;
+    int32_t expected;
+  } atoi_tests[] =
+  {
+    {"0", 0}, {"123", 123}, {"-123", -123}, {"+45", 45}, {"12ab", 12}, {"", 0}, {"-", 0},
+    {"2147483647", 2147483647}, {"2147483648", 2147483647}, {"-2147483647", -2147483647},
+    {"99999999999999999999", 2147483647}, {"-99999999999999999999", -2147483647},
+    {"0000000000000000000000000000042", 42},
+  };
+  static const struct
+  {
+    const char *p_str;
+    uint32_t expected;
+  } atoi_hex_tests[] =
+  {
+    {"0", 0U}, {"1f", 0x1FU}, {"1F", 0x1FU}, {"7ffffffe", 0x7FFFFFFEU}, {"7FFFFFFF", 0x7FFFFFFFU},
+    {"80000000", 0x7FFFFFFFU}, {"DEADbeef", 0x7FFFFFFFU}, {"fffffffff", 0x7FFFFFFFU},
+    {"00000000000000000000000000000000001f", 0x1FU}, {"12g", 0x12U}, {"", 0U},
+  };
+
+  for (uint32_t i = 0U; i < (sizeof(atoi_tests) / sizeof(atoi_tests[0])); i++)
+  {
+    int32_t value = crs_atoi((const uint8_t *)atoi_tests[i].p_str);
+    test_check(value == atoi_tests[i].expected, "crs_atoi", (const uint8_t *)atoi_tests[i].p_str,
+               (uint32_t)strlen(atoi_tests[i].p_str), 10U, (uint32_t)value, (uint32_t)atoi_tests[i].expected);
+  }
+  for (uint32_t i = 0U; i < (sizeof(atoi_hex_tests) / sizeof(atoi_hex_tests[0])); i++)
+  {
+    uint32_t value = (uint32_t)crs_atoi_hex((const uint8_t *)atoi_hex_tests[i].p_str);
+    test_check(value == atoi_hex_tests[i].expected, "crs_atoi_hex", (const uint8_t *)atoi_hex_tests[i].p_str,
+               (uint32_t)strlen(atoi_hex_tests[i].p_str), 16U, value, atoi_hex_tests[i].expected);
+  }
+  test_check(crs_atoi_hex(NULL) == 0, "crs_atoi_hex", (const uint8_t *)"(NULL)", 6U, 16U,
+             (uint32_t)crs_atoi_hex(NULL), 0U);
+
+  /* '\0' ends the conversion even if digits follow it in memory */
+  static const uint8_t nul_str[] = {(uint8_t)'1', (uint8_t)'2', 0U, (uint8_t)'3', (uint8_t)'4'};
+  test_check(crs_atoi(nul_str) == 12, "crs_atoi", nul_str, 2U, 10U, (uint32_t)crs_atoi(nul_str), 12U);
+  test_check(crs_atoi_hex(nul_str) == 0x12, "crs_atoi_hex", nul_str, 2U, 16U,
+             (uint32_t)crs_atoi_hex(nul_str), 0x12U);
+}
+
+/**
+ * @brief  ATutil conversions on AT parameters (as extracted by the modem drivers)
+ */
+static void test_atutil(void)
+{
+  static const struct
+  {
+    const char *p_str;
+    uint32_t expected;
+  } dec_tests[] =
+  {
+    /* single parameters */
+    {"0", 0U}, {"23", 23U}, {"1460", 1460U}, {"4294967295", 0xFFFFFFFFU},
+    /* leading characters are skipped, conversion stops at the first non digit */
+    {" 7", 7U}, {"\"12\"", 12U}, {"-5", 5U}, {"12\r", 12U}, {"1 2", 1U}, {"abc", 0U}, {"", 0U},
+    /* saturation instead of wrapping */
+    {"4294967296", 0xFFFFFFFFU}, {"123456789012345", 0xFFFFFFFFU},
+    /* hexadecimal values */
+    {"0x1F", 0x1FU}, {"0xffffffff", 0xFFFFFFFFU}, {"0x0", 0U}, {"0x123456789", 0U},
+  };
+  static const struct
+  {
+    const char *p_str;
+    uint32_t expected;
+  } hex_tests[] =
+  {
+    {"1F", 0x1FU}, {"0x1F", 0x1FU}, {"A1B2", 0xA1B2U}, {"01A2B3C4", 0x01A2B3C4U}, {"123456789", 0U},
+  };
+  static const struct
+  {
+    const char *p_str;
+    uint32_t expected;
+  } bin_tests[] =
+  {
+    {"0", 0U}, {"1", 1U}, {"101", 5U}, {"00100001", 0x21U}, {"11111111111111111111111111111111", 0xFFFFFFFFU},
+  };
+  uint32_t value;
+  uint32_t high;
+  uint32_t low;
+
+  for (uint32_t i = 0U; i < (sizeof(dec_tests) / sizeof(dec_tests[0])); i++)
+  {
+    value = ATutil_convertStringToInt((const uint8_t *)dec_tests[i].p_str, (uint16_t)strlen(dec_tests[i].p_str));
+    test_check(value == dec_tests[i].expected, "ATutil_convertStringToInt", (const uint8_t *)dec_tests[i].p_str,
+               (uint32_t)strlen(dec_tests[i].p_str), 10U, value, dec_tests[i].expected);
+  }
+  for (uint32_t i = 0U; i < (sizeof(hex_tests) / sizeof(hex_tests[0])); i++)
+  {
+    value = ATutil_convertHexaStringToInt32((const uint8_t *)hex_tests[i].p_str,
+                                            (uint16_t)strlen(hex_tests[i].p_str));
+    test_check(value == hex_tests[i].expected, "ATutil_convertHexaStringToInt32",
+               (const uint8_t *)hex_tests[i].p_str, (uint32_t)strlen(hex_tests[i].p_str), 16U,
+               value, hex_tests[i].expected);
+  }
+  for (uint32_t i = 0U; i < (sizeof(bin_tests) / sizeof(bin_tests[0])); i++)
+  {
+    value = ATutil_convertBinStringToInt32((const uint8_t *)bin_tests[i].p_str,
+                                           (uint16_t)strlen(bin_tests[i].p_str));
+    test_check(value == bin_tests[i].expected, "ATutil_convertBinStringToInt32",
+               (const uint8_t *)bin_tests[i].p_str, (uint32_t)strlen(bin_tests[i].p_str), 2U,
+               value, bin_tests[i].expected);
+  }
+
+  /* 64bits hexadecimal value in two parts */
+  value = ATutil_convertHexaStringToInt64((const uint8_t *)"0x0123456789ABCDEF", 18U, &high, &low);
+  test_check((value == 1U) && (high == 0x01234567U) && (low == 0x89ABCDEFU), "ATutil_convertHexaStringToInt64",
+             (const uint8_t *)"0x0123456789ABCDEF", 18U, 16U, low, 0x89ABCDEFU);
+}
+
+/**
+ * @brief  former decimal conversion (one ATutil_ipow per digit), for benchmark only
+ */
+static uint32_t legacy_convertStringToInt(const uint8_t *p_string, uint16_t size)
+{
+  uint32_t conv_nbr = 0U;
+  uint16_t nb_digit_ignored = 0U;
+  uint16_t loop = 0U;
+
+  for (uint16_t idx = 0U; idx < size; idx++)
+  {
+    if ((p_string[idx] >= 48U) && (p_string[idx] <= 57U))
+    {
+      loop++;
+      conv_nbr = conv_nbr + (((uint32_t)p_string[idx] - 48U) * ATutil_ipow(10U, (size - loop - nb_digit_ignored)));
+    }
+    else
+    {
+      nb_digit_ignored++;
+    }
+  }
+  return conv_nbr;
+}
+
+/**
+ * @brief  monotonic time in ns
+ */
+static double test_time_ns(void)
+{
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief  time per digit of the current and of the former decimal conversion
+ */
+static void test_benchmark(void)
+{
+  volatile uint32_t sink = 0U;
+  uint32_t nb_digits = 0U;
+  double t_new;
+  double t_old;
+  double t0;
+
+  for (uint32_t i = 0U; i < (sizeof(test_captured_params) / sizeof(test_captured_params[0])); i++)
+  {
+    const uint8_t *p_str = (const uint8_t *)test_captured_params[i];
+    uint32_t size = (uint32_t)strlen(test_captured_params[i]);
+    nb_digits += (uint32_t)test_digit_prefix((p_str[0] == (uint8_t)'"') ? &p_str[1] : p_str, size, 10U);
+  }
+
+  t0 = test_time_ns();
+  for (uint32_t loop = 0U; loop < TEST_BENCH_LOOP; loop++)
+  {
+    for (uint32_t i = 0U; i < (sizeof(test_captured_params) / sizeof(test_captured_params[0])); i++)
+    {
+      sink += ATutil_convertStringToInt((const uint8_t *)test_captured_params[i],
+                                        (uint16_t)strlen(test_captured_params[i]));
+    }
+  }
+  t_new = test_time_ns() - t0;
+
+  t0 = test_time_ns();
+  for (uint32_t loop = 0U; loop < TEST_BENCH_LOOP; loop++)
+  {
+    for (uint32_t i = 0U; i < (sizeof(test_captured_params) / sizeof(test_captured_params[0])); i++)
+    {
+      sink += legacy_convertStringToInt((const uint8_t *)test_captured_params[i],
+                                        (uint16_t)strlen(test_captured_params[i]));
+    }
+  }
+  t_old = test_time_ns() - t0;
+
+  printf("benchmark (SWAR %s): %u captured parameters, %u digits, %u loops\n",
+         (CRS_SWAR_CONVERSION == 1U) ? "on" : "off",
+         (uint32_t)(sizeof(test_captured_params) / sizeof(test_captured_params[0])), nb_digits, TEST_BENCH_LOOP);
+  printf("  ATutil_convertStringToInt : %6.2f ns/digit\n", t_new / ((double)nb_digits * TEST_BENCH_LOOP));
+  printf("  former ipow conversion    : %6.2f ns/digit\n", t_old / ((double)nb_digits * TEST_BENCH_LOOP));
+  (void)sink;
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+  uint32_t iter = TEST_RANDOM_ITER_DEFAULT;
+
+  if (argc > 1)
+  {
+    iter = (uint32_t)strtoul(argv[1], NULL, 10);
+  }
+
+  test_strtou32_exhaustive();
+  test_strtou32_random(iter);
+  test_atoi();
+  test_atutil();
+  printf("numeric conversion (SWAR %s): %u tests, %u failures\n",
+         (CRS_SWAR_CONVERSION == 1U) ? "on" : "off", test_nb, test_fail_nb);
+
+  test_benchmark();
+
+  return (test_fail_nb > 255U) ? 255 : (int)test_fail_nb;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
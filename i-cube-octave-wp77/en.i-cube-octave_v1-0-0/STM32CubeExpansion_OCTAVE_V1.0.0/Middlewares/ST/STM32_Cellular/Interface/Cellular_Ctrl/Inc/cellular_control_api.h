@@ -627,6 +627,17 @@ typedef struct
   ca_eidrx_mode_t                 eidrx_mode;             /*!< requested eDRX mode                                */
   cellular_power_eidrx_config_t   eidrx;                  /*!< eIDRX config                                       */
 } cellular_power_config_t;
+
+/**
+  * @brief  Structure definition of deferred transmission statistics.
+  */
+typedef struct
+{
+  uint32_t                        posted;         /*!< Number of scheduled transmissions                          */
+  uint32_t                        flushed;        /*!< Number of transmissions called back                        */
+  uint32_t                        flush_nb;       /*!< Number of grouped flushes of pending transmissions         */
+  uint32_t                        wakeups_saved;  /*!< Modem wakeups avoided by grouping deferred transmissions   */
+} cellular_power_tx_stats_t;
 #endif  /* (USE_LOW_POWER == 1) */
 
 /**
@@ -685,6 +696,13 @@ typedef void (* cellular_power_info_cb_t)(ca_event_type_t event, const cellular_
                                           void *const p_callback_ctx);
 #endif /* USE_LOW_POWER == 1 */
 
+/**
+  * @brief     Callback definition used to inform that a deferred transmission can be done.
+  * @param[in] p_callback_ctx - The p_callback_ctx parameter in cellular_power_tx_schedule function.
+  * @note      Called from a Cellular task context: it should only post a message to the application task.
+  */
+typedef void (* cellular_power_tx_cb_t)(void *const p_callback_ctx);
+
 /**
   * @}
   */
@@ -920,8 +938,31 @@ void cellular_get_power_info(cellular_power_info_t *const p_power_info);
   *            CELLULAR_ERR_INTERNAL     Error while executing X-Cube-Cellular internal function.
   */
 cellular_result_t cellular_set_power(const cellular_power_config_t *const p_power_config);
+
+/**
+  * @brief         Get deferred transmission statistics.
+  * @param[in,out] p_tx_stats - The statistics structure to contain the response.
+  * @retval -
+  */
+void cellular_get_power_tx_stats(cellular_power_tx_stats_t *const p_tx_stats);
 #endif /* USE_LOW_POWER == 1 */
 
+/**
+  * @brief     Schedule a deferrable transmission.
+  * @param[in] tx_cb          - The callback called when the application can transmit.
+  * @param[in] p_callback_ctx - The context to be passed when tx_cb callback is called.
+  * @param[in] deadline       - Maximum delay (in ms) before tx_cb is called.
+  * @retval    cellular_result_t         The code indicating if the operation is successful otherwise an error code
+  *                                      indicating the cause of the error.\n
+  *            CELLULAR_SUCCESS          The operation is successful.\n
+  *            CELLULAR_ERR_BADARGUMENT  tx_cb is NULL.
+  * @note      When the modem is in low power (PSM/eDRX), tx_cb is called at the next modem wake window
+  *            together with the other deferred transmissions, or at the latest when deadline expires.
+  *            Otherwise tx_cb is called immediately.
+  */
+cellular_result_t cellular_power_tx_schedule(cellular_power_tx_cb_t tx_cb, void *const p_callback_ctx,
+                                             uint32_t deadline);
+
 /**
   * @brief     Register a callback that will be called when Cellular information is updated.
   * @param[in] cellular_info_cb        - The callback to register.
@@ -29,6 +29,7 @@
 #include "com_core.h"
 #if (USE_LOW_POWER == 1)
 #include "cellular_service_power.h"
+#include "cellular_service_txsched.h"
 #endif  /* (USE_LOW_POWER == 1) */
 #include "cellular_service_task.h"
 #include "dc_common.h"
@@ -150,13 +151,14 @@ static cellular_result_t cellular_api_register_general_cb(void)
   static bool cellular_api_global_cb_registered = false;
 
   cellular_result_t ret = CELLULAR_SUCCESS;
+  dc_com_reg_id_t reg_id;
 
   /* if global call back not already registered to Data Cache */
   if (cellular_api_global_cb_registered == false)
   {
     /* register general call back to Data Cache  */
-    if (dc_com_register_gen_event_cb(&dc_com_db, cellular_api_general_data_cache_callback, (const void *)NULL) ==
-        DC_COM_INVALID_ENTRY)
+    reg_id = dc_com_register_gen_event_cb(&dc_com_db, cellular_api_general_data_cache_callback, (const void *)NULL);
+    if (reg_id == DC_COM_INVALID_ENTRY)
     {
       /* Data Cache registration returned an error */
       ret = CELLULAR_ERR_INTERNAL;
@@ -165,6 +167,14 @@ static cellular_result_t cellular_api_register_general_cb(void)
     {
       /* Data Cache registration is OK, store the fact that cellular api global call back is now registered */
       cellular_api_global_cb_registered = true;
+      /* only entries forwarded to cellular api call backs are notified */
+      (void)dc_com_set_res_mask(&dc_com_db, reg_id,
+                                DC_COM_RES_MASK(DC_CELLULAR_INFO) | DC_COM_RES_MASK(DC_CELLULAR_SIGNAL_INFO)
+                                | DC_COM_RES_MASK(DC_CELLULAR_SIM_INFO) | DC_COM_RES_MASK(DC_CELLULAR_NFMC_INFO)
+#if (USE_LOW_POWER == 1)
+                                | DC_COM_RES_MASK(DC_CELLULAR_POWER_STATUS)
+#endif /* (USE_LOW_POWER == 1) */
+                                | DC_COM_RES_MASK(DC_CELLULAR_NIFMAN_INFO));
       /* Reset the content of the structure containing the call back information */
       (void)memset((void *)cellular_api_registration_cb, 0,
                    sizeof(cellular_api_cb_t) * CELLULAR_CONCURENT_REGISTRATION_CB_MAX_NB);
@@ -1267,7 +1277,63 @@ cellular_result_t cellular_set_power(const cellular_power_config_t *const p_powe
   }
   return (ret);
 }
+
+/**
+  * @brief         Get deferred transmission statistics.
+  * @param[in,out] p_tx_stats - The statistics structure to contain the response.
+  * @retval -
+  */
+void cellular_get_power_tx_stats(cellular_power_tx_stats_t *const p_tx_stats)
+{
+  CSX_Stats_t csx_stats;                                    /* Statistics of Cellular Service tx scheduler             */
+
+  if (p_tx_stats != NULL)
+  {
+    CSX_GetStats(&csx_stats);
+    p_tx_stats->posted        = csx_stats.posted;
+    p_tx_stats->flushed       = csx_stats.flushed;
+    p_tx_stats->flush_nb      = csx_stats.flush_nb;
+    p_tx_stats->wakeups_saved = csx_stats.wakeups_saved;
+  }
+}
+#endif /* USE_LOW_POWER == 1 */
+
+/**
+  * @brief     Schedule a deferrable transmission.
+  * @param[in] tx_cb          - The callback called when the application can transmit.
+  * @param[in] p_callback_ctx - The context to be passed when tx_cb callback is called.
+  * @param[in] deadline       - Maximum delay (in ms) before tx_cb is called.
+  * @retval    cellular_result_t         The code indicating if the operation is successful otherwise an error code
+  *                                      indicating the cause of the error.\n
+  *            CELLULAR_SUCCESS          The operation is successful.\n
+  *            CELLULAR_ERR_BADARGUMENT  tx_cb is NULL.
+  */
+cellular_result_t cellular_power_tx_schedule(cellular_power_tx_cb_t tx_cb, void *const p_callback_ctx,
+                                             uint32_t deadline)
+{
+  cellular_result_t ret;                                    /* Return value of the function                            */
+
+  if (tx_cb != NULL)
+  {
+    ret = CELLULAR_SUCCESS;
+#if (USE_LOW_POWER == 1)
+    /* Wait for the next modem wake window */
+    if (CSX_Schedule(tx_cb, p_callback_ctx, deadline) != CELLULAR_OK)
+    {
+      ret = CELLULAR_ERR_INTERNAL;
+    }
+#else
+    /* No low power: modem is always reachable */
+    UNUSED(deadline);
+    tx_cb(p_callback_ctx);
 #endif /* USE_LOW_POWER == 1 */
+  }
+  else
+  {
+    ret = CELLULAR_ERR_BADARGUMENT;
+  }
+  return (ret);
+}
 
 /**
   * @brief     Register a callback that will be called when Cellular information is updated.
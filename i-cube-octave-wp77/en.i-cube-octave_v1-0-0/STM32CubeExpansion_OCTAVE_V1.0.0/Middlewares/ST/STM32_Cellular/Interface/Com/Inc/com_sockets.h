@@ -392,6 +392,34 @@ int32_t com_recvfrom(int32_t sock,
                      int32_t flags,
                      com_sockaddr_t *from, int32_t *fromlen);
 
+#if (COM_SOCKETS_MMSG == 1U)
+/**
+  * @brief  Socket send several datagrams
+  * @note   Send a burst of datagrams in one call
+  *         Sending stops at the first datagram in error
+  * @param  sock      - socket handle obtained with com_socket
+  * @param  msgvec    - array of datagrams
+  * @note   msg_len of each datagram is updated with number of bytes sent or error value
+  * @param  vlen      - number of datagrams in msgvec
+  * @param  flags     - options (see com_sendto)
+  * @retval int32_t   - number of datagrams sent or error value of the first datagram
+  */
+int32_t com_sendmmsg(int32_t sock, com_mmsghdr_t *msgvec, uint32_t vlen, int32_t flags);
+
+/**
+  * @brief  Socket receive several datagrams
+  * @note   Wait for a first datagram then receive the datagrams already available
+  * @param  sock      - socket handle obtained with com_socket
+  * @param  msgvec    - array of datagrams
+  * @note   msg_len of each datagram is updated with number of bytes received or error value
+  *         msg_name/msg_namelen are updated as in com_recvfrom
+  * @param  vlen      - number of datagrams in msgvec
+  * @param  flags     - options for the first datagram (see com_recvfrom)
+  * @retval int32_t   - number of datagrams received or result of the first datagram
+  */
+int32_t com_recvmmsg(int32_t sock, com_mmsghdr_t *msgvec, uint32_t vlen, int32_t flags);
+#endif /* COM_SOCKETS_MMSG == 1U */
+
 
 /**
   * @brief  Socket close
@@ -401,6 +429,29 @@ int32_t com_recvfrom(int32_t sock,
   */
 int32_t com_closesocket(int32_t sock);
 
+#if (COM_SOCKETS_TCP_POOL == 1U)
+/**
+  * @brief  Socket connect using the connection pool
+  * @note   Hand out an idle TCP connection to the same remote kept by com_closesocket_pooled
+  *         else create a TCP socket and connect it
+  * @param  addr      - remote IP address and port
+  * @note   only an IPv4 address is supported
+  * @param  addrlen   - addr length
+  * @retval int32_t   - socket handle or error value
+  */
+int32_t com_connect_pooled(const com_sockaddr_t *addr, int32_t addrlen);
+
+/**
+  * @brief  Socket close keeping the connection in the pool
+  * @note   Keep an idle TCP connection for a next com_connect_pooled
+  *         (during COM_SOCKETS_TCP_POOL_IDLE_TIMEOUT) else close it
+  *         In both cases the socket handle is released
+  * @param  sock      - socket handle obtained with com_socket or com_connect_pooled
+  * @retval int32_t   - ok or error value
+  */
+int32_t com_closesocket_pooled(int32_t sock);
+#endif /* COM_SOCKETS_TCP_POOL == 1U */
+
 
 /**
   * @}
@@ -416,6 +467,8 @@ int32_t com_closesocket(int32_t sock);
 /**
   * @brief  Get host IP from host name
   * @note   Retrieve host IP address from host name
+  *         If COM_SOCKETS_DNS_CACHE is activated, successful resolutions are cached
+  *         (errors are not) and cache is flushed at each network status change
   * @param  name      - host name
   * @param  addr      - host IP corresponding to host name
   * @retval int32_t   - ok or error value
@@ -444,6 +497,22 @@ int32_t com_getpeername(int32_t sock,
   */
 int32_t com_getsockname(int32_t sock,
                         com_sockaddr_t *name, int32_t *namelen);
+
+#if (COM_SOCKETS_POLL == 1U)
+/**
+  * @brief  Wait for events on several sockets
+  * @note   Allows a single thread to service several sockets
+  * @param  fds       - array of poll descriptors
+  * @note   for each entry, events are the requested COM_POLLIN/COM_POLLOUT
+  *         revents are updated with the events ready
+  *         (COM_POLLERR, COM_POLLHUP and COM_POLLNVAL are always reported)
+  * @param  nfds      - number of entries in fds
+  * @param  timeout   - maximum time to wait (in ms)
+  * @note   0: no wait, < 0: wait forever
+  * @retval int32_t   - number of entries with revents != 0, 0 if timeout or error value
+  */
+int32_t com_poll(com_pollfd_t *fds, uint32_t nfds, int32_t timeout);
+#endif /* COM_SOCKETS_POLL == 1U */
 /**
   * @}
   */
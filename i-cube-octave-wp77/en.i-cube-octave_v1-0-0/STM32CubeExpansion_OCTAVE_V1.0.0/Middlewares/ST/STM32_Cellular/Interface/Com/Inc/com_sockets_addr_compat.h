@@ -219,6 +219,27 @@ typedef struct sockaddr_in com_sockaddr_in_t;
 
 #endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP) */
 
+#if (COM_SOCKETS_MMSG == 1U)
+/* Common Exported types -----------------------------------------------------*/
+/** @addtogroup COM_SOCKETS_Types
+  * @{
+  */
+
+/* Datagram descriptor used by com_sendmmsg/com_recvmmsg */
+typedef struct
+{
+  com_char_t     *msg_buf;     /*!< datagram data */
+  int32_t         msg_buflen;  /*!< length of data to send / size of buffer to receive (in bytes) */
+  com_sockaddr_t *msg_name;    /*!< remote IP address and port (to send: NULL to use connect address) */
+  int32_t         msg_namelen; /*!< remote IP length */
+  int32_t         msg_len;     /*!< returned number of bytes sent/received or error value */
+} com_mmsghdr_t;
+
+/**
+  * @}
+  */
+#endif /* COM_SOCKETS_MMSG == 1U */
+
 #ifdef __cplusplus
 }
 #endif
@@ -32,6 +32,7 @@ extern "C" {
 
 #include "com_common.h"
 #include "com_sockets_addr_compat.h"
+#include "com_sockets_net_compat.h"
 
 /* Exported constants --------------------------------------------------------*/
 
@@ -277,6 +278,36 @@ int32_t com_recvfrom_ip_modem(int32_t sock,
                               int32_t flags,
                               com_sockaddr_t *from, int32_t *fromlen);
 
+#if (COM_SOCKETS_MMSG == 1U)
+/**
+  * @brief  Socket send several datagrams
+  * @note   Send a burst of datagrams in one call
+  *         Socket and parameters are checked once and remote address translation
+  *         is reused while datagrams are sent to the same remote
+  *         Sending stops at the first datagram in error
+  * @param  sock      - socket handle obtained with com_socket
+  * @param  msgvec    - array of datagrams
+  * @note   msg_len of each datagram is updated with number of bytes sent or error value
+  * @param  vlen      - number of datagrams in msgvec
+  * @param  flags     - options (see com_sendto)
+  * @retval int32_t   - number of datagrams sent or error value of the first datagram
+  */
+int32_t com_sendmmsg_ip_modem(int32_t sock, com_mmsghdr_t *msgvec, uint32_t vlen, int32_t flags);
+
+/**
+  * @brief  Socket receive several datagrams
+  * @note   Wait for a first datagram then receive the datagrams already available
+  * @param  sock      - socket handle obtained with com_socket
+  * @param  msgvec    - array of datagrams
+  * @note   msg_len of each datagram is updated with number of bytes received or error value
+  *         msg_name/msg_namelen are updated as in com_recvfrom
+  * @param  vlen      - number of datagrams in msgvec
+  * @param  flags     - options for the first datagram (see com_recvfrom)
+  * @retval int32_t   - number of datagrams received or result of the first datagram
+  */
+int32_t com_recvmmsg_ip_modem(int32_t sock, com_mmsghdr_t *msgvec, uint32_t vlen, int32_t flags);
+#endif /* COM_SOCKETS_MMSG == 1U */
+
 /**
   * @brief  Socket close
   * @note   Close a socket and release socket handle
@@ -287,6 +318,33 @@ int32_t com_recvfrom_ip_modem(int32_t sock,
   */
 int32_t com_closesocket_ip_modem(int32_t sock);
 
+#if (COM_SOCKETS_TCP_POOL == 1U)
+/**
+  * @brief  Socket connect using the connection pool
+  * @note   Hand out an idle connection of the pool to the same remote
+  *         if it passes the health check (not closed by remote, not expired,
+  *         no unread data, connection still known by the modem),
+  *         else create a TCP socket and connect it
+  * @param  addr      - remote IP address and port
+  * @note   only an IPv4 address is supported
+  * @param  addrlen   - addr length
+  * @retval int32_t   - socket handle or error value
+  */
+int32_t com_connect_pooled_ip_modem(const com_sockaddr_t *addr, int32_t addrlen);
+
+/**
+  * @brief  Socket close keeping the connection in the pool
+  * @note   A TCP connection without error and without unread data is kept in the pool
+  *         (at most COM_SOCKETS_TCP_POOL_SIZE connections)
+  *         to be handed out by com_connect_pooled until COM_SOCKETS_TCP_POOL_IDLE_TIMEOUT
+  *         else the socket is closed
+  *         In both cases the socket handle is released
+  * @param  sock      - socket handle obtained with com_socket or com_connect_pooled
+  * @retval int32_t   - ok or error value
+  */
+int32_t com_closesocket_pooled_ip_modem(int32_t sock);
+#endif /* COM_SOCKETS_TCP_POOL == 1U */
+
 /**
   * @}
   */
@@ -334,6 +392,22 @@ int32_t com_getpeername_ip_modem(int32_t sock,
 int32_t com_getsockname_ip_modem(int32_t sock,
                                  com_sockaddr_t *name, int32_t *namelen);
 
+#if (COM_SOCKETS_POLL == 1U)
+/**
+  * @brief  Wait for events on several sockets
+  * @note   Readiness is updated by modem URC data received and socket closing
+  *         COM_POLLIN : data already read from modem or data received URC not yet consumed by a receive
+  *         COM_POLLOUT: socket connected (or UDP socket created) and no other request in progress on it
+  *         COM_POLLHUP: socket closed by remote
+  *         COM_POLLERR: network down or last request on the socket in error
+  * @param  fds       - array of poll descriptors
+  * @param  nfds      - number of entries in fds
+  * @param  timeout   - maximum time to wait (in ms) - 0: no wait, < 0: wait forever
+  * @retval int32_t   - number of entries with revents != 0, 0 if timeout or error value
+  */
+int32_t com_poll_ip_modem(com_pollfd_t *fds, uint32_t nfds, int32_t timeout);
+#endif /* COM_SOCKETS_POLL == 1U */
+
 /**
   * @}
   */
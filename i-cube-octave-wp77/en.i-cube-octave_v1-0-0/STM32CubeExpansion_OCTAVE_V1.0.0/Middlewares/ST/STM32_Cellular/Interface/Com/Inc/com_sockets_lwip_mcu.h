@@ -32,6 +32,7 @@ extern "C" {
 
 #include "com_common.h"
 #include "com_sockets_addr_compat.h"
+#include "com_sockets_net_compat.h"
 
 /* Exported constants --------------------------------------------------------*/
 
@@ -224,6 +225,36 @@ int32_t com_recvfrom_lwip_mcu(int32_t sock,
                               int32_t flags,
                               com_sockaddr_t *from, int32_t *fromlen);
 
+#if (COM_SOCKETS_MMSG == 1U)
+/**
+  * @brief  Socket send several datagrams
+  * @note   Send a burst of datagrams in one call
+  *         Restrictions, if any, are linked to LwIP module used
+  *         Sending stops at the first datagram in error
+  * @param  sock      - socket handle obtained with com_socket
+  * @param  msgvec    - array of datagrams
+  * @note   msg_len of each datagram is updated with number of bytes sent or error value
+  * @param  vlen      - number of datagrams in msgvec
+  * @param  flags     - options (see com_sendto)
+  * @retval int32_t   - number of datagrams sent or error value of the first datagram
+  */
+int32_t com_sendmmsg_lwip_mcu(int32_t sock, com_mmsghdr_t *msgvec, uint32_t vlen, int32_t flags);
+
+/**
+  * @brief  Socket receive several datagrams
+  * @note   Wait for a first datagram then receive the datagrams already available
+  *         Restrictions, if any, are linked to LwIP module used
+  * @param  sock      - socket handle obtained with com_socket
+  * @param  msgvec    - array of datagrams
+  * @note   msg_len of each datagram is updated with number of bytes received or error value
+  *         msg_name/msg_namelen are updated as in com_recvfrom
+  * @param  vlen      - number of datagrams in msgvec
+  * @param  flags     - options for the first datagram (see com_recvfrom)
+  * @retval int32_t   - number of datagrams received or result of the first datagram
+  */
+int32_t com_recvmmsg_lwip_mcu(int32_t sock, com_mmsghdr_t *msgvec, uint32_t vlen, int32_t flags);
+#endif /* COM_SOCKETS_MMSG == 1U */
+
 /**
   * @brief  Socket close
   * @note   Close a socket and release socket handle
@@ -233,6 +264,25 @@ int32_t com_recvfrom_lwip_mcu(int32_t sock,
   */
 int32_t com_closesocket_lwip_mcu(int32_t sock);
 
+#if (COM_SOCKETS_TCP_POOL == 1U)
+/**
+  * @brief  Socket connect using the connection pool
+  * @note   No connection pool with LwIP: create a TCP socket and connect it
+  * @param  addr      - remote IP address and port
+  * @param  addrlen   - addr length
+  * @retval int32_t   - socket handle or error value
+  */
+int32_t com_connect_pooled_lwip_mcu(const com_sockaddr_t *addr, int32_t addrlen);
+
+/**
+  * @brief  Socket close keeping the connection in the pool
+  * @note   No connection pool with LwIP: close the socket
+  * @param  sock      - socket handle obtained with com_socket or com_connect_pooled
+  * @retval int32_t   - ok or error value
+  */
+int32_t com_closesocket_pooled_lwip_mcu(int32_t sock);
+#endif /* COM_SOCKETS_TCP_POOL == 1U */
+
 /**
   * @}
   */
@@ -278,6 +328,18 @@ int32_t com_getpeername_lwip_mcu(int32_t sock,
 int32_t com_getsockname_lwip_mcu(int32_t sock,
                                  com_sockaddr_t *name, int32_t *namelen);
 
+#if (COM_SOCKETS_POLL == 1U)
+/**
+  * @brief  Wait for events on several sockets
+  * @note   Restrictions, if any, are linked to LwIP module used
+  * @param  fds       - array of poll descriptors
+  * @param  nfds      - number of entries in fds
+  * @param  timeout   - maximum time to wait (in ms) - 0: no wait, < 0: wait forever
+  * @retval int32_t   - number of entries with revents != 0, 0 if timeout or error value
+  */
+int32_t com_poll_lwip_mcu(com_pollfd_t *fds, uint32_t nfds, int32_t timeout);
+#endif /* COM_SOCKETS_POLL == 1U */
+
 /**
   * @}
   */
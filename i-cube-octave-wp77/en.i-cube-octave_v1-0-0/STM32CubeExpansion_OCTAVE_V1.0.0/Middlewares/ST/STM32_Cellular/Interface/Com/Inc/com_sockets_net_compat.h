@@ -88,17 +88,42 @@ extern "C" {
 #define COM_SO_SNDTIMEO    0x1005 /*!< Socket Options send timeout - used for (get/set)sockopt() */
 #define COM_SO_RCVTIMEO    0x1006 /*!< Socket Options receive timeout - used for (get/set)sockopt() */
 #define COM_SO_ERROR       0x1007 /*!< Socket Options get error status and clear - used for (get/set)sockopt() */
+#define COM_SO_TXCOALESCE  0x1008 /*!< Socket Options send coalescing on TCP socket (uint32_t 0: off, 1: on)
+                                       - used for (get/set)sockopt() - needs COM_SOCKETS_TX_COALESCING */
+#define COM_SO_TXFLUSH     0x1009 /*!< Socket Options send coalesced data now - used for setsockopt()
+                                       - needs COM_SOCKETS_TX_COALESCING */
 
 /* Flags used with recv. */
 #define COM_MSG_WAIT       0x00    /*!< Blocking     */
 #define COM_MSG_DONTWAIT   0x01    /*!< Non blocking */
 
+/* Events used with poll. */
+#define COM_POLLIN         0x001   /*!< Data can be read                        */
+#define COM_POLLOUT        0x002   /*!< Data can be sent                        */
+#define COM_POLLERR        0x004   /*!< Error on socket (always reported)       */
+#define COM_POLLNVAL       0x008   /*!< Invalid socket handle (always reported) */
+#define COM_POLLHUP        0x200   /*!< Closed by remote (always reported)      */
+
 /**
   * @}
   */
 
 /* Exported types ------------------------------------------------------------*/
-/* None */
+/** @addtogroup COM_SOCKETS_Types
+  * @{
+  */
+
+/* Poll descriptor */
+typedef struct
+{
+  int32_t fd;      /*!< socket handle obtained with com_socket */
+  int16_t events;  /*!< requested events COM_POLLIN and/or COM_POLLOUT */
+  int16_t revents; /*!< returned events */
+} com_pollfd_t;
+
+/**
+  * @}
+  */
 
 /* External variables --------------------------------------------------------*/
 /* None */
@@ -162,8 +187,15 @@ extern "C" {
 #define COM_MSG_WAIT       0x00
 #define COM_MSG_DONTWAIT   MSG_DONTWAIT
 
+/* Events used with poll. */
+#define COM_POLLIN         POLLIN
+#define COM_POLLOUT        POLLOUT
+#define COM_POLLERR        POLLERR
+#define COM_POLLNVAL       POLLNVAL
+#define COM_POLLHUP        POLLHUP
+
 /* Exported types ------------------------------------------------------------*/
-/* None */
+typedef struct pollfd com_pollfd_t;
 
 /* External variables --------------------------------------------------------*/
 /* None */
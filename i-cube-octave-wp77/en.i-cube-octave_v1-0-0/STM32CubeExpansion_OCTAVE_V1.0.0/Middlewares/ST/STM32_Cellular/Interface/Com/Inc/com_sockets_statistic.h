@@ -29,7 +29,15 @@ extern "C" {
 #include "plf_config.h"
 
 /* Exported constants --------------------------------------------------------*/
-/* None */
+/* Latency histogram: bucket i counts calls lasting less than (16ms << i),
+ * last bucket counts all the longer calls */
+#define COM_SOCKETS_STAT_LAT_BUCKET_NB     10U
+#define COM_SOCKETS_STAT_LAT_BUCKET_FIRST  16U  /* in ms */
+
+/* Version of the binary export layout - see com_sockets_statistic_export() */
+#define COM_SOCKETS_STAT_EXPORT_VERSION    1U
+/* Maximum size of the binary export */
+#define COM_SOCKETS_STAT_EXPORT_SIZE_MAX   256U
 
 
 /* Exported types ------------------------------------------------------------*/
@@ -51,9 +59,33 @@ typedef enum
   COM_SOCKET_STAT_CLS_OK,
   COM_SOCKET_STAT_CLS_NOK,
   COM_SOCKET_STAT_NWK_UP,
-  COM_SOCKET_STAT_NWK_DWN
+  COM_SOCKET_STAT_NWK_DWN,
+  COM_SOCKET_STAT_SND_COALESCED,  /* application data kept in a send coalescing buffer */
+  COM_SOCKET_STAT_SND_FLUSH       /* coalescing buffer sent to the modem */
 } com_sockets_stat_update_t;
 
+/* Internal usage only: use by com_sockets_ip_modem to update latency statistics */
+typedef enum
+{
+  COM_SOCKET_STAT_LAT_CNT = 0,    /* connect AT round trip */
+  COM_SOCKET_STAT_LAT_SND,        /* send/sendto AT round trip */
+  COM_SOCKET_STAT_LAT_RCV,        /* receive/receivefrom AT round trip */
+  COM_SOCKET_STAT_LAT_WAIT,       /* wait of data availability in receive/receivefrom */
+  COM_SOCKET_STAT_LAT_NB
+} com_sockets_stat_latency_t;
+
+/* Summary of the statistics, i.e: what is published to the cloud */
+typedef struct
+{
+  uint32_t tx_bytes;                                 /* total bytes sent */
+  uint32_t rx_bytes;                                 /* total bytes received */
+  uint32_t tx_peak;                                  /* peak tx throughput in bytes/s */
+  uint32_t rx_peak;                                  /* peak rx throughput in bytes/s */
+  uint32_t errors;                                   /* total errors returned to the application */
+  uint32_t lat_avg[COM_SOCKET_STAT_LAT_NB];          /* average latency in ms */
+  uint32_t lat_max[COM_SOCKET_STAT_LAT_NB];          /* maximum latency in ms */
+} com_sockets_stat_summary_t;
+
 /**
   * @}
   */
@@ -77,6 +109,29 @@ typedef enum
   */
 void com_sockets_statistic_display(void);
 
+/**
+  * @brief  Export com sockets statistics in a compact binary form
+  * @note   Layout (little endian) version 1:
+  *         - u8 version, u8 sockets nb, u8 latency nb, u8 buckets nb, u8 errors nb
+  *         - u16 ok/nok counters: network, create, connect, send, receive, close
+  *         - u32 tx bytes, rx bytes, tx peak, rx peak (bytes/s)
+  *         - per socket: u32 tx bytes, u32 rx bytes
+  *         - per latency: u32 max, u32 sum, u32 count, u16 buckets[buckets nb]
+  *         - u16 errors[errors nb], index i is the count of error code -i
+  * @param  p_buf - buffer to fill
+  * @param  size  - size of the buffer
+  * @retval uint32_t - number of bytes written, 0 if buffer is too small
+  */
+uint32_t com_sockets_statistic_export(uint8_t *p_buf, uint32_t size);
+
+/**
+  * @brief  Get a summary of com sockets statistics
+  * @note   used to publish the statistics to the cloud
+  * @param  p_summary - summary to fill
+  * @retval -
+  */
+void com_sockets_statistic_summary(com_sockets_stat_summary_t *p_summary);
+
 /**
   * @}
   */
@@ -105,6 +160,41 @@ void com_sockets_statistic_init(void);
   */
 void com_sockets_statistic_update(com_sockets_stat_update_t stat);
 
+/**
+  * @brief  Reset the statistics of a socket
+  * @note   called when the socket is created
+  * @param  id - socket id
+  * @retval -
+  */
+void com_sockets_statistic_socket(int32_t id);
+
+/**
+  * @brief  Add bytes exchanged on a socket
+  * @note   also update peak throughput
+  * @param  id     - socket id
+  * @param  tx_len - bytes sent
+  * @param  rx_len - bytes received
+  * @retval -
+  */
+void com_sockets_statistic_bytes(int32_t id, uint32_t tx_len, uint32_t rx_len);
+
+/**
+  * @brief  Add a latency measure
+  * @note   -
+  * @param  lat        - operation measured
+  * @param  start_tick - HAL tick at operation start
+  * @retval -
+  */
+void com_sockets_statistic_latency(com_sockets_stat_latency_t lat, uint32_t start_tick);
+
+/**
+  * @brief  Count an error returned to the application
+  * @note   -
+  * @param  err - error code (COM_SOCKETS_ERR_xxx)
+  * @retval -
+  */
+void com_sockets_statistic_error(int32_t err);
+
 #ifdef __cplusplus
 }
 #endif
@@ -44,6 +44,7 @@
 
 /* Private defines -----------------------------------------------------------*/
 #define COM_CORE_CMD_ARG_MAX_NB                5U
+#define COM_CORE_CMD_BIN_LINE_SIZE             32U /* bytes displayed per line by 'comlib stat bin' */
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private macros ------------------------------------------------------------*/
@@ -52,6 +53,7 @@
 /* Private function prototypes -----------------------------------------------*/
 #if (USE_CMD_CONSOLE == 1)
 static void com_core_cmd_help(void);
+static void com_core_cmd_stat_bin(void);
 static cmd_status_t com_core_cmd(uint8_t *p_cmd_line);
 #endif /* USE_CMD_CONSOLE == 1 */
 
@@ -67,7 +69,36 @@ static cmd_status_t com_core_cmd(uint8_t *p_cmd_line);
 static void com_core_cmd_help(void) {
 	CMD_print_help((uint8_t*) "comlib");
 	PRINT_FORCE("comlib help")
-	PRINT_FORCE("comlib stat : display com statitistics\n\r")
+	PRINT_FORCE("comlib stat : display com statitistics")
+	PRINT_FORCE("comlib stat bin : export com statistics in binary form (hexadecimal)\n\r")
+}
+
+/**
+ * @brief  console cmd stat bin: display binary statistics export
+ * @param  -
+ * @note   see com_sockets_statistic_export() for the layout
+ * @retval -
+ */
+static void com_core_cmd_stat_bin(void) {
+	static const uint8_t hex[] = "0123456789ABCDEF";
+	static uint8_t export_buf[COM_SOCKETS_STAT_EXPORT_SIZE_MAX];
+	uint8_t line[(2U * COM_CORE_CMD_BIN_LINE_SIZE) + 1U];
+	uint32_t size;
+	uint32_t i;
+	uint32_t j;
+
+	size = com_sockets_statistic_export(export_buf, COM_SOCKETS_STAT_EXPORT_SIZE_MAX);
+
+	PRINT_FORCE("*** Socket Stat Bin Begin: %ld bytes ***", size)
+	for (i = 0U; i < size; i += COM_CORE_CMD_BIN_LINE_SIZE) {
+		for (j = 0U; (j < COM_CORE_CMD_BIN_LINE_SIZE) && ((i + j) < size); j++) {
+			line[2U * j] = hex[export_buf[i + j] >> 4];
+			line[(2U * j) + 1U] = hex[export_buf[i + j] & 0x0FU];
+		}
+		line[2U * j] = 0U;
+		PRINT_FORCE("ComLibBin: %s", line)
+	}
+	PRINT_FORCE("*** Socket Stat Bin End ***")
 }
 
 /**
@@ -112,9 +143,16 @@ static cmd_status_t com_core_cmd(uint8_t *p_cmd_line) {
 					result = CMD_OK;
 					com_core_cmd_help();
 				} else if (memcmp((CRC_CHAR_t*) p_argv[0], "stat", len) == 0) {
-					/* cmd 'comlib stat': display statistics */
 					result = CMD_OK;
-					com_sockets_statistic_display();
+					if ((argc > 1U)
+							&& (memcmp((CRC_CHAR_t*) p_argv[1], "bin",
+									crs_strlen(p_argv[1])) == 0)) {
+						/* cmd 'comlib stat bin': export statistics */
+						com_core_cmd_stat_bin();
+					} else {
+						/* cmd 'comlib stat': display statistics */
+						com_sockets_statistic_display();
+					}
 				} else /* cmd 'comlib xxx ...': unknown */
 				{
 					PRINT_FORCE("comlib: Unrecognized command. Usage:")
@@ -761,9 +761,14 @@ bool com_icc_init(void) {
  * @retval -
  */
 void com_icc_start(void) {
-	/* Datacache registration for icc status */
-	(void) dc_com_core_register_gen_event_cb(&dc_com_db, com_icc_datacache_cb,
-			(void*) NULL);
+	dc_com_reg_id_t reg_id;
+
+	/* Datacache registration for icc status: sim status and modem power state */
+	reg_id = dc_com_core_register_gen_event_cb(&dc_com_db,
+			com_icc_datacache_cb, (void*) NULL);
+	(void) dc_com_set_res_mask(&dc_com_db, reg_id,
+			DC_COM_RES_MASK(DC_CELLULAR_SIM_INFO)
+					| DC_COM_RES_MASK(DC_CELLULAR_INFO));
 }
 
 #endif /* USE_COM_ICC == 1 */
@@ -38,6 +38,9 @@
 #include "dc_common.h"
 #include "cellular_control_api.h"
 #include "cellular_service_datacache.h"
+#if (USE_LOW_POWER == 1)
+#include "cellular_service_activity.h"
+#endif /* USE_LOW_POWER == 1 */
 
 /* Private defines -----------------------------------------------------------*/
 
@@ -52,6 +55,9 @@ typedef enum
 typedef struct
 {
   com_mdm_handle_state_t         handle;
+#if (USE_LOW_POWER == 1)
+  bool                           rx_activity; /* activity token held until MDM URC message is read */
+#endif /* USE_LOW_POWER == 1 */
 } com_mdm_desc_t;
 
 /* Private macros ------------------------------------------------------------*/
@@ -69,12 +75,22 @@ static com_mdm_urc_callback_t com_mdm_app_cb;
 
 /* Local callback for MDM URC */
 void com_mdm_cb(CS_comMdm_status_t comMdmd_event_infos);
+/* Release the activity token held while MDM URC message is not read */
+static void com_mdm_rx_activity_release(void);
 
 /* Private function Definition -----------------------------------------------*/
 
 void com_mdm_cb(CS_comMdm_status_t comMdmd_event_infos)
 {
   UNUSED(comMdmd_event_infos);
+#if (USE_LOW_POWER == 1)
+  /* Modem must not enter low power before the message is read */
+  if (com_mdm_desc.rx_activity == false)
+  {
+    com_mdm_desc.rx_activity = true;
+    CSA_Acquire(CSA_ACTIVITY_MDM_RX);
+  }
+#endif /* USE_LOW_POWER == 1 */
   if (com_mdm_app_cb != NULL)
   {
     /* if the application MDM URC call back is registered/defined, then call it */
@@ -82,6 +98,17 @@ void com_mdm_cb(CS_comMdm_status_t comMdmd_event_infos)
   }
 }
 
+static void com_mdm_rx_activity_release(void)
+{
+#if (USE_LOW_POWER == 1)
+  if (com_mdm_desc.rx_activity == true)
+  {
+    com_mdm_desc.rx_activity = false;
+    CSA_Release(CSA_ACTIVITY_MDM_RX, false);
+  }
+#endif /* USE_LOW_POWER == 1 */
+}
+
 /* Functions Definition ------------------------------------------------------*/
 
 /**
@@ -167,7 +194,13 @@ com_err_t com_mdm_send(uint8_t handle, com_char_t *command, uint32_t length, int
     cs_tx_buffer.p_buffer = command;
     cs_tx_buffer.buffer_size = length;
 
+#if (USE_LOW_POWER == 1)
+    CSA_Acquire(CSA_ACTIVITY_MDM);
+#endif /* USE_LOW_POWER == 1 */
     cs_return = osCS_ComMdm_send(&cs_tx_buffer, command_err_code);
+#if (USE_LOW_POWER == 1)
+    CSA_Release(CSA_ACTIVITY_MDM, false);
+#endif /* USE_LOW_POWER == 1 */
     if (cs_return == CELLULAR_OK)
     {
       error = COM_ERR_OK;
@@ -209,7 +242,13 @@ com_err_t com_mdm_transaction(uint8_t handle, com_char_t *cmd_buff, uint32_t cmd
 
     cs_rx_buffer.p_buffer = rsp_buf;
     cs_rx_buffer.max_buffer_size = rsp_length;
+#if (USE_LOW_POWER == 1)
+    CSA_Acquire(CSA_ACTIVITY_MDM);
+#endif /* USE_LOW_POWER == 1 */
     cs_return = osCS_ComMdm_transaction(&cs_tx_buffer, &cs_rx_buffer, command_err_code);
+#if (USE_LOW_POWER == 1)
+    CSA_Release(CSA_ACTIVITY_MDM, false);
+#endif /* USE_LOW_POWER == 1 */
 
     if (cs_return == CELLULAR_OK)
     {
@@ -246,7 +285,15 @@ com_err_t com_mdm_receive(uint8_t handle, com_char_t *resp, uint32_t length, int
     cs_rx_buffer.p_buffer = resp;
     cs_rx_buffer.max_buffer_size = length;
 
+#if (USE_LOW_POWER == 1)
+    CSA_Acquire(CSA_ACTIVITY_MDM);
+#endif /* USE_LOW_POWER == 1 */
+    /* Receive transaction now keeps the modem awake */
+    com_mdm_rx_activity_release();
     cs_return = osCS_ComMdm_receive(&cs_rx_buffer, command_err_code);
+#if (USE_LOW_POWER == 1)
+    CSA_Release(CSA_ACTIVITY_MDM, false);
+#endif /* USE_LOW_POWER == 1 */
 
     if (cs_return == CELLULAR_OK)
     {
@@ -281,6 +328,7 @@ com_err_t com_mdm_close(uint8_t handle)
 
     /* set handle status to not used */
     com_mdm_desc.handle = COM_MDM_NOT_USED;
+    com_mdm_rx_activity_release();
     if (com_mdm_app_cb != NULL)
     {
       /* a callback is registered, unsubscribe com_mdm callback to MDM URC event */
@@ -318,6 +366,9 @@ void com_mdm_init(void)
 {
   /* Initialize com_mdm descriptor */
   com_mdm_desc.handle = COM_MDM_NOT_USED;
+#if (USE_LOW_POWER == 1)
+  com_mdm_desc.rx_activity = false;
+#endif /* USE_LOW_POWER == 1 */
   /* Initialize registered application callback */
   com_mdm_app_cb = NULL;
 }
@@ -33,14 +33,176 @@
 #include "com_sockets_statistic.h"
 #include "cellular_service_os.h"
 
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+#include <string.h>
+#include "rtosal.h"
+#include "dc_common.h"
+#include "cellular_service_datacache.h"
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
 /* Private defines -----------------------------------------------------------*/
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+#define COM_DNS_CACHE_NAME_SIZE 64U /* longer host names are not cached */
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
 
 /* Private typedef -----------------------------------------------------------*/
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+typedef struct {
+	com_char_t name[COM_DNS_CACHE_NAME_SIZE]; /* empty string: entry free */
+	com_sockaddr_t addr;   /* host IP */
+	uint32_t tick;         /* resolution time */
+	uint32_t last_use;     /* used to replace the least recently used entry */
+} com_dns_cache_t;
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
 /* Private macros ------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+/* Mutex to protect DNS cache access (several applications and datacache) */
+static osMutexId ComDnsCacheMutexHandle;
+static com_dns_cache_t com_dns_cache[COM_SOCKETS_DNS_CACHE_SIZE];
+static uint32_t com_dns_cache_use_counter;
+static dc_service_rt_state_t com_dns_cache_network_state;
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
 /* Global variables ----------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+static bool com_dns_cache_get(const com_char_t *name, com_sockaddr_t *addr);
+static void com_dns_cache_put(const com_char_t *name,
+		const com_sockaddr_t *addr);
+static void com_dns_cache_flush(void);
+static void com_dns_cache_datacache_cb(dc_com_event_id_t dc_event_id,
+		const void *p_private_gui_data);
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
 /* Private function Definition -----------------------------------------------*/
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+/**
+ * @brief  Search a host name in DNS cache
+ * @note   An entry older than its time to live is freed
+ * @param  name      - host name
+ * @param  addr      - host IP found in the cache
+ * @retval bool      - true/false host name found/not found in the cache
+ */
+static bool com_dns_cache_get(const com_char_t *name, com_sockaddr_t *addr) {
+	uint8_t i;
+	bool found;
+
+	found = false;
+
+	if ((name != NULL) && (addr != NULL)) {
+		(void) rtosalMutexAcquire(ComDnsCacheMutexHandle, RTOSAL_WAIT_FOREVER);
+		for (i = 0U; (i < COM_SOCKETS_DNS_CACHE_SIZE) && (found == false);
+				i++) {
+			if ((com_dns_cache[i].name[0] != 0U)
+					&& (strcmp((const char*) com_dns_cache[i].name,
+							(const char*) name) == 0)) {
+				if ((HAL_GetTick() - com_dns_cache[i].tick)
+						< COM_SOCKETS_DNS_CACHE_TTL) {
+					found = true;
+					com_dns_cache_use_counter++;
+					com_dns_cache[i].last_use = com_dns_cache_use_counter;
+					(void) memcpy(addr, &com_dns_cache[i].addr,
+							sizeof(com_sockaddr_t));
+				} else {
+					/* Expired: free the entry */
+					com_dns_cache[i].name[0] = 0U;
+				}
+			}
+		}
+		(void) rtosalMutexRelease(ComDnsCacheMutexHandle);
+	}
+
+	if (found == true) {
+		PRINT_DBG("DNS cache hit for %s", name)
+	}
+
+	return (found);
+}
+
+/**
+ * @brief  Add a resolved host in DNS cache
+ * @note   Replace the entry of the same host name, else a free entry,
+ *         else the least recently used entry
+ * @note   Resolution errors are not cached: the back-ends cannot tell
+ *         a "name not found" answer of the resolver from a transient error
+ *         (no network, AT or modem error, timeout)
+ * @param  name      - host name
+ * @param  addr      - host IP
+ * @retval -
+ */
+static void com_dns_cache_put(const com_char_t *name,
+		const com_sockaddr_t *addr) {
+	uint8_t i;
+	uint8_t entry;
+
+	if ((name != NULL) && (addr != NULL)
+			&& (strlen((const char*) name) < COM_DNS_CACHE_NAME_SIZE)) {
+		(void) rtosalMutexAcquire(ComDnsCacheMutexHandle, RTOSAL_WAIT_FOREVER);
+		entry = 0U;
+		for (i = 0U; i < COM_SOCKETS_DNS_CACHE_SIZE; i++) {
+			if ((com_dns_cache[i].name[0] != 0U)
+					&& (strcmp((const char*) com_dns_cache[i].name,
+							(const char*) name) == 0)) {
+				entry = i;
+				break;
+			}
+			if ((com_dns_cache[entry].name[0] != 0U)
+					&& ((com_dns_cache[i].name[0] == 0U)
+							|| (com_dns_cache[i].last_use
+									< com_dns_cache[entry].last_use))) {
+				entry = i;
+			}
+		}
+		(void) strcpy((char*) com_dns_cache[entry].name, (const char*) name);
+		(void) memcpy(&com_dns_cache[entry].addr, addr, sizeof(com_sockaddr_t));
+		com_dns_cache[entry].tick = HAL_GetTick();
+		com_dns_cache_use_counter++;
+		com_dns_cache[entry].last_use = com_dns_cache_use_counter;
+		(void) rtosalMutexRelease(ComDnsCacheMutexHandle);
+	}
+}
+
+/**
+ * @brief  Flush DNS cache
+ * @param  -
+ * @retval -
+ */
+static void com_dns_cache_flush(void) {
+	(void) rtosalMutexAcquire(ComDnsCacheMutexHandle, RTOSAL_WAIT_FOREVER);
+	(void) memset(com_dns_cache, 0, sizeof(com_dns_cache));
+	(void) rtosalMutexRelease(ComDnsCacheMutexHandle);
+}
+
+/**
+ * @brief  Callback called when a value in datacache changed
+ * @note   DNS cache is flushed at each network status change:
+ *         addresses resolved on the previous PDN activation may be obsolete
+ * @param  dc_event_id - value changed
+ * @param  p_private_gui_data - value provided at service subscription
+ * @note   Unused
+ * @retval -
+ */
+static void com_dns_cache_datacache_cb(dc_com_event_id_t dc_event_id,
+		const void *p_private_gui_data) {
+	UNUSED(p_private_gui_data);
+
+	if (dc_event_id == DC_CELLULAR_NIFMAN_INFO) {
+		dc_nifman_info_t dc_nifman_rt_info;
+
+		if (dc_com_read(&dc_com_db, DC_CELLULAR_NIFMAN_INFO,
+				(void*) &dc_nifman_rt_info, sizeof(dc_nifman_rt_info))
+				== DC_COM_OK) {
+			if (dc_nifman_rt_info.rt_state != com_dns_cache_network_state) {
+				com_dns_cache_network_state = dc_nifman_rt_info.rt_state;
+				com_dns_cache_flush();
+				PRINT_INFO("DNS cache flushed")
+			}
+		}
+	}
+}
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
 
 /* Functions Definition ------------------------------------------------------*/
 
@@ -60,8 +222,9 @@ int32_t com_socket(int32_t family, int32_t type, int32_t protocol) {
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	result = com_socket_ip_modem(family, type, protocol);
 #else
-  result = com_socket_lwip_mcu(family, type, protocol);
+	result = com_socket_lwip_mcu(family, type, protocol);
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+	com_sockets_statistic_error(result);
 
 	return (result);
 }
@@ -83,7 +246,7 @@ int32_t com_setsockopt(int32_t sock, int32_t level, int32_t optname,
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	result = com_setsockopt_ip_modem(sock, level, optname, optval, optlen);
 #else
-  result = com_setsockopt_lwip_mcu(sock, level, optname, optval, optlen);
+	result = com_setsockopt_lwip_mcu(sock, level, optname, optval, optlen);
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
 
 	return (result);
@@ -106,7 +269,7 @@ int32_t com_getsockopt(int32_t sock, int32_t level, int32_t optname,
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	result = com_getsockopt_ip_modem(sock, level, optname, optval, optlen);
 #else
-  result = com_getsockopt_lwip_mcu(sock, level, optname, optval, optlen);
+	result = com_getsockopt_lwip_mcu(sock, level, optname, optval, optlen);
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
 
 	return (result);
@@ -126,7 +289,7 @@ int32_t com_bind(int32_t sock, const com_sockaddr_t *addr, int32_t addrlen) {
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	result = com_bind_ip_modem(sock, addr, addrlen);
 #else
-  result = com_bind_lwip_mcu(sock, addr, addrlen);
+	result = com_bind_lwip_mcu(sock, addr, addrlen);
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
 
 	return (result);
@@ -145,7 +308,7 @@ int32_t com_listen(int32_t sock, int32_t backlog) {
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	result = com_listen_ip_modem(sock, backlog);
 #else
-  result = com_listen_lwip_mcu(sock, backlog);
+	result = com_listen_lwip_mcu(sock, backlog);
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
 
 	return (result);
@@ -165,7 +328,7 @@ int32_t com_accept(int32_t sock, com_sockaddr_t *addr, int32_t *addrlen) {
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	result = com_accept_ip_modem(sock, addr, addrlen);
 #else
-  result = com_accept_lwip_mcu(sock, addr, addrlen);
+	result = com_accept_lwip_mcu(sock, addr, addrlen);
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
 
 	return (result);
@@ -185,8 +348,9 @@ int32_t com_connect(int32_t sock, const com_sockaddr_t *addr, int32_t addrlen) {
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	result = com_connect_ip_modem(sock, addr, addrlen);
 #else
-  result = com_connect_lwip_mcu(sock, addr, addrlen);
+	result = com_connect_lwip_mcu(sock, addr, addrlen);
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+	com_sockets_statistic_error(result);
 
 	return (result);
 }
@@ -207,8 +371,9 @@ int32_t com_send(int32_t sock, const com_char_t *buf, int32_t len,
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	result = com_send_ip_modem(sock, buf, len, flags);
 #else
-  result = com_send_lwip_mcu(sock, buf, len, flags);
+	result = com_send_lwip_mcu(sock, buf, len, flags);
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+	com_sockets_statistic_error(result);
 
 	return (result);
 }
@@ -231,8 +396,9 @@ int32_t com_sendto(int32_t sock, const com_char_t *buf, int32_t len,
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	result = com_sendto_ip_modem(sock, buf, len, flags, to, tolen);
 #else
-  result = com_sendto_lwip_mcu(sock, buf, len, flags, to, tolen);
+	result = com_sendto_lwip_mcu(sock, buf, len, flags, to, tolen);
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+	com_sockets_statistic_error(result);
 
 	return (result);
 }
@@ -252,8 +418,9 @@ int32_t com_recv(int32_t sock, com_char_t *buf, int32_t len, int32_t flags) {
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	result = com_recv_ip_modem(sock, buf, len, flags);
 #else
-  result = com_recv_lwip_mcu(sock, buf, len, flags);
+	result = com_recv_lwip_mcu(sock, buf, len, flags);
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+	com_sockets_statistic_error(result);
 
 	return (result);
 }
@@ -276,11 +443,61 @@ int32_t com_recvfrom(int32_t sock, com_char_t *buf, int32_t len, int32_t flags,
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	result = com_recvfrom_ip_modem(sock, buf, len, flags, from, fromlen);
 #else
-  result = com_recvfrom_lwip_mcu(sock, buf, len, flags, from, fromlen);
+	result = com_recvfrom_lwip_mcu(sock, buf, len, flags, from, fromlen);
+#endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+	com_sockets_statistic_error(result);
+
+	return (result);
+}
+
+#if (COM_SOCKETS_MMSG == 1U)
+/**
+ * @brief  Socket send several datagrams
+ * @note   Send a burst of datagrams in one call
+ *         Sending stops at the first datagram in error
+ * @param  sock      - socket handle obtained with com_socket
+ * @param  msgvec    - array of datagrams
+ * @param  vlen      - number of datagrams in msgvec
+ * @param  flags     - options
+ * @retval int32_t   - number of datagrams sent or error value of the first datagram
+ */
+int32_t com_sendmmsg(int32_t sock, com_mmsghdr_t *msgvec, uint32_t vlen,
+		int32_t flags) {
+	int32_t result;
+
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+	result = com_sendmmsg_ip_modem(sock, msgvec, vlen, flags);
+#else
+	result = com_sendmmsg_lwip_mcu(sock, msgvec, vlen, flags);
+#endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+	com_sockets_statistic_error(result);
+
+	return (result);
+}
+
+/**
+ * @brief  Socket receive several datagrams
+ * @note   Wait for a first datagram then receive the datagrams already available
+ * @param  sock      - socket handle obtained with com_socket
+ * @param  msgvec    - array of datagrams
+ * @param  vlen      - number of datagrams in msgvec
+ * @param  flags     - options for the first datagram
+ * @retval int32_t   - number of datagrams received or result of the first datagram
+ */
+int32_t com_recvmmsg(int32_t sock, com_mmsghdr_t *msgvec, uint32_t vlen,
+		int32_t flags) {
+	int32_t result;
+
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+	result = com_recvmmsg_ip_modem(sock, msgvec, vlen, flags);
+#else
+	result = com_recvmmsg_lwip_mcu(sock, msgvec, vlen, flags);
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+	com_sockets_statistic_error(result);
 
 	return (result);
 }
+#endif /* COM_SOCKETS_MMSG == 1U */
 
 /**
  * @brief  Socket close
@@ -294,11 +511,54 @@ int32_t com_closesocket(int32_t sock) {
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	result = com_closesocket_ip_modem(sock);
 #else
-  result = com_closesocket_lwip_mcu(sock);
+	result = com_closesocket_lwip_mcu(sock);
+#endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+	com_sockets_statistic_error(result);
+
+	return (result);
+}
+
+#if (COM_SOCKETS_TCP_POOL == 1U)
+/**
+ * @brief  Socket connect using the connection pool
+ * @note   Hand out an idle TCP connection to the same remote kept by com_closesocket_pooled
+ *         else create a TCP socket and connect it
+ * @param  addr      - remote IP address and port
+ * @param  addrlen   - addr length
+ * @retval int32_t   - socket handle or error value
+ */
+int32_t com_connect_pooled(const com_sockaddr_t *addr, int32_t addrlen) {
+	int32_t result;
+
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+	result = com_connect_pooled_ip_modem(addr, addrlen);
+#else
+	result = com_connect_pooled_lwip_mcu(addr, addrlen);
+#endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+	com_sockets_statistic_error(result);
+
+	return (result);
+}
+
+/**
+ * @brief  Socket close keeping the connection in the pool
+ * @note   Keep an idle TCP connection for a next com_connect_pooled else close it
+ * @param  sock      - socket handle obtained with com_socket or com_connect_pooled
+ * @retval int32_t   - ok or error value
+ */
+int32_t com_closesocket_pooled(int32_t sock) {
+	int32_t result;
+
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+	result = com_closesocket_pooled_ip_modem(sock);
+#else
+	result = com_closesocket_pooled_lwip_mcu(sock);
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+	com_sockets_statistic_error(result);
 
 	return (result);
 }
+#endif /* COM_SOCKETS_TCP_POOL == 1U */
 
 /*** Other functionalities ****************************************************/
 
@@ -311,12 +571,26 @@ int32_t com_closesocket(int32_t sock) {
  */
 int32_t com_gethostbyname(const com_char_t *name, com_sockaddr_t *addr) {
 	int32_t result;
+	bool cached;
+
+	cached = false;
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+	cached = com_dns_cache_get(name, addr);
+	result = COM_SOCKETS_ERR_OK;
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
 
+	if (cached == false) {
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
-	result = com_gethostbyname_ip_modem(name, addr);
+		result = com_gethostbyname_ip_modem(name, addr);
 #else
-  result = com_gethostbyname_lwip_mcu(name, addr);
+		result = com_gethostbyname_lwip_mcu(name, addr);
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+		if (result == COM_SOCKETS_ERR_OK) {
+			com_dns_cache_put(name, addr);
+		}
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+	}
 
 	return (result);
 }
@@ -335,7 +609,7 @@ int32_t com_getpeername(int32_t sock, com_sockaddr_t *name, int32_t *namelen) {
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	result = com_getpeername_ip_modem(sock, name, namelen);
 #else
-  result = com_getpeername_lwip_mcu(sock, name, namelen);
+	result = com_getpeername_lwip_mcu(sock, name, namelen);
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
 
 	return (result);
@@ -355,12 +629,34 @@ int32_t com_getsockname(int32_t sock, com_sockaddr_t *name, int32_t *namelen) {
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	result = com_getsockname_ip_modem(sock, name, namelen);
 #else
-  result = com_getsockname_lwip_mcu(sock, name, namelen);
+	result = com_getsockname_lwip_mcu(sock, name, namelen);
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
 
 	return (result);
 }
 
+#if (COM_SOCKETS_POLL == 1U)
+/**
+ * @brief  Wait for events on several sockets
+ * @note   Allows a single thread to service several sockets
+ * @param  fds       - array of poll descriptors
+ * @param  nfds      - number of entries in fds
+ * @param  timeout   - maximum time to wait (in ms) - 0: no wait, < 0: wait forever
+ * @retval int32_t   - number of entries with revents != 0, 0 if timeout or error value
+ */
+int32_t com_poll(com_pollfd_t *fds, uint32_t nfds, int32_t timeout) {
+	int32_t result;
+
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+	result = com_poll_ip_modem(fds, nfds, timeout);
+#else
+	result = com_poll_lwip_mcu(fds, nfds, timeout);
+#endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+
+	return (result);
+}
+#endif /* COM_SOCKETS_POLL == 1U */
+
 /*** Ping functionalities *****************************************************/
 
 #if (USE_COM_PING == 1)
@@ -376,7 +672,7 @@ int32_t com_ping(void) {
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	result = com_ping_ip_modem();
 #else
-  result = com_ping_lwip_mcu();
+	result = com_ping_lwip_mcu();
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
 
 	return (result);
@@ -399,7 +695,7 @@ int32_t com_ping_process(int32_t ping, const com_sockaddr_t *addr,
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	result = com_ping_process_ip_modem(ping, addr, addrlen, timeout, rsp);
 #else
-  result = com_ping_process_lwip_mcu(ping, addr, addrlen, timeout, rsp);
+	result = com_ping_process_lwip_mcu(ping, addr, addrlen, timeout, rsp);
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
 
 	return (result);
@@ -417,7 +713,7 @@ int32_t com_closeping(int32_t ping) {
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	result = com_closeping_ip_modem(ping);
 #else
-  result = com_closeping_lwip_mcu(ping);
+	result = com_closeping_lwip_mcu(ping);
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
 
 	return (result);
@@ -443,11 +739,21 @@ bool com_sockets_init(void) {
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	result = com_init_ip_modem();
 #else
-  result = com_init_lwip_mcu();
+	result = com_init_lwip_mcu();
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
 
 	com_sockets_statistic_init();
 
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+	(void) memset(com_dns_cache, 0, sizeof(com_dns_cache));
+	com_dns_cache_use_counter = 0U;
+	com_dns_cache_network_state = DC_SERVICE_UNAVAIL;
+	ComDnsCacheMutexHandle = rtosalMutexNew(NULL);
+	if (ComDnsCacheMutexHandle == NULL) {
+		result = false;
+	}
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
 	return (result);
 }
 
@@ -460,13 +766,25 @@ bool com_sockets_init(void) {
  * @retval -
  */
 void com_sockets_start(void) {
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+	dc_com_reg_id_t reg_id;
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
+
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 	com_start_ip_modem();
 #else
-  com_start_lwip_mcu();
+	com_start_lwip_mcu();
 #endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
 
 	/* no com_sockets_statistic_start(); */
+
+#if (COM_SOCKETS_DNS_CACHE == 1U)
+	/* Datacache registration to flush DNS cache on network status change */
+	reg_id = dc_com_core_register_gen_event_cb(&dc_com_db,
+			com_dns_cache_datacache_cb, (void*) NULL);
+	(void) dc_com_set_res_mask(&dc_com_db, reg_id,
+			DC_COM_RES_MASK(DC_CELLULAR_NIFMAN_INFO));
+#endif /* COM_SOCKETS_DNS_CACHE == 1U */
 }
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -36,8 +36,11 @@
 
 #include "cellular_service_os.h"
 #if (USE_LOW_POWER == 1)
-#include "cellular_service_power.h"
+#include "cellular_service_activity.h"
 #endif /* USE_LOW_POWER == 1 */
+#if (CST_EVENT_LOG == 1U)
+#include "cellular_service_evtlog.h"
+#endif /* CST_EVENT_LOG == 1U */
 
 #include "dc_common.h"
 #include "cellular_service_datacache.h"
@@ -53,15 +56,44 @@
 #define COM_MODEM_MAX_TX_DATA_SIZE CONFIG_MODEM_MAX_SOCKET_TX_DATA_SIZE
 #define COM_MODEM_MAX_RX_DATA_SIZE CONFIG_MODEM_MAX_SOCKET_RX_DATA_SIZE
 
+#if (COM_SOCKETS_TX_COALESCING == 1U)
+/* Send coalescing buffer is sent to the modem in one time */
+#define COM_TX_COALESCING_SIZE COM_MIN((uint32_t)COM_SOCKETS_TX_COALESCING_SIZE, COM_MODEM_MAX_TX_DATA_SIZE)
+#endif /* COM_SOCKETS_TX_COALESCING == 1U */
+
+/* ComSockets thread does the AT transactions requested by the timers */
+#if ((COM_SOCKETS_TX_COALESCING == 1U) || (COM_SOCKETS_TCP_POOL == 1U))
+#define COM_THREAD_ACTIVATED (1U)
+/* Requests posted by the timers to ComSockets thread: a timer can be raised again
+   before its previous request is treated */
+#define COM_THREAD_QUEUE_SIZE ((2U * CELLULAR_MAX_SOCKETS) + 2U)
+#else
+#define COM_THREAD_ACTIVATED (0U)
+#endif /* (COM_SOCKETS_TX_COALESCING == 1U) || (COM_SOCKETS_TCP_POOL == 1U) */
+
+#if (COM_SOCKETS_TCP_POOL == 1U)
+/* Pool timer restarted after this delay if its request can't be posted to ComSockets thread */
+#define COM_POOL_RETRY_DELAY 1000U /* in ms */
+#endif /* COM_SOCKETS_TCP_POOL == 1U */
+
 #define COM_SOCKET_LOCAL_ID_NB 1U /* Socket local id number : 1 for ping */
 
+/* Socket descriptor table: modem sockets (index = modem socket id) then local sockets */
+#define COM_SOCKET_DESC_NB (CELLULAR_MAX_SOCKETS + COM_SOCKET_LOCAL_ID_NB)
+
+/* Socket handle provided to the application: generation << COM_SOCKET_HANDLE_GEN_SHIFT | socket id */
+#define COM_SOCKET_HANDLE_GEN_SHIFT 8U
+#define COM_SOCKET_HANDLE_ID_MASK   0xFFU
+#define COM_SOCKET_GENERATION_MAX   0x7FU /* handle is always positive */
+
+#if (COM_SOCKETS_POLL == 1U)
+/* Maximum number of tasks waiting at the same time in com_poll: one poll per socket is enough */
+#define COM_POLL_WAITER_NB CELLULAR_MAX_SOCKETS
+#endif /* COM_SOCKETS_POLL == 1U */
+
 #define COM_LOCAL_PORT_BEGIN  0xc000U /* 49152 */
 #define COM_LOCAL_PORT_END    0xffffU /* 65535 */
 
-#if (USE_LOW_POWER == 1)
-#define COM_TIMER_INACTIVITY_MS 10000U /* in ms */
-#endif /* USE_LOW_POWER == 1 */
-
 /* Private typedef -----------------------------------------------------------*/
 typedef char CSIP_CHAR_t; /* used in stdio.h and string.h service call */
 
@@ -74,6 +106,11 @@ typedef uint16_t com_socket_msg_id_t;
 #define COM_DATA_RCV          (com_socket_msg_id_t)1      /* MSG id is DATA_RCV       */
 #define COM_CLOSING_RCV       (com_socket_msg_id_t)2      /* MSG id is CLOSING_RCV    */
 
+/* Requests treated by ComSockets thread */
+#define COM_TX_FLUSH_MSG      (com_socket_msg_type_t)3    /* MSG is send coalesced data request
+                                                             MSG id is the socket id */
+#define COM_POOL_EXPIRE_MSG   (com_socket_msg_type_t)4    /* MSG is close expired pool connections */
+
 typedef uint32_t com_socket_msg_t;
 
 /* Socket State */
@@ -86,7 +123,8 @@ typedef enum
   COM_SOCKET_SENDING,
   COM_SOCKET_WAITING_RSP,
   COM_SOCKET_WAITING_FROM,
-  COM_SOCKET_CLOSING
+  COM_SOCKET_CLOSING,
+  COM_SOCKET_POOLED      /* connected but idle, kept to be handed out by com_connect_pooled */
 } com_socket_state_t;
 
 /* Socket descriptor data structure */
@@ -106,7 +144,28 @@ typedef struct _socket_desc_t
   uint32_t              rcv_timeout; /* timeout for receive cmd */
   osMessageQId          queue;       /* message queue for URC   */
   com_ping_rsp_t        *rsp;
-  struct _socket_desc_t *next;       /* chained list            */
+  uint8_t               generation;  /* incremented at each use of the descriptor */
+#if (COM_SOCKETS_RX_READ_AHEAD == 1U)
+  uint8_t               *rx_buf;     /* data read from modem and not yet provided to application */
+  uint32_t              rx_buf_idx;  /* index of the next byte to provide */
+  uint32_t              rx_buf_len;  /* number of bytes still available */
+#endif /* COM_SOCKETS_RX_READ_AHEAD == 1U */
+#if (COM_SOCKETS_TX_COALESCING == 1U)
+  bool                  tx_coalescing; /* send coalescing activated by COM_SO_TXCOALESCE */
+  bool                  tx_error;      /* coalesced data not sent - reported at next send */
+  uint8_t               *tx_buf;       /* coalesced data not yet sent to modem */
+  uint32_t              tx_buf_len;    /* number of bytes coalesced */
+  osTimerId             tx_timer;      /* send coalesced data after COM_SOCKETS_TX_COALESCING_DELAY */
+#endif /* COM_SOCKETS_TX_COALESCING == 1U */
+#if (COM_SOCKETS_POLL == 1U)
+  bool                  rx_ready;    /* data received URC not yet consumed by a receive */
+#endif /* COM_SOCKETS_POLL == 1U */
+#if (COM_SOCKETS_TCP_POOL == 1U)
+  uint32_t              pool_tick;   /* time the connection has been put in the pool */
+#endif /* COM_SOCKETS_TCP_POOL == 1U */
+#if (USE_LOW_POWER == 1)
+  bool                  rx_activity; /* activity token held until received data are read */
+#endif /* USE_LOW_POWER == 1 */
 } socket_desc_t;
 
 typedef struct
@@ -121,16 +180,6 @@ typedef struct
   uint16_t        port;
 } socket_addr_t;
 
-#if (USE_LOW_POWER == 1)
-/* Timer State */
-typedef enum
-{
-  COM_TIMER_INVALID = 0,
-  COM_TIMER_IDLE,
-  COM_TIMER_RUN
-} com_timer_state_t;
-#endif /* USE_LOW_POWER == 1 */
-
 /* Private macros ------------------------------------------------------------*/
 
 #define COM_MIN(a,b) (((a)<(b)) ? (a) : (b))
@@ -164,37 +213,48 @@ socket_msg_t
 #define GET_SOCKET_MSG_TYPE(msg)       ((com_socket_msg_type_t)((msg)&0x0000FFFFU))
 #define GET_SOCKET_MSG_ID(msg)         ((com_socket_msg_id_t)(((msg)&0xFFFF0000U)>>16))
 
+#define SOCKET_HANDLE(socket) \
+  ((int32_t)(((uint32_t)(socket)->generation << COM_SOCKET_HANDLE_GEN_SHIFT) | (uint32_t)(socket)->id))
+
+/* Generation 0 is never used: a socket id without generation is not a valid handle */
+#define SOCKET_NEXT_GENERATION(socket) ((socket)->generation = ((socket)->generation >= COM_SOCKET_GENERATION_MAX) ? \
+                                                               1U : (uint8_t)((socket)->generation + 1U))
+
 /* Private variables ---------------------------------------------------------*/
 
-/* Mutex to protect access to :
-   socket descriptor list,
-   socket local_id array */
+/* Mutex to protect access to socket descriptor table */
 static osMutexId ComSocketsMutexHandle;
 
-static socket_desc_t *socket_desc_list; /* Socket descriptor list */
+static socket_desc_t socket_desc_table[COM_SOCKET_DESC_NB]; /* Socket descriptor table */
+
+#if (COM_SOCKETS_TX_COALESCING == 1U)
+/* Mutex to protect access to socket send coalescing buffers */
+static osMutexId ComSocketsTxMutexHandle;
+#endif /* COM_SOCKETS_TX_COALESCING == 1U */
+
+#if (COM_THREAD_ACTIVATED == 1U)
+/* Queue of the requests treated by ComSockets thread */
+static osMessageQId ComSocketsThreadQueue;
+#endif /* COM_THREAD_ACTIVATED == 1U */
+
+#if (COM_SOCKETS_POLL == 1U)
+/* Semaphore of each task waiting in com_poll: a wake up can't be consumed by another waiter */
+static osSemaphoreId ComSocketsPollSemaphore[COM_POLL_WAITER_NB];
+/* Waiter slots in use - protected by ComSocketsMutexHandle */
+static bool com_poll_waiter_used[COM_POLL_WAITER_NB];
+#endif /* COM_SOCKETS_POLL == 1U */
+
+#if (COM_SOCKETS_TCP_POOL == 1U)
+/* Timer to close the idle connections of the pool */
+static osTimerId ComSocketsPoolTimerId;
+#endif /* COM_SOCKETS_TCP_POOL == 1U */
 
-/* Provide a socket local id - Used for Ping */
-static bool socket_local_id[COM_SOCKET_LOCAL_ID_NB]; /* false : unused, true  : in use  */
 #if (USE_COM_PING == 1)
 static int32_t ping_socket_id; /* Ping socket id */
 #endif /* USE_COM_PING  == 1 */
 
 static bool com_sockets_network_is_up; /* Network status is managed through Datacache */
 
-#if (USE_LOW_POWER == 1)
-/* Timer to check inactivity on socket and maybe to go in data idle mode */
-static osTimerId ComTimerInactivityId;
-/* Timer state */
-static com_timer_state_t com_timer_inactivity_state;
-/* If com_nb_wake_up <= 1 inactivity timer can be activated */
-static uint8_t com_nb_wake_up;
-/* Mutex to protect access to :
-   com_timer_inactivity_state,
-   com_nb_wake_up
-  (several applications and datacache) */
-static osMutexId ComTimerInactivityMutexHandle;
-#endif /* USE_LOW_POWER == 1 */
-
 #if (UDP_SERVICE_SUPPORTED == 1U)
 /* Local port allocated - used when bind(local_port = 0U) */
 static uint16_t com_local_port; /* a value in [COM_LOCAL_PORT_BEGIN, COM_LOCAL_PORT_BEGIN] */
@@ -218,25 +278,79 @@ static void com_socket_datacache_cb(dc_com_event_id_t dc_event_id, const void *p
 static void com_ip_modem_ping_rsp_cb(CS_Ping_response_t ping_rsp);
 #endif /* USE_COM_PING == 1 */
 
-#if (USE_LOW_POWER == 1)
-/* Callback called When Timer Inactivity is raised */
-static void com_ip_modem_timer_inactivity_cb(void *p_argument);
-#endif /* USE_LOW_POWER == 1 */
-
 /* Initialize a socket descriptor */
 static void com_ip_modem_init_socket_desc(socket_desc_t *socket_desc);
 /* Create a socket descriptor */
-static socket_desc_t *com_ip_modem_create_socket_desc(void);
+static bool com_ip_modem_create_socket_desc(socket_desc_t *socket_desc);
 /* Provide a free socket descriptor */
-static socket_desc_t *com_ip_modem_provide_socket_desc(bool local);
+static socket_desc_t *com_ip_modem_provide_socket_desc(int32_t id, bool local);
 /* Delete a socket descriptor - in fact reinitialize it */
-static void com_ip_modem_delete_socket_desc(int32_t sock, bool local);
-/* Find a socket descriptor */
+static void com_ip_modem_delete_socket_desc(socket_desc_t *socket_desc);
+/* Find a socket descriptor from an application handle */
 static socket_desc_t *com_ip_modem_find_socket(int32_t sock, bool local);
+/* Get a socket descriptor from a socket id */
+static socket_desc_t *com_ip_modem_get_socket(int32_t id, bool local);
 
 /* Empty queue from all messages */
 static void com_ip_modem_empty_queue(osMessageQId queue);
 
+/* Socket AT transactions with latency and bytes statistics */
+static CS_Status_t com_ip_modem_at_connect(const socket_desc_t *socket_desc, CS_IPaddrType_t addr_type,
+                                           CS_CHAR_t *p_ip_addr_value, uint16_t remote_port);
+static CS_Status_t com_ip_modem_at_send(const socket_desc_t *socket_desc, const com_char_t *buf, uint32_t len);
+static int32_t com_ip_modem_at_receive(const socket_desc_t *socket_desc, com_char_t *buf, uint32_t len);
+#if (UDP_SERVICE_SUPPORTED == 1U)
+static CS_Status_t com_ip_modem_at_sendto(const socket_desc_t *socket_desc, const com_char_t *buf, uint32_t len,
+                                          CS_IPaddrType_t addr_type, CS_CHAR_t *p_ip_addr_value,
+                                          uint16_t remote_port);
+static int32_t com_ip_modem_at_receivefrom(const socket_desc_t *socket_desc, com_char_t *buf, uint32_t len,
+                                           CS_IPaddrType_t *p_addr_type, CS_CHAR_t *p_ip_addr_value,
+                                           uint16_t *p_remote_port);
+#endif /* UDP_SERVICE_SUPPORTED == 1U */
+
+/* Receive data from modem on a TCP socket */
+static int32_t com_ip_modem_receive(socket_desc_t *socket_desc, com_char_t *buf, uint32_t len);
+#if (COM_SOCKETS_RX_READ_AHEAD == 1U)
+/* Provide data already read from modem */
+static uint32_t com_ip_modem_rx_buf_read(socket_desc_t *socket_desc, com_char_t *buf, uint32_t len);
+#endif /* COM_SOCKETS_RX_READ_AHEAD == 1U */
+
+#if (COM_SOCKETS_TX_COALESCING == 1U)
+/* Activate/Deactivate send coalescing on a socket */
+static int32_t com_ip_modem_tx_coalescing(socket_desc_t *socket_desc, bool activate);
+/* Coalesce data in the socket send buffer */
+static bool com_ip_modem_tx_coalesce(socket_desc_t *socket_desc, const com_char_t *buf, uint32_t len,
+                                     int32_t *p_result);
+/* Send coalesced data to the modem */
+static int32_t com_ip_modem_tx_flush(socket_desc_t *socket_desc);
+static void com_ip_modem_tx_send_buf(socket_desc_t *socket_desc);
+/* Callback called when send coalescing timer raised */
+static void com_ip_modem_tx_timer_cb(void *p_argument);
+#endif /* COM_SOCKETS_TX_COALESCING == 1U */
+
+#if (COM_SOCKETS_POLL == 1U)
+/* Poll management */
+static void com_ip_modem_poll_notify(void);
+static int16_t com_ip_modem_poll_events(const socket_desc_t *socket_desc, int16_t events);
+static int32_t com_ip_modem_poll_scan(com_pollfd_t *fds, uint32_t nfds);
+#endif /* COM_SOCKETS_POLL == 1U */
+
+#if (COM_SOCKETS_TCP_POOL == 1U)
+/* Connection pool management */
+static socket_desc_t *com_ip_modem_pool_get(const com_ip_addr_t *remote_addr, uint16_t remote_port);
+static bool com_ip_modem_pool_put(socket_desc_t *socket_desc);
+static bool com_ip_modem_pool_is_healthy(const socket_desc_t *socket_desc);
+static void com_ip_modem_pool_close(socket_desc_t *socket_desc);
+static void com_ip_modem_pool_expire(void);
+/* Callback called when the pool timer expires */
+static void com_ip_modem_pool_timer_cb(void *p_argument);
+#endif /* COM_SOCKETS_TCP_POOL == 1U */
+
+#if (COM_THREAD_ACTIVATED == 1U)
+/* ComSockets thread: AT transactions requested by the timers */
+static void com_ip_modem_thread(void *p_argument);
+#endif /* COM_THREAD_ACTIVATED == 1U */
+
 /* Conversion IP address functions */
 static bool com_translate_ip_address(const com_sockaddr_t *addr,
                                      int32_t              addrlen,
@@ -260,11 +374,22 @@ static uint16_t com_ip_modem_new_local_port(void);
 
 /* Establish a UDP service (sendto/recvfrom) socket */
 static int32_t com_ip_modem_connect_udp_service(socket_desc_t *socket_desc);
+
+/* Send data on a UDP service socket */
+static int32_t com_ip_modem_sendto_addr(const socket_desc_t *socket_desc,
+                                        const com_sockaddr_t *to, int32_t tolen,
+                                        socket_addr_t *socket_addr);
+static int32_t com_ip_modem_sendto_data(socket_desc_t *socket_desc,
+                                        const com_char_t *buf, int32_t len,
+                                        int32_t flags,
+                                        socket_addr_t *socket_addr);
 #endif /* UDP_SERVICE_SUPPORTED == 1U */
 
 /* Request low power */
 static void com_ip_modem_wakeup_request(void);
 static void com_ip_modem_idlemode_request(bool immediate);
+/* Release the activity token held while received data are not read */
+static void com_ip_modem_rx_activity_release(socket_desc_t *socket_desc);
 #if (USE_LOW_POWER == 1)
 static bool com_ip_modem_are_all_sockets_invalid(void);
 #endif /* USE_LOW_POWER == 1U */
@@ -290,262 +415,1054 @@ static void com_ip_modem_init_socket_desc(socket_desc_t *socket_desc)
   socket_desc->rcv_timeout      = RTOSAL_WAIT_FOREVER;
   socket_desc->snd_timeout      = RTOSAL_WAIT_FOREVER;
   socket_desc->error            = COM_SOCKETS_ERR_OK;
-  /* socket_desc->next is not re-initialize - element is let in the list at its place */
+#if (COM_SOCKETS_RX_READ_AHEAD == 1U)
+  socket_desc->rx_buf_idx       = 0U;
+  socket_desc->rx_buf_len       = 0U;
+  if (socket_desc->rx_buf != NULL)
+  {
+    /* Buffer is only kept while the socket is used */
+    vPortFree(socket_desc->rx_buf);
+    socket_desc->rx_buf = NULL;
+  }
+#endif /* COM_SOCKETS_RX_READ_AHEAD == 1U */
+#if (COM_SOCKETS_TX_COALESCING == 1U)
+  socket_desc->tx_coalescing    = false;
+  socket_desc->tx_error         = false;
+  socket_desc->tx_buf_len       = 0U;
+  /* socket_desc->tx_buf and socket_desc->tx_timer are not re-initialize - they are reused */
+#endif /* COM_SOCKETS_TX_COALESCING == 1U */
+#if (COM_SOCKETS_POLL == 1U)
+  socket_desc->rx_ready         = false;
+#endif /* COM_SOCKETS_POLL == 1U */
+  com_ip_modem_rx_activity_release(socket_desc);
+  /* socket_desc->generation is not re-initialize - it is incremented at next use */
   /* socket_desc->queue is not re-initialize - queue is reused */
 }
 
 /**
   * @brief  Create a socket descriptor
-  * @note   Allocate a new socket_desc_t and its queue
+  * @note   Allocate the queue of a socket descriptor of the table
   *         and initialize the socket to default value
-  * @param  -
-  * @retval socket_desc_t or NULL (if not enough memory)
+  * @param  socket_desc - socket descriptor to create
+  * @retval bool        - true/false creation ok/nok (not enough memory)
+  */
+static bool com_ip_modem_create_socket_desc(socket_desc_t *socket_desc)
+{
+  bool result;
+
+  socket_desc->queue = rtosalMessageQueueNew(NULL, 4U);
+  socket_desc->generation = 0U;
+#if (COM_SOCKETS_RX_READ_AHEAD == 1U)
+  /* Allocated at first read-ahead on a stream socket */
+  socket_desc->rx_buf = NULL;
+#endif /* COM_SOCKETS_RX_READ_AHEAD == 1U */
+#if (COM_SOCKETS_TX_COALESCING == 1U)
+  /* Allocated only when send coalescing is activated on the socket */
+  socket_desc->tx_buf = NULL;
+  socket_desc->tx_timer = NULL;
+#endif /* COM_SOCKETS_TX_COALESCING == 1U */
+  com_ip_modem_init_socket_desc(socket_desc);
+
+  result = (socket_desc->queue != NULL) ? true : false;
+
+  return result;
+}
+
+/**
+  * @brief  Provide a socket descriptor
+  * @note   Network socket: the descriptor is the one of the modem socket id
+  *         Local socket: the first free local descriptor is provided
+  *         Generation of the descriptor is incremented to invalidate handles of its previous use
+  * @param  id
+  * @note   modem socket id (unused if socket is local)
+  * @param  local
+  * @note   true/false socket is local (used for Ping) / network one
+  * @retval socket_desc_t or NULL (if no descriptor available)
   */
-static socket_desc_t *com_ip_modem_create_socket_desc(void)
+static socket_desc_t *com_ip_modem_provide_socket_desc(int32_t id, bool local)
 {
+  uint8_t i;
   socket_desc_t *socket_desc;
 
-  socket_desc = (socket_desc_t *)pvPortMalloc(sizeof(socket_desc_t));
-  if (socket_desc != NULL)
+  socket_desc = NULL;
+
+  (void)rtosalMutexAcquire(ComSocketsMutexHandle, RTOSAL_WAIT_FOREVER);
+
+  if (local == true)
   {
-    socket_desc->queue = rtosalMessageQueueNew(NULL, 4U);
-    if (socket_desc->queue == NULL)
+    /* Search an unused local id */
+    for (i = 0U; (i < COM_SOCKET_LOCAL_ID_NB) && (socket_desc == NULL); i++)
     {
-      /* Not enough memory - Deallocate socket_desc */
-      vPortFree(socket_desc);
-      socket_desc = NULL;
+      if (socket_desc_table[CELLULAR_MAX_SOCKETS + i].state == COM_SOCKET_INVALID)
+      {
+        socket_desc = &socket_desc_table[CELLULAR_MAX_SOCKETS + i];
+        /* Don't need an OFFSET to not overlap Modem id: local is also checked */
+        socket_desc->id = (int32_t)i;
+      }
     }
-    else
+  }
+  else if ((id >= 0) && (id < (int32_t)CELLULAR_MAX_SOCKETS))
+  {
+    if (socket_desc_table[id].state == COM_SOCKET_INVALID)
     {
-      socket_desc->next = NULL;
-      com_ip_modem_init_socket_desc(socket_desc);
+      socket_desc = &socket_desc_table[id];
+      socket_desc->id = id;
     }
   }
+  else
+  {
+    /* Modem socket id out of the table */
+  }
+
+  if (socket_desc != NULL)
+  {
+    socket_desc->state = COM_SOCKET_CREATING;
+    socket_desc->local = local;
+    SOCKET_NEXT_GENERATION(socket_desc);
+    PRINT_DBG("socket desc provided %ld queue %p", socket_desc->id, socket_desc->queue)
+  }
 
+  (void)rtosalMutexRelease(ComSocketsMutexHandle);
+
+  /* If provide == false then socket_desc = NULL */
   return socket_desc;
 }
 
 /**
-  * @brief  Provide a socket descriptor
-  * @note   Search the first empty place in the chained socket list
-  *         or create a new socket and add it at the end of the chained list
-  * @param  local
-  * @note   true/false socket is local (used for Ping) / network one
-  * @retval socket_desc_t or NULL (if not enough memory)
+  * @brief  Delete a socket descriptor
+  * @note   Reinitialize the socket descriptor to unused
+  * @param  socket_desc - socket descriptor to delete
+  * @retval -
   */
-static socket_desc_t *com_ip_modem_provide_socket_desc(bool local)
+static void com_ip_modem_delete_socket_desc(socket_desc_t *socket_desc)
 {
-  /* Chained list will be changed */
   (void)rtosalMutexAcquire(ComSocketsMutexHandle, RTOSAL_WAIT_FOREVER);
 
-  bool found;
-  uint8_t i;
+  /* Descriptor is kept in the table, its generation is kept to detect stale handles */
+  com_ip_modem_init_socket_desc(socket_desc);
+
+  (void)rtosalMutexRelease(ComSocketsMutexHandle);
+
+#if (COM_SOCKETS_POLL == 1U)
+  /* Handle is no more valid */
+  com_ip_modem_poll_notify();
+#endif /* COM_SOCKETS_POLL == 1U */
+}
+
+/**
+  * @brief  Find a socket descriptor
+  * @note   Access directly the socket descriptor table
+  * @param  sock
+  * @note   socket handle provided to the application (generation and socket id)
+  * @param  local
+  * @note   true/false
+  * @retval socket_desc_t or NULL (unknown or stale handle)
+  */
+static socket_desc_t *com_ip_modem_find_socket(int32_t sock, bool local)
+{
   socket_desc_t *socket_desc;
-  socket_desc_t *socket_desc_previous;
 
-  i = 0U;
-  found = false;
-  socket_desc = socket_desc_list;
+  if (sock >= 0)
+  {
+    socket_desc = com_ip_modem_get_socket((int32_t)((uint32_t)sock & COM_SOCKET_HANDLE_ID_MASK), local);
 
-  /* If socket is local first check an id is still available in the table */
-  if (local == true)
+    if ((socket_desc != NULL)
+        && (((uint32_t)sock >> COM_SOCKET_HANDLE_GEN_SHIFT) != (uint32_t)socket_desc->generation))
+    {
+      /* Handle of a previous use of the descriptor */
+      socket_desc = NULL;
+    }
+  }
+  else
+  {
+    socket_desc = NULL;
+  }
+
+  return socket_desc;
+}
+
+/**
+  * @brief  Get a socket descriptor
+  * @note   Access directly the socket descriptor table
+  * @param  id
+  * @note   socket id (modem socket id or local id)
+  * @param  local
+  * @note   true/false
+  * @retval socket_desc_t or NULL (socket id not used)
+  */
+static socket_desc_t *com_ip_modem_get_socket(int32_t id, bool local)
+{
+  uint32_t index;
+  socket_desc_t *socket_desc;
+
+  socket_desc = NULL;
+
+  /* Local descriptors are after the modem descriptors in the table */
+  if ((local == true) && (id >= 0) && (id < (int32_t)COM_SOCKET_LOCAL_ID_NB))
   {
-    while ((i < COM_SOCKET_LOCAL_ID_NB) && (found == false))
+    index = CELLULAR_MAX_SOCKETS + (uint32_t)id;
+  }
+  else if ((local == false) && (id >= 0) && (id < (int32_t)CELLULAR_MAX_SOCKETS))
+  {
+    index = (uint32_t)id;
+  }
+  else
+  {
+    index = COM_SOCKET_DESC_NB;
+  }
+
+  if ((index < COM_SOCKET_DESC_NB)
+      && (socket_desc_table[index].state != COM_SOCKET_INVALID)
+      && (socket_desc_table[index].id == id))
+  {
+    socket_desc = &socket_desc_table[index];
+  }
+
+  return socket_desc;
+}
+
+/**
+  * @brief  Empty queue from potential messages
+  * @param  queue - queue to empty
+  * @retval -
+  */
+static void com_ip_modem_empty_queue(osMessageQId queue)
+{
+  uint32_t msg_queue;
+
+  do
+  {
+    msg_queue = 0U;
+    (void)rtosalMessageQueueGet(queue, &msg_queue, 0U);
+    if (msg_queue != 0U)
     {
-      if (socket_local_id[i] == false)
+      /* Message available in the queue */
+      PRINT_DBG("rcv cleanup MSGqueue")
+    }
+  } while (msg_queue != 0U);
+}
+
+/**
+  * @brief  Connect a socket at modem level
+  * @note   AT round trip is added to the statistics
+  * @param  socket_desc     - socket descriptor
+  * @param  addr_type       - remote address type
+  * @param  p_ip_addr_value - remote address
+  * @param  remote_port     - remote port
+  * @retval CS_Status_t     - CELLULAR_OK or error value
+  */
+static CS_Status_t com_ip_modem_at_connect(const socket_desc_t *socket_desc, CS_IPaddrType_t addr_type,
+                                           CS_CHAR_t *p_ip_addr_value, uint16_t remote_port)
+{
+  CS_Status_t status;
+  uint32_t lat_tick;
+
+  lat_tick = HAL_GetTick();
+  status = osCDS_socket_connect(socket_desc->id, addr_type, p_ip_addr_value, remote_port);
+  com_sockets_statistic_latency(COM_SOCKET_STAT_LAT_CNT, lat_tick);
+
+  return status;
+}
+
+/**
+  * @brief  Send data at modem level
+  * @note   AT round trip and bytes sent are added to the statistics
+  * @param  socket_desc - socket descriptor
+  * @param  buf         - data to send
+  * @param  len         - data length
+  * @retval CS_Status_t - CELLULAR_OK or error value
+  */
+static CS_Status_t com_ip_modem_at_send(const socket_desc_t *socket_desc, const com_char_t *buf, uint32_t len)
+{
+  CS_Status_t status;
+  uint32_t lat_tick;
+
+  lat_tick = HAL_GetTick();
+  status = osCDS_socket_send(socket_desc->id, buf, len);
+  com_sockets_statistic_latency(COM_SOCKET_STAT_LAT_SND, lat_tick);
+  if (status == CELLULAR_OK)
+  {
+    com_sockets_statistic_bytes(socket_desc->id, len, 0U);
+#if (CST_EVENT_LOG == 1U)
+    CSE_DataNotify(CSE_DATA_SEND, len);
+#endif /* CST_EVENT_LOG == 1U */
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Receive data at modem level
+  * @note   AT round trip and bytes received are added to the statistics
+  * @param  socket_desc - socket descriptor
+  * @param  buf         - buffer to fill
+  * @param  len         - buffer length
+  * @retval int32_t     - number of bytes received or error value (< 0)
+  */
+static int32_t com_ip_modem_at_receive(const socket_desc_t *socket_desc, com_char_t *buf, uint32_t len)
+{
+  int32_t len_rcv;
+  uint32_t lat_tick;
+
+  lat_tick = HAL_GetTick();
+  len_rcv = osCDS_socket_receive(socket_desc->id, buf, len);
+  com_sockets_statistic_latency(COM_SOCKET_STAT_LAT_RCV, lat_tick);
+  if (len_rcv > 0)
+  {
+    com_sockets_statistic_bytes(socket_desc->id, 0U, (uint32_t)len_rcv);
+#if (CST_EVENT_LOG == 1U)
+    CSE_DataNotify(CSE_DATA_RECEIVE, (uint32_t)len_rcv);
+#endif /* CST_EVENT_LOG == 1U */
+  }
+
+  return len_rcv;
+}
+
+#if (UDP_SERVICE_SUPPORTED == 1U)
+/**
+  * @brief  Send data to a remote at modem level
+  * @note   AT round trip and bytes sent are added to the statistics
+  * @param  socket_desc     - socket descriptor
+  * @param  buf             - data to send
+  * @param  len             - data length
+  * @param  addr_type       - remote address type
+  * @param  p_ip_addr_value - remote address
+  * @param  remote_port     - remote port
+  * @retval CS_Status_t     - CELLULAR_OK or error value
+  */
+static CS_Status_t com_ip_modem_at_sendto(const socket_desc_t *socket_desc, const com_char_t *buf, uint32_t len,
+                                          CS_IPaddrType_t addr_type, CS_CHAR_t *p_ip_addr_value,
+                                          uint16_t remote_port)
+{
+  CS_Status_t status;
+  uint32_t lat_tick;
+
+  lat_tick = HAL_GetTick();
+  status = osCDS_socket_sendto(socket_desc->id, buf, len, addr_type, p_ip_addr_value, remote_port);
+  com_sockets_statistic_latency(COM_SOCKET_STAT_LAT_SND, lat_tick);
+  if (status == CELLULAR_OK)
+  {
+    com_sockets_statistic_bytes(socket_desc->id, len, 0U);
+#if (CST_EVENT_LOG == 1U)
+    CSE_DataNotify(CSE_DATA_SEND, len);
+#endif /* CST_EVENT_LOG == 1U */
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Receive data and remote address at modem level
+  * @note   AT round trip and bytes received are added to the statistics
+  * @param  socket_desc     - socket descriptor
+  * @param  buf             - buffer to fill
+  * @param  len             - buffer length
+  * @param  p_addr_type     - remote address type
+  * @param  p_ip_addr_value - remote address
+  * @param  p_remote_port   - remote port
+  * @retval int32_t         - number of bytes received or error value (< 0)
+  */
+static int32_t com_ip_modem_at_receivefrom(const socket_desc_t *socket_desc, com_char_t *buf, uint32_t len,
+                                           CS_IPaddrType_t *p_addr_type, CS_CHAR_t *p_ip_addr_value,
+                                           uint16_t *p_remote_port)
+{
+  int32_t len_rcv;
+  uint32_t lat_tick;
+
+  lat_tick = HAL_GetTick();
+  len_rcv = osCDS_socket_receivefrom(socket_desc->id, buf, len, p_addr_type, p_ip_addr_value, p_remote_port);
+  com_sockets_statistic_latency(COM_SOCKET_STAT_LAT_RCV, lat_tick);
+  if (len_rcv > 0)
+  {
+    com_sockets_statistic_bytes(socket_desc->id, 0U, (uint32_t)len_rcv);
+#if (CST_EVENT_LOG == 1U)
+    CSE_DataNotify(CSE_DATA_RECEIVE, (uint32_t)len_rcv);
+#endif /* CST_EVENT_LOG == 1U */
+  }
+
+  return len_rcv;
+}
+
+#endif /* UDP_SERVICE_SUPPORTED == 1U */
+
+/**
+  * @brief  Receive data from modem on a TCP socket
+  * @note   If read-ahead is activated and application buffer is smaller than
+  *         the maximum data the modem can provide, the maximum is read in the socket
+  *         receive buffer and next com_recv calls are served from it
+  *         The receive buffer is allocated at first read-ahead and freed when the socket is closed,
+  *         if it can't be allocated data are read directly in application buffer
+  * @param  socket_desc - socket descriptor
+  * @param  buf         - application buffer
+  * @param  len         - application buffer length
+  * @retval int32_t     - number of bytes provided to application or error value (< 0)
+  */
+static int32_t com_ip_modem_receive(socket_desc_t *socket_desc, com_char_t *buf, uint32_t len)
+{
+  int32_t len_rcv;
+
+#if (COM_SOCKETS_RX_READ_AHEAD == 1U)
+  if ((len < COM_MODEM_MAX_RX_DATA_SIZE) && (socket_desc->rx_buf == NULL))
+  {
+    socket_desc->rx_buf = (uint8_t *)pvPortMalloc(COM_MODEM_MAX_RX_DATA_SIZE);
+  }
+  if ((len < COM_MODEM_MAX_RX_DATA_SIZE) && (socket_desc->rx_buf != NULL))
+  {
+    /* Read the maximum allowed by the modem in the receive buffer */
+    len_rcv = com_ip_modem_at_receive(socket_desc,
+                                      socket_desc->rx_buf, COM_MODEM_MAX_RX_DATA_SIZE);
+#if (COM_SOCKETS_POLL == 1U)
+    /* Receive buffer full: modem may have more data */
+    if (len_rcv == (int32_t)COM_MODEM_MAX_RX_DATA_SIZE)
+    {
+      socket_desc->rx_ready = true;
+    }
+#endif /* COM_SOCKETS_POLL == 1U */
+    if (len_rcv > 0)
+    {
+      socket_desc->rx_buf_idx = 0U;
+      socket_desc->rx_buf_len = (uint32_t)len_rcv;
+      len_rcv = (int32_t)com_ip_modem_rx_buf_read(socket_desc, buf, len);
+    }
+  }
+  else
+#endif /* COM_SOCKETS_RX_READ_AHEAD == 1U */
+  {
+    /* Read directly in application buffer */
+    len_rcv = com_ip_modem_at_receive(socket_desc,
+                                      buf, COM_MIN(len, COM_MODEM_MAX_RX_DATA_SIZE));
+#if (COM_SOCKETS_POLL == 1U)
+    /* Application buffer full: modem may have more data */
+    if (len_rcv == (int32_t)COM_MIN(len, COM_MODEM_MAX_RX_DATA_SIZE))
+    {
+      socket_desc->rx_ready = true;
+    }
+#endif /* COM_SOCKETS_POLL == 1U */
+  }
+
+  return len_rcv;
+}
+
+#if (COM_SOCKETS_RX_READ_AHEAD == 1U)
+/**
+  * @brief  Provide data already read from modem
+  * @param  socket_desc - socket descriptor
+  * @param  buf         - application buffer
+  * @param  len         - application buffer length
+  * @retval uint32_t    - number of bytes provided to application
+  */
+static uint32_t com_ip_modem_rx_buf_read(socket_desc_t *socket_desc, com_char_t *buf, uint32_t len)
+{
+  uint32_t length_read;
+
+  length_read = COM_MIN(len, socket_desc->rx_buf_len);
+  (void)memcpy((void *)buf, (const void *)&socket_desc->rx_buf[socket_desc->rx_buf_idx], length_read);
+  socket_desc->rx_buf_idx += length_read;
+  socket_desc->rx_buf_len -= length_read;
+
+  return length_read;
+}
+#endif /* COM_SOCKETS_RX_READ_AHEAD == 1U */
+
+#if (COM_SOCKETS_TX_COALESCING == 1U)
+/**
+  * @brief  Activate/Deactivate send coalescing on a socket
+  * @note   Send buffer and timer are allocated at first activation and reused with the socket descriptor
+  *         Deactivation sends the coalesced data
+  * @param  socket_desc - socket descriptor
+  * @param  activate    - true/false activate/deactivate send coalescing
+  * @retval int32_t     - ok or error value
+  */
+static int32_t com_ip_modem_tx_coalescing(socket_desc_t *socket_desc, bool activate)
+{
+  int32_t result;
+
+  result = COM_SOCKETS_ERR_OK;
+
+  if (activate == true)
+  {
+    if (socket_desc->type != (uint8_t)COM_SOCK_STREAM)
+    {
+      /* Datagram boundaries must be kept */
+      result = COM_SOCKETS_ERR_UNSUPPORTED;
+    }
+    else
+    {
+      if (socket_desc->tx_buf == NULL)
+      {
+        socket_desc->tx_buf = (uint8_t *)pvPortMalloc(COM_TX_COALESCING_SIZE);
+      }
+      if (socket_desc->tx_timer == NULL)
       {
-        found = true; /* an unused local id has been found */
-        /* com_socket_local_id book is done only if socket is really created */
+        socket_desc->tx_timer = rtosalTimerNew(NULL, (os_ptimer)com_ip_modem_tx_timer_cb, osTimerOnce,
+                                               (void *)socket_desc);
+      }
+      if ((socket_desc->tx_buf == NULL) || (socket_desc->tx_timer == NULL))
+      {
+        /* Not enough memory - buffer or timer reused at next activation */
+        result = COM_SOCKETS_ERR_NOMEMORY;
       }
       else
       {
-        i++;
+        socket_desc->tx_coalescing = true;
       }
     }
   }
   else
   {
-    found = true; /* if local == false no specific treatment to do */
+    if (socket_desc->tx_coalescing == true)
+    {
+      result = com_ip_modem_tx_flush(socket_desc);
+      socket_desc->tx_coalescing = false;
+    }
+  }
+
+  return result;
+}
+
+/**
+  * @brief  Coalesce data in the socket send buffer
+  * @note   Buffer is sent when it is full
+  *         Timer is started at first data coalesced in the buffer
+  * @param  socket_desc - socket descriptor
+  * @param  buf         - application data to send
+  * @param  len         - application data length
+  * @param  p_result    - number of bytes accepted or error value
+  * @retval bool        - true : data treated (p_result updated)
+  *                       false: data too big to be coalesced, coalesced data already sent
+  *                              application data must be sent directly
+  */
+static bool com_ip_modem_tx_coalesce(socket_desc_t *socket_desc, const com_char_t *buf, uint32_t len,
+                                     int32_t *p_result)
+{
+  bool result;
+
+  result = true;
+
+  (void)rtosalMutexAcquire(ComSocketsTxMutexHandle, RTOSAL_WAIT_FOREVER);
+
+  /* Not enough place for new data: send coalesced data first to keep data order */
+  if ((socket_desc->tx_buf_len + len) > COM_TX_COALESCING_SIZE)
+  {
+    com_ip_modem_tx_send_buf(socket_desc);
   }
 
-  if ((found == true) && (i < COM_SOCKET_LOCAL_ID_NB))
+  if (socket_desc->tx_error == true)
   {
-    /* Need to create a new socket_desc ? */
-    while ((socket_desc->state != COM_SOCKET_INVALID)
-           && (socket_desc->next != NULL))
+    /* Previous coalesced data not sent */
+    socket_desc->tx_error = false;
+    *p_result = COM_SOCKETS_ERR_GENERAL;
+  }
+  else if (len < COM_TX_COALESCING_SIZE)
+  {
+    (void)memcpy((void *)&socket_desc->tx_buf[socket_desc->tx_buf_len], (const void *)buf, len);
+    socket_desc->tx_buf_len += len;
+    *p_result = (int32_t)len;
+    com_sockets_statistic_update(COM_SOCKET_STAT_SND_COALESCED);
+
+    if (socket_desc->tx_buf_len == COM_TX_COALESCING_SIZE)
     {
-      socket_desc = socket_desc->next; /* Check next descriptor */
+      /* Buffer full */
+      com_ip_modem_tx_send_buf(socket_desc);
     }
-    /* Find an empty socket ? */
-    if (socket_desc->state != COM_SOCKET_INVALID)
+    else if (socket_desc->tx_buf_len == len)
     {
-      /* No empty socket, save the last socket descriptor to attach the new one */
-      socket_desc_previous = socket_desc;
-      /* Create new socket descriptor */
-      socket_desc = com_ip_modem_create_socket_desc();
-      if (socket_desc != NULL)
-      {
-        PRINT_DBG("socket desc created %ld queue %p", socket_desc->id, socket_desc->queue)
-        /* Before to attach this new socket to the descriptor list finalize its initialization */
-        socket_desc->state = COM_SOCKET_CREATING;
-        socket_desc->local = local;
-        if (local == true)
-        {
-          /* even if an application create two sockets one local - one distant
-             no issue if id is same because it will be stored
-             in two variables at application level */
-          /* Don't need an OFFSET to not overlap Modem id */
-          socket_desc->id = (int32_t)i;
-          /*  Socket is really created - book com_socket_local_id */
-          socket_local_id[i] = true;
-        }
-        /* Initialization is finalized, socket can be attached to the list
-           and so visible to other functions
-           even the one accessing in read mode to socket descriptor list */
-        socket_desc_previous->next = socket_desc;
-      }
+      /* First data in the buffer */
+      (void)rtosalTimerStart(socket_desc->tx_timer, COM_SOCKETS_TX_COALESCING_DELAY);
     }
     else
     {
-      /* Find an empty place */
-      socket_desc->state = COM_SOCKET_CREATING;
-      socket_desc->local = local;
-      if (local == true)
+      /* Timer already started */
+    }
+  }
+  else
+  {
+    /* Buffer is empty: application data are sent directly */
+    result = false;
+  }
+
+  (void)rtosalMutexRelease(ComSocketsTxMutexHandle);
+
+  return result;
+}
+
+/**
+  * @brief  Send coalesced data to the modem
+  * @note   Used on COM_SO_TXFLUSH request, before a receive and before a close
+  * @param  socket_desc - socket descriptor
+  * @retval int32_t     - ok or error value (coalesced data not sent)
+  */
+static int32_t com_ip_modem_tx_flush(socket_desc_t *socket_desc)
+{
+  int32_t result;
+
+  result = COM_SOCKETS_ERR_OK;
+
+  (void)rtosalMutexAcquire(ComSocketsTxMutexHandle, RTOSAL_WAIT_FOREVER);
+
+  com_ip_modem_tx_send_buf(socket_desc);
+  if (socket_desc->tx_error == true)
+  {
+    socket_desc->tx_error = false;
+    result = COM_SOCKETS_ERR_GENERAL;
+  }
+
+  (void)rtosalMutexRelease(ComSocketsTxMutexHandle);
+
+  return result;
+}
+
+/**
+  * @brief  Send the socket send buffer to the modem
+  * @note   ComSocketsTxMutexHandle must be acquired by the caller
+  *         If data can't be sent they are lost and tx_error is set
+  * @param  socket_desc - socket descriptor
+  * @retval -
+  */
+static void com_ip_modem_tx_send_buf(socket_desc_t *socket_desc)
+{
+  if (socket_desc->tx_buf_len != 0U)
+  {
+    (void)rtosalTimerStop(socket_desc->tx_timer);
+
+    if ((socket_desc->closing == false)
+        && (com_ip_modem_is_network_up() == true))
+    {
+      com_ip_modem_wakeup_request();
+      if (com_ip_modem_at_send(socket_desc,
+                               socket_desc->tx_buf, socket_desc->tx_buf_len)
+          == CELLULAR_OK)
       {
-        /* even if an application create two sockets one local - one distant
-           no issue if id is same because it will be stored
-           in two variable s at application level */
-        /* Don't need an OFFSET to not overlap Modem id */
-        socket_desc->id = (int32_t)i;
-        /*  Socket is really created - book com_socket_local_id */
-        socket_local_id[i] = true;
+        PRINT_INFO("snd coalesced data ok")
+      }
+      else
+      {
+        socket_desc->tx_error = true;
+        PRINT_ERR("snd coalesced data NOK at low level")
       }
+      com_ip_modem_idlemode_request(false);
     }
+    else
+    {
+      socket_desc->tx_error = true;
+      PRINT_ERR("snd coalesced data NOK socket closing or no network")
+    }
+    socket_desc->tx_buf_len = 0U;
+    com_sockets_statistic_update(COM_SOCKET_STAT_SND_FLUSH);
   }
+}
 
-  (void)rtosalMutexRelease(ComSocketsMutexHandle);
+/**
+  * @brief  Callback called when send coalescing timer raised
+  * @note   Runs in the RTOS timer thread: must not wait for an AT transaction
+  *         the coalesced data are sent by ComSockets thread
+  * @param  p_argument - socket descriptor
+  * @retval -
+  */
+static void com_ip_modem_tx_timer_cb(void *p_argument)
+{
+  const socket_desc_t *socket_desc;
+  com_socket_msg_t msg_queue;
 
-  /* If provide == false then socket_desc = NULL */
-  return socket_desc;
+  socket_desc = (const socket_desc_t *)p_argument;
+  msg_queue = 0U;
+
+  SET_SOCKET_MSG_TYPE(msg_queue, COM_TX_FLUSH_MSG);
+  SET_SOCKET_MSG_ID(msg_queue, (uint32_t)socket_desc->id);
+  if (rtosalMessageQueuePut(ComSocketsThreadQueue, msg_queue, 0U) != osOK)
+  {
+    /* Coalesced data sent at next socket send, receive, flush or close */
+    PRINT_ERR("snd coalesced data request NOK queue full")
+  }
 }
+#endif /* COM_SOCKETS_TX_COALESCING == 1U */
 
+#if (COM_SOCKETS_POLL == 1U)
 /**
-  * @brief  Delete a socket descriptor
-  * @note   Search the socket descriptor and reinitialze it to unused
-  * @param  sock
-  * @note   socket id
-  * @param  local
-  * @note   true/false
+  * @brief  Wake up the tasks waiting in com_poll
+  * @note   Each woken task scans again its sockets
+  * @param  -
   * @retval -
   */
-static void com_ip_modem_delete_socket_desc(int32_t sock, bool local)
+static void com_ip_modem_poll_notify(void)
 {
-  /* Chained list will be changed */
-  (void)rtosalMutexAcquire(ComSocketsMutexHandle, RTOSAL_WAIT_FOREVER);
+  uint8_t i;
 
-  bool found;
-  socket_desc_t *socket_desc;
+  (void)rtosalMutexAcquire(ComSocketsMutexHandle, RTOSAL_WAIT_FOREVER);
+  for (i = 0U; i < COM_POLL_WAITER_NB; i++)
+  {
+    if (com_poll_waiter_used[i] == true)
+    {
+      /* If semaphore is already released, the task is already going to scan its sockets */
+      (void)rtosalSemaphoreRelease(ComSocketsPollSemaphore[i]);
+    }
+  }
+  (void)rtosalMutexRelease(ComSocketsMutexHandle);
+}
 
-  found = false;
+/**
+  * @brief  Compute the events ready on a socket
+  * @param  socket_desc - socket descriptor (NULL if handle is invalid)
+  * @param  events      - events requested by the application
+  * @retval int16_t     - events ready
+  */
+static int16_t com_ip_modem_poll_events(const socket_desc_t *socket_desc, int16_t events)
+{
+  uint16_t revents;
 
-  socket_desc = socket_desc_list;
+  revents = 0U;
 
-  /* Search the socket descriptor */
-  while ((socket_desc != NULL)
-         && (found != true))
+  if (socket_desc == NULL)
   {
-    if ((socket_desc->id == sock)
-        && (socket_desc->local == local))
+    revents = (uint16_t)COM_POLLNVAL;
+  }
+  else
+  {
+    if (socket_desc->closing == true)
     {
-      /* Socket descriptor is found */
-      found = true;
+      revents |= (uint16_t)COM_POLLHUP;
     }
-    else
+    if (((socket_desc->state >= COM_SOCKET_CONNECTED) && (com_ip_modem_is_network_up() == false))
+        || (socket_desc->error == COM_SOCKETS_ERR_GENERAL)
+        || (socket_desc->error == COM_SOCKETS_ERR_NONETWORK)
+#if (COM_SOCKETS_TX_COALESCING == 1U)
+        || (socket_desc->tx_error == true)
+#endif /* COM_SOCKETS_TX_COALESCING == 1U */
+       )
+    {
+      revents |= (uint16_t)COM_POLLERR;
+    }
+    if ((((uint16_t)events & (uint16_t)COM_POLLIN) != 0U)
+        && ((socket_desc->state == COM_SOCKET_CONNECTED) || (socket_desc->state == COM_SOCKET_CLOSING))
+        && ((socket_desc->rx_ready == true)
+#if (COM_SOCKETS_RX_READ_AHEAD == 1U)
+            || (socket_desc->rx_buf_len != 0U)
+#endif /* COM_SOCKETS_RX_READ_AHEAD == 1U */
+           ))
+    {
+      revents |= (uint16_t)COM_POLLIN;
+    }
+    if ((((uint16_t)events & (uint16_t)COM_POLLOUT) != 0U)
+        && (socket_desc->closing == false)
+        && ((socket_desc->state == COM_SOCKET_CONNECTED)
+            || ((socket_desc->state == COM_SOCKET_CREATED) && (socket_desc->type == (uint8_t)COM_SOCK_DGRAM))))
     {
-      /* Not the searched one ... Next */
-      socket_desc = socket_desc->next;
+      revents |= (uint16_t)COM_POLLOUT;
     }
   }
-  if (found == true)
+
+  return (int16_t)revents;
+}
+
+/**
+  * @brief  Update the events ready on the poll descriptors
+  * @param  fds     - array of poll descriptors
+  * @param  nfds    - number of entries in fds
+  * @retval int32_t - number of entries with events ready
+  */
+static int32_t com_ip_modem_poll_scan(com_pollfd_t *fds, uint32_t nfds)
+{
+  int32_t nb_ready;
+  uint32_t i;
+
+  nb_ready = 0;
+
+  for (i = 0U; i < nfds; i++)
   {
-    /* Always keep a created socket */
-    com_ip_modem_init_socket_desc(socket_desc);
-    if (local == true)
+    if (fds[i].fd < 0)
+    {
+      /* Entry ignored */
+      fds[i].revents = 0;
+    }
+    else
     {
-      /* Free com_socket_local_id */
-      socket_local_id[sock] = false;
+      fds[i].revents = com_ip_modem_poll_events(com_ip_modem_find_socket(fds[i].fd, false), fds[i].events);
+      if (fds[i].revents != 0)
+      {
+        nb_ready++;
+      }
     }
   }
 
-  (void)rtosalMutexRelease(ComSocketsMutexHandle);
+  return nb_ready;
 }
+#endif /* COM_SOCKETS_POLL == 1U */
 
+#if (COM_SOCKETS_TCP_POOL == 1U)
 /**
-  * @brief  Find a socket descriptor
-  * @note   Search the socket descriptor
-  * @param  sock
-  * @note   socket id
-  * @param  local
-  * @note   true/false
-  * @retval socket_desc_t or NULL
+  * @brief  Take a connection from the pool
+  * @note   Connections failing the health check are closed
+  * @param  remote_addr - remote IP address
+  * @param  remote_port - remote port
+  * @retval socket_desc_t or NULL (no healthy connection to the remote in the pool)
   */
-static socket_desc_t *com_ip_modem_find_socket(int32_t sock, bool local)
+static socket_desc_t *com_ip_modem_pool_get(const com_ip_addr_t *remote_addr, uint16_t remote_port)
 {
+  uint8_t i;
+  socket_desc_t *candidate;
   socket_desc_t *socket_desc;
 
-  if (sock >= 0)
+  socket_desc = NULL;
+
+  do
   {
-    bool found;
+    candidate = NULL;
 
-    socket_desc = socket_desc_list;
-    found = false;
+    (void)rtosalMutexAcquire(ComSocketsMutexHandle, RTOSAL_WAIT_FOREVER);
+    for (i = 0U; (i < CELLULAR_MAX_SOCKETS) && (candidate == NULL); i++)
+    {
+      if ((socket_desc_table[i].state == COM_SOCKET_POOLED)
+          && (socket_desc_table[i].remote_addr.addr == remote_addr->addr)
+          && (socket_desc_table[i].remote_port == remote_port))
+      {
+        /* Remove it from the pool */
+        candidate = &socket_desc_table[i];
+        candidate->state = COM_SOCKET_CONNECTED;
+      }
+    }
+    (void)rtosalMutexRelease(ComSocketsMutexHandle);
 
-    /* Search the socket descriptor */
-    while ((socket_desc != NULL)
-           && (found != true))
+    if (candidate != NULL)
     {
-      if ((socket_desc->id == sock)
-          && (socket_desc->local == local))
+      if (com_ip_modem_pool_is_healthy(candidate) == true)
       {
-        /* Socket descriptor is found */
-        found = true;
+        socket_desc = candidate;
+        PRINT_INFO("socket %ld taken from pool", socket_desc->id)
       }
       else
       {
-        /* Not the searched one ... Next */
-        socket_desc = socket_desc->next;
+        PRINT_INFO("socket %ld from pool NOK: closed", candidate->id)
+        com_ip_modem_pool_close(candidate);
       }
     }
+  } while ((candidate != NULL) && (socket_desc == NULL));
+
+  return socket_desc;
+}
+
+/**
+  * @brief  Put a connection in the pool
+  * @note   Handle of the application is invalidated
+  * @param  socket_desc - socket descriptor
+  * @retval bool        - true/false connection kept in the pool / pool full
+  */
+static bool com_ip_modem_pool_put(socket_desc_t *socket_desc)
+{
+  uint8_t i;
+  uint8_t nb_pooled;
+  bool result;
+
+  nb_pooled = 0U;
+
+  (void)rtosalMutexAcquire(ComSocketsMutexHandle, RTOSAL_WAIT_FOREVER);
+  for (i = 0U; i < CELLULAR_MAX_SOCKETS; i++)
+  {
+    if (socket_desc_table[i].state == COM_SOCKET_POOLED)
+    {
+      nb_pooled++;
+    }
+  }
+  if (nb_pooled < COM_SOCKETS_TCP_POOL_SIZE)
+  {
+    socket_desc->state       = COM_SOCKET_POOLED;
+    socket_desc->pool_tick   = HAL_GetTick();
+    socket_desc->rcv_timeout = RTOSAL_WAIT_FOREVER;
+    socket_desc->snd_timeout = RTOSAL_WAIT_FOREVER;
+    socket_desc->error       = COM_SOCKETS_ERR_OK;
+    SOCKET_NEXT_GENERATION(socket_desc);
+    result = true;
   }
   else
   {
-    socket_desc = NULL;
+    result = false;
+  }
+  (void)rtosalMutexRelease(ComSocketsMutexHandle);
+
+  /* First connection in the pool: start the timer,
+     else it is already running for an older connection */
+  if ((result == true) && (nb_pooled == 0U))
+  {
+    (void)rtosalTimerStart(ComSocketsPoolTimerId, COM_SOCKETS_TCP_POOL_IDLE_TIMEOUT);
+  }
+
+  return result;
+}
+
+/**
+  * @brief  Check a connection taken from the pool can be reused
+  * @note   Connection must not be closed by remote, not expired, without unread data
+  *         and still known by the modem
+  * @param  socket_desc - socket descriptor
+  * @retval bool        - true/false connection can be reused / must be closed
+  */
+static bool com_ip_modem_pool_is_healthy(const socket_desc_t *socket_desc)
+{
+  bool result;
+  CS_SocketCnxInfos_t cnx_infos;
+
+  result = false;
+
+  if ((socket_desc->closing == false)
+      && (com_ip_modem_is_network_up() == true)
+      && ((HAL_GetTick() - socket_desc->pool_tick) < COM_SOCKETS_TCP_POOL_IDLE_TIMEOUT)
+#if (COM_SOCKETS_POLL == 1U)
+      && (socket_desc->rx_ready == false)
+#endif /* COM_SOCKETS_POLL == 1U */
+     )
+  {
+    com_ip_modem_wakeup_request();
+    if (osCDS_socket_cnx_status(socket_desc->id, &cnx_infos) == CELLULAR_OK)
+    {
+      result = true;
+    }
+    com_ip_modem_idlemode_request(false);
+  }
+
+  return result;
+}
+
+/**
+  * @brief  Close a connection removed from the pool
+  * @note   Descriptor is released even if close is NOK at low level: no handle refers to it
+  * @param  socket_desc - socket descriptor
+  * @retval -
+  */
+static void com_ip_modem_pool_close(socket_desc_t *socket_desc)
+{
+  com_ip_modem_wakeup_request();
+  if (osCDS_socket_close(socket_desc->id, 0U) != CELLULAR_OK)
+  {
+    PRINT_INFO("close pool socket NOK low level")
+  }
+  com_ip_modem_delete_socket_desc(socket_desc);
+  com_ip_modem_idlemode_request(true);
+}
+
+/**
+  * @brief  Close the connections idle in the pool since COM_SOCKETS_TCP_POOL_IDLE_TIMEOUT
+  * @note   Timer is restarted for the next connection to expire
+  * @param  -
+  * @retval -
+  */
+static void com_ip_modem_pool_expire(void)
+{
+  uint8_t i;
+  uint32_t idle_time;
+  uint32_t next_expiry;
+  socket_desc_t *expired;
+
+  do
+  {
+    expired = NULL;
+    next_expiry = 0U;
+
+    (void)rtosalMutexAcquire(ComSocketsMutexHandle, RTOSAL_WAIT_FOREVER);
+    for (i = 0U; i < CELLULAR_MAX_SOCKETS; i++)
+    {
+      if (socket_desc_table[i].state == COM_SOCKET_POOLED)
+      {
+        idle_time = HAL_GetTick() - socket_desc_table[i].pool_tick;
+        if (idle_time >= COM_SOCKETS_TCP_POOL_IDLE_TIMEOUT)
+        {
+          if (expired == NULL)
+          {
+            /* Remove it from the pool */
+            expired = &socket_desc_table[i];
+            expired->state = COM_SOCKET_CONNECTED;
+          }
+        }
+        else if ((next_expiry == 0U) || ((COM_SOCKETS_TCP_POOL_IDLE_TIMEOUT - idle_time) < next_expiry))
+        {
+          next_expiry = COM_SOCKETS_TCP_POOL_IDLE_TIMEOUT - idle_time;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      }
+    }
+    (void)rtosalMutexRelease(ComSocketsMutexHandle);
+
+    if (expired != NULL)
+    {
+      PRINT_INFO("socket %ld idle in pool: closed", expired->id)
+      com_ip_modem_pool_close(expired);
+    }
+  } while (expired != NULL);
+
+  if (next_expiry != 0U)
+  {
+    (void)rtosalTimerStart(ComSocketsPoolTimerId, next_expiry);
+  }
+}
+
+/**
+  * @brief  Callback called when the pool timer expires
+  * @note   Runs in the RTOS timer thread: must not wait for an AT transaction
+  *         the expired idle connections are closed by ComSockets thread
+  * @param  p_argument - unused
+  * @retval -
+  */
+static void com_ip_modem_pool_timer_cb(void *p_argument)
+{
+  com_socket_msg_t msg_queue;
+
+  UNUSED(p_argument);
+  msg_queue = 0U;
+
+  SET_SOCKET_MSG_TYPE(msg_queue, COM_POOL_EXPIRE_MSG);
+  if (rtosalMessageQueuePut(ComSocketsThreadQueue, msg_queue, 0U) != osOK)
+  {
+    /* Try again later */
+    (void)rtosalTimerStart(ComSocketsPoolTimerId, COM_POOL_RETRY_DELAY);
   }
-
-  /* If found == false then socket_desc = NULL */
-  return socket_desc;
 }
+#endif /* COM_SOCKETS_TCP_POOL == 1U */
 
+#if (COM_THREAD_ACTIVATED == 1U)
 /**
-  * @brief  Empty queue from potential messages
-  * @param  queue - queue to empty
+  * @brief  ComSockets thread
+  * @note   Treats the requests of the timers in task context:
+  *         their AT transactions can't be done in the RTOS timer thread
+  * @param  p_argument - unused
   * @retval -
   */
-static void com_ip_modem_empty_queue(osMessageQId queue)
+static void com_ip_modem_thread(void *p_argument)
 {
   uint32_t msg_queue;
+#if (COM_SOCKETS_TX_COALESCING == 1U)
+  uint32_t id;
+#endif /* COM_SOCKETS_TX_COALESCING == 1U */
 
-  do
+  UNUSED(p_argument);
+
+  for (;;)
   {
     msg_queue = 0U;
-    (void)rtosalMessageQueueGet(queue, &msg_queue, 0U);
-    if (msg_queue != 0U)
+    (void)rtosalMessageQueueGet(ComSocketsThreadQueue, &msg_queue, RTOSAL_WAIT_FOREVER);
+#if (COM_SOCKETS_TX_COALESCING == 1U)
+    if ((msg_queue != 0U) && (GET_SOCKET_MSG_TYPE(msg_queue) == COM_TX_FLUSH_MSG))
     {
-      /* Message available in the queue */
-      PRINT_DBG("rcv cleanup MSGqueue")
+      id = (uint32_t)GET_SOCKET_MSG_ID(msg_queue);
+      if (id < CELLULAR_MAX_SOCKETS)
+      {
+        (void)rtosalMutexAcquire(ComSocketsTxMutexHandle, RTOSAL_WAIT_FOREVER);
+        /* Data maybe already sent by application request or socket reused: nothing to send */
+        com_ip_modem_tx_send_buf(&socket_desc_table[id]);
+        (void)rtosalMutexRelease(ComSocketsTxMutexHandle);
+      }
     }
-  } while (msg_queue != 0U);
+#endif /* COM_SOCKETS_TX_COALESCING == 1U */
+#if (COM_SOCKETS_TCP_POOL == 1U)
+    if ((msg_queue != 0U) && (GET_SOCKET_MSG_TYPE(msg_queue) == COM_POOL_EXPIRE_MSG))
+    {
+      /* Connections maybe already taken from the pool: only the expired ones are closed */
+      com_ip_modem_pool_expire();
+    }
+#endif /* COM_SOCKETS_TCP_POOL == 1U */
+  }
 }
+#endif /* COM_THREAD_ACTIVATED == 1U */
 
 #if (USE_LOW_POWER == 1)
 /**
@@ -557,26 +1474,19 @@ static void com_ip_modem_empty_queue(osMessageQId queue)
   */
 static bool com_ip_modem_are_all_sockets_invalid(void)
 {
-  socket_desc_t *socket_desc;
+  uint8_t i;
   bool result; /* false : at least one socket is still open
                   true : all sockets are Invalid */
 
-  socket_desc = socket_desc_list;
   result = true;
 
   /* Search the socket descriptor */
-  while ((socket_desc != NULL)
-         && (result != false))
+  for (i = 0U; (i < COM_SOCKET_DESC_NB) && (result != false); i++)
   {
-    if (socket_desc->id > COM_SOCKET_INVALID_ID)
+    if (socket_desc_table[i].id > COM_SOCKET_INVALID_ID)
     {
       result = false;
     }
-    else
-    {
-      /* Socket is Invalid, check the next one */
-      socket_desc = socket_desc->next;
-    }
   }
 
   return result;
@@ -763,7 +1673,7 @@ static uint16_t com_ip_modem_new_local_port(void)
   bool found;
   uint16_t iter;
   uint16_t result;
-  socket_desc_t *socket_desc;
+  uint8_t i;
 
   local_port_ok = false;
   iter = 0U;
@@ -779,22 +1689,16 @@ static uint16_t com_ip_modem_new_local_port(void)
       com_local_port = COM_LOCAL_PORT_BEGIN;
     }
 
-    socket_desc = socket_desc_list;
     found = false;
 
     /* See if a socket already created is not using this port */
-    while ((socket_desc != NULL)
-           && (found != true))
+    for (i = 0U; (i < COM_SOCKET_DESC_NB) && (found != true); i++)
     {
-      if (socket_desc->local_port == com_local_port)
+      if (socket_desc_table[i].local_port == com_local_port)
       {
         /* Local port already used */
         found = true;
       }
-      else
-      {
-        socket_desc = socket_desc->next;
-      }
     }
 
     if (found == false)
@@ -862,10 +1766,10 @@ static int32_t com_ip_modem_connect_udp_service(socket_desc_t *socket_desc)
       {
         PRINT_INFO("socket internal bind ok")
         /* Connect UDP service */
-        if (osCDS_socket_connect(socket_desc->id,
-                                 CS_IPAT_IPV4,
-                                 CONFIG_MODEM_UDP_SERVICE_CONNECT_IP,
-                                 0)
+        if (com_ip_modem_at_connect(socket_desc,
+                                    CS_IPAT_IPV4,
+                                    CONFIG_MODEM_UDP_SERVICE_CONNECT_IP,
+                                    0)
             == CELLULAR_OK)
         {
           result = COM_SOCKETS_ERR_OK;
@@ -898,65 +1802,207 @@ static int32_t com_ip_modem_connect_udp_service(socket_desc_t *socket_desc)
 
   return (result);
 }
-#endif /* UDP_SERVICE_SUPPORTED == 1U */
 
 /**
-  * @brief  Request Idle mode
-  * @note   -
-  * @param  immediate - false/true
-  * @retval -
+  * @brief  Translate the remote address of a UDP service socket
+  * @note   Address provided to sendto or else address provided by connect
+  * @param  socket_desc - socket descriptor
+  * @param  to          - remote IP address and port (may be NULL)
+  * @param  tolen       - remote IP length
+  * @param  socket_addr - translated remote address
+  * @retval int32_t     - ok or COM_SOCKETS_ERR_PARAMETER
   */
-static void com_ip_modem_idlemode_request(bool immediate)
+static int32_t com_ip_modem_sendto_addr(const socket_desc_t *socket_desc,
+                                        const com_sockaddr_t *to, int32_t tolen,
+                                        socket_addr_t *socket_addr)
 {
-#if (USE_LOW_POWER == 1)
-  (void)rtosalMutexAcquire(ComTimerInactivityMutexHandle, RTOSAL_WAIT_FOREVER);
+  int32_t result;
+
+  result = COM_SOCKETS_ERR_PARAMETER;
+
+  /* Check remote addr is valid */
+  if ((to != NULL) && (tolen != 0))
+  {
+    if (com_translate_ip_address(to, tolen,
+                                 socket_addr)
+        == true)
+    {
+      result = COM_SOCKETS_ERR_OK;
+    }
+    /* else result = COM_SOCKETS_ERR_PARAMETER */
+  }
+  /* No address provided by connect previously done */
+  /* a send translate to sendto */
+  /* Use IPaddress of connect */
+  else if ((to == NULL) && (tolen == 0)
+           && (socket_desc->remote_addr.addr != 0U))
+  {
+    com_sockaddr_in_t sockaddr_in;
+    com_ip_addr_t remote_addr;
+    uint16_t remote_port;
+
+    remote_addr.addr = socket_desc->remote_addr.addr;
+    remote_port = socket_desc->remote_port;
+    com_convert_ipaddr_port_to_sockaddr(&remote_addr,
+                                        remote_port,
+                                        &sockaddr_in);
+
+    if (com_translate_ip_address((com_sockaddr_t *)&sockaddr_in,
+                                 (int32_t)sizeof(sockaddr_in),
+                                 socket_addr)
+        == true)
+    {
+      result = COM_SOCKETS_ERR_OK;
+    }
+    else
+    {
+      /* else result = COM_SOCKETS_ERR_PARAMETER */
+    }
+  }
+  else
+  {
+    /* else result = COM_SOCKETS_ERR_PARAMETER */
+  }
+
+  return (result);
+}
+
+/**
+  * @brief  Send data on a UDP service socket
+  * @note   If socket state == CREATED implicit bind and connect UDP service are done
+  * @param  socket_desc - socket descriptor
+  * @param  buf         - pointer to application data buffer to send
+  * @param  len         - length of the data to send (in bytes)
+  * @param  flags       - options (see com_sendto_ip_modem)
+  * @param  socket_addr - translated remote address
+  * @retval int32_t     - number of bytes sent or error value
+  */
+static int32_t com_ip_modem_sendto_data(socket_desc_t *socket_desc,
+                                        const com_char_t *buf, int32_t len,
+                                        int32_t flags,
+                                        socket_addr_t *socket_addr)
+{
+  bool is_network_up;
+  int32_t result;
 
-  if (com_nb_wake_up <= 1U) /* only one socket in progress */
+  /* If socket state == CREATED implicit bind and connect UDP service must be done */
+  /* Without updating internal parameters
+     => com_ip_modem_connect must not be called */
+  result = com_ip_modem_connect_udp_service(socket_desc);
+
+  /* closing maybe received, refuse to send data */
+  if ((result == COM_SOCKETS_ERR_OK)
+      && (socket_desc->closing == false)
+      && (socket_desc->state == COM_SOCKET_CONNECTED))
   {
-    /* Are all sockets closed ?
-       If so, don't arm the timer, immediate request to go in idle */
-    if ((immediate == true)
-        && (com_ip_modem_are_all_sockets_invalid() == true)) /* Should be always true */
+    /* network maybe down, refuse to send data */
+    if (com_ip_modem_is_network_up() == false)
+    {
+      result = COM_SOCKETS_ERR_NONETWORK;
+      PRINT_ERR("sndto data NOK no network")
+    }
+    else
     {
-      com_timer_inactivity_state = COM_TIMER_IDLE;
-      (void)rtosalTimerStop(ComTimerInactivityId);
-      if (com_ip_modem_is_network_up() == true) /* If network is up IdleMode can be requested */
+      uint32_t length_to_send;
+      uint32_t length_send;
+
+      result = COM_SOCKETS_ERR_GENERAL;
+      length_send = 0U;
+      socket_desc->state = COM_SOCKET_SENDING;
+
+      com_ip_modem_wakeup_request();
+
+      if (flags == COM_MSG_DONTWAIT)
       {
-        PRINT_INFO("Inactivity: All sockets closed: Timer stopped and IdleMode requested because network is up")
-        if (CSP_DataIdle() == CELLULAR_OK)
+        length_to_send = COM_MIN((uint32_t)len, COM_MODEM_MAX_TX_DATA_SIZE);
+
+        if (com_ip_modem_at_sendto(socket_desc,
+                                   buf, length_to_send,
+                                   socket_addr->ip_type,
+                                   socket_addr->ip_value,
+                                   socket_addr->port)
+            == CELLULAR_OK)
         {
-          PRINT_INFO("Inactivity: IdleMode request OK")
+          length_send = length_to_send;
+          result = (int32_t)length_send;
+          PRINT_INFO("sndto data DONTWAIT ok")
         }
         else
         {
-          /* CSP_DataIdle may be NOK because CSP already in Idle */
-          PRINT_INFO("Inactivity: IdleMode request NOK")
+          PRINT_ERR("sndto data DONTWAIT NOK at low level")
         }
+        socket_desc->state = COM_SOCKET_CONNECTED;
       }
       else
       {
-        PRINT_INFO("Inactivity: All sockets closed: Timer stopped but IdleMode NOT requested because network is down")
+        is_network_up = com_ip_modem_is_network_up();
+        /* Send all data of a big buffer - Whatever the size */
+        while ((length_send != (uint32_t)len)
+               && (socket_desc->closing == false)
+               && (is_network_up == true)
+               && (socket_desc->state == COM_SOCKET_SENDING))
+        {
+          length_to_send = COM_MIN((((uint32_t)len) - length_send),
+                                   COM_MODEM_MAX_TX_DATA_SIZE);
+          com_ip_modem_wakeup_request();
+          /* A tempo is already managed at low-level */
+          if (com_ip_modem_at_sendto(socket_desc,
+                                     buf + length_send,
+                                     length_to_send,
+                                     socket_addr->ip_type,
+                                     socket_addr->ip_value,
+                                     socket_addr->port)
+              == CELLULAR_OK)
+          {
+            length_send += length_to_send;
+            PRINT_INFO("sndto data ok")
+            /* Update Network status */
+            is_network_up = com_ip_modem_is_network_up();
+          }
+          else
+          {
+            socket_desc->state = COM_SOCKET_CONNECTED;
+            PRINT_ERR("sndto data NOK at low level")
+          }
+          com_ip_modem_idlemode_request(false);
+        }
+        socket_desc->state = COM_SOCKET_CONNECTED;
+        result = (int32_t)length_send;
       }
+      com_ip_modem_idlemode_request(false);
+    }
+  }
+  else
+  {
+    if (socket_desc->closing == true)
+    {
+      PRINT_ERR("sndto data NOK socket closing")
+      result = COM_SOCKETS_ERR_CLOSING;
     }
     else
     {
-      com_timer_inactivity_state = COM_TIMER_RUN;
-      /* Start or Restart timer */
-      (void)rtosalTimerStart(ComTimerInactivityId, COM_TIMER_INACTIVITY_MS);
-      PRINT_INFO("Inactivity: last command finished - Timer re/started")
+      /* else result already updated com_ip_modem_connect_udp_service */
     }
-    com_nb_wake_up = 0U;
-  }
-  else /* at least one socket in transaction ping/send/recv... and another finished its action */
-  {
-    /* Improvement : do next treatment only if all sockets in INVALID/CREATING/CREATED state ? */
-    com_timer_inactivity_state = COM_TIMER_RUN;
-    /* Start or Restart timer */
-    (void)rtosalTimerStart(ComTimerInactivityId, COM_TIMER_INACTIVITY_MS);
-    PRINT_INFO("Inactivity: one command finished - Timer re/started")
-    com_nb_wake_up --;
   }
-  (void)rtosalMutexRelease(ComTimerInactivityMutexHandle);
+
+  return (result);
+}
+#endif /* UDP_SERVICE_SUPPORTED == 1U */
+
+/**
+  * @brief  Request Idle mode
+  * @note   -
+  * @param  immediate - false/true
+  * @retval -
+  */
+static void com_ip_modem_idlemode_request(bool immediate)
+{
+#if (USE_LOW_POWER == 1)
+  /* Are all sockets closed ?
+     If so, don't wait for inactivity, immediate request to go in idle */
+  CSA_Release(CSA_ACTIVITY_SOCKET,
+              ((immediate == true) && (com_ip_modem_are_all_sockets_invalid() == true)) ? true : false);
+  PRINT_INFO("Inactivity: command finished - activity released")
 
 #else /* USE_LOW_POWER == 0 */
   UNUSED(immediate);
@@ -973,25 +2019,30 @@ static void com_ip_modem_idlemode_request(bool immediate)
 static void com_ip_modem_wakeup_request(void)
 {
 #if (USE_LOW_POWER == 1)
-  (void)rtosalMutexAcquire(ComTimerInactivityMutexHandle, RTOSAL_WAIT_FOREVER);
+  /* Low power is not entered until the matching com_ip_modem_idlemode_request */
+  CSA_Acquire(CSA_ACTIVITY_SOCKET);
+  PRINT_INFO("Inactivity: WakeUp requested - activity acquired")
+#else /* USE_LOW_POWER == 0 */
+  __NOP();
+#endif /* USE_LOW_POWER == 1 */
+}
 
-  com_timer_inactivity_state = COM_TIMER_IDLE;
-  (void)rtosalTimerStop(ComTimerInactivityId);
-  com_nb_wake_up++;
-  PRINT_INFO("Inactivity: WakeUp requested - Timer stopped")
-  if (CSP_DataWakeup(HOST_WAKEUP) == CELLULAR_OK)
-  {
-    PRINT_INFO("Inactivity: WakeUp request OK")
-  }
-  else
+/**
+  * @brief  Release the activity token held while received data are not read
+  * @note   -
+  * @param  socket_desc - socket descriptor
+  * @retval -
+  */
+static void com_ip_modem_rx_activity_release(socket_desc_t *socket_desc)
+{
+#if (USE_LOW_POWER == 1)
+  if (socket_desc->rx_activity == true)
   {
-    /* CSP_DataWakeUp may be NOK because CSP already WakeUp */
-    PRINT_INFO("Inactivity: WakeUp request NOK")
+    socket_desc->rx_activity = false;
+    CSA_Release(CSA_ACTIVITY_SOCKET_RX, false);
   }
-
-  (void)rtosalMutexRelease(ComTimerInactivityMutexHandle);
 #else /* USE_LOW_POWER == 0 */
-  __NOP();
+  UNUSED(socket_desc);
 #endif /* USE_LOW_POWER == 1 */
 }
 
@@ -1008,12 +2059,25 @@ static void com_ip_modem_data_received_cb(socket_handle_t sock)
   socket_desc_t    *socket_desc;
 
   msg_queue = 0U;
-  socket_desc = com_ip_modem_find_socket(sock, false);
+  socket_desc = com_ip_modem_get_socket(sock, false);
 
   if (socket_desc != NULL)
   {
     if (socket_desc->closing != true)
     {
+#if (USE_LOW_POWER == 1)
+      /* Modem must not enter low power before data are read */
+      if (socket_desc->rx_activity == false)
+      {
+        socket_desc->rx_activity = true;
+        CSA_Acquire(CSA_ACTIVITY_SOCKET_RX);
+      }
+#endif /* USE_LOW_POWER == 1 */
+#if (COM_SOCKETS_POLL == 1U)
+      /* Data available until a receive consumes them */
+      socket_desc->rx_ready = true;
+      com_ip_modem_poll_notify();
+#endif /* COM_SOCKETS_POLL == 1U */
       if (socket_desc->state == COM_SOCKET_WAITING_RSP)
       {
         PRINT_INFO("cb socket %ld data ready called: waiting rsp", socket_desc->id)
@@ -1062,7 +2126,7 @@ static void com_ip_modem_closing_cb(socket_handle_t sock)
   socket_desc_t    *socket_desc;
 
   msg_queue = 0U;
-  socket_desc = com_ip_modem_find_socket(sock, false);
+  socket_desc = com_ip_modem_get_socket(sock, false);
 
   if (socket_desc != NULL)
   {
@@ -1071,6 +2135,9 @@ static void com_ip_modem_closing_cb(socket_handle_t sock)
     {
       socket_desc->closing = true;
       PRINT_INFO("cb socket closing: close rqt")
+#if (COM_SOCKETS_POLL == 1U)
+      com_ip_modem_poll_notify();
+#endif /* COM_SOCKETS_POLL == 1U */
     }
     if ((socket_desc->state == COM_SOCKET_WAITING_RSP)
         || (socket_desc->state == COM_SOCKET_WAITING_FROM))
@@ -1101,9 +2168,8 @@ static void com_socket_datacache_cb(dc_com_event_id_t dc_event_id, const void *p
 {
   UNUSED(p_private_gui_data);
 
-  /** Using DC_CELLULAR_INFO in case of LowPower com_socket_datacache_cb to update LowPower state
-    * but soft is still in function com_ip_modem_idlemode_request so ComTimerInactivityMutexHandle is still acquire
-    * possible to be blocked on: else (void)rtosalMutexAcquire(ComTimerInactivityMutexHandle, RTOSAL_WAIT_FOREVER);
+  /** In case of LowPower, CSA_Check only takes the activity mutex for counters and timer update:
+    * no Data Cache access is done while it is acquired, so it can be called from Data Cache callback
     */
   if (dc_event_id == DC_CELLULAR_NIFMAN_INFO)
   {
@@ -1120,12 +2186,9 @@ static void com_socket_datacache_cb(dc_com_event_id_t dc_event_id, const void *p
           com_sockets_network_is_up = true;
           com_sockets_statistic_update(COM_SOCKET_STAT_NWK_UP);
 #if (USE_LOW_POWER == 1)
-          (void)rtosalMutexAcquire(ComTimerInactivityMutexHandle, RTOSAL_WAIT_FOREVER);
-          com_timer_inactivity_state = COM_TIMER_RUN;
-          /* Start or Restart timer */
-          (void)rtosalTimerStart(ComTimerInactivityId, COM_TIMER_INACTIVITY_MS);
-          PRINT_INFO("Inactivity: Network on - Timer started")
-          (void)rtosalMutexRelease(ComTimerInactivityMutexHandle);
+          /* Idle mode requested if no activity */
+          CSA_Check();
+          PRINT_INFO("Inactivity: Network on - activity check started")
 #endif /* USE_LOW_POWER == 1 */
         }
       }
@@ -1135,13 +2198,10 @@ static void com_socket_datacache_cb(dc_com_event_id_t dc_event_id, const void *p
         {
           com_sockets_network_is_up = false;
           com_sockets_statistic_update(COM_SOCKET_STAT_NWK_DWN);
-#if (USE_LOW_POWER == 1)
-          (void)rtosalMutexAcquire(ComTimerInactivityMutexHandle, RTOSAL_WAIT_FOREVER);
-          com_timer_inactivity_state = COM_TIMER_IDLE;
-          (void)rtosalTimerStop(ComTimerInactivityId);
-          PRINT_INFO("Inactivity: Network off - Timer stopped")
-          (void)rtosalMutexRelease(ComTimerInactivityMutexHandle);
-#endif /* USE_LOW_POWER == 1 */
+#if (COM_SOCKETS_POLL == 1U)
+          /* Connected sockets are in error */
+          com_ip_modem_poll_notify();
+#endif /* COM_SOCKETS_POLL == 1U */
         }
       }
     }
@@ -1270,51 +2330,6 @@ static void com_ip_modem_ping_rsp_cb(CS_Ping_response_t ping_rsp)
 
 #endif /* USE_COM_PING == 1 */
 
-#if (USE_LOW_POWER == 1)
-/**
-  * @brief  Callback called when Inactivity Timer raised
-  * @note   Managed Inactivity Timer
-  * @param  p_argument - UNUSED
-  * @note   -
-  * @retval -
-  */
-static void com_ip_modem_timer_inactivity_cb(void *p_argument)
-{
-  PRINT_DBG("callback socket inactitvity timer called")
-  UNUSED(p_argument);
-  PRINT_INFO("Inactivity: Inactivity Timer: Timer cb interaction %d", com_nb_wake_up)
-
-  /* Improvement : do next treatment also if a Ping session is opened and not closed ? */
-  if ((com_timer_inactivity_state == COM_TIMER_RUN)
-      && (com_nb_wake_up == 0U))
-  {
-    com_timer_inactivity_state = COM_TIMER_IDLE;
-    if (com_ip_modem_is_network_up() == true) /* If network is up IdleMode can be requested */
-    {
-      PRINT_INFO("Inactivity: Inactivity Timer: IdleMode requested because network is up")
-
-      if (CSP_DataIdle() == CELLULAR_OK)
-      {
-        PRINT_INFO("Inactivity: Inactivity Timer: IdleMode request OK")
-      }
-      else
-      {
-        /* CSP_DataIdle may be NOK because CSP already in Idle */
-        PRINT_INFO("Inactivity: Inactivity Timer: IdleMode request NOK")
-      }
-    }
-    else
-    {
-      PRINT_INFO("Inactivity: Inactivity Timer: IdleMode NOT requested because network is down")
-    }
-  }
-  else
-  {
-    PRINT_INFO("Inactivity: Inactivity Timer: Timer cb called but timer state or interaction: %d NOK", com_nb_wake_up)
-  }
-}
-#endif /* USE_LOW_POWER == 1 */
-
 /* Functions Definition ------------------------------------------------------*/
 
 /*** Socket management ********************************************************/
@@ -1396,8 +2411,8 @@ int32_t com_socket_ip_modem(int32_t family, int32_t type, int32_t protocol)
       socket_desc_t *socket_desc;
       PRINT_INFO("create socket ok low level")
 
-      /* Need to create a new socket_desc ? */
-      socket_desc = com_ip_modem_provide_socket_desc(false);
+      /* Descriptor of the modem socket id */
+      socket_desc = com_ip_modem_provide_socket_desc(sock, false);
       if (socket_desc == NULL)
       {
         result = COM_SOCKETS_ERR_NOMEMORY;
@@ -1417,11 +2432,13 @@ int32_t com_socket_ip_modem(int32_t family, int32_t type, int32_t protocol)
       else
       {
         /* Update socket descriptor */
-        socket_desc->id    = sock;
         socket_desc->type  = (uint8_t)type;
         socket_desc->state = COM_SOCKET_CREATED;
+        /* Application uses a handle including the generation of the descriptor */
+        sock = SOCKET_HANDLE(socket_desc);
+        com_sockets_statistic_socket(socket_desc->id);
 
-        if (osCDS_socket_set_callbacks(sock, com_ip_modem_data_received_cb, NULL, com_ip_modem_closing_cb)
+        if (osCDS_socket_set_callbacks(socket_desc->id, com_ip_modem_data_received_cb, NULL, com_ip_modem_closing_cb)
             == CELLULAR_OK)
         {
           result = COM_SOCKETS_ERR_OK;
@@ -1536,6 +2553,23 @@ int32_t com_setsockopt_ip_modem(int32_t sock, int32_t level, int32_t optname,
             /* Set for this option NOK */
             break;
           }
+#if (COM_SOCKETS_TX_COALESCING == 1U)
+          /* Send coalescing */
+          case COM_SO_TXCOALESCE :
+          {
+            if ((uint32_t)optlen == sizeof(uint32_t))
+            {
+              result = com_ip_modem_tx_coalescing(socket_desc, (*(const uint32_t *)optval != 0U));
+            }
+            break;
+          }
+          /* Send coalesced data */
+          case COM_SO_TXFLUSH :
+          {
+            result = (socket_desc->tx_coalescing == true) ? com_ip_modem_tx_flush(socket_desc) : COM_SOCKETS_ERR_OK;
+            break;
+          }
+#endif /* COM_SOCKETS_TX_COALESCING == 1U */
           default :
           {
             /* Other options NOT YET SUPPORTED */
@@ -1631,6 +2665,18 @@ int32_t com_getsockopt_ip_modem(int32_t sock, int32_t level, int32_t optname,
             }
             break;
           }
+#if (COM_SOCKETS_TX_COALESCING == 1U)
+          /* Send coalescing */
+          case COM_SO_TXCOALESCE :
+          {
+            if ((uint32_t)*optlen == sizeof(uint32_t))
+            {
+              *(uint32_t *)optval = (socket_desc->tx_coalescing == true) ? 1U : 0U;
+              result = COM_SOCKETS_ERR_OK;
+            }
+            break;
+          }
+#endif /* COM_SOCKETS_TX_COALESCING == 1U */
           default :
           {
             /* Other options NOT YET SUPPORTED */
@@ -1689,7 +2735,7 @@ int32_t com_bind_ip_modem(int32_t sock,
         result = COM_SOCKETS_ERR_GENERAL;
         PRINT_DBG("socket bind request")
 
-        if (osCDS_socket_bind(sock,
+        if (osCDS_socket_bind(socket_desc->id,
                               socket_addr.port)
             == CELLULAR_OK)
         {
@@ -1795,10 +2841,10 @@ int32_t com_connect_ip_modem(int32_t sock,
         if (com_ip_modem_is_network_up() == true)
         {
           com_ip_modem_wakeup_request();
-          if (osCDS_socket_connect(socket_desc->id,
-                                   socket_addr.ip_type,
-                                   &socket_addr.ip_value[0],
-                                   socket_addr.port)
+          if (com_ip_modem_at_connect(socket_desc,
+                                      socket_addr.ip_type,
+                                      &socket_addr.ip_value[0],
+                                      socket_addr.port)
               == CELLULAR_OK)
           {
             /* result already set to the correct value COM_SOCKETS_ERR_OK */
@@ -1836,10 +2882,10 @@ int32_t com_connect_ip_modem(int32_t sock,
           || (socket_desc->state == COM_SOCKET_CONNECTED))
       {
         com_ip_modem_wakeup_request();
-        if (osCDS_socket_connect(socket_desc->id,
-                                 socket_addr.ip_type,
-                                 &socket_addr.ip_value[0],
-                                 socket_addr.port)
+        if (com_ip_modem_at_connect(socket_desc,
+                                    socket_addr.ip_type,
+                                    &socket_addr.ip_value[0],
+                                    socket_addr.port)
             == CELLULAR_OK)
         {
           /* result already set to the correct value COM_SOCKETS_ERR_OK */
@@ -1947,7 +2993,12 @@ int32_t com_send_ip_modem(int32_t sock,
             result = com_sendto_ip_modem(sock, buf, len, flags, NULL, 0);
           }
           else
-#else /* UDP_SERVICE_SUPPORTED == 0 */
+#endif /* UDP_SERVICE_SUPPORTED == 1U */
+#if (COM_SOCKETS_TX_COALESCING == 1U)
+          /* Small data are coalesced, big data are sent directly */
+          if ((socket_desc->tx_coalescing == false)
+              || (com_ip_modem_tx_coalesce(socket_desc, buf, (uint32_t)len, &result) == false))
+#endif /* COM_SOCKETS_TX_COALESCING == 1U */
           {
             bool is_network_up;
             uint32_t length_to_send;
@@ -1960,8 +3011,8 @@ int32_t com_send_ip_modem(int32_t sock,
             if (flags == COM_MSG_DONTWAIT)
             {
               length_to_send = COM_MIN((uint32_t)len, COM_MODEM_MAX_TX_DATA_SIZE);
-              if (osCDS_socket_send(socket_desc->id,
-                                    buf, length_to_send)
+              if (com_ip_modem_at_send(socket_desc,
+                                       buf, length_to_send)
                   == CELLULAR_OK)
               {
                 length_send = length_to_send;
@@ -1987,9 +3038,9 @@ int32_t com_send_ip_modem(int32_t sock,
                                          COM_MODEM_MAX_TX_DATA_SIZE);
                 com_ip_modem_wakeup_request();
                 /* A tempo is already managed at low-level */
-                if (osCDS_socket_send(socket_desc->id,
-                                      buf + length_send,
-                                      length_to_send)
+                if (com_ip_modem_at_send(socket_desc,
+                                         buf + length_send,
+                                         length_to_send)
                     == CELLULAR_OK)
                 {
                   length_send += length_to_send;
@@ -2008,7 +3059,6 @@ int32_t com_send_ip_modem(int32_t sock,
               result = (int32_t)length_send;
             }
           }
-#endif /* UDP_SERVICE_SUPPORTED == 1 */
           com_ip_modem_idlemode_request(false);
         }
       }
@@ -2111,163 +3161,22 @@ int32_t com_sendto_ip_modem(int32_t sock,
     {
       /* If Modem doesn't support sendto rather than to test:
          if connect already done by appli
-         and if IPaddress in sendto equal to IPaddress in connect
-         decision is to return an error
-      */
-#if (UDP_SERVICE_SUPPORTED == 0U)
-      {
-        result = COM_SOCKETS_ERR_UNSUPPORTED;
-      }
-#else /* UDP_SERVICE_SUPPORTED == 1U */
-      {
-        bool is_network_up;
-        socket_addr_t socket_addr;
-
-        /* Check remote addr is valid */
-        if ((to != NULL) && (tolen != 0))
-        {
-          if (com_translate_ip_address(to, tolen,
-                                       &socket_addr)
-              == true)
-          {
-            result = COM_SOCKETS_ERR_OK;
-          }
-          /* else result = COM_SOCKETS_ERR_PARAMETER */
-        }
-        /* No address provided by connect previously done */
-        /* a send translate to sendto */
-        /* Use IPaddress of connect */
-        else if ((to == NULL) && (tolen == 0)
-                 && (socket_desc->remote_addr.addr != 0U))
-        {
-          com_sockaddr_in_t sockaddr_in;
-          com_ip_addr_t remote_addr;
-          uint16_t remote_port;
-
-          remote_addr.addr = socket_desc->remote_addr.addr;
-          remote_port = socket_desc->remote_port;
-          com_convert_ipaddr_port_to_sockaddr(&remote_addr,
-                                              remote_port,
-                                              &sockaddr_in);
-
-          if (com_translate_ip_address((com_sockaddr_t *)&sockaddr_in,
-                                       (int32_t)sizeof(sockaddr_in),
-                                       &socket_addr)
-              == true)
-          {
-            result = COM_SOCKETS_ERR_OK;
-          }
-          else
-          {
-            /* else result = COM_SOCKETS_ERR_PARAMETER */
-          }
-        }
-        else
-        {
-          /* else result = COM_SOCKETS_ERR_PARAMETER */
-        }
-
-        if (result == COM_SOCKETS_ERR_OK)
-        {
-          /* If socket state == CREATED implicit bind and connect UDP service must be done */
-          /* Without updating internal parameters
-             => com_ip_modem_connect must not be called */
-          result = com_ip_modem_connect_udp_service(socket_desc);
-
-          /* closing maybe received, refuse to send data */
-          if ((result == COM_SOCKETS_ERR_OK)
-              && (socket_desc->closing == false)
-              && (socket_desc->state == COM_SOCKET_CONNECTED))
-          {
-            /* network maybe down, refuse to send data */
-            if (com_ip_modem_is_network_up() == false)
-            {
-              result = COM_SOCKETS_ERR_NONETWORK;
-              PRINT_ERR("sndto data NOK no network")
-            }
-            else
-            {
-              uint32_t length_to_send;
-              uint32_t length_send;
-
-              result = COM_SOCKETS_ERR_GENERAL;
-              length_send = 0U;
-              socket_desc->state = COM_SOCKET_SENDING;
-
-              com_ip_modem_wakeup_request();
-
-              if (flags == COM_MSG_DONTWAIT)
-              {
-                length_to_send = COM_MIN((uint32_t)len, COM_MODEM_MAX_TX_DATA_SIZE);
-
-                if (osCDS_socket_sendto(socket_desc->id,
-                                        buf, length_to_send,
-                                        socket_addr.ip_type,
-                                        socket_addr.ip_value,
-                                        socket_addr.port)
-                    == CELLULAR_OK)
-                {
-                  length_send = length_to_send;
-                  result = (int32_t)length_send;
-                  PRINT_INFO("sndto data DONTWAIT ok")
-                }
-                else
-                {
-                  PRINT_ERR("sndto data DONTWAIT NOK at low level")
-                }
-                socket_desc->state = COM_SOCKET_CONNECTED;
-              }
-              else
-              {
-                is_network_up = com_ip_modem_is_network_up();
-                /* Send all data of a big buffer - Whatever the size */
-                while ((length_send != (uint32_t)len)
-                       && (socket_desc->closing == false)
-                       && (is_network_up == true)
-                       && (socket_desc->state == COM_SOCKET_SENDING))
-                {
-                  length_to_send = COM_MIN((((uint32_t)len) - length_send),
-                                           COM_MODEM_MAX_TX_DATA_SIZE);
-                  com_ip_modem_wakeup_request();
-                  /* A tempo is already managed at low-level */
-                  if (osCDS_socket_sendto(socket_desc->id,
-                                          buf + length_send,
-                                          length_to_send,
-                                          socket_addr.ip_type,
-                                          socket_addr.ip_value,
-                                          socket_addr.port)
-                      == CELLULAR_OK)
-                  {
-                    length_send += length_to_send;
-                    PRINT_INFO("sndto data ok")
-                    /* Update Network status */
-                    is_network_up = com_ip_modem_is_network_up();
-                  }
-                  else
-                  {
-                    socket_desc->state = COM_SOCKET_CONNECTED;
-                    PRINT_ERR("sndto data NOK at low level")
-                  }
-                  com_ip_modem_idlemode_request(false);
-                }
-                socket_desc->state = COM_SOCKET_CONNECTED;
-                result = (int32_t)length_send;
-              }
-              com_ip_modem_idlemode_request(false);
-            }
-          }
-          else
-          {
-            if (socket_desc->closing == true)
-            {
-              PRINT_ERR("sndto data NOK socket closing")
-              result = COM_SOCKETS_ERR_CLOSING;
-            }
-            else
-            {
-              /* else result already updated com_ip_modem_connect_udp_service */
-            }
-          }
+         and if IPaddress in sendto equal to IPaddress in connect
+         decision is to return an error
+      */
+#if (UDP_SERVICE_SUPPORTED == 0U)
+      {
+        result = COM_SOCKETS_ERR_UNSUPPORTED;
+      }
+#else /* UDP_SERVICE_SUPPORTED == 1U */
+      {
+        socket_addr_t socket_addr;
+
+        result = com_ip_modem_sendto_addr(socket_desc, to, tolen, &socket_addr);
+
+        if (result == COM_SOCKETS_ERR_OK)
+        {
+          result = com_ip_modem_sendto_data(socket_desc, buf, len, flags, &socket_addr);
 
           com_sockets_statistic_update((result >= 0) ? \
                                        COM_SOCKET_STAT_SND_OK : COM_SOCKET_STAT_SND_NOK);
@@ -2321,6 +3230,7 @@ int32_t com_recv_ip_modem(int32_t sock,
   com_socket_msg_t msg_queue;
   rtosalStatus status_queue;
   socket_desc_t *socket_desc;
+  uint32_t lat_tick;
 
   result = COM_SOCKETS_ERR_PARAMETER;
   len_rcv = 0;
@@ -2330,15 +3240,41 @@ int32_t com_recv_ip_modem(int32_t sock,
       && (buf != NULL)
       && (len > 0))
   {
+#if (COM_SOCKETS_RX_READ_AHEAD == 1U)
+    /* Data already read from modem: provide them without AT transaction */
+    if ((socket_desc->rx_buf_len != 0U)
+        && ((socket_desc->state == COM_SOCKET_CONNECTED)
+            || (socket_desc->state == COM_SOCKET_CLOSING)))
+    {
+      len_rcv = (int32_t)com_ip_modem_rx_buf_read(socket_desc, buf, (uint32_t)len);
+      result = COM_SOCKETS_ERR_OK;
+      PRINT_DBG("rcv data from receive buffer")
+    }
+    else
+#endif /* COM_SOCKETS_RX_READ_AHEAD == 1U */
     /* Closing maybe received or Network maybe done
        but still some data to read */
     if (socket_desc->state == COM_SOCKET_CONNECTED)
     {
-      uint32_t length_to_read;
-      length_to_read = COM_MIN((uint32_t)len, COM_MODEM_MAX_RX_DATA_SIZE);
+#if (COM_SOCKETS_TX_COALESCING == 1U)
+      if (socket_desc->tx_coalescing == true)
+      {
+        /* Request maybe still coalesced: send it before to wait the response
+           if it can't be sent error is reported at next send */
+        (void)rtosalMutexAcquire(ComSocketsTxMutexHandle, RTOSAL_WAIT_FOREVER);
+        com_ip_modem_tx_send_buf(socket_desc);
+        (void)rtosalMutexRelease(ComSocketsTxMutexHandle);
+      }
+#endif /* COM_SOCKETS_TX_COALESCING == 1U */
       socket_desc->state = COM_SOCKET_WAITING_RSP;
+#if (COM_SOCKETS_POLL == 1U)
+      /* Data received URC is consumed by this receive */
+      socket_desc->rx_ready = false;
+#endif /* COM_SOCKETS_POLL == 1U */
 
       com_ip_modem_wakeup_request();
+      /* Receive transaction now keeps the modem awake */
+      com_ip_modem_rx_activity_release(socket_desc);
 
       /* Empty the queue from possible messages */
       com_ip_modem_empty_queue(socket_desc->queue);
@@ -2347,8 +3283,7 @@ int32_t com_recv_ip_modem(int32_t sock,
       {
 
         /* Application don't want to wait if there is no data available */
-        len_rcv = osCDS_socket_receive(socket_desc->id,
-                                       buf, length_to_read);
+        len_rcv = com_ip_modem_receive(socket_desc, buf, (uint32_t)len);
         result = (len_rcv < 0) ? COM_SOCKETS_ERR_GENERAL : COM_SOCKETS_ERR_OK;
         socket_desc->state = COM_SOCKET_CONNECTED;
         PRINT_INFO("rcv data DONTWAIT")
@@ -2358,15 +3293,16 @@ int32_t com_recv_ip_modem(int32_t sock,
         /* Maybe still some data available
            because application don't read all data with previous calls */
         PRINT_DBG("rcv data waiting")
-        len_rcv = osCDS_socket_receive(socket_desc->id,
-                                       buf, length_to_read);
+        len_rcv = com_ip_modem_receive(socket_desc, buf, (uint32_t)len);
         PRINT_DBG("rcv data waiting exit")
 
         if (len_rcv == 0)
         {
           /* Waiting for Distant response or Closure Socket or Timeout */
           msg_queue = 0U;
+          lat_tick = HAL_GetTick();
           status_queue = rtosalMessageQueueGet(socket_desc->queue, &msg_queue, socket_desc->rcv_timeout);
+          com_sockets_statistic_latency(COM_SOCKET_STAT_LAT_WAIT, lat_tick);
           if (status_queue == osEventTimeout)
           {
             result = COM_SOCKETS_ERR_TIMEOUT;
@@ -2382,8 +3318,7 @@ int32_t com_recv_ip_modem(int32_t sock,
               {
                 case COM_DATA_RCV :
                 {
-                  len_rcv = osCDS_socket_receive(socket_desc->id,
-                                                 buf, length_to_read);
+                  len_rcv = com_ip_modem_receive(socket_desc, buf, (uint32_t)len);
                   result = (len_rcv < 0) ? \
                            COM_SOCKETS_ERR_GENERAL : COM_SOCKETS_ERR_OK;
                   socket_desc->state = COM_SOCKET_CONNECTED;
@@ -2540,6 +3475,7 @@ int32_t com_recvfrom_ip_modem(int32_t sock,
         rtosalStatus status_queue;
         com_socket_msg_t msg_queue;
         CS_IPaddrType_t ip_addr_type;
+        uint32_t lat_tick;
 
         ip_addr_type = CS_IPAT_INVALID;
 
@@ -2557,6 +3493,12 @@ int32_t com_recvfrom_ip_modem(int32_t sock,
           uint32_t length_to_read;
           length_to_read = COM_MIN((uint32_t)len, COM_MODEM_MAX_RX_DATA_SIZE);
           socket_desc->state = COM_SOCKET_WAITING_FROM;
+#if (COM_SOCKETS_POLL == 1U)
+          /* Data received URC is consumed by this receive */
+          socket_desc->rx_ready = false;
+#endif /* COM_SOCKETS_POLL == 1U */
+          /* Receive transaction now keeps the modem awake */
+          com_ip_modem_rx_activity_release(socket_desc);
 
           /* Empty the queue from possible messages */
           com_ip_modem_empty_queue(socket_desc->queue);
@@ -2564,11 +3506,11 @@ int32_t com_recvfrom_ip_modem(int32_t sock,
           if (flags == COM_MSG_DONTWAIT)
           {
             /* Application don't want to wait if there is no data available */
-            len_rcv = osCDS_socket_receivefrom(socket_desc->id,
-                                               buf, length_to_read,
-                                               &ip_addr_type,
-                                               &ip_addr_value[0],
-                                               &ip_remote_port);
+            len_rcv = com_ip_modem_at_receivefrom(socket_desc,
+                                                  buf, length_to_read,
+                                                  &ip_addr_type,
+                                                  &ip_addr_value[0],
+                                                  &ip_remote_port);
             result = (len_rcv < 0) ? COM_SOCKETS_ERR_GENERAL : COM_SOCKETS_ERR_OK;
             socket_desc->state = COM_SOCKET_CONNECTED;
             PRINT_INFO("rcvfrom data DONTWAIT")
@@ -2578,11 +3520,11 @@ int32_t com_recvfrom_ip_modem(int32_t sock,
             /* Maybe still some data available
                because application don't read all data with previous calls */
             PRINT_DBG("rcvfrom data waiting")
-            len_rcv = osCDS_socket_receivefrom(socket_desc->id,
-                                               buf, length_to_read,
-                                               &ip_addr_type,
-                                               &ip_addr_value[0],
-                                               &ip_remote_port);
+            len_rcv = com_ip_modem_at_receivefrom(socket_desc,
+                                                  buf, length_to_read,
+                                                  &ip_addr_type,
+                                                  &ip_addr_value[0],
+                                                  &ip_remote_port);
             PRINT_DBG("rcvfrom data waiting exit")
 
             if (len_rcv == 0)
@@ -2590,7 +3532,9 @@ int32_t com_recvfrom_ip_modem(int32_t sock,
               /* Waiting for Distant response or Closure Socket or Timeout */
               PRINT_DBG("rcvfrom data waiting on MSGqueue")
               msg_queue = 0U;
+              lat_tick = HAL_GetTick();
               status_queue = rtosalMessageQueueGet(socket_desc->queue, &msg_queue, socket_desc->rcv_timeout);
+              com_sockets_statistic_latency(COM_SOCKET_STAT_LAT_WAIT, lat_tick);
               PRINT_DBG("rcvfrom data exit from MSGqueue")
               if (status_queue == osEventTimeout)
               {
@@ -2607,11 +3551,11 @@ int32_t com_recvfrom_ip_modem(int32_t sock,
                   {
                     case COM_DATA_RCV :
                     {
-                      len_rcv = osCDS_socket_receivefrom(socket_desc->id,
-                                                         buf, length_to_read,
-                                                         &ip_addr_type,
-                                                         &ip_addr_value[0],
-                                                         &ip_remote_port);
+                      len_rcv = com_ip_modem_at_receivefrom(socket_desc,
+                                                            buf, length_to_read,
+                                                            &ip_addr_type,
+                                                            &ip_addr_value[0],
+                                                            &ip_remote_port);
                       result = (len_rcv < 0) ? \
                                COM_SOCKETS_ERR_GENERAL : COM_SOCKETS_ERR_OK;
                       socket_desc->state = COM_SOCKET_CONNECTED;
@@ -2659,6 +3603,13 @@ int32_t com_recvfrom_ip_modem(int32_t sock,
 
           /* Empty the queue from possible messages */
           com_ip_modem_empty_queue(socket_desc->queue);
+#if (COM_SOCKETS_POLL == 1U)
+          /* A datagram has been read: others may be available */
+          if (len_rcv > 0)
+          {
+            socket_desc->rx_ready = true;
+          }
+#endif /* COM_SOCKETS_POLL == 1U */
         }
         else
         {
@@ -2695,6 +3646,158 @@ int32_t com_recvfrom_ip_modem(int32_t sock,
   return ((result == COM_SOCKETS_ERR_OK) ? len_rcv : result);
 }
 
+#if (COM_SOCKETS_MMSG == 1U)
+/**
+  * @brief  Socket send several datagrams
+  * @note   Send a burst of datagrams in one call
+  *         Socket and parameters are checked once and remote address translation
+  *         is reused while datagrams are sent to the same remote
+  *         Sending stops at the first datagram in error
+  * @param  sock      - socket handle obtained with com_socket
+  * @param  msgvec    - array of datagrams
+  * @note   msg_len of each datagram is updated with number of bytes sent or error value
+  * @param  vlen      - number of datagrams in msgvec
+  * @param  flags     - options (see com_sendto_ip_modem)
+  * @retval int32_t   - number of datagrams sent or error value of the first datagram
+  */
+int32_t com_sendmmsg_ip_modem(int32_t sock, com_mmsghdr_t *msgvec, uint32_t vlen, int32_t flags)
+{
+  int32_t result;
+  uint32_t i;
+  uint32_t nb_sent;
+  socket_desc_t *socket_desc;
+#if (UDP_SERVICE_SUPPORTED == 1U)
+  socket_addr_t socket_addr;
+  const com_sockaddr_t *socket_addr_to; /* remote address translated in socket_addr */
+  int32_t socket_addr_tolen;
+
+  socket_addr_to = NULL;
+  socket_addr_tolen = -1; /* no translation done yet */
+#endif /* UDP_SERVICE_SUPPORTED == 1U */
+
+  result = COM_SOCKETS_ERR_PARAMETER;
+  nb_sent = 0U;
+  socket_desc = com_ip_modem_find_socket(sock, false);
+
+  if ((socket_desc != NULL)
+      && (msgvec != NULL)
+      && (vlen > 0U))
+  {
+    result = COM_SOCKETS_ERR_OK;
+
+    for (i = 0U; (i < vlen) && (result >= 0); i++)
+    {
+#if (UDP_SERVICE_SUPPORTED == 1U)
+      if (socket_desc->type == (uint8_t)COM_SOCK_DGRAM)
+      {
+        result = COM_SOCKETS_ERR_PARAMETER;
+        if ((msgvec[i].msg_buf != NULL)
+            && (msgvec[i].msg_buflen > 0))
+        {
+          /* Same remote as previous datagram: translation is reused */
+          if ((msgvec[i].msg_name == socket_addr_to)
+              && (msgvec[i].msg_namelen == socket_addr_tolen))
+          {
+            result = COM_SOCKETS_ERR_OK;
+          }
+          else
+          {
+            result = com_ip_modem_sendto_addr(socket_desc,
+                                              msgvec[i].msg_name, msgvec[i].msg_namelen,
+                                              &socket_addr);
+            if (result == COM_SOCKETS_ERR_OK)
+            {
+              socket_addr_to = msgvec[i].msg_name;
+              socket_addr_tolen = msgvec[i].msg_namelen;
+            }
+          }
+
+          if (result == COM_SOCKETS_ERR_OK)
+          {
+            result = com_ip_modem_sendto_data(socket_desc,
+                                              msgvec[i].msg_buf, msgvec[i].msg_buflen,
+                                              flags, &socket_addr);
+
+            com_sockets_statistic_update((result >= 0) ? \
+                                         COM_SOCKET_STAT_SND_OK : COM_SOCKET_STAT_SND_NOK);
+          }
+        }
+        SOCKET_SET_ERROR(socket_desc, (result >= 0) ? COM_SOCKETS_ERR_OK : result);
+      }
+      else
+#endif /* UDP_SERVICE_SUPPORTED == 1U */
+      {
+        result = com_sendto_ip_modem(sock,
+                                     msgvec[i].msg_buf, msgvec[i].msg_buflen,
+                                     flags,
+                                     msgvec[i].msg_name, msgvec[i].msg_namelen);
+      }
+
+      msgvec[i].msg_len = result;
+      if (result >= 0)
+      {
+        nb_sent++;
+      }
+    }
+
+    if (nb_sent > 0U)
+    {
+      result = (int32_t)nb_sent;
+    }
+  }
+
+  return (result);
+}
+
+/**
+  * @brief  Socket receive several datagrams
+  * @note   Wait for a first datagram then receive the datagrams already available
+  *         (each datagram is still a modem receive request)
+  * @param  sock      - socket handle obtained with com_socket
+  * @param  msgvec    - array of datagrams
+  * @note   msg_len of each datagram is updated with number of bytes received or error value
+  *         msg_name/msg_namelen are updated as in com_recvfrom_ip_modem
+  * @param  vlen      - number of datagrams in msgvec
+  * @param  flags     - options for the first datagram (see com_recvfrom_ip_modem)
+  * @retval int32_t   - number of datagrams received or result of the first datagram
+  */
+int32_t com_recvmmsg_ip_modem(int32_t sock, com_mmsghdr_t *msgvec, uint32_t vlen, int32_t flags)
+{
+  int32_t result;
+  int32_t rcv_flags;
+  uint32_t nb_rcv;
+
+  result = COM_SOCKETS_ERR_PARAMETER;
+  nb_rcv = 0U;
+
+  if ((msgvec != NULL) && (vlen > 0U))
+  {
+    /* Wait for the first datagram according to flags, then only read datagrams already available */
+    rcv_flags = flags;
+    do
+    {
+      result = com_recvfrom_ip_modem(sock,
+                                     msgvec[nb_rcv].msg_buf, msgvec[nb_rcv].msg_buflen,
+                                     rcv_flags,
+                                     msgvec[nb_rcv].msg_name, &msgvec[nb_rcv].msg_namelen);
+      msgvec[nb_rcv].msg_len = result;
+      if (result > 0)
+      {
+        nb_rcv++;
+        rcv_flags = COM_MSG_DONTWAIT;
+      }
+    } while ((result > 0) && (nb_rcv < vlen));
+
+    if (nb_rcv > 0U)
+    {
+      result = (int32_t)nb_rcv;
+    }
+  }
+
+  return (result);
+}
+#endif /* COM_SOCKETS_MMSG == 1U */
+
 
 /**
   * @brief  Socket close
@@ -2725,10 +3828,17 @@ int32_t com_closesocket_ip_modem(int32_t sock)
     {
       result = COM_SOCKETS_ERR_GENERAL;
       com_ip_modem_wakeup_request();
-      if (osCDS_socket_close(sock, 0U)
+#if (COM_SOCKETS_TX_COALESCING == 1U)
+      if (socket_desc->tx_coalescing == true)
+      {
+        /* Best effort: send coalesced data before to close */
+        (void)com_ip_modem_tx_flush(socket_desc);
+      }
+#endif /* COM_SOCKETS_TX_COALESCING == 1U */
+      if (osCDS_socket_close(socket_desc->id, 0U)
           == CELLULAR_OK)
       {
-        com_ip_modem_delete_socket_desc(sock, false);
+        com_ip_modem_delete_socket_desc(socket_desc);
         result = COM_SOCKETS_ERR_OK;
         PRINT_INFO("close socket ok")
       }
@@ -2746,6 +3856,120 @@ int32_t com_closesocket_ip_modem(int32_t sock)
   return (result);
 }
 
+#if (COM_SOCKETS_TCP_POOL == 1U)
+/**
+  * @brief  Socket connect using the connection pool
+  * @note   Hand out an idle connection of the pool to the same remote
+  *         if it passes the health check,
+  *         else create a TCP socket and connect it
+  * @param  addr      - remote IP address and port
+  * @note   only an IPv4 address is supported
+  * @param  addrlen   - addr length
+  * @retval int32_t   - socket handle or error value
+  */
+int32_t com_connect_pooled_ip_modem(const com_sockaddr_t *addr, int32_t addrlen)
+{
+  int32_t result;
+  int32_t sock;
+  com_ip_addr_t remote_addr;
+  uint16_t remote_port;
+  socket_desc_t *socket_desc;
+
+  if ((addr == NULL)
+      || (addrlen != (int32_t)sizeof(com_sockaddr_in_t))
+      || (addr->sa_family != (uint8_t)COM_AF_INET))
+  {
+    result = COM_SOCKETS_ERR_PARAMETER;
+  }
+  else
+  {
+    com_convert_sockaddr_to_ipaddr_port((const com_sockaddr_in_t *)addr,
+                                        &remote_addr,
+                                        &remote_port);
+    socket_desc = com_ip_modem_pool_get(&remote_addr, remote_port);
+
+    if (socket_desc != NULL)
+    {
+      /* No socket creation and connection to do */
+      result = SOCKET_HANDLE(socket_desc);
+    }
+    else
+    {
+      result = com_socket_ip_modem(COM_AF_INET, COM_SOCK_STREAM, COM_IPPROTO_TCP);
+      if (result >= 0)
+      {
+        sock = result;
+        result = com_connect_ip_modem(sock, addr, addrlen);
+        if (result == COM_SOCKETS_ERR_OK)
+        {
+          result = sock;
+        }
+        else
+        {
+          (void)com_closesocket_ip_modem(sock);
+        }
+      }
+    }
+  }
+
+  return result;
+}
+
+/**
+  * @brief  Socket close keeping the connection in the pool
+  * @note   A TCP connection without error and without unread data is kept in the pool
+  *         to be handed out by com_connect_pooled until COM_SOCKETS_TCP_POOL_IDLE_TIMEOUT
+  *         else (or if pool is full) the socket is closed
+  *         In both cases the socket handle is released
+  * @param  sock      - socket handle obtained with com_socket or com_connect_pooled
+  * @retval int32_t   - ok or error value
+  */
+int32_t com_closesocket_pooled_ip_modem(int32_t sock)
+{
+  int32_t result;
+  bool pooled;
+  socket_desc_t *socket_desc;
+
+  pooled = false;
+  socket_desc = com_ip_modem_find_socket(sock, false);
+
+  if ((socket_desc != NULL)
+      && (socket_desc->type == (uint8_t)COM_SOCK_STREAM)
+      && (socket_desc->state == COM_SOCKET_CONNECTED)
+      && (socket_desc->closing == false)
+      && (socket_desc->error != COM_SOCKETS_ERR_GENERAL)
+      && (com_ip_modem_is_network_up() == true)
+#if (COM_SOCKETS_RX_READ_AHEAD == 1U)
+      && (socket_desc->rx_buf_len == 0U)
+#endif /* COM_SOCKETS_RX_READ_AHEAD == 1U */
+#if (COM_SOCKETS_POLL == 1U)
+      && (socket_desc->rx_ready == false)
+#endif /* COM_SOCKETS_POLL == 1U */
+     )
+  {
+#if (COM_SOCKETS_TX_COALESCING == 1U)
+    /* Coalesced data are sent and coalescing is deactivated for next user */
+    if (com_ip_modem_tx_coalescing(socket_desc, false) == COM_SOCKETS_ERR_OK)
+#endif /* COM_SOCKETS_TX_COALESCING == 1U */
+    {
+      pooled = com_ip_modem_pool_put(socket_desc);
+    }
+  }
+
+  if (pooled == true)
+  {
+    PRINT_INFO("socket %ld put in pool", socket_desc->id)
+    result = COM_SOCKETS_ERR_OK;
+  }
+  else
+  {
+    result = com_closesocket_ip_modem(sock);
+  }
+
+  return result;
+}
+#endif /* COM_SOCKETS_TCP_POOL == 1U */
+
 
 /*** Other functionalities ****************************************************/
 
@@ -2778,32 +4002,40 @@ int32_t com_gethostbyname_ip_modem(const com_char_t *name,
       (void)strcpy((CSIP_CHAR_t *)&dns_req.host_name[0],
                    (const CSIP_CHAR_t *)name);
 
-      result = COM_SOCKETS_ERR_GENERAL;
-      com_ip_modem_wakeup_request();
-      if (osCDS_dns_request(PDN_conf_id,
-                            &dns_req,
-                            &dns_resp)
-          == CELLULAR_OK)
+      if (com_ip_modem_is_network_up() == false)
       {
-        PRINT_INFO("DNS resolution OK - Remote: %s IP: %s", name, dns_resp.host_addr)
-        if (com_convert_IPString_to_sockaddr(0U,
-                                             (com_char_t *)&dns_resp.host_addr[0],
-                                             addr)
-            == true)
+        result = COM_SOCKETS_ERR_NONETWORK;
+        PRINT_ERR("DNS resolution NOK no network")
+      }
+      else
+      {
+        result = COM_SOCKETS_ERR_GENERAL;
+        com_ip_modem_wakeup_request();
+        if (osCDS_dns_request(PDN_conf_id,
+                              &dns_req,
+                              &dns_resp)
+            == CELLULAR_OK)
         {
-          PRINT_DBG("DNS conversion OK")
-          result = COM_SOCKETS_ERR_OK;
+          PRINT_INFO("DNS resolution OK - Remote: %s IP: %s", name, dns_resp.host_addr)
+          if (com_convert_IPString_to_sockaddr(0U,
+                                               (com_char_t *)&dns_resp.host_addr[0],
+                                               addr)
+              == true)
+          {
+            PRINT_DBG("DNS conversion OK")
+            result = COM_SOCKETS_ERR_OK;
+          }
+          else
+          {
+            PRINT_ERR("DNS conversion NOK")
+          }
         }
         else
         {
-          PRINT_ERR("DNS conversion NOK")
+          PRINT_ERR("DNS resolution NOK for %s", name)
         }
+        com_ip_modem_idlemode_request(false);
       }
-      else
-      {
-        PRINT_ERR("DNS resolution NOK for %s", name)
-      }
-      com_ip_modem_idlemode_request(false);
     }
   }
 
@@ -2848,6 +4080,98 @@ int32_t com_getsockname_ip_modem(int32_t sock,
   return COM_SOCKETS_ERR_UNSUPPORTED;
 }
 
+#if (COM_SOCKETS_POLL == 1U)
+/**
+  * @brief  Wait for events on several sockets
+  * @note   Readiness is updated by modem URC data received and socket closing
+  *         COM_POLLIN : data already read from modem or data received URC not yet consumed by a receive
+  *         COM_POLLOUT: socket connected (or UDP socket created) and no other request in progress on it
+  *         COM_POLLHUP: socket closed by remote
+  *         COM_POLLERR: network down or last request on the socket in error
+  * @param  fds       - array of poll descriptors
+  * @param  nfds      - number of entries in fds
+  * @param  timeout   - maximum time to wait (in ms) - 0: no wait, < 0: wait forever
+  * @retval int32_t   - number of entries with revents != 0, 0 if timeout or error value
+  *                     COM_SOCKETS_ERR_NOMEMORY if COM_POLL_WAITER_NB tasks are already waiting
+  */
+int32_t com_poll_ip_modem(com_pollfd_t *fds, uint32_t nfds, int32_t timeout)
+{
+  int32_t result;
+  uint8_t waiter;
+  uint32_t tick_start;
+  uint32_t elapsed;
+  uint32_t wait_time;
+  bool expired;
+
+  if ((fds == NULL) || (nfds == 0U))
+  {
+    result = COM_SOCKETS_ERR_PARAMETER;
+  }
+  else
+  {
+    tick_start = HAL_GetTick();
+
+    /* Register as waiting before the scan: an event during the scan is not lost */
+    (void)rtosalMutexAcquire(ComSocketsMutexHandle, RTOSAL_WAIT_FOREVER);
+    waiter = 0U;
+    while ((waiter < COM_POLL_WAITER_NB) && (com_poll_waiter_used[waiter] == true))
+    {
+      waiter++;
+    }
+    if (waiter < COM_POLL_WAITER_NB)
+    {
+      com_poll_waiter_used[waiter] = true;
+      /* Forget a wake up addressed to the previous user of the slot */
+      (void)rtosalSemaphoreAcquire(ComSocketsPollSemaphore[waiter], 0U);
+    }
+    (void)rtosalMutexRelease(ComSocketsMutexHandle);
+
+    if (waiter < COM_POLL_WAITER_NB)
+    {
+      result = com_ip_modem_poll_scan(fds, nfds);
+      expired = (timeout == 0) ? true : false;
+
+      while ((result == 0) && (expired == false))
+      {
+        if (timeout < 0)
+        {
+          wait_time = RTOSAL_WAIT_FOREVER;
+        }
+        else
+        {
+          elapsed = HAL_GetTick() - tick_start;
+          if (elapsed >= (uint32_t)timeout)
+          {
+            expired = true;
+            wait_time = 0U;
+          }
+          else
+          {
+            wait_time = (uint32_t)timeout - elapsed;
+          }
+        }
+        if (expired == false)
+        {
+          /* Woken up by an event on a socket or timeout: scan again */
+          (void)rtosalSemaphoreAcquire(ComSocketsPollSemaphore[waiter], wait_time);
+          result = com_ip_modem_poll_scan(fds, nfds);
+        }
+      }
+
+      (void)rtosalMutexAcquire(ComSocketsMutexHandle, RTOSAL_WAIT_FOREVER);
+      com_poll_waiter_used[waiter] = false;
+      (void)rtosalMutexRelease(ComSocketsMutexHandle);
+    }
+    else
+    {
+      result = COM_SOCKETS_ERR_NOMEMORY;
+    }
+  }
+
+  return result;
+}
+#endif /* COM_SOCKETS_POLL == 1U */
+
 
 /*** Ping functionalities *****************************************************/
 
@@ -2863,8 +4187,8 @@ int32_t com_ping_ip_modem(void)
   int32_t result;
   socket_desc_t *socket_desc;
 
-  /* Need to create a new socket_desc ? */
-  socket_desc = com_ip_modem_provide_socket_desc(true);
+  /* Provide a free local socket_desc */
+  socket_desc = com_ip_modem_provide_socket_desc(COM_SOCKET_INVALID_ID, true);
   if (socket_desc == NULL)
   {
     result = COM_SOCKETS_ERR_NOMEMORY;
@@ -2881,7 +4205,7 @@ int32_t com_ping_ip_modem(void)
     com_ip_modem_wakeup_request(); /* to avoid to be stopped by a close socket */
   }
 
-  return ((result == COM_SOCKETS_ERR_OK) ? socket_desc->id : result);
+  return ((result == COM_SOCKETS_ERR_OK) ? SOCKET_HANDLE(socket_desc) : result);
 }
 
 
@@ -2957,8 +4281,8 @@ int32_t com_ping_process_ip_modem(int32_t ping,
       }
       else
       {
-        /* No ping in progress => assign id to ping_socket_id */
-        ping_socket_id = socket_desc->id;
+        /* No ping in progress => assign handle to ping_socket_id */
+        ping_socket_id = ping;
         /* result already set to the correct value COM_SOCKETS_ERR_OK */
       }
       (void)rtosalMutexRelease(ComSocketsMutexHandle);
@@ -3110,7 +4434,7 @@ int32_t com_ping_process_ip_modem(int32_t ping,
 int32_t com_closeping_ip_modem(int32_t ping)
 {
   int32_t result;
-  const socket_desc_t *socket_desc;
+  socket_desc_t *socket_desc;
 
   result = COM_SOCKETS_ERR_PARAMETER;
   socket_desc = com_ip_modem_find_socket(ping, true);
@@ -3126,7 +4450,7 @@ int32_t com_closeping_ip_modem(int32_t ping)
     }
     else
     {
-      com_ip_modem_delete_socket_desc(ping, true);
+      com_ip_modem_delete_socket_desc(socket_desc);
       result = COM_SOCKETS_ERR_OK;
       PRINT_INFO("close ping ok")
       com_ip_modem_idlemode_request(true); /* same behavior than all sockets closed */
@@ -3162,38 +4486,74 @@ bool com_init_ip_modem(void)
   ping_socket_id = COM_SOCKET_INVALID_ID;
 #endif /* USE_COM_PING == 1 */
 
-  for (uint8_t i = 0U; i < COM_SOCKET_LOCAL_ID_NB; i++)
-  {
-    socket_local_id[i] = false; /* set socket local id to unused */
-  }
-
-  /* Initialize Mutex to protect socket descriptor list access */
+  /* Initialize Mutex to protect socket descriptor table access */
   ComSocketsMutexHandle = rtosalMutexNew(NULL);
   if (ComSocketsMutexHandle != NULL)
   {
-    /* Create always the first element of the list */
-    socket_desc_list = com_ip_modem_create_socket_desc();
-    if (socket_desc_list != NULL)
+    /* Create all the descriptors of the table */
+    result = true;
+    for (uint8_t i = 0U; i < COM_SOCKET_DESC_NB; i++)
     {
-      result = true;
+      if (com_ip_modem_create_socket_desc(&socket_desc_table[i]) == false)
+      {
+        result = false;
+      }
     }
   }
 
-#if (USE_LOW_POWER == 1)
-  /* Initialize Timer inactivity and its Mutex to check inactivity on socket */
-  ComTimerInactivityId = rtosalTimerNew(NULL, (os_ptimer)com_ip_modem_timer_inactivity_cb, osTimerOnce, NULL);
-  ComTimerInactivityMutexHandle = rtosalMutexNew(NULL);
-  if ((ComTimerInactivityId == NULL) || (ComTimerInactivityMutexHandle == NULL))
+#if (COM_SOCKETS_TX_COALESCING == 1U)
+  /* Initialize Mutex to protect send coalescing buffers access */
+  ComSocketsTxMutexHandle = rtosalMutexNew(NULL);
+  if (ComSocketsTxMutexHandle == NULL)
+  {
+    result = false;
+  }
+#endif /* COM_SOCKETS_TX_COALESCING == 1U */
+
+#if (COM_THREAD_ACTIVATED == 1U)
+  /* Initialize ComSockets thread doing the AT transactions when the timers are raised */
+  ComSocketsThreadQueue = rtosalMessageQueueNew(NULL, COM_THREAD_QUEUE_SIZE);
+  if (ComSocketsThreadQueue == NULL)
+  {
+    result = false;
+  }
+  else if (rtosalThreadNew((const rtosal_char_t *)"ComSockets", (os_pthread)com_ip_modem_thread,
+                           COM_SOCKETS_THREAD_PRIO, (uint32_t)COM_SOCKETS_THREAD_STACK_SIZE, NULL) == NULL)
   {
-    com_timer_inactivity_state = COM_TIMER_INVALID;
     result = false;
   }
   else
   {
-    com_timer_inactivity_state = COM_TIMER_IDLE;
+    /* ComSockets thread waits for the requests */
   }
-  com_nb_wake_up = 0U;
-#endif /* USE_LOW_POWER == 1 */
+#endif /* COM_THREAD_ACTIVATED == 1U */
+
+#if (COM_SOCKETS_TCP_POOL == 1U)
+  /* Initialize Timer to close the idle connections of the pool */
+  ComSocketsPoolTimerId = rtosalTimerNew(NULL, (os_ptimer)com_ip_modem_pool_timer_cb, osTimerOnce, NULL);
+  if (ComSocketsPoolTimerId == NULL)
+  {
+    result = false;
+  }
+#endif /* COM_SOCKETS_TCP_POOL == 1U */
+
+#if (COM_SOCKETS_POLL == 1U)
+  /* Initialize Semaphores to wake up the tasks waiting in com_poll */
+  for (uint8_t i = 0U; i < COM_POLL_WAITER_NB; i++)
+  {
+    com_poll_waiter_used[i] = false;
+    ComSocketsPollSemaphore[i] = rtosalSemaphoreNew(NULL, 1U);
+    if (ComSocketsPollSemaphore[i] == NULL)
+    {
+      result = false;
+    }
+    else
+    {
+      /* Semaphore is created available: take it so that the first wait blocks */
+      (void)rtosalSemaphoreAcquire(ComSocketsPollSemaphore[i], 0U);
+    }
+  }
+#endif /* COM_SOCKETS_POLL == 1U */
 
 #if (UDP_SERVICE_SUPPORTED == 1U)
   com_local_port = 0U; /* com_start_ip in charge to initialize it to a random value */
@@ -3213,8 +4573,11 @@ bool com_init_ip_modem(void)
   */
 void com_start_ip_modem(void)
 {
+  dc_com_reg_id_t reg_id;
+
   /* Datacache registration for netwok on/off status */
-  (void)dc_com_core_register_gen_event_cb(&dc_com_db, com_socket_datacache_cb, (void *)NULL);
+  reg_id = dc_com_core_register_gen_event_cb(&dc_com_db, com_socket_datacache_cb, (void *)NULL);
+  (void)dc_com_set_res_mask(&dc_com_db, reg_id, DC_COM_RES_MASK(DC_CELLULAR_NIFMAN_INFO));
 
 #if (UDP_SERVICE_SUPPORTED == 1U)
   uint32_t random;
@@ -258,6 +258,97 @@ int32_t com_recvfrom_lwip_mcu(int32_t sock,
   return lwip_recvfrom(sock, buf, (size_t)len, flags, (struct sockaddr *)from, fromlen);
 }
 
+#if (COM_SOCKETS_MMSG == 1U)
+/**
+  * @brief  Socket send several datagrams
+  * @note   Send a burst of datagrams in one call
+  *         Restrictions, if any, are linked to LwIP module used
+  *         Sending stops at the first datagram in error
+  * @param  sock      - socket handle obtained with com_socket
+  * @param  msgvec    - array of datagrams
+  * @param  vlen      - number of datagrams in msgvec
+  * @param  flags     - options
+  * @retval int32_t   - number of datagrams sent or error value of the first datagram
+  */
+int32_t com_sendmmsg_lwip_mcu(int32_t sock, com_mmsghdr_t *msgvec, uint32_t vlen, int32_t flags)
+{
+  int32_t result;
+  uint32_t nb_sent;
+
+  result = (int32_t)ERR_ARG;
+  nb_sent = 0U;
+
+  if ((msgvec != NULL) && (vlen > 0U))
+  {
+    do
+    {
+      result = com_sendto_lwip_mcu(sock,
+                                   msgvec[nb_sent].msg_buf, msgvec[nb_sent].msg_buflen,
+                                   flags,
+                                   msgvec[nb_sent].msg_name, msgvec[nb_sent].msg_namelen);
+      msgvec[nb_sent].msg_len = result;
+      if (result >= 0)
+      {
+        nb_sent++;
+      }
+    } while ((result >= 0) && (nb_sent < vlen));
+
+    if (nb_sent > 0U)
+    {
+      result = (int32_t)nb_sent;
+    }
+  }
+
+  return result;
+}
+
+/**
+  * @brief  Socket receive several datagrams
+  * @note   Wait for a first datagram then receive the datagrams already available
+  *         Restrictions, if any, are linked to LwIP module used
+  * @param  sock      - socket handle obtained with com_socket
+  * @param  msgvec    - array of datagrams
+  * @param  vlen      - number of datagrams in msgvec
+  * @param  flags     - options for the first datagram
+  * @retval int32_t   - number of datagrams received or result of the first datagram
+  */
+int32_t com_recvmmsg_lwip_mcu(int32_t sock, com_mmsghdr_t *msgvec, uint32_t vlen, int32_t flags)
+{
+  int32_t result;
+  int32_t rcv_flags;
+  uint32_t nb_rcv;
+
+  result = (int32_t)ERR_ARG;
+  nb_rcv = 0U;
+
+  if ((msgvec != NULL) && (vlen > 0U))
+  {
+    /* Wait for the first datagram according to flags, then only read datagrams already available */
+    rcv_flags = flags;
+    do
+    {
+      result = com_recvfrom_lwip_mcu(sock,
+                                     msgvec[nb_rcv].msg_buf, msgvec[nb_rcv].msg_buflen,
+                                     rcv_flags,
+                                     msgvec[nb_rcv].msg_name, &msgvec[nb_rcv].msg_namelen);
+      msgvec[nb_rcv].msg_len = result;
+      if (result > 0)
+      {
+        nb_rcv++;
+        rcv_flags = COM_MSG_DONTWAIT;
+      }
+    } while ((result > 0) && (nb_rcv < vlen));
+
+    if (nb_rcv > 0U)
+    {
+      result = (int32_t)nb_rcv;
+    }
+  }
+
+  return result;
+}
+#endif /* COM_SOCKETS_MMSG == 1U */
+
 
 /**
   * @brief  Socket close
@@ -271,6 +362,52 @@ int32_t com_closesocket_lwip_mcu(int32_t sock)
   return lwip_close(sock);
 }
 
+#if (COM_SOCKETS_TCP_POOL == 1U)
+/**
+  * @brief  Socket connect using the connection pool
+  * @note   No connection pool with LwIP: create a TCP socket and connect it
+  * @param  addr      - remote IP address and port
+  * @param  addrlen   - addr length
+  * @retval int32_t   - socket handle or error value
+  */
+int32_t com_connect_pooled_lwip_mcu(const com_sockaddr_t *addr, int32_t addrlen)
+{
+  int32_t result;
+  int32_t sock;
+
+  sock = com_socket_lwip_mcu(COM_AF_INET, COM_SOCK_STREAM, COM_IPPROTO_TCP);
+  if (sock >= 0)
+  {
+    result = com_connect_lwip_mcu(sock, addr, addrlen);
+    if (result == 0)
+    {
+      result = sock;
+    }
+    else
+    {
+      (void)com_closesocket_lwip_mcu(sock);
+    }
+  }
+  else
+  {
+    result = sock;
+  }
+
+  return result;
+}
+
+/**
+  * @brief  Socket close keeping the connection in the pool
+  * @note   No connection pool with LwIP: close the socket
+  * @param  sock      - socket handle obtained with com_socket or com_connect_pooled
+  * @retval int32_t   - ok or error value
+  */
+int32_t com_closesocket_pooled_lwip_mcu(int32_t sock)
+{
+  return com_closesocket_lwip_mcu(sock);
+}
+#endif /* COM_SOCKETS_TCP_POOL == 1U */
+
 
 /*** Other functionalities ****************************************************/
 
@@ -342,6 +479,21 @@ int32_t com_getsockname_lwip_mcu(int32_t sock,
   return lwip_getsockname(sock, (struct sockaddr *)name, namelen);
 }
 
+#if (COM_SOCKETS_POLL == 1U)
+/**
+  * @brief  Wait for events on several sockets
+  * @note   Restrictions, if any, are linked to LwIP module used
+  * @param  fds       - array of poll descriptors
+  * @param  nfds      - number of entries in fds
+  * @param  timeout   - maximum time to wait (in ms) - 0: no wait, < 0: wait forever
+  * @retval int32_t   - number of entries with revents != 0, 0 if timeout or error value
+  */
+int32_t com_poll_lwip_mcu(com_pollfd_t *fds, uint32_t nfds, int32_t timeout)
+{
+  return lwip_poll(fds, (nfds_t)nfds, (timeout < 0) ? -1 : timeout);
+}
+#endif /* COM_SOCKETS_POLL == 1U */
+
 
 /*** Ping functionalities *****************************************************/
 
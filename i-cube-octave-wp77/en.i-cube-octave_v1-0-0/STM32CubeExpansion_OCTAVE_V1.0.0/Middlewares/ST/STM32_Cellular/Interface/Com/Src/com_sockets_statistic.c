@@ -30,11 +30,27 @@
 
 #include "dc_common.h"
 
+#include "com_err.h"
+#include "cellular_service.h"
+
 /* Private defines -----------------------------------------------------------*/
 
 /* Private typedef -----------------------------------------------------------*/
 
 /* Private defines -----------------------------------------------------------*/
+/* Error breakdown: index is -error code, from COM_ERR_OK to COM_ERR_NOICC */
+#define COM_SOCKETS_STAT_ERR_NB      (15U)
+
+/* Window used to compute the peak throughput */
+#define COM_SOCKETS_STAT_PEAK_WINDOW (1000U) /* in ms */
+
+/* Size of the binary export - see com_sockets_statistic_export() */
+#define COM_SOCKETS_STAT_EXPORT_SIZE (5U + (12U * 2U) + (4U * 4U) + (CELLULAR_MAX_SOCKETS * 8U) \
+                                      + (COM_SOCKET_STAT_LAT_NB * (12U + (COM_SOCKETS_STAT_LAT_BUCKET_NB * 2U))) \
+                                      + (COM_SOCKETS_STAT_ERR_NB * 2U))
+#if (COM_SOCKETS_STAT_EXPORT_SIZE > COM_SOCKETS_STAT_EXPORT_SIZE_MAX)
+#error COM_SOCKETS_STAT_EXPORT_SIZE_MAX too small for statistics export
+#endif /* COM_SOCKETS_STAT_EXPORT_SIZE > COM_SOCKETS_STAT_EXPORT_SIZE_MAX */
 
 /* Private typedef -----------------------------------------------------------*/
 /* Socket statistics counter definition */
@@ -51,8 +67,35 @@ typedef struct {
 	com_sockets_stat_counter_t receive;
 	com_sockets_stat_counter_t close;
 	com_sockets_stat_counter_t network;
+	uint16_t coalesced; /* application writes coalesced in a send buffer */
+	uint16_t flush;     /* modem sends of coalesced data */
 } com_socket_statistic_t;
 
+/* Socket bytes counter definition */
+typedef struct {
+	uint32_t tx;
+	uint32_t rx;
+} com_sockets_stat_bytes_t;
+
+/* Latency statistics definition */
+typedef struct {
+	uint32_t max;
+	uint32_t sum;
+	uint32_t count;
+	uint16_t bucket[COM_SOCKETS_STAT_LAT_BUCKET_NB];
+} com_sockets_stat_latency_entry_t;
+
+/* Throughput statistics definition */
+typedef struct {
+	com_sockets_stat_bytes_t total;                         /* since init */
+	com_sockets_stat_bytes_t sock[CELLULAR_MAX_SOCKETS];    /* since socket creation */
+	com_sockets_stat_bytes_t window;                        /* in current peak window */
+	com_sockets_stat_bytes_t peak;                          /* bytes/s */
+	uint32_t window_tick;                                   /* start of current peak window */
+	com_sockets_stat_latency_entry_t latency[COM_SOCKET_STAT_LAT_NB];
+	uint16_t error[COM_SOCKETS_STAT_ERR_NB];
+} com_socket_statistic_data_t;
+
 /* Private macros ------------------------------------------------------------*/
 
 /* Private variables ---------------------------------------------------------*/
@@ -76,6 +119,18 @@ static const uint8_t *com_socket_state_string[] =
 /* Statistic socket variable */
 static com_socket_statistic_t com_socket_statistic;
 
+/* Statistic socket throughput/latency/error variable */
+static com_socket_statistic_data_t com_socket_statistic_data;
+
+/* Statistic latency readable print, used by com_sockets_statistic_display() whatever the trace configuration */
+static const char *com_socket_latency_string[COM_SOCKET_STAT_LAT_NB] =
+{
+  "Cnt",
+  "Snd",
+  "Rcv",
+  "Wai"
+};
+
 /* Private typedef -----------------------------------------------------------*/
 
 /* Private macros ------------------------------------------------------------*/
@@ -90,6 +145,8 @@ static com_socket_statistic_t com_socket_statistic;
 #if (COM_SOCKETS_STATISTIC_PERIOD != 0U)
 static void com_socket_statistic_timer_cb(void *argument);
 #endif /* COM_SOCKETS_STATISTIC_PERIOD != 0U */
+static void com_socket_statistic_peak(void);
+static uint32_t com_socket_statistic_put(uint8_t *p_buf, uint32_t offset, uint32_t value, uint8_t len);
 
 /* Private function Definition -----------------------------------------------*/
 
@@ -108,6 +165,51 @@ static void com_socket_statistic_timer_cb(void *argument)
 }
 #endif /* COM_SOCKETS_STATISTIC_PERIOD != 0U */
 
+/**
+ * @brief  Close the peak window if elapsed
+ * @note   peak is the throughput of the best window
+ * @param  -
+ * @retval -
+ */
+static void com_socket_statistic_peak(void) {
+	uint32_t elapsed;
+	uint32_t rate;
+
+	elapsed = HAL_GetTick() - com_socket_statistic_data.window_tick;
+	if (elapsed >= COM_SOCKETS_STAT_PEAK_WINDOW) {
+		rate = (uint32_t)(((uint64_t)com_socket_statistic_data.window.tx * 1000U) / elapsed);
+		if (rate > com_socket_statistic_data.peak.tx) {
+			com_socket_statistic_data.peak.tx = rate;
+		}
+		rate = (uint32_t)(((uint64_t)com_socket_statistic_data.window.rx * 1000U) / elapsed);
+		if (rate > com_socket_statistic_data.peak.rx) {
+			com_socket_statistic_data.peak.rx = rate;
+		}
+		com_socket_statistic_data.window.tx = 0U;
+		com_socket_statistic_data.window.rx = 0U;
+		com_socket_statistic_data.window_tick = HAL_GetTick();
+	}
+}
+
+/**
+ * @brief  Write a value in little endian
+ * @note   -
+ * @param  p_buf  - buffer to fill
+ * @param  offset - where to write in the buffer
+ * @param  value  - value to write
+ * @param  len    - number of bytes to write (1, 2 or 4)
+ * @retval uint32_t - offset after the value
+ */
+static uint32_t com_socket_statistic_put(uint8_t *p_buf, uint32_t offset, uint32_t value, uint8_t len) {
+	uint32_t i;
+
+	for (i = 0U; i < len; i++) {
+		p_buf[offset + i] = (uint8_t)(value >> (8U * i));
+	}
+
+	return (offset + len);
+}
+
 /* Functions Definition ------------------------------------------------------*/
 
 /*** Used by com_sockets module - Not an User Interface ***********************/
@@ -126,6 +228,8 @@ void com_sockets_statistic_init(void) {
 
 	/* Initialize socket statistics structure to 0U */
 	(void) memset(&com_socket_statistic, 0, sizeof(com_socket_statistic_t));
+	(void) memset(&com_socket_statistic_data, 0, sizeof(com_socket_statistic_data_t));
+	com_socket_statistic_data.window_tick = HAL_GetTick();
 
 #if (COM_SOCKETS_STATISTIC_PERIOD != 0U)
   /* Timer creation */
@@ -189,12 +293,184 @@ void com_sockets_statistic_update(com_sockets_stat_update_t stat) {
 	case COM_SOCKET_STAT_CLS_NOK:
 		com_socket_statistic.close.nok++;
 		break;
+	case COM_SOCKET_STAT_SND_COALESCED:
+		com_socket_statistic.coalesced++;
+		break;
+	case COM_SOCKET_STAT_SND_FLUSH:
+		com_socket_statistic.flush++;
+		break;
 	default:
 		__NOP(); /* Nothing to do */
 		break;
 	}
 }
 
+/**
+ * @brief  Reset the statistics of a socket
+ * @note   called when the socket is created
+ * @param  id - socket id
+ * @retval -
+ */
+void com_sockets_statistic_socket(int32_t id) {
+	if ((id >= 0) && (id < (int32_t)CELLULAR_MAX_SOCKETS)) {
+		com_socket_statistic_data.sock[id].tx = 0U;
+		com_socket_statistic_data.sock[id].rx = 0U;
+	}
+}
+
+/**
+ * @brief  Add bytes exchanged on a socket
+ * @note   also update peak throughput
+ * @param  id     - socket id
+ * @param  tx_len - bytes sent
+ * @param  rx_len - bytes received
+ * @retval -
+ */
+void com_sockets_statistic_bytes(int32_t id, uint32_t tx_len, uint32_t rx_len) {
+	if ((id >= 0) && (id < (int32_t)CELLULAR_MAX_SOCKETS)) {
+		com_socket_statistic_data.sock[id].tx += tx_len;
+		com_socket_statistic_data.sock[id].rx += rx_len;
+	}
+	com_socket_statistic_data.total.tx += tx_len;
+	com_socket_statistic_data.total.rx += rx_len;
+
+	com_socket_statistic_peak();
+	com_socket_statistic_data.window.tx += tx_len;
+	com_socket_statistic_data.window.rx += rx_len;
+}
+
+/**
+ * @brief  Add a latency measure
+ * @note   -
+ * @param  lat        - operation measured
+ * @param  start_tick - HAL tick at operation start
+ * @retval -
+ */
+void com_sockets_statistic_latency(com_sockets_stat_latency_t lat, uint32_t start_tick) {
+	com_sockets_stat_latency_entry_t *p_entry;
+	uint32_t latency;
+	uint32_t bucket;
+
+	if (lat < COM_SOCKET_STAT_LAT_NB) {
+		p_entry = &com_socket_statistic_data.latency[lat];
+		latency = HAL_GetTick() - start_tick;
+
+		bucket = 0U;
+		while ((bucket < (COM_SOCKETS_STAT_LAT_BUCKET_NB - 1U))
+				&& (latency >= (COM_SOCKETS_STAT_LAT_BUCKET_FIRST << bucket))) {
+			bucket++;
+		}
+		if (p_entry->bucket[bucket] < 0xFFFFU) {
+			p_entry->bucket[bucket]++;
+		}
+		if (latency > p_entry->max) {
+			p_entry->max = latency;
+		}
+		p_entry->sum += latency;
+		p_entry->count++;
+	}
+}
+
+/**
+ * @brief  Count an error returned to the application
+ * @note   -
+ * @param  err - error code (COM_SOCKETS_ERR_xxx)
+ * @retval -
+ */
+void com_sockets_statistic_error(int32_t err) {
+	if ((err < 0) && (err > -(int32_t)COM_SOCKETS_STAT_ERR_NB)) {
+		com_socket_statistic_data.error[-err]++;
+	}
+}
+
+/**
+ * @brief  Export com sockets statistics in a compact binary form
+ * @note   see layout in com_sockets_statistic.h
+ * @param  p_buf - buffer to fill
+ * @param  size  - size of the buffer
+ * @retval uint32_t - number of bytes written, 0 if buffer is too small
+ */
+uint32_t com_sockets_statistic_export(uint8_t *p_buf, uint32_t size) {
+	const com_sockets_stat_counter_t *p_counter[6];
+	uint32_t offset = 0U;
+	uint32_t i;
+	uint32_t j;
+
+	if ((p_buf != NULL) && (size >= COM_SOCKETS_STAT_EXPORT_SIZE)) {
+		com_socket_statistic_peak();
+
+		offset = com_socket_statistic_put(p_buf, offset, COM_SOCKETS_STAT_EXPORT_VERSION, 1U);
+		offset = com_socket_statistic_put(p_buf, offset, CELLULAR_MAX_SOCKETS, 1U);
+		offset = com_socket_statistic_put(p_buf, offset, (uint32_t)COM_SOCKET_STAT_LAT_NB, 1U);
+		offset = com_socket_statistic_put(p_buf, offset, COM_SOCKETS_STAT_LAT_BUCKET_NB, 1U);
+		offset = com_socket_statistic_put(p_buf, offset, COM_SOCKETS_STAT_ERR_NB, 1U);
+
+		p_counter[0] = &com_socket_statistic.network;
+		p_counter[1] = &com_socket_statistic.create;
+		p_counter[2] = &com_socket_statistic.connect;
+		p_counter[3] = &com_socket_statistic.send;
+		p_counter[4] = &com_socket_statistic.receive;
+		p_counter[5] = &com_socket_statistic.close;
+		for (i = 0U; i < 6U; i++) {
+			offset = com_socket_statistic_put(p_buf, offset, p_counter[i]->ok, 2U);
+			offset = com_socket_statistic_put(p_buf, offset, p_counter[i]->nok, 2U);
+		}
+
+		offset = com_socket_statistic_put(p_buf, offset, com_socket_statistic_data.total.tx, 4U);
+		offset = com_socket_statistic_put(p_buf, offset, com_socket_statistic_data.total.rx, 4U);
+		offset = com_socket_statistic_put(p_buf, offset, com_socket_statistic_data.peak.tx, 4U);
+		offset = com_socket_statistic_put(p_buf, offset, com_socket_statistic_data.peak.rx, 4U);
+
+		for (i = 0U; i < CELLULAR_MAX_SOCKETS; i++) {
+			offset = com_socket_statistic_put(p_buf, offset, com_socket_statistic_data.sock[i].tx, 4U);
+			offset = com_socket_statistic_put(p_buf, offset, com_socket_statistic_data.sock[i].rx, 4U);
+		}
+
+		for (i = 0U; i < (uint32_t)COM_SOCKET_STAT_LAT_NB; i++) {
+			offset = com_socket_statistic_put(p_buf, offset, com_socket_statistic_data.latency[i].max, 4U);
+			offset = com_socket_statistic_put(p_buf, offset, com_socket_statistic_data.latency[i].sum, 4U);
+			offset = com_socket_statistic_put(p_buf, offset, com_socket_statistic_data.latency[i].count, 4U);
+			for (j = 0U; j < COM_SOCKETS_STAT_LAT_BUCKET_NB; j++) {
+				offset = com_socket_statistic_put(p_buf, offset, com_socket_statistic_data.latency[i].bucket[j], 2U);
+			}
+		}
+
+		for (i = 0U; i < COM_SOCKETS_STAT_ERR_NB; i++) {
+			offset = com_socket_statistic_put(p_buf, offset, com_socket_statistic_data.error[i], 2U);
+		}
+	}
+
+	return (offset);
+}
+
+/**
+ * @brief  Get a summary of com sockets statistics
+ * @note   used to publish the statistics to the cloud
+ * @param  p_summary - summary to fill
+ * @retval -
+ */
+void com_sockets_statistic_summary(com_sockets_stat_summary_t *p_summary) {
+	uint32_t i;
+
+	if (p_summary != NULL) {
+		com_socket_statistic_peak();
+
+		p_summary->tx_bytes = com_socket_statistic_data.total.tx;
+		p_summary->rx_bytes = com_socket_statistic_data.total.rx;
+		p_summary->tx_peak  = com_socket_statistic_data.peak.tx;
+		p_summary->rx_peak  = com_socket_statistic_data.peak.rx;
+		p_summary->errors   = 0U;
+		for (i = 0U; i < COM_SOCKETS_STAT_ERR_NB; i++) {
+			p_summary->errors += com_socket_statistic_data.error[i];
+		}
+		for (i = 0U; i < (uint32_t)COM_SOCKET_STAT_LAT_NB; i++) {
+			p_summary->lat_max[i] = com_socket_statistic_data.latency[i].max;
+			p_summary->lat_avg[i] = (com_socket_statistic_data.latency[i].count != 0U) ?
+					(com_socket_statistic_data.latency[i].sum / com_socket_statistic_data.latency[i].count) : 0U;
+		}
+	}
+}
+
 /**
  * @brief  Display com sockets statistics
  * @note   COM_SOCKETS_STATISTIC and USE_TRACE_COM_SOCKETS must be set to 1
@@ -206,6 +482,8 @@ void com_sockets_statistic_display(void) {
   socket_desc_t *socket_desc;
   socket_desc = socket_desc_list;
 #endif /* not yet supported */
+	const com_sockets_stat_latency_entry_t *p_lat;
+	uint32_t i;
 
 	/* Check that at least one socket has run */
 	if (com_socket_statistic.create.ok != 0U) {
@@ -236,6 +514,36 @@ void com_sockets_statistic_display(void) {
 		PRINT_FORCE("ComLibStat: Cls: ok:%5d - nok:%5d - tot:%6d",
 				com_socket_statistic.close.ok, com_socket_statistic.close.nok,
 				(com_socket_statistic.close.ok + com_socket_statistic.close.nok))
+#if (COM_SOCKETS_TX_COALESCING == 1U)
+		PRINT_FORCE("ComLibStat: Coa: wr:%5d - snd:%5d",
+				com_socket_statistic.coalesced, com_socket_statistic.flush)
+#endif /* COM_SOCKETS_TX_COALESCING == 1U */
+		com_socket_statistic_peak();
+		PRINT_FORCE("ComLibStat: Byt: tx:%9ld - rx:%9ld - peak tx:%7ld B/s - peak rx:%7ld B/s",
+				com_socket_statistic_data.total.tx, com_socket_statistic_data.total.rx,
+				com_socket_statistic_data.peak.tx, com_socket_statistic_data.peak.rx)
+		for (i = 0U; i < CELLULAR_MAX_SOCKETS; i++) {
+			if ((com_socket_statistic_data.sock[i].tx != 0U)
+					|| (com_socket_statistic_data.sock[i].rx != 0U)) {
+				PRINT_FORCE("ComLibStat: Sck%ld: tx:%9ld - rx:%9ld", i,
+						com_socket_statistic_data.sock[i].tx,
+						com_socket_statistic_data.sock[i].rx)
+			}
+		}
+		for (i = 0U; i < (uint32_t)COM_SOCKET_STAT_LAT_NB; i++) {
+			p_lat = &com_socket_statistic_data.latency[i];
+			if (p_lat->count != 0U) {
+				PRINT_FORCE("ComLibStat: Lat%s: nb:%5ld - avg:%5ld - max:%5ld ms - <16:%d <32:%d <64:%d <128:%d <256:%d <512:%d <1s:%d <2s:%d <4s:%d >4s:%d",
+						com_socket_latency_string[i], p_lat->count, (p_lat->sum / p_lat->count), p_lat->max,
+						p_lat->bucket[0], p_lat->bucket[1], p_lat->bucket[2], p_lat->bucket[3], p_lat->bucket[4],
+						p_lat->bucket[5], p_lat->bucket[6], p_lat->bucket[7], p_lat->bucket[8], p_lat->bucket[9])
+			}
+		}
+		for (i = 1U; i < COM_SOCKETS_STAT_ERR_NB; i++) {
+			if (com_socket_statistic_data.error[i] != 0U) {
+				PRINT_FORCE("ComLibStat: Err: %3ld:%5d", -(int32_t)i, com_socket_statistic_data.error[i])
+			}
+		}
 #if 0
     /* Socket status displayed */
     while (socket_desc != NULL)
@@ -262,6 +570,9 @@ void com_sockets_statistic_display(void) {
 }
 
 #else /* COM_SOCKETS_STATISTIC == 0U */
+
+#include <string.h>
+
 /**
   * @brief  Component initialization
   * @note   must be called only one time and
@@ -298,6 +609,88 @@ void com_sockets_statistic_display(void)
   __NOP(); /* Nothing to do */
 }
 
+/**
+  * @brief  Export com sockets statistics in a compact binary form
+  * @note   -
+  * @param  p_buf - buffer to fill
+  * @param  size  - size of the buffer
+  * @retval uint32_t - number of bytes written, always 0
+  */
+uint32_t com_sockets_statistic_export(uint8_t *p_buf, uint32_t size)
+{
+  UNUSED(p_buf);
+  UNUSED(size);
+  return (0U);
+}
+
+/**
+  * @brief  Get a summary of com sockets statistics
+  * @note   summary is reset
+  * @param  p_summary - summary to fill
+  * @retval -
+  */
+void com_sockets_statistic_summary(com_sockets_stat_summary_t *p_summary)
+{
+  if (p_summary != NULL)
+  {
+    (void)memset(p_summary, 0, sizeof(com_sockets_stat_summary_t));
+  }
+}
+
+/**
+  * @brief  Reset the statistics of a socket
+  * @note   -
+  * @param  id - socket id
+  * @retval -
+  */
+void com_sockets_statistic_socket(int32_t id)
+{
+  UNUSED(id); /* Nothing to do */
+  __NOP();
+}
+
+/**
+  * @brief  Add bytes exchanged on a socket
+  * @note   -
+  * @param  id     - socket id
+  * @param  tx_len - bytes sent
+  * @param  rx_len - bytes received
+  * @retval -
+  */
+void com_sockets_statistic_bytes(int32_t id, uint32_t tx_len, uint32_t rx_len)
+{
+  UNUSED(id); /* Nothing to do */
+  UNUSED(tx_len);
+  UNUSED(rx_len);
+  __NOP();
+}
+
+/**
+  * @brief  Add a latency measure
+  * @note   -
+  * @param  lat        - operation measured
+  * @param  start_tick - HAL tick at operation start
+  * @retval -
+  */
+void com_sockets_statistic_latency(com_sockets_stat_latency_t lat, uint32_t start_tick)
+{
+  UNUSED(lat); /* Nothing to do */
+  UNUSED(start_tick);
+  __NOP();
+}
+
+/**
+  * @brief  Count an error returned to the application
+  * @note   -
+  * @param  err - error code
+  * @retval -
+  */
+void com_sockets_statistic_error(int32_t err)
+{
+  UNUSED(err); /* Nothing to do */
+  __NOP();
+}
+
 #endif /* COM_SOCKET_STATISTIC == 1U */
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
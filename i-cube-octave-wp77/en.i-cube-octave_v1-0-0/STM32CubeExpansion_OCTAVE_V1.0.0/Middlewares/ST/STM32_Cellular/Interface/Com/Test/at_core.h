@@ -0,0 +1,41 @@
+/**
+  ******************************************************************************
+  * @file    at_core.h
+  * @author  MCD Application Team
+  * @brief   AT core definitions used by cellular_service.h in the host test of
+  *          the com sockets statistics (replaces the target at_core.h)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef AT_CORE_H_
+#define AT_CORE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "plf_config.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define ATCMD_MAX_BUF_SIZE   ((uint16_t) 128U) /* same value as the target at_core.h */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT_CORE_H_ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
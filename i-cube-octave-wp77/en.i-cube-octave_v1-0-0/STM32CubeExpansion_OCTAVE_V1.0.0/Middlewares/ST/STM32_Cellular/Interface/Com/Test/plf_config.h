@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * @file    plf_config.h
+  * @author  MCD Application Team
+  * @brief   Platform configuration used by the host test of the com sockets
+  *          statistics (replaces the project plf_config.h)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef PLF_CONFIG_H
+#define PLF_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define COM_SOCKETS_STATISTIC         (1U)
+#define COM_SOCKETS_TX_COALESCING     (1U)
+#define USE_TRACE_COMLIB              (0U)
+#define USE_CMD_CONSOLE               (0)
+#define USE_PRINTF                    (1U)
+
+/* Exported macros -----------------------------------------------------------*/
+#define UNUSED(X)                     (void)(X)
+#define __NOP()                       do {} while (false)
+
+/* Exported functions ------------------------------------------------------- */
+/* HAL tick: implemented by the test */
+uint32_t HAL_GetTick(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLF_CONFIG_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,43 @@
+/**
+  ******************************************************************************
+  * @file    rtosal.h
+  * @author  MCD Application Team
+  * @brief   RTOS abstraction used by the host test of the com sockets
+  *          statistics: types only, no RTOS service is used
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef RTOSAL_H
+#define RTOSAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+typedef uint8_t          rtosal_char_t;
+typedef int32_t          rtosalStatus;
+typedef void            *osTimerId;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RTOSAL_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
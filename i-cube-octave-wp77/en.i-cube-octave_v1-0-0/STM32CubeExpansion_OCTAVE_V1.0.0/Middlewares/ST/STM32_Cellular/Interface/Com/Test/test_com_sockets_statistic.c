@@ -0,0 +1,488 @@
+/**
+ ******************************************************************************
+ * @file    test_com_sockets_statistic.c
+ * @author  MCD Application Team
+ * @brief   Host test of the com sockets statistics: bytes, peak throughput,
+ *          latency histograms, errors and binary export (com_sockets_statistic.c)
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+ * All rights reserved.</center></h2>
+ *
+ * This software component is licensed by ST under Ultimate Liberty license
+ * SLA0044, the "License"; You may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at:
+ *                             www.st.com/SLA0044
+ *
+ ******************************************************************************
+ *
+ * This file is not part of the target build. From this directory, build and run it
+ * on the host:
+ *
+ *   gcc -O2 -Wall -Wno-format -fsanitize=bounds -fno-sanitize-recover=bounds \
+ *       -I. -I../Inc -I../../../Core/Cellular_Service/Inc -I../../../Core/Data_Cache/Inc \
+ *       test_com_sockets_statistic.c ../Src/com_sockets_statistic.c -o test_comstat
+ *   ./test_comstat
+ *
+ * The headers of this directory replace the target ones: HAL_GetTick is driven by the
+ * test, statistics are read back through the binary export. Checked:
+ *   - export: size, header, fields at the offsets of the layout documented in
+ *     com_sockets_statistic.h, buffer too small or NULL refused,
+ *   - ok/nok counters of each operation,
+ *   - bytes in total and per socket, socket reset at creation, invalid socket id,
+ *   - peak throughput computed on windows of 1s at least,
+ *   - latency histogram bucket limits (16ms << i), last bucket, saturation at 0xFFFF,
+ *     max, sum, count, tick wrap, invalid operation,
+ *   - errors counted by code, out of range codes ignored,
+ *   - summary: totals, peaks, errors, latency average and max,
+ *   - display: all sections printed (values are not checked: the display uses %ld for the
+ *     32 bits values, as int32_t is long on the target but not on a 64 bits host).
+ * The bounds sanitizer stops the test on an out of range index (e.g. an error code).
+ * The process exit code is the number of failures (0: all tests passed).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "com_sockets_statistic.h"
+#include "com_err.h"
+#include "cellular_service.h"
+
+/* Private defines -----------------------------------------------------------*/
+/* Same values as com_sockets_statistic.c */
+#define TEST_ERR_NB            (15U)
+#define TEST_EXPORT_SIZE       (5U + (12U * 2U) + (4U * 4U) + (CELLULAR_MAX_SOCKETS * 8U) \
+                                + (COM_SOCKET_STAT_LAT_NB * (12U + (COM_SOCKETS_STAT_LAT_BUCKET_NB * 2U))) \
+                                + (TEST_ERR_NB * 2U))
+
+/* Offsets of the export layout version 1 */
+#define TEST_OFS_COUNTERS      (5U)
+#define TEST_OFS_BYTES         (TEST_OFS_COUNTERS + (12U * 2U))
+#define TEST_OFS_SOCKETS       (TEST_OFS_BYTES + (4U * 4U))
+#define TEST_OFS_LATENCY       (TEST_OFS_SOCKETS + (CELLULAR_MAX_SOCKETS * 8U))
+#define TEST_LATENCY_SIZE      (12U + (COM_SOCKETS_STAT_LAT_BUCKET_NB * 2U))
+#define TEST_OFS_ERRORS        (TEST_OFS_LATENCY + (COM_SOCKET_STAT_LAT_NB * TEST_LATENCY_SIZE))
+
+/* Index of the counters in the export */
+#define TEST_CNT_NETWORK       (0U)
+#define TEST_CNT_CREATE        (1U)
+#define TEST_CNT_CONNECT       (2U)
+#define TEST_CNT_SEND          (3U)
+#define TEST_CNT_RECEIVE       (4U)
+#define TEST_CNT_CLOSE         (5U)
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t test_nb = 0U;
+static uint32_t test_fail_nb = 0U;
+static uint32_t test_tick = 0U;
+static uint8_t test_export[COM_SOCKETS_STAT_EXPORT_SIZE_MAX];
+
+/* Private function prototypes -----------------------------------------------*/
+static void test_check(bool ok, const char *p_label, uint32_t value);
+static uint32_t test_get(uint32_t offset, uint8_t len);
+static void test_do_export(void);
+static uint32_t test_counter(uint32_t index, bool ok);
+static uint32_t test_bucket(com_sockets_stat_latency_t lat, uint32_t bucket);
+static uint32_t test_latency(com_sockets_stat_latency_t lat, uint32_t field);
+static void test_start(uint32_t tick);
+static void test_export_layout(void);
+static void test_counters(void);
+static void test_bytes(void);
+static void test_peak(void);
+static void test_latency_histogram(void);
+static void test_errors(void);
+static void test_summary(void);
+static void test_display(void);
+
+/* Private function Definition -----------------------------------------------*/
+static void test_check(bool ok, const char *p_label, uint32_t value)
+{
+  test_nb++;
+  if (ok == false)
+  {
+    test_fail_nb++;
+    printf("FAIL %s (%u)\n", p_label, value);
+  }
+}
+
+/**
+ * @brief  read a little endian value of the last export
+ */
+static uint32_t test_get(uint32_t offset, uint8_t len)
+{
+  uint32_t value = 0U;
+
+  for (uint32_t i = 0U; i < len; i++)
+  {
+    value |= (uint32_t)test_export[offset + i] << (8U * i);
+  }
+  return value;
+}
+
+static void test_do_export(void)
+{
+  uint32_t size;
+
+  (void)memset((void *)test_export, 0xA5, sizeof(test_export));
+  size = com_sockets_statistic_export(test_export, sizeof(test_export));
+  test_check(size == TEST_EXPORT_SIZE, "export size", size);
+}
+
+static uint32_t test_counter(uint32_t index, bool ok)
+{
+  return test_get(TEST_OFS_COUNTERS + (index * 4U) + ((ok == true) ? 0U : 2U), 2U);
+}
+
+static uint32_t test_bucket(com_sockets_stat_latency_t lat, uint32_t bucket)
+{
+  return test_get(TEST_OFS_LATENCY + ((uint32_t)lat * TEST_LATENCY_SIZE) + 12U + (bucket * 2U), 2U);
+}
+
+/**
+ * @brief  field 0: max, 1: sum, 2: count
+ */
+static uint32_t test_latency(com_sockets_stat_latency_t lat, uint32_t field)
+{
+  return test_get(TEST_OFS_LATENCY + ((uint32_t)lat * TEST_LATENCY_SIZE) + (field * 4U), 4U);
+}
+
+static void test_start(uint32_t tick)
+{
+  test_tick = tick;
+  com_sockets_statistic_init();
+}
+
+/**
+ * @brief  export header, size and empty statistics
+ */
+static void test_export_layout(void)
+{
+  uint8_t small[TEST_EXPORT_SIZE];
+  bool zero = true;
+
+  test_start(1000U);
+  test_check(TEST_EXPORT_SIZE <= COM_SOCKETS_STAT_EXPORT_SIZE_MAX, "export fits in the maximum size",
+             TEST_EXPORT_SIZE);
+  test_check(com_sockets_statistic_export(NULL, sizeof(test_export)) == 0U, "export in NULL refused", 0U);
+  test_check(com_sockets_statistic_export(small, TEST_EXPORT_SIZE - 1U) == 0U, "export in a too small buffer refused",
+             TEST_EXPORT_SIZE - 1U);
+  test_check(com_sockets_statistic_export(small, TEST_EXPORT_SIZE) == TEST_EXPORT_SIZE,
+             "export in a buffer of the exact size", TEST_EXPORT_SIZE);
+
+  test_do_export();
+  test_check(test_get(0U, 1U) == COM_SOCKETS_STAT_EXPORT_VERSION, "export version", test_get(0U, 1U));
+  test_check(test_get(1U, 1U) == CELLULAR_MAX_SOCKETS, "export sockets nb", test_get(1U, 1U));
+  test_check(test_get(2U, 1U) == (uint32_t)COM_SOCKET_STAT_LAT_NB, "export latency nb", test_get(2U, 1U));
+  test_check(test_get(3U, 1U) == COM_SOCKETS_STAT_LAT_BUCKET_NB, "export buckets nb", test_get(3U, 1U));
+  test_check(test_get(4U, 1U) == TEST_ERR_NB, "export errors nb", test_get(4U, 1U));
+  for (uint32_t i = 5U; i < TEST_EXPORT_SIZE; i++)
+  {
+    zero = (test_export[i] == 0U) ? zero : false;
+  }
+  test_check(zero == true, "export after init: all zero", 0U);
+  test_check(test_export[TEST_EXPORT_SIZE] == 0xA5U, "export: nothing written after its size", 0U);
+  test_check(TEST_OFS_ERRORS + (TEST_ERR_NB * 2U) == TEST_EXPORT_SIZE, "export: errors at the end", TEST_OFS_ERRORS);
+}
+
+/**
+ * @brief  ok/nok counters of each operation
+ */
+static void test_counters(void)
+{
+  static const com_sockets_stat_update_t updates[12] =
+  {
+    COM_SOCKET_STAT_NWK_UP, COM_SOCKET_STAT_NWK_DWN, COM_SOCKET_STAT_CRE_OK, COM_SOCKET_STAT_CRE_NOK,
+    COM_SOCKET_STAT_CNT_OK, COM_SOCKET_STAT_CNT_NOK, COM_SOCKET_STAT_SND_OK, COM_SOCKET_STAT_SND_NOK,
+    COM_SOCKET_STAT_RCV_OK, COM_SOCKET_STAT_RCV_NOK, COM_SOCKET_STAT_CLS_OK, COM_SOCKET_STAT_CLS_NOK
+  };
+  bool result = true;
+
+  test_start(1000U);
+  /* counter i updated i + 1 times */
+  for (uint32_t i = 0U; i < 12U; i++)
+  {
+    for (uint32_t j = 0U; j <= i; j++)
+    {
+      com_sockets_statistic_update(updates[i]);
+    }
+  }
+  com_sockets_statistic_update(COM_SOCKET_STAT_SND_COALESCED);
+  com_sockets_statistic_update(COM_SOCKET_STAT_SND_FLUSH);
+  test_do_export();
+  for (uint32_t i = 0U; i < 6U; i++)
+  {
+    result = ((test_counter(i, true) == ((2U * i) + 1U)) && (test_counter(i, false) == ((2U * i) + 2U))) ? result : false;
+  }
+  test_check(result == true, "counters: network, create, connect, send, receive, close", 0U);
+  test_check(test_counter(TEST_CNT_SEND, true) == 7U, "counters: coalescing not counted as send", 0U);
+}
+
+/**
+ * @brief  bytes in total and per socket
+ */
+static void test_bytes(void)
+{
+  test_start(1000U);
+  com_sockets_statistic_bytes(0, 100U, 0U);
+  com_sockets_statistic_bytes(0, 0U, 2000U);
+  com_sockets_statistic_bytes((int32_t)CELLULAR_MAX_SOCKETS - 1, 30U, 40U);
+  com_sockets_statistic_bytes(-1, 5U, 6U);
+  com_sockets_statistic_bytes((int32_t)CELLULAR_MAX_SOCKETS, 7U, 8U);
+  test_do_export();
+  test_check(test_get(TEST_OFS_BYTES, 4U) == 142U, "total tx", test_get(TEST_OFS_BYTES, 4U));
+  test_check(test_get(TEST_OFS_BYTES + 4U, 4U) == 2054U, "total rx", test_get(TEST_OFS_BYTES + 4U, 4U));
+  test_check((test_get(TEST_OFS_SOCKETS, 4U) == 100U) && (test_get(TEST_OFS_SOCKETS + 4U, 4U) == 2000U),
+             "socket 0 tx/rx", test_get(TEST_OFS_SOCKETS, 4U));
+  test_check((test_get(TEST_OFS_SOCKETS + ((CELLULAR_MAX_SOCKETS - 1U) * 8U), 4U) == 30U)
+             && (test_get(TEST_OFS_SOCKETS + ((CELLULAR_MAX_SOCKETS - 1U) * 8U) + 4U, 4U) == 40U),
+             "last socket tx/rx", 0U);
+  test_check(test_get(TEST_OFS_SOCKETS + 8U, 4U) == 0U, "other socket untouched", test_get(TEST_OFS_SOCKETS + 8U, 4U));
+
+  /* socket created again: its counters restart, the total doesn't */
+  com_sockets_statistic_socket(0);
+  com_sockets_statistic_socket(-1);
+  com_sockets_statistic_socket((int32_t)CELLULAR_MAX_SOCKETS);
+  com_sockets_statistic_bytes(0, 1U, 2U);
+  test_do_export();
+  test_check((test_get(TEST_OFS_SOCKETS, 4U) == 1U) && (test_get(TEST_OFS_SOCKETS + 4U, 4U) == 2U),
+             "socket reset at creation", test_get(TEST_OFS_SOCKETS, 4U));
+  test_check(test_get(TEST_OFS_SOCKETS + ((CELLULAR_MAX_SOCKETS - 1U) * 8U), 4U) == 30U,
+             "socket reset: other sockets kept", 0U);
+  test_check(test_get(TEST_OFS_BYTES, 4U) == 143U, "socket reset: total kept", test_get(TEST_OFS_BYTES, 4U));
+}
+
+/**
+ * @brief  peak throughput on windows of 1s at least
+ */
+static void test_peak(void)
+{
+  com_sockets_stat_summary_t summary;
+
+  test_start(1000U);
+  com_sockets_statistic_bytes(0, 500U, 0U);
+  test_tick = 1500U;
+  com_sockets_statistic_bytes(0, 500U, 0U);
+  com_sockets_statistic_summary(&summary);
+  test_check((summary.tx_peak == 0U) && (summary.rx_peak == 0U), "peak: window not elapsed", summary.tx_peak);
+
+  /* 1000 bytes in the first second */
+  test_tick = 2000U;
+  com_sockets_statistic_bytes(0, 100U, 200U);
+  com_sockets_statistic_summary(&summary);
+  test_check(summary.tx_peak == 1000U, "peak tx of the first window", summary.tx_peak);
+  test_check(summary.rx_peak == 0U, "peak rx of the first window", summary.rx_peak);
+
+  /* 100/200 bytes in 2s: tx peak kept, rx peak 100 B/s */
+  test_tick = 4000U;
+  com_sockets_statistic_summary(&summary);
+  test_check(summary.tx_peak == 1000U, "peak tx kept", summary.tx_peak);
+  test_check(summary.rx_peak == 100U, "peak rx over a longer window", summary.rx_peak);
+
+  /* window restarted empty: 1100 bytes in 1.1s don't exceed the peak */
+  com_sockets_statistic_bytes(0, 1100U, 0U);
+  test_tick = 5100U;
+  com_sockets_statistic_summary(&summary);
+  test_check(summary.tx_peak == 1000U, "peak: new window starts empty", summary.tx_peak);
+
+  /* higher rate across the tick wrap */
+  test_start(0xFFFFFE00U);
+  com_sockets_statistic_bytes(1, 0U, 4000U);
+  test_tick = 0x000001E8U; /* 1000 ms later */
+  com_sockets_statistic_summary(&summary);
+  test_check(summary.rx_peak == 4000U, "peak across the tick wrap", summary.rx_peak);
+  test_do_export();
+  test_check(test_get(TEST_OFS_BYTES + 12U, 4U) == 4000U, "export rx peak", test_get(TEST_OFS_BYTES + 12U, 4U));
+}
+
+/**
+ * @brief  latency histogram
+ */
+static void test_latency_histogram(void)
+{
+  static const struct
+  {
+    uint32_t latency;
+    uint32_t bucket;
+  } limits[] =
+  {
+    { 0U, 0U }, { 15U, 0U }, { 16U, 1U }, { 31U, 1U }, { 32U, 2U }, { 255U, 4U }, { 256U, 5U },
+    { 4095U, 8U }, { 4096U, 9U }, { 600000U, 9U }
+  };
+  uint32_t sum = 0U;
+  uint32_t count;
+
+  test_start(1000U);
+  for (uint32_t i = 0U; i < (sizeof(limits) / sizeof(limits[0])); i++)
+  {
+    test_tick = 1000000U;
+    com_sockets_statistic_latency(COM_SOCKET_STAT_LAT_SND, test_tick - limits[i].latency);
+    sum += limits[i].latency;
+    test_do_export();
+    count = 0U;
+    for (uint32_t j = 0U; j <= i; j++)
+    {
+      count += (limits[j].bucket == limits[i].bucket) ? 1U : 0U;
+    }
+    test_check(test_bucket(COM_SOCKET_STAT_LAT_SND, limits[i].bucket) == count, "latency bucket", limits[i].latency);
+  }
+  test_check(test_latency(COM_SOCKET_STAT_LAT_SND, 0U) == 600000U, "latency max",
+             test_latency(COM_SOCKET_STAT_LAT_SND, 0U));
+  test_check(test_latency(COM_SOCKET_STAT_LAT_SND, 1U) == sum, "latency sum", test_latency(COM_SOCKET_STAT_LAT_SND, 1U));
+  test_check(test_latency(COM_SOCKET_STAT_LAT_SND, 2U) == 10U, "latency count",
+             test_latency(COM_SOCKET_STAT_LAT_SND, 2U));
+  test_check((test_latency(COM_SOCKET_STAT_LAT_CNT, 2U) == 0U) && (test_latency(COM_SOCKET_STAT_LAT_RCV, 2U) == 0U)
+             && (test_latency(COM_SOCKET_STAT_LAT_WAIT, 2U) == 0U), "latency: other operations untouched", 0U);
+
+  /* tick wrap during the operation */
+  test_tick = 0x10U;
+  com_sockets_statistic_latency(COM_SOCKET_STAT_LAT_WAIT, 0xFFFFFFF0U);
+  test_do_export();
+  test_check((test_bucket(COM_SOCKET_STAT_LAT_WAIT, 2U) == 1U) && (test_latency(COM_SOCKET_STAT_LAT_WAIT, 0U) == 32U),
+             "latency across the tick wrap", test_latency(COM_SOCKET_STAT_LAT_WAIT, 0U));
+
+  /* invalid operation ignored */
+  com_sockets_statistic_latency(COM_SOCKET_STAT_LAT_NB, 0U);
+  test_do_export();
+  test_check(test_get(TEST_OFS_ERRORS, 2U) == 0U, "invalid latency operation ignored", test_get(TEST_OFS_ERRORS, 2U));
+
+  /* bucket saturation, count goes on */
+  test_start(1000U);
+  for (uint32_t i = 0U; i < 0x10005U; i++)
+  {
+    com_sockets_statistic_latency(COM_SOCKET_STAT_LAT_RCV, test_tick - 20U);
+  }
+  test_do_export();
+  test_check(test_bucket(COM_SOCKET_STAT_LAT_RCV, 1U) == 0xFFFFU, "latency bucket saturated",
+             test_bucket(COM_SOCKET_STAT_LAT_RCV, 1U));
+  test_check(test_latency(COM_SOCKET_STAT_LAT_RCV, 2U) == 0x10005U, "latency count not saturated",
+             test_latency(COM_SOCKET_STAT_LAT_RCV, 2U));
+  test_check(test_bucket(COM_SOCKET_STAT_LAT_RCV, 2U) == 0U, "latency saturation: next bucket untouched",
+             test_bucket(COM_SOCKET_STAT_LAT_RCV, 2U));
+}
+
+/**
+ * @brief  errors counted by code
+ */
+static void test_errors(void)
+{
+  bool result = true;
+
+  test_start(1000U);
+  com_sockets_statistic_error(COM_ERR_TIMEOUT);
+  com_sockets_statistic_error(COM_ERR_TIMEOUT);
+  com_sockets_statistic_error(COM_ERR_GENERAL);
+  com_sockets_statistic_error(COM_ERR_NOICC);
+  com_sockets_statistic_error(COM_ERR_OK);
+  com_sockets_statistic_error(-(int32_t)TEST_ERR_NB);
+  com_sockets_statistic_error(1);
+  test_do_export();
+  for (uint32_t i = 0U; i < TEST_ERR_NB; i++)
+  {
+    uint32_t expected = (i == 8U) ? 2U : (((i == 1U) || (i == 14U)) ? 1U : 0U);
+    result = (test_get(TEST_OFS_ERRORS + (i * 2U), 2U) == expected) ? result : false;
+  }
+  test_check(result == true, "errors counted by code, out of range ignored", 0U);
+}
+
+/**
+ * @brief  summary published to the cloud
+ */
+static void test_summary(void)
+{
+  com_sockets_stat_summary_t summary;
+
+  test_start(1000U);
+  com_sockets_statistic_bytes(2, 300U, 400U);
+  com_sockets_statistic_latency(COM_SOCKET_STAT_LAT_CNT, test_tick - 100U);
+  com_sockets_statistic_latency(COM_SOCKET_STAT_LAT_CNT, test_tick - 301U);
+  com_sockets_statistic_latency(COM_SOCKET_STAT_LAT_CNT, test_tick - 202U);
+  com_sockets_statistic_error(COM_ERR_NONETWORK);
+  com_sockets_statistic_error(COM_ERR_WOULDBLOCK);
+  test_tick += 2000U;
+  (void)memset((void *)&summary, 0xFF, sizeof(summary));
+  com_sockets_statistic_summary(&summary);
+  test_check((summary.tx_bytes == 300U) && (summary.rx_bytes == 400U), "summary bytes", summary.tx_bytes);
+  test_check((summary.tx_peak == 150U) && (summary.rx_peak == 200U), "summary peaks", summary.tx_peak);
+  test_check(summary.errors == 2U, "summary errors", summary.errors);
+  test_check((summary.lat_avg[COM_SOCKET_STAT_LAT_CNT] == 201U) && (summary.lat_max[COM_SOCKET_STAT_LAT_CNT] == 301U),
+             "summary latency average and max", summary.lat_avg[COM_SOCKET_STAT_LAT_CNT]);
+  test_check((summary.lat_avg[COM_SOCKET_STAT_LAT_SND] == 0U) && (summary.lat_max[COM_SOCKET_STAT_LAT_SND] == 0U),
+             "summary latency without measure", summary.lat_avg[COM_SOCKET_STAT_LAT_SND]);
+  com_sockets_statistic_summary(NULL);
+}
+
+/**
+ * @brief  display: all sections printed
+ */
+static void test_display(void)
+{
+  static const char *sections[] =
+  {
+    "ComLibStat: Nwk:", "ComLibStat: Cls:", "ComLibStat: Coa:", "ComLibStat: Byt:", "ComLibStat: Sck3:",
+    "ComLibStat: LatCnt:", "ComLibStat: LatWai:", "ComLibStat: Err:", "*** Socket Stat End ***"
+  };
+  static char output[4096];
+  FILE *p_file;
+  size_t len;
+  int stdout_fd;
+
+  test_start(1000U);
+  com_sockets_statistic_update(COM_SOCKET_STAT_CRE_OK);
+  com_sockets_statistic_bytes(3, 10U, 20U);
+  com_sockets_statistic_latency(COM_SOCKET_STAT_LAT_CNT, test_tick - 10U);
+  com_sockets_statistic_latency(COM_SOCKET_STAT_LAT_WAIT, test_tick - 10U);
+  com_sockets_statistic_error(COM_ERR_TIMEOUT);
+
+  /* display output captured in a temporary file */
+  p_file = tmpfile();
+  (void)fflush(stdout);
+  stdout_fd = dup(STDOUT_FILENO);
+  (void)dup2(fileno(p_file), STDOUT_FILENO);
+  com_sockets_statistic_display();
+  (void)fflush(stdout);
+  (void)dup2(stdout_fd, STDOUT_FILENO);
+  (void)close(stdout_fd);
+  rewind(p_file);
+  len = fread(output, 1U, sizeof(output) - 1U, p_file);
+  output[len] = '\0';
+  (void)fclose(p_file);
+
+  for (uint32_t i = 0U; i < (sizeof(sections) / sizeof(sections[0])); i++)
+  {
+    test_check(strstr(output, sections[i]) != NULL, sections[i], i);
+  }
+  test_check(strstr(output, "ComLibStat: LatSnd:") == NULL, "display: latency without measure not printed", 0U);
+  test_check(strstr(output, "ComLibStat: Sck0:") == NULL, "display: socket without bytes not printed", 0U);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+
+uint32_t HAL_GetTick(void)
+{
+  return test_tick;
+}
+
+int main(void)
+{
+  test_export_layout();
+  test_counters();
+  test_bytes();
+  test_peak();
+  test_latency_histogram();
+  test_errors();
+  test_summary();
+  test_display();
+
+  printf("com sockets statistics (export %u bytes): %u tests, %u failures\n", TEST_EXPORT_SIZE, test_nb,
+         test_fail_nb);
+
+  return (int)test_fail_nb;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -23,6 +23,10 @@
 #include "stm32l4xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "plf_config.h"
+#if (CST_MODEM_CONFIG_CACHE == 1U)
+#include "cellular_service_nvm.h"
+#endif /* (CST_MODEM_CONFIG_CACHE == 1U) */
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -72,7 +76,12 @@ extern TIM_HandleTypeDef htim3;
  */
 void NMI_Handler(void) {
 	/* USER CODE BEGIN NonMaskableInt_IRQn 0 */
-
+#if (CST_MODEM_CONFIG_CACHE == 1U)
+	/* flash ECC double error while reading the modem config cache: record discarded */
+	if (CSN_FlashEccErrorCallback() == true) {
+		return;
+	}
+#endif /* (CST_MODEM_CONFIG_CACHE == 1U) */
 	/* USER CODE END NonMaskableInt_IRQn 0 */
 	/* USER CODE BEGIN NonMaskableInt_IRQn 1 */
 	while (1) {
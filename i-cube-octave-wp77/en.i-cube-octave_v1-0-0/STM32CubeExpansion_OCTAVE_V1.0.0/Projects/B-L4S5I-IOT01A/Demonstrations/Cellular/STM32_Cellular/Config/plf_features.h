@@ -68,6 +68,64 @@ extern "C" {
 #define USE_COM_ICC               (1)  /* 0: not included, 1: included */
 #endif /* !defined USE_COM_ICC */
 
+/* If activated then URC are forwarded to Cellular Service by a dedicated AT Core thread
+   and latency-critical URC (COM-MDM events, socket data pending/closed) are forwarded first */
+#if !defined ATCORE_URC_FAST_PATH
+#define ATCORE_URC_FAST_PATH      (1U) /* 0: not activated, 1: activated */
+#endif /* !defined ATCORE_URC_FAST_PATH */
+
+/* If activated then AT Core measures the latency of each AT command (EWMA, deviation, percentiles)
+   Statistics are displayed by the console command 'atlat' */
+#if !defined ATCORE_LATENCY_STATS
+#define ATCORE_LATENCY_STATS      (1U) /* 0: not activated, 1: activated */
+#endif /* !defined ATCORE_LATENCY_STATS */
+
+/* If activated then the timeout of an AT command is learned from its measured latency
+   bounded by ATCORE_ADAPTIVE_TIMEOUT_FLOOR (floor) and by the timeout of the modem LUT (ceiling)
+   Requires ATCORE_LATENCY_STATS activated */
+#if !defined ATCORE_ADAPTIVE_TIMEOUT
+#define ATCORE_ADAPTIVE_TIMEOUT   (0U) /* 0: not activated, 1: activated */
+#endif /* !defined ATCORE_ADAPTIVE_TIMEOUT */
+
+#if !defined ATCORE_ADAPTIVE_TIMEOUT_FLOOR
+#define ATCORE_ADAPTIVE_TIMEOUT_FLOOR (1000U) /* in ms */
+#endif /* !defined ATCORE_ADAPTIVE_TIMEOUT_FLOOR */
+
+#if ((ATCORE_ADAPTIVE_TIMEOUT == 1U) && (ATCORE_LATENCY_STATS == 0U))
+#error ATCORE_ADAPTIVE_TIMEOUT requires ATCORE_LATENCY_STATS
+#endif /* (ATCORE_ADAPTIVE_TIMEOUT == 1U) && (ATCORE_LATENCY_STATS == 0U) */
+
+/* If activated then decimal strings are converted by chunks of 8 digits (SWAR: 8 digits in a 64bits word)
+   Only for little-endian targets (chunks are read with memcpy: no alignment constraint on the string) */
+#if !defined CRS_SWAR_CONVERSION
+#define CRS_SWAR_CONVERSION       (1U) /* 0: not activated, 1: activated */
+#endif /* !defined CRS_SWAR_CONVERSION */
+
+/* If activated then the Cellular Service requests are arbitrated per class (one class per socket,
+   one for the Com MDM (ORP) transactions, one for the other services) and classes are served in round robin
+   else the requests are served according to the task priorities of the requesters */
+#if !defined CS_FAIR_SCHEDULING
+#define CS_FAIR_SCHEDULING        (1U) /* 0: not activated, 1: activated */
+#endif /* !defined CS_FAIR_SCHEDULING */
+
+/* If activated then Data Cache application consumers are notified by a dedicated low priority thread
+   and successive updates of an entry not yet notified are coalesced (consumer reads the latest value)
+   Core consumers are still notified in the writer context */
+#if !defined DC_COM_DEFERRED_NOTIF
+#define DC_COM_DEFERRED_NOTIF     (0U) /* 0: not activated, 1: activated */
+#endif /* !defined DC_COM_DEFERRED_NOTIF */
+
+/* If activated then Cellular Service automaton states and events, modem states, AT requests and first data
+   are recorded with their timestamp in a RAM ring buffer of CST_EVENT_LOG_NB records (8 bytes each)
+   Log is displayed by the console command 'cst evtlog' and decoded by cst_evtlog_decode.py */
+#if !defined CST_EVENT_LOG
+#define CST_EVENT_LOG             (1U) /* 0: not activated, 1: activated */
+#endif /* !defined CST_EVENT_LOG */
+
+#if !defined CST_EVENT_LOG_NB
+#define CST_EVENT_LOG_NB          (128U) /* number of records */
+#endif /* !defined CST_EVENT_LOG_NB */
+
 /* ======================================= */
 /* END   -  Miscellaneous functionalities  */
 /* ======================================= */
@@ -47,6 +47,53 @@ extern "C" {
 #define CST_MODEM_POLLING_PERIOD            (0U)      /* No polling for modem monitoring */
 #endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) */
 
+/* If CST_MODEM_POLLING_ADAPTIVE activated then for USE_SOCKETS_TYPE == USE_SOCKETS_LWIP
+   modem polling, which needs to suspend data mode, is deferred while data traffic is in flight
+   and its period is doubled (up to CST_MODEM_POLLING_BACKOFF_MAX) while signal quality is stable */
+#if !defined CST_MODEM_POLLING_ADAPTIVE
+#define CST_MODEM_POLLING_ADAPTIVE          (1U) /* 0: not activated, 1: activated */
+#endif /* !defined CST_MODEM_POLLING_ADAPTIVE */
+#if !defined CST_MODEM_POLLING_IDLE_DELAY
+#define CST_MODEM_POLLING_IDLE_DELAY        (2000U) /* in ms, no data traffic since this delay to poll */
+#endif /* !defined CST_MODEM_POLLING_IDLE_DELAY */
+#if !defined CST_MODEM_POLLING_BACKOFF_MAX
+#define CST_MODEM_POLLING_BACKOFF_MAX       (8U) /* maximum multiplier of CST_MODEM_POLLING_PERIOD */
+#endif /* !defined CST_MODEM_POLLING_BACKOFF_MAX */
+
+/* If CST_MODEM_CONFIG_CACHE activated then modem identity, IMSI and a fingerprint of the applied modem
+   configuration (SIM slot, APN, PDN) are stored in flash at CST_MODEM_CONFIG_CACHE_ADDR.
+   At next boot, if configuration is unchanged, SIM only init, PDN definition and device identity requests
+   are skipped. The record is written alternately in two 8KB pages from CST_MODEM_CONFIG_CACHE_ADDR:
+   these 16KB must be excluded from the linker ROM region and NMI_Handler must call CSN_FlashEccErrorCallback() */
+#if !defined CST_MODEM_CONFIG_CACHE
+#define CST_MODEM_CONFIG_CACHE              (1U) /* 0: not activated, 1: activated */
+#endif /* !defined CST_MODEM_CONFIG_CACHE */
+#if !defined CST_MODEM_CONFIG_CACHE_ADDR
+#define CST_MODEM_CONFIG_CACHE_ADDR         (0x081FC000U) /* last 16KB of flash: two full pages in any bank mode */
+#endif /* !defined CST_MODEM_CONFIG_CACHE_ADDR */
+
+/* If CST_OVERLAPPED_BRINGUP activated then, in full modem init, the device identity requests (IMEI, model,
+   revision, serial number, ICCID) are done once network registration has been launched instead of before it:
+   the modem searches and attaches to the network meanwhile */
+#if !defined CST_OVERLAPPED_BRINGUP
+#define CST_OVERLAPPED_BRINGUP              (1U) /* 0: not activated, 1: activated */
+#endif /* !defined CST_OVERLAPPED_BRINGUP */
+
+/* If CST_FAST_REATTACH activated then, after a modem (re)initialization, registration is first requested on the last
+   network registered (operator and access technology, manual then automatic selection) and automatic selection is
+   restored once registered. After a network loss the modem reselects on its own. When the attachment timeout expires,
+   registration is requested again after a jittered exponential backoff delay (NFMC tempo used as minimal delay when
+   NFMC is active). Attachment metrics are published in DC_CELLULAR_ATTACH_INFO */
+#if !defined CST_FAST_REATTACH
+#define CST_FAST_REATTACH                   (1U) /* 0: not activated, 1: activated */
+#endif /* !defined CST_FAST_REATTACH */
+#if !defined CST_REATTACH_BACKOFF_MIN
+#define CST_REATTACH_BACKOFF_MIN            (5000U)   /* first retry delay, in ms */
+#endif /* !defined CST_REATTACH_BACKOFF_MIN */
+#if !defined CST_REATTACH_BACKOFF_MAX
+#define CST_REATTACH_BACKOFF_MAX            (300000U) /* maximum retry delay, in ms */
+#endif /* !defined CST_REATTACH_BACKOFF_MAX */
+
 /* If activated then for USE_SOCKETS_TYPE == USE_SOCKETS_MODEM
    com_getsockopt with COM_SO_ERROR parameter return a value compatible with errno.h
    see com_sockets_err_compat.c for the conversion */
@@ -58,6 +105,65 @@ extern "C" {
 #define COM_SOCKETS_STATISTIC               (1U) /* 0: not activated, 1: activated */
 #endif /* !defined COM_SOCKETS_STATISTIC */
 
+/* If COM_SOCKETS_RX_READ_AHEAD activated then for USE_SOCKETS_TYPE == USE_SOCKETS_MODEM
+   each TCP socket reads the maximum data allowed by the modem in a receive buffer
+   and small com_recv are served from this buffer without AT transaction */
+#if !defined COM_SOCKETS_RX_READ_AHEAD
+#define COM_SOCKETS_RX_READ_AHEAD           (1U) /* 0: not activated, 1: activated */
+#endif /* !defined COM_SOCKETS_RX_READ_AHEAD */
+
+/* If COM_SOCKETS_TX_COALESCING activated then for USE_SOCKETS_TYPE == USE_SOCKETS_MODEM
+   small com_send on a TCP socket can be coalesced in a send buffer (socket option COM_SO_TXCOALESCE)
+   buffer is sent when full, COM_SOCKETS_TX_COALESCING_DELAY after the first coalesced data
+   (by ComSockets thread), before a com_recv or on COM_SO_TXFLUSH request */
+#if !defined COM_SOCKETS_TX_COALESCING
+#define COM_SOCKETS_TX_COALESCING           (1U) /* 0: not activated, 1: activated */
+#endif /* !defined COM_SOCKETS_TX_COALESCING */
+#if !defined COM_SOCKETS_TX_COALESCING_SIZE
+#define COM_SOCKETS_TX_COALESCING_SIZE      (512U) /* in bytes - must be <= modem socket max tx data size */
+#endif /* !defined COM_SOCKETS_TX_COALESCING_SIZE */
+#if !defined COM_SOCKETS_TX_COALESCING_DELAY
+#define COM_SOCKETS_TX_COALESCING_DELAY     (100U) /* in ms */
+#endif /* !defined COM_SOCKETS_TX_COALESCING_DELAY */
+
+/* If COM_SOCKETS_POLL activated then com_poll() is available to wait on several sockets
+   readiness (readable, writable, closed, error) from a single thread */
+#if !defined COM_SOCKETS_POLL
+#define COM_SOCKETS_POLL                    (1U) /* 0: not activated, 1: activated */
+#endif /* !defined COM_SOCKETS_POLL */
+
+/* If COM_SOCKETS_TCP_POOL activated then com_closesocket_pooled() keeps an idle TCP connection
+   and com_connect_pooled() to the same remote reuses it instead of a new socket open/connect
+   idle connections are closed after COM_SOCKETS_TCP_POOL_IDLE_TIMEOUT (by ComSockets thread) */
+#if !defined COM_SOCKETS_TCP_POOL
+#define COM_SOCKETS_TCP_POOL                (1U) /* 0: not activated, 1: activated */
+#endif /* !defined COM_SOCKETS_TCP_POOL */
+#if !defined COM_SOCKETS_TCP_POOL_SIZE
+#define COM_SOCKETS_TCP_POOL_SIZE           (2U) /* maximum number of idle connections kept */
+#endif /* !defined COM_SOCKETS_TCP_POOL_SIZE */
+#if !defined COM_SOCKETS_TCP_POOL_IDLE_TIMEOUT
+#define COM_SOCKETS_TCP_POOL_IDLE_TIMEOUT   (60000U) /* in ms */
+#endif /* !defined COM_SOCKETS_TCP_POOL_IDLE_TIMEOUT */
+
+/* If COM_SOCKETS_MMSG activated then com_sendmmsg()/com_recvmmsg() are available
+   to send/receive a burst of datagrams in one call */
+#if !defined COM_SOCKETS_MMSG
+#define COM_SOCKETS_MMSG                    (1U) /* 0: not activated, 1: activated */
+#endif /* !defined COM_SOCKETS_MMSG */
+
+/* If COM_SOCKETS_DNS_CACHE activated then com_gethostbyname() successful resolutions are cached
+   during COM_SOCKETS_DNS_CACHE_TTL (errors are not cached)
+   the cache is flushed at each network (PDN) status change */
+#if !defined COM_SOCKETS_DNS_CACHE
+#define COM_SOCKETS_DNS_CACHE               (1U) /* 0: not activated, 1: activated */
+#endif /* !defined COM_SOCKETS_DNS_CACHE */
+#if !defined COM_SOCKETS_DNS_CACHE_SIZE
+#define COM_SOCKETS_DNS_CACHE_SIZE          (4U) /* number of host names cached, least recently used is replaced */
+#endif /* !defined COM_SOCKETS_DNS_CACHE_SIZE */
+#if !defined COM_SOCKETS_DNS_CACHE_TTL
+#define COM_SOCKETS_DNS_CACHE_TTL           (300000U) /* in ms */
+#endif /* !defined COM_SOCKETS_DNS_CACHE_TTL */
+
 /* ======================= */
 /* END - Miscellaneous     */
 /* ======================= */
@@ -152,6 +258,12 @@ extern "C" {
 #define USE_LOW_POWER                       (0) /* 0: not activated, 1: activated */
 #endif  /* !defined USE_LOW_POWER */
 
+/* Number of deferred transmissions kept waiting for the next modem wake window (PSM/eDRX).
+   When the table is full, pending transmissions are flushed. Used only if USE_LOW_POWER == 1 */
+#if !defined CSP_TX_SCHEDULER_NB
+#define CSP_TX_SCHEDULER_NB                 (8U)
+#endif  /* !defined CSP_TX_SCHEDULER_NB */
+
 /* ================================= */
 /* END   - Internal functionalities  */
 /* ================================= */
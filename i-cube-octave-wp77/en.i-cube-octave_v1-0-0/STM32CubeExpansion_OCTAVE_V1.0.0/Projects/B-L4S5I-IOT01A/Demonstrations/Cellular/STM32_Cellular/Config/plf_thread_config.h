@@ -28,6 +28,7 @@ extern "C" {
 /* Includes ------------------------------------------------------------------*/
 
 #include "plf_features.h"
+#include "plf_sw_config.h"
 #if defined(APPLICATION_THREAD_CONFIG_FILE)
 #include APPLICATION_THREAD_CONFIG_FILE
 #endif /* defined(APPLICATION_THREAD_CONFIG_FILE) */
@@ -38,7 +39,16 @@ extern "C" {
 /* BEGIN - Stack Priority  */
 /* ========================*/
 #define ATCORE_THREAD_STACK_PRIO           osPriorityNormal
+#if (ATCORE_URC_FAST_PATH == 1U)
+#define ATCORE_URC_THREAD_PRIO             osPriorityAboveNormal
+#endif /* ATCORE_URC_FAST_PATH == 1U */
 #define CELLULAR_SERVICE_THREAD_PRIO       osPriorityNormal
+#if (DC_COM_DEFERRED_NOTIF == 1U)
+#define DC_COM_NOTIF_THREAD_PRIO           osPriorityBelowNormal
+#endif /* DC_COM_DEFERRED_NOTIF == 1U */
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) && ((COM_SOCKETS_TX_COALESCING == 1U) || (COM_SOCKETS_TCP_POOL == 1U))
+#define COM_SOCKETS_THREAD_PRIO            osPriorityBelowNormal
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) && ((COM_SOCKETS_TX_COALESCING == 1U) || (COM_SOCKETS_TCP_POOL == 1U)) */
 
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP)
 #define TCPIP_THREAD_PRIO                  osPriorityBelowNormal
@@ -62,12 +72,36 @@ extern "C" {
 #define FREERTOS_IDLE_THREAD_STACK_SIZE     (128U)
 #define FREERTOS_IDLE_THREAD_NB             (1U)
 
-#define ATCORE_THREAD_STACK_SIZE            (384U)
+#define ATCORE_THREAD_STACK_SIZE            (448U) /* includes the fields of the line parsed */
 #define ATCORE_THREAD_NB                    (1U)
 
+#if (ATCORE_URC_FAST_PATH == 1U)
+#define ATCORE_URC_THREAD_STACK_SIZE        (384U)
+#define ATCORE_URC_THREAD_NB                (1U)
+#else
+#define ATCORE_URC_THREAD_STACK_SIZE        (0U)
+#define ATCORE_URC_THREAD_NB                (0U)
+#endif /* ATCORE_URC_FAST_PATH == 1U */
+
 #define CELLULAR_SERVICE_THREAD_STACK_SIZE  (512U)
 #define CELLULAR_SERVICE_THREAD_NB          (1U)
 
+#if (DC_COM_DEFERRED_NOTIF == 1U)
+#define DC_COM_NOTIF_THREAD_STACK_SIZE      (512U)
+#define DC_COM_NOTIF_THREAD_NB              (1U)
+#else
+#define DC_COM_NOTIF_THREAD_STACK_SIZE      (0U)
+#define DC_COM_NOTIF_THREAD_NB              (0U)
+#endif /* DC_COM_DEFERRED_NOTIF == 1U */
+
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) && ((COM_SOCKETS_TX_COALESCING == 1U) || (COM_SOCKETS_TCP_POOL == 1U))
+#define COM_SOCKETS_THREAD_STACK_SIZE       (384U)
+#define COM_SOCKETS_THREAD_NB               (1U)
+#else
+#define COM_SOCKETS_THREAD_STACK_SIZE       (0U)
+#define COM_SOCKETS_THREAD_NB               (0U)
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) && ((COM_SOCKETS_TX_COALESCING == 1U) || (COM_SOCKETS_TCP_POOL == 1U)) */
+
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP)
 /* check value in FreeRTOSConfig.h */
 #define TCPIP_THREAD_STACK_SIZE             (512U)
@@ -115,7 +149,10 @@ extern "C" {
   (size_t)( FREERTOS_TIMER_THREAD_STACK_SIZE       \
             +FREERTOS_IDLE_THREAD_STACK_SIZE       \
             +ATCORE_THREAD_STACK_SIZE              \
+            +ATCORE_URC_THREAD_STACK_SIZE          \
             +CELLULAR_SERVICE_THREAD_STACK_SIZE    \
+            +DC_COM_NOTIF_THREAD_STACK_SIZE        \
+            +COM_SOCKETS_THREAD_STACK_SIZE         \
             +CMD_THREAD_STACK_SIZE                 \
             +TCPIP_THREAD_STACK_SIZE               \
             +PPPOSIF_CLIENT_THREAD_STACK_SIZE      )
@@ -124,7 +161,10 @@ extern "C" {
   (uint8_t)( FREERTOS_TIMER_THREAD_NB              \
              +FREERTOS_IDLE_THREAD_NB              \
              +ATCORE_THREAD_NB                     \
+             +ATCORE_URC_THREAD_NB                 \
              +CELLULAR_SERVICE_THREAD_NB           \
+             +DC_COM_NOTIF_THREAD_NB               \
+             +COM_SOCKETS_THREAD_NB                \
              +CMD_THREAD_NB                        \
              +TCPIP_THREAD_NB                      \
              +PPPOSIF_CLIENT_THREAD_NB             )
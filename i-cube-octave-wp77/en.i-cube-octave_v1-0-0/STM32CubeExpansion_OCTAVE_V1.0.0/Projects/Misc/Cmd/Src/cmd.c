@@ -41,11 +41,18 @@
  * CellularService: 3U or 4U according to LowPower definition,
  * TraceInterface : 1U,
  * Cmd            : 1U,
- * ComLib         : 1U */
+ * ComLib         : 1U,
+ * ATCore         : 1U if ATCORE_LATENCY_STATS activated */
+#if (ATCORE_LATENCY_STATS == 1U)
+#define ATCORE_CMD_NB               (1U)
+#else /* ATCORE_LATENCY_STATS == 0U */
+#define ATCORE_CMD_NB               (0U)
+#endif /* (ATCORE_LATENCY_STATS == 1U) */
+
 #if (USE_LOW_POWER == 1)
-#define CMD_MAX_CMD                 (7U + (APPLICATION_CMD_NB)) /* number max of recorded components */
+#define CMD_MAX_CMD                 (7U + (ATCORE_CMD_NB) + (APPLICATION_CMD_NB)) /* number max of recorded components */
 #else /* USE_LOW_POWER == 0 */
-#define CMD_MAX_CMD                 (6U + (APPLICATION_CMD_NB)) /* number max of recorded components */
+#define CMD_MAX_CMD                 (6U + (ATCORE_CMD_NB) + (APPLICATION_CMD_NB)) /* number max of recorded components */
 #endif  /* (USE_LOW_POWER == 1) */
 #define CMD_MAX_LINE_SIZE           (100U)                      /* maximum size of command           */
 #define CMD_READMEM_LINE_SIZE_MAX   (256U)                      /* maximum size of memory read       */
@@ -291,7 +298,11 @@ uint32_t CMD_GetValue(uint8_t *string_p, uint32_t *value_p) {
 		*value_p = 0U;
 	} else {
 		if (memcmp((CRC_CHAR_t*) string_p, "0x", 2U) == 0) {
-			*value_p = (uint32_t) crs_atoi_hex(&string_p[2]);
+			/* full unsigned 32bits range: overflow reported as an error */
+			if (crs_strtou32(&string_p[2], crs_strlen(&string_p[2]), 16U, value_p, NULL) != 0U) {
+				ret = 1U;
+				*value_p = 0U;
+			}
 		} else {
 			digit8 = (*string_p - (uint8_t) '0');
 			digit = (uint32_t) digit8;
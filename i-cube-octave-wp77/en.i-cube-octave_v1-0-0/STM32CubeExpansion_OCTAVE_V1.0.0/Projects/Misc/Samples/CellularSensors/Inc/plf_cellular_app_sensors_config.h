@@ -102,6 +102,12 @@ extern "C" {
 #define USE_SENSORS    (1)  /* 0: not activated, 1: activated */
 #endif /* !defined USE_SENSORS */
 
+/* Number of sensors samples kept while Octave is not ready (modem bring-up), pushed as soon as it is ready
+   0: samples read while Octave is not ready are dropped */
+#if !defined SENSORSCLIENT_BOOT_QUEUE_NB
+#define SENSORSCLIENT_BOOT_QUEUE_NB    (16U)
+#endif /* !defined SENSORSCLIENT_BOOT_QUEUE_NB */
+
 /* ======================================= */
 /* END   -  CellularApp specific defines   */
 /* ======================================= */
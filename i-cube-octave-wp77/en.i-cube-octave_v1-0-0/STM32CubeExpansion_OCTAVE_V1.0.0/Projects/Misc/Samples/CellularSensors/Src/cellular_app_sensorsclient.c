@@ -37,6 +37,10 @@
 
 #include "rtosal.h"
 
+#if (COM_SOCKETS_STATISTIC == 1U)
+#include "com_sockets_statistic.h"
+#endif /* COM_SOCKETS_STATISTIC == 1U */
+
 
 /* Private typedef -----------------------------------------------------------*/
 /* Timer State */
@@ -45,6 +49,19 @@ typedef uint8_t cellular_app_sensorsclient_timer_state_t;
 #define CELLULAR_APP_SENSORSCLIENT_TIMER_IDLE          (cellular_app_sensorsclient_timer_state_t)1
 #define CELLULAR_APP_SENSORSCLIENT_TIMER_RUN           (cellular_app_sensorsclient_timer_state_t)2
 
+/* Sensors sample */
+typedef struct
+{
+  float_t humidity;
+  float_t pressure;
+  float_t temperature;
+  int16_t axis_x;
+  int16_t axis_y;
+  int16_t axis_z;
+  uint8_t valid;                                /* sensors read successfully and not yet pushed:
+                                                   bit mask of SENSORSCLIENT_SAMPLE_xxx */
+} sensorsclient_sample_t;
+
 /* Private defines -----------------------------------------------------------*/
 #define SENSORSCLIENT_CELLULAR_MSG                     ((CELLULAR_APP_VALUE_MAX_MSG) + (cellular_app_msg_type_t)1)
 #define SENSORSCLIENT_TIMER_MSG                        ((CELLULAR_APP_VALUE_MAX_MSG) + (cellular_app_msg_type_t)2)
@@ -72,6 +89,16 @@ typedef uint8_t cellular_app_sensorsclient_timer_state_t;
 #define ORP_RESOURCE_SENSOR_ACCELEROMETER_AXIS_Y       "telemetry/Accelerometer/AXIS_Y"
 #define ORP_RESOURCE_SENSOR_ACCELEROMETER_AXIS_Z       "telemetry/Accelerometer/AXIS_Z"
 #define ORP_RESOURCE_BOOLEAN_TEST				       "telemetry/boolean"
+#define ORP_RESOURCE_COM_STATISTIC                     "telemetry/ComStat"
+
+/* Sensors read successfully in a sample */
+#define SENSORSCLIENT_SAMPLE_HUMIDITY                  (0x01U)
+#define SENSORSCLIENT_SAMPLE_PRESSURE                  (0x02U)
+#define SENSORSCLIENT_SAMPLE_TEMPERATURE               (0x04U)
+#define SENSORSCLIENT_SAMPLE_ACCELEROMETER             (0x08U)
+
+/* Com sockets statistics are published every SENSORSCLIENT_COMSTAT_PUBLISH_NB sensors update */
+#define SENSORSCLIENT_COMSTAT_PUBLISH_NB               30U
 
 /* Private variables ---------------------------------------------------------*/
 uint32_t SENSORSCLIENT_SENSORS_READ_TIMER = 10000; /* Unit: in ms. */
@@ -102,6 +129,17 @@ static cellular_app_sensorsclient_timer_state_t cellular_app_sensorsclient_senso
 
 static uint8_t cellular_app_sensorsclient_string[250];
 
+#if (SENSORSCLIENT_BOOT_QUEUE_NB > 0U)
+#if (SENSORSCLIENT_BOOT_QUEUE_NB > 255U)
+#error SENSORSCLIENT_BOOT_QUEUE_NB must not exceed 255: queue indexes are uint8_t
+#endif /* SENSORSCLIENT_BOOT_QUEUE_NB > 255U */
+/* Sensors samples read while Octave is not ready (modem bring-up, network lost) */
+static sensorsclient_sample_t sensorsclient_queue[SENSORSCLIENT_BOOT_QUEUE_NB];
+static uint8_t  sensorsclient_queue_first = 0U; /* index of the oldest sample */
+static uint8_t  sensorsclient_queue_nb = 0U;    /* number of samples in the queue */
+static uint32_t sensorsclient_queue_dropped = 0U;
+#endif /* SENSORSCLIENT_BOOT_QUEUE_NB > 0U */
+
 /* Private macro -------------------------------------------------------------*/
 
 /* Global variables ----------------------------------------------------------*/
@@ -115,8 +153,19 @@ static void cellular_app_sensorsclient_cellular_info_status_cb(ca_event_type_t e
 /* Callback called when Sensors Timer is raised */
 static void cellular_app_sensorsclient_sensors_timer_cb(void *p_argument);
 
+static bool sensorsclient_push_numeric_resource(const char *p_name, float_t value);
+static bool sensorsclient_push_json_resource(const char *p_name, char *p_value);
+static bool sensorsclient_push_sensors_sample(sensorsclient_sample_t *p_sample);
+#if (SENSORSCLIENT_BOOT_QUEUE_NB > 0U)
+static void sensorsclient_queue_sensors_sample(const sensorsclient_sample_t *p_sample);
+static void sensorsclient_flush_sensors_samples(void);
+#endif /* SENSORSCLIENT_BOOT_QUEUE_NB > 0U */
 static void sensorsclient_update_sensors_info(void);
 
+#if (COM_SOCKETS_STATISTIC == 1U)
+static void sensorsclient_update_com_statistic(void);
+#endif /* COM_SOCKETS_STATISTIC == 1U */
+
 static void sensorsclient_thread(void *p_argument);
 
 /* Public  functions  prototypes ---------------------------------------------*/
@@ -245,6 +294,10 @@ static void sensorsclient_update_cellular_info(void)
   switch (sensors_cellular_info.modem_state)
   {
     case CA_MODEM_STATE_POWERED_ON:
+#if (SENSORSCLIENT_BOOT_QUEUE_NB > 0U)
+      /* samples are queued until Octave is ready */
+      sensors_timer = true;
+#endif /* SENSORSCLIENT_BOOT_QUEUE_NB > 0U */
       p_string2 = state_string[1];
       break;
     case CA_MODEM_STATE_SIM_CONNECTED:
@@ -358,6 +411,174 @@ static void sensorsclient_update_cellular_info(void)
   PRINT_FORCE("%s: %s %s", p_cellular_app_sensorsclient_trace, p_string1, p_string2)
 }
 
+/**
+  * @brief  Push a numeric resource to Octave
+  * @param  p_name - resource name (absolute path)
+  * @param  value  - resource value
+  * @retval bool   - true: resource pushed, false: push failed
+  */
+static bool sensorsclient_push_numeric_resource(const char *p_name, float_t value)
+{
+  static orp_numeric_resource_update_t orp_update;
+
+  /* Resource member declaration */
+  strcpy((char *)orp_update.resource_name, p_name);
+  orp_update.resource_value = value;
+  (void) memset((void *)orp_rspbuf, 0, ORP_MAX_RSP_SIZE);
+  com_err = orp_set_numeric_resource(currentHandle, &orp_update, orp_rspbuf, &orp_error_code);
+  PRINT_INFO("The Update of %s to Octave is %ld :", p_name, com_err)
+
+  return (com_err == 0);
+}
+
+/**
+  * @brief  Push a JSON resource to Octave
+  * @param  p_name  - resource name (absolute path)
+  * @param  p_value - resource value (JSON members)
+  * @retval bool    - true: resource pushed, false: push failed
+  */
+static bool sensorsclient_push_json_resource(const char *p_name, char *p_value)
+{
+  static orp_json_resource_update_t orp_json_update;
+
+  /* Resource member declaration */
+  strcpy((char *)orp_json_update.resource_name, p_name);
+  orp_json_update.resource_value = (com_char_t *)p_value;
+  (void) memset((void *)orp_rspbuf, 0, ORP_MAX_RSP_SIZE);
+  com_err = orp_set_json_resource(currentHandle, &orp_json_update, orp_rspbuf, &orp_error_code);
+  PRINT_INFO("The Update of %s JSON data to Octave is %ld :", p_name, com_err)
+
+  return (com_err == 0);
+}
+
+/**
+  * @brief  Push a sensors sample to Octave
+  * @note   the valid bit of each resource pushed is cleared: after a failure,
+  *         a new call only pushes the resources not yet accepted by Octave
+  * @param  p_sample - sensors sample to push
+  * @retval bool     - true: sample pushed, false: at least one push failed
+  */
+static bool sensorsclient_push_sensors_sample(sensorsclient_sample_t *p_sample)
+{
+  char orp_json_value[ORP_MAX_RESOURCE_VALUE];
+  bool result = true;
+
+  if (orp_pushJSONUpdate == false)
+  {
+    /* One resource per sensor read successfully and not yet pushed */
+    if ((p_sample->valid & SENSORSCLIENT_SAMPLE_HUMIDITY) != 0U)
+    {
+      if (sensorsclient_push_numeric_resource(ORP_RESOURCE_SENSOR_HUMIDITY, p_sample->humidity) == true)
+      {
+        p_sample->valid &= (uint8_t)~SENSORSCLIENT_SAMPLE_HUMIDITY;
+      }
+      else
+      {
+        result = false;
+      }
+    }
+    if ((p_sample->valid & SENSORSCLIENT_SAMPLE_PRESSURE) != 0U)
+    {
+      if (sensorsclient_push_numeric_resource(ORP_RESOURCE_SENSOR_PRESSURE, p_sample->pressure) == true)
+      {
+        p_sample->valid &= (uint8_t)~SENSORSCLIENT_SAMPLE_PRESSURE;
+      }
+      else
+      {
+        result = false;
+      }
+    }
+    if ((p_sample->valid & SENSORSCLIENT_SAMPLE_TEMPERATURE) != 0U)
+    {
+      if (sensorsclient_push_numeric_resource(ORP_RESOURCE_SENSOR_TEMPERATURE, p_sample->temperature) == true)
+      {
+        p_sample->valid &= (uint8_t)~SENSORSCLIENT_SAMPLE_TEMPERATURE;
+      }
+      else
+      {
+        result = false;
+      }
+    }
+    if ((p_sample->valid & SENSORSCLIENT_SAMPLE_ACCELEROMETER) != 0U)
+    {
+      (void)sprintf(orp_json_value, "\\x22AXIS_X\\x22:%d,\\x22AXIS_Y\\x22:%d,\\x22AXIS_Z\\x22:%d",
+                    p_sample->axis_x, p_sample->axis_y, p_sample->axis_z);
+      if (sensorsclient_push_json_resource(ORP_RESOURCE_SENSOR_ACCELEROMETER_ROOT, orp_json_value) == true)
+      {
+        p_sample->valid &= (uint8_t)~SENSORSCLIENT_SAMPLE_ACCELEROMETER;
+      }
+      else
+      {
+        result = false;
+      }
+    }
+  }
+  else
+  {
+    /* All sensors in a single JSON resource */
+    (void)sprintf(orp_json_value, "\\x22Temperature\\x22:%4.1f,\\x22Pressure\\x22:%6.1f,\\x22Humidity\\x22:%4.1f,\\x22Accelerometer/AXIS_X\\x22:%d,\\x22Accelerometer/AXIS_Y\\x22:%d,\\x22Accelerometer/AXIS_Z\\x22:%d",
+                  p_sample->temperature, p_sample->pressure, p_sample->humidity,
+                  p_sample->axis_x, p_sample->axis_y, p_sample->axis_z);
+    result = sensorsclient_push_json_resource(ORP_RESOURCE_SENSOR_JSON_ROOT, orp_json_value);
+    if (result == true)
+    {
+      p_sample->valid = 0U;
+    }
+  }
+
+  return (result);
+}
+
+#if (SENSORSCLIENT_BOOT_QUEUE_NB > 0U)
+/**
+  * @brief  Keep a sensors sample read while Octave is not ready
+  * @note   when the queue is full the oldest sample is dropped
+  * @param  p_sample - sensors sample to keep
+  * @retval -
+  */
+static void sensorsclient_queue_sensors_sample(const sensorsclient_sample_t *p_sample)
+{
+  uint8_t index;
+
+  if (sensorsclient_queue_nb == SENSORSCLIENT_BOOT_QUEUE_NB)
+  {
+    /* Queue full: drop the oldest sample */
+    sensorsclient_queue_first = (uint8_t)((sensorsclient_queue_first + 1U) % SENSORSCLIENT_BOOT_QUEUE_NB);
+    sensorsclient_queue_nb--;
+    sensorsclient_queue_dropped++;
+  }
+  index = (uint8_t)((sensorsclient_queue_first + sensorsclient_queue_nb) % SENSORSCLIENT_BOOT_QUEUE_NB);
+  sensorsclient_queue[index] = *p_sample;
+  sensorsclient_queue_nb++;
+  PRINT_INFO("%s: Octave not ready, sample queued (%d queued, %ld dropped)", p_cellular_app_sensorsclient_trace,
+             sensorsclient_queue_nb, sensorsclient_queue_dropped)
+}
+
+/**
+  * @brief  Push to Octave the sensors samples read while it was not ready, oldest first
+  * @note   stops at first push failure, remaining samples (and the resources of the failed sample
+  *         not yet pushed) are pushed at next call
+  * @retval -
+  */
+static void sensorsclient_flush_sensors_samples(void)
+{
+  if (sensorsclient_queue_nb > 0U)
+  {
+    PRINT_FORCE("%s: Octave ready, push %d queued samples", p_cellular_app_sensorsclient_trace,
+                sensorsclient_queue_nb)
+  }
+  while (sensorsclient_queue_nb > 0U)
+  {
+    if (sensorsclient_push_sensors_sample(&sensorsclient_queue[sensorsclient_queue_first]) == false)
+    {
+      break;
+    }
+    sensorsclient_queue_first = (uint8_t)((sensorsclient_queue_first + 1U) % SENSORSCLIENT_BOOT_QUEUE_NB);
+    sensorsclient_queue_nb--;
+  }
+}
+#endif /* SENSORSCLIENT_BOOT_QUEUE_NB > 0U */
+
 /**
   * @brief  Update status according to new sensors info read
   * @retval -
@@ -368,121 +589,54 @@ static void sensorsclient_update_sensors_info(void)
   static cellular_app_sensors_data_t sensor_pressure;
   static cellular_app_sensors_data_t sensor_temperature;
   static cellular_app_sensors_data_t accelerometer_info;
-  static orp_numeric_resource_update_t orp_update;
-  static orp_json_resource_update_t orp_json_update;
+  sensorsclient_sample_t sample;
+
   orp_start();
+  sample.valid = 0U;
   /* Read Humidity sensor */
   if (cellular_app_sensors_read(CELLULAR_APP_SENSOR_TYPE_HUMIDITY, &sensor_humidity) == true)
   {
-	/* Push sensor data to Octave */
-	if(orpReady == true && orp_pushUpdate == true && orp_pushJSONUpdate == false)
-	{
-	  /* Resource member declaration */
-	  strcpy((char *)orp_update.resource_name,(const char *)ORP_RESOURCE_SENSOR_HUMIDITY);
-	  orp_update.resource_value = sensor_humidity.float_data;
-	  (void) memset((void *)orp_rspbuf, 0, ORP_MAX_RSP_SIZE);
-	  com_err = orp_set_numeric_resource(currentHandle,&orp_update,orp_rspbuf,&orp_error_code);
-	  PRINT_INFO("The Update of Humidity to Octave is %ld :",com_err)
-	}
+    sample.valid |= SENSORSCLIENT_SAMPLE_HUMIDITY;
   }
   else
   {
-	sensor_humidity.float_data = (float_t)0;
+    sensor_humidity.float_data = (float_t)0;
   }
   /* Read Pressure sensor */
   if (cellular_app_sensors_read(CELLULAR_APP_SENSOR_TYPE_PRESSURE, &sensor_pressure) == true)
   {
-  	/* Push sensor data to Octave */
-  	if(orpReady == true && orp_pushUpdate == true && orp_pushJSONUpdate == false)
-  	{
-  	  /* Resource member declaration */
-  	  strcpy((char *)orp_update.resource_name,(const char *)ORP_RESOURCE_SENSOR_PRESSURE);
-  	  orp_update.resource_value = sensor_pressure.float_data;
-  	  (void) memset((void *)orp_rspbuf, 0, ORP_MAX_RSP_SIZE);
-  	  com_err = orp_set_numeric_resource(currentHandle,&orp_update,orp_rspbuf,&orp_error_code);
-  	  PRINT_INFO("The Update of Pressure to Octave is %ld :",com_err)
-  	}
+    sample.valid |= SENSORSCLIENT_SAMPLE_PRESSURE;
   }
   else
   {
     sensor_pressure.float_data = (float_t)0;
   }
-
   /* Read Temperature sensor */
   if (cellular_app_sensors_read(CELLULAR_APP_SENSOR_TYPE_TEMPERATURE, &sensor_temperature) == true)
   {
-	/* Push sensor data to Octave */
-	if(orpReady == true && orp_pushUpdate == true && orp_pushJSONUpdate == false)
-	{
-      /* Resource member declaration */
-      strcpy((char *)orp_update.resource_name,(const char *)ORP_RESOURCE_SENSOR_TEMPERATURE);
-      orp_update.resource_value = sensor_temperature.float_data;
-      (void) memset((void *)orp_rspbuf, 0, ORP_MAX_RSP_SIZE);
-      com_err = orp_set_numeric_resource(currentHandle,&orp_update,orp_rspbuf,&orp_error_code);
-      PRINT_INFO("The Update of Temperature to Octave is %ld :",com_err)
-	}
+    sample.valid |= SENSORSCLIENT_SAMPLE_TEMPERATURE;
   }
   else
   {
-	sensor_temperature.float_data = (float_t)0;
+    sensor_temperature.float_data = (float_t)0;
   }
   /* Read Accelerometer sensor */
   if (cellular_app_sensors_read(CELLULAR_APP_SENSOR_TYPE_ACCELEROMETER, &accelerometer_info) == true)
   {
-	/* Push sensor data to Octave */
-	if(orpReady == true && orp_pushUpdate == true && orp_pushJSONUpdate == false)
-	{
-/*	   Resource member declaration
-	  strcpy((char *)orp_update.resource_name,(const char *)ORP_RESOURCE_SENSOR_ACCELEROMETER_AXIS_X);
-	  orp_update.resource_value = accelerometer_info.AXIS_X;
-	  (void) memset((void *)orp_rspbuf, 0, ORP_MAX_RSP_SIZE);
-	  com_err = orp_set_numeric_resource(currentHandle,&orp_update,orp_rspbuf,&orp_error_code);
-	  PRINT_INFO("The Update of ACCELEROMETER_AXIS_X to Octave is %ld :",com_err)
-	  if(com_err == 0)
-	  {
-		 Resource member declaration
-		strcpy((char *)orp_update.resource_name,(const char *)ORP_RESOURCE_SENSOR_ACCELEROMETER_AXIS_Y);
-		orp_update.resource_value = accelerometer_info.AXIS_Y;
-		(void) memset((void *)orp_rspbuf, 0, ORP_MAX_RSP_SIZE);
-		com_err = orp_set_numeric_resource(currentHandle,&orp_update,orp_rspbuf,&orp_error_code);
-		PRINT_INFO("The Update of ACCELEROMETER_AXIS_Y to Octave is %ld :",com_err)
-		if(com_err == 0)
-		{
-		   Resource member declaration
-		  strcpy((char *)orp_update.resource_name,(const char *)ORP_RESOURCE_SENSOR_ACCELEROMETER_AXIS_Z);
-		  orp_update.resource_value = accelerometer_info.AXIS_Z;
-		  (void) memset((void *)orp_rspbuf, 0, ORP_MAX_RSP_SIZE);
-		  com_err = orp_set_numeric_resource(currentHandle,&orp_update,orp_rspbuf,&orp_error_code);
-		  PRINT_INFO("The Update of ACCELEROMETER_AXIS_Z to Octave is %ld :",com_err)
-		}
-	  }
-*/
-		/* Resource member declaration */
-		strcpy((char *)orp_json_update.resource_name,(const char *)ORP_RESOURCE_SENSOR_ACCELEROMETER_ROOT);
-		char ORP_json_Update[ORP_MAX_RESOURCE_VALUE] = {0} ;
-		sprintf(ORP_json_Update,"\\x22AXIS_X\\x22:%d,\\x22AXIS_Y\\x22:%d,\\x22AXIS_Z\\x22:%d",accelerometer_info.AXIS_X,accelerometer_info.AXIS_Y,accelerometer_info.AXIS_Z);
-		orp_json_update.resource_value = (com_char_t *) ORP_json_Update;
-		(void) memset((void *)orp_rspbuf, 0, ORP_MAX_RSP_SIZE);
-		com_err = orp_set_json_resource(currentHandle,&orp_json_update,orp_rspbuf,&orp_error_code);
-		PRINT_INFO("The Update action of ACCELEROMETER_JSON to Octave is %ld :",com_err)
-
-		/* Resource member declaration */
-		/*strcpy((char *)orp_json_update.resource_name,(const char *)ORP_RESOURCE_SENSOR_JSON_ROOT);
-		char ORP_json_Update[ORP_MAX_RESOURCE_VALUE] = {0} ;
-		sprintf(ORP_json_Update,"\\x22Temperature\\x22:%4.1f,\\x22Pressure\\x22:%6.1f,\\x22Humidity\\x22:%4.1f,\\x22Accelerometer/AXIS_X\\x22:%d,\\x22Accelerometer/AXIS_Y\\x22:%d,\\x22Accelerometer/AXIS_Z\\x22:%d",
-				sensor_temperature.float_data,sensor_pressure.float_data,sensor_humidity.float_data, accelerometer_info.AXIS_X,accelerometer_info.AXIS_Y,accelerometer_info.AXIS_Z);
-		orp_json_update.resource_value = (com_char_t *) ORP_json_Update;
-		(void) memset((void *)orp_rspbuf, 0, ORP_MAX_RSP_SIZE);
-		com_err = orp_set_json_resource(currentHandle,&orp_json_update,orp_rspbuf,&orp_error_code);
-		PRINT_INFO("The Update of Sensor JSON data to Cloud to Octave is %ld :",com_err)*/
-	}
+    sample.valid |= SENSORSCLIENT_SAMPLE_ACCELEROMETER;
   }
   else
   {
-	accelerometer_info.AXIS_X  =  (int16_t)0;
-	accelerometer_info.AXIS_Y  =  (int16_t)0;
-	accelerometer_info.AXIS_Z  =  (int16_t)0;
+    accelerometer_info.AXIS_X  =  (int16_t)0;
+    accelerometer_info.AXIS_Y  =  (int16_t)0;
+    accelerometer_info.AXIS_Z  =  (int16_t)0;
   }
+  sample.humidity    = sensor_humidity.float_data;
+  sample.pressure    = sensor_pressure.float_data;
+  sample.temperature = sensor_temperature.float_data;
+  sample.axis_x      = accelerometer_info.AXIS_X;
+  sample.axis_y      = accelerometer_info.AXIS_Y;
+  sample.axis_z      = accelerometer_info.AXIS_Z;
 
   (void)sprintf((CRC_CHAR_t *)cellular_app_sensorsclient_string, "Temperature:%4.1fC Humidity:%4.1f%% Pressure:%6.1fP AxisX:%d AxisY:%d AxisZ:%d",
                 sensor_temperature.float_data, sensor_humidity.float_data, sensor_pressure.float_data,accelerometer_info.AXIS_X,accelerometer_info.AXIS_Y,accelerometer_info.AXIS_Z);
@@ -490,19 +644,67 @@ static void sensorsclient_update_sensors_info(void)
 
   /* Display information about Sensors data */
   PRINT_FORCE("%s: %s", p_cellular_app_sensorsclient_trace, cellular_app_sensorsclient_string)
-  if(orpReady == true && orp_pushUpdate == true && orp_pushJSONUpdate == true)
+
+  /* Push sensor data to Octave */
+  if ((orpReady == true) && (orp_pushUpdate == true))
   {
+#if (SENSORSCLIENT_BOOT_QUEUE_NB > 0U)
+    /* Samples read before Octave was ready are pushed first */
+    sensorsclient_flush_sensors_samples();
+    if (sensorsclient_queue_nb > 0U)
+    {
+      sensorsclient_queue_sensors_sample(&sample);
+    }
+    else
+#endif /* SENSORSCLIENT_BOOT_QUEUE_NB > 0U */
+    {
+      (void)sensorsclient_push_sensors_sample(&sample);
+    }
+  }
+#if (SENSORSCLIENT_BOOT_QUEUE_NB > 0U)
+  else
+  {
+    sensorsclient_queue_sensors_sample(&sample);
+  }
+#endif /* SENSORSCLIENT_BOOT_QUEUE_NB > 0U */
+#if (COM_SOCKETS_STATISTIC == 1U)
+  sensorsclient_update_com_statistic();
+#endif /* COM_SOCKETS_STATISTIC == 1U */
+}
+
+#if (COM_SOCKETS_STATISTIC == 1U)
+/**
+  * @brief  Publish com sockets statistics summary to Octave
+  * @note   published every SENSORSCLIENT_COMSTAT_PUBLISH_NB calls
+  * @retval -
+  */
+static void sensorsclient_update_com_statistic(void)
+{
+  static uint32_t update_nb = 0U;
+  static orp_json_resource_update_t orp_json_update;
+  com_sockets_stat_summary_t summary;
+
+  update_nb++;
+  if (orpReady == true && orp_pushUpdate == true && update_nb >= SENSORSCLIENT_COMSTAT_PUBLISH_NB)
+  {
+	update_nb = 0U;
+	com_sockets_statistic_summary(&summary);
 	/* Resource member declaration */
-	strcpy((char *)orp_update.resource_name,(const char *)ORP_RESOURCE_SENSOR_JSON_ROOT);
+	strcpy((char *)orp_json_update.resource_name,(const char *)ORP_RESOURCE_COM_STATISTIC);
 	char ORP_json_Update[ORP_MAX_RESOURCE_VALUE] = {0} ;
-	sprintf(ORP_json_Update,"\\x22Temperature\\x22:%4.1f,\\x22Pressure\\x22:%6.1f,\\x22Humidity\\x22:%4.1f,\\x22Accelerometer/AXIS_X\\x22:%d,\\x22Accelerometer/AXIS_Y\\x22:%d,\\x22Accelerometer/AXIS_Z\\x22:%d",
-			sensor_temperature.float_data,sensor_pressure.float_data,sensor_humidity.float_data, accelerometer_info.AXIS_X,accelerometer_info.AXIS_Y,accelerometer_info.AXIS_Z);
+	sprintf(ORP_json_Update,"\\x22TxBytes\\x22:%lu,\\x22RxBytes\\x22:%lu,\\x22TxPeak\\x22:%lu,\\x22RxPeak\\x22:%lu,\\x22Errors\\x22:%lu,\\x22CntAvg\\x22:%lu,\\x22CntMax\\x22:%lu,\\x22SndAvg\\x22:%lu,\\x22SndMax\\x22:%lu,\\x22RcvAvg\\x22:%lu,\\x22RcvMax\\x22:%lu,\\x22WaitAvg\\x22:%lu,\\x22WaitMax\\x22:%lu",
+			summary.tx_bytes, summary.rx_bytes, summary.tx_peak, summary.rx_peak, summary.errors,
+			summary.lat_avg[COM_SOCKET_STAT_LAT_CNT], summary.lat_max[COM_SOCKET_STAT_LAT_CNT],
+			summary.lat_avg[COM_SOCKET_STAT_LAT_SND], summary.lat_max[COM_SOCKET_STAT_LAT_SND],
+			summary.lat_avg[COM_SOCKET_STAT_LAT_RCV], summary.lat_max[COM_SOCKET_STAT_LAT_RCV],
+			summary.lat_avg[COM_SOCKET_STAT_LAT_WAIT], summary.lat_max[COM_SOCKET_STAT_LAT_WAIT]);
 	orp_json_update.resource_value = (com_char_t *) ORP_json_Update;
 	(void) memset((void *)orp_rspbuf, 0, ORP_MAX_RSP_SIZE);
 	com_err = orp_set_json_resource(currentHandle,&orp_json_update,orp_rspbuf,&orp_error_code);
-	PRINT_INFO("The Update of Sensor JSON data to Cloud to Octave is %ld :",com_err)
+	PRINT_INFO("The Update of Com statistics JSON data to Octave is %ld :",com_err)
   }
 }
+#endif /* COM_SOCKETS_STATISTIC == 1U */
 
 /**
   * @brief  SensorsClt thread
@@ -560,6 +762,14 @@ static void sensorsclient_thread(void *p_argument)
               /* reset flag */
               orpReady = false;
             }
+            /* Define Octave resources as soon as ORP is ready, not at next sensors read */
+            orp_start();
+#if (SENSORSCLIENT_BOOT_QUEUE_NB > 0U)
+            if ((orpReady == true) && (orp_pushUpdate == true))
+            {
+              sensorsclient_flush_sensors_samples();
+            }
+#endif /* SENSORSCLIENT_BOOT_QUEUE_NB > 0U */
             sensorsclient_update_cellular_info();
           }
           else /* Should not happen */
@@ -842,6 +1052,13 @@ void orp_start (void)
 		  	    sPeriodicity.res_dir = 'I';
 		  	    sPeriodicity.res_type = 'J';
 		  	    com_err = orp_create_resource(currentHandle,&sPeriodicity,&orp_error_code);
+#if (COM_SOCKETS_STATISTIC == 1U)
+		  	    /* Resource member declaration */
+		  	    strcpy((char *)sPeriodicity.resource_name,(const char *)ORP_RESOURCE_COM_STATISTIC);
+		  	    sPeriodicity.res_dir = 'I';
+		  	    sPeriodicity.res_type = 'J';
+		  	    com_err = orp_create_resource(currentHandle,&sPeriodicity,&orp_error_code);
+#endif /* COM_SOCKETS_STATISTIC == 1U */
 		  	    /* Set the ORP defined resource flag to False to notify successful creation of all resources *
 		  	     * ORP wont throw error if resource with same name is created as no action will be done by ORP if done so */
 		  	    orp_defineResource = false;